@@ -993,6 +993,11 @@ void achievements_tracker::clear()
     achievements_status_.clear();
 }
 
+bool achievements_tracker::wants( const event_type type ) const
+{
+    return type == event_type::game_start;
+}
+
 void achievements_tracker::notify( const cata::event &e )
 {
     if( e.type() == event_type::game_start ) {
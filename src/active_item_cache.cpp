@@ -6,27 +6,58 @@
 #include "item.h"
 #include "safe_reference.h"
 
+bool active_item_cache::timing_wheel::empty() const
+{
+    return size == 0;
+}
+
+void active_item_cache::timing_wheel::erase_broken( size_t slot )
+{
+    std::vector<cache_reference<item>> &refs = slots[slot];
+    const auto broken = std::remove_if( refs.begin(), refs.end(),
+    []( const cache_reference<item> &ref ) {
+        return !ref;
+    } );
+    size -= refs.end() - broken;
+    refs.erase( broken, refs.end() );
+}
+
+bool active_item_cache::timing_wheel::in_slot( const item *it, size_t slot ) const
+{
+    const std::vector<cache_reference<item>> &refs = slots[slot];
+    return std::any_of( refs.begin(), refs.end(), [it]( const cache_reference<item> &ref ) {
+        return ref && &*ref == it;
+    } );
+}
+
+void active_item_cache::timing_wheel::rebuild_index()
+{
+    slot_of.clear();
+    for( size_t slot = 0; slot < slots.size(); slot++ ) {
+        erase_broken( slot );
+        for( const cache_reference<item> &ref : slots[slot] ) {
+            slot_of[&*ref] = slot;
+        }
+    }
+    index_limit = std::max<size_t>( 64, slot_of.size() * 2 );
+}
+
 void active_item_cache::remove( const item *it )
 {
-    for( auto &list : active_items ) {
-        int count = 0;
-        list.second.second.erase( std::remove_if( list.second.second.begin(),
-        list.second.second.end(), [it, &count, &list]( const cache_reference<item> &active_item ) {
-            if( !active_item ) {
-                count++;
-                return true;
-            }
-            item *const target = &*active_item;
-            if( !target || target == it ) {
-                if( count >= list.second.first ) {
-                    list.second.first = std::max( 0, list.second.first - 1 );
-                }
-                count++;
-                return true;
-            }
-            count++;
-            return false;
-        } ), list.second.second.end() );
+    for( auto &kv : active_items ) {
+        timing_wheel &wheel = kv.second;
+        const auto found = wheel.slot_of.find( it );
+        if( found == wheel.slot_of.end() ) {
+            continue;
+        }
+        std::vector<cache_reference<item>> &slot = wheel.slots[found->second];
+        const auto removed = std::remove_if( slot.begin(), slot.end(),
+        [it]( const cache_reference<item> &ref ) {
+            return !ref || &*ref == it;
+        } );
+        wheel.size -= slot.end() - removed;
+        slot.erase( removed, slot.end() );
+        wheel.slot_of.erase( found );
     }
     if( it->can_revive() ) {
         std::vector<cache_reference<item>> &corpse = special_items[ special_item_type::corpse ];
@@ -40,9 +71,14 @@ void active_item_cache::remove( const item *it )
 
 void active_item_cache::add( item &it )
 {
+    const int speed = std::max( 1, it.processing_speed() );
+    timing_wheel &wheel = active_items[speed];
+    if( wheel.slots.empty() ) {
+        wheel.slots.resize( speed );
+    }
     // If the item is alread in the cache for some reason, don't add a second reference
-    std::vector<cache_reference<item>> &target_list = active_items[it.processing_speed()].second;
-    if( std::find( target_list.begin(), target_list.end(), it ) != target_list.end() ) {
+    const auto found = wheel.slot_of.find( &it );
+    if( found != wheel.slot_of.end() && wheel.in_slot( &it, found->second ) ) {
         return;
     }
     if( it.can_revive() ) {
@@ -51,27 +87,37 @@ void active_item_cache::add( item &it )
     if( it.get_use( "explosion" ) ) {
         special_items[ special_item_type::explosive ].emplace_back( it );
     }
-    target_list.emplace_back( it );
+    if( wheel.empty() ) {
+        // The first item doesn't have to wait for a whole period
+        wheel.add_slot = wheel.next_slot;
+    }
+    const size_t slot = wheel.add_slot;
+    wheel.add_slot = ( wheel.add_slot + 1 ) % wheel.slots.size();
+    wheel.slots[slot].emplace_back( it );
+    wheel.size++;
+    wheel.slot_of[&it] = slot;
+    // Destroyed items are only dropped from the slots, so the index grows until it's rebuilt
+    if( wheel.slot_of.size() > wheel.index_limit ) {
+        wheel.rebuild_index();
+    }
 }
 
 bool active_item_cache::empty() const
 {
-    return std::all_of( active_items.begin(), active_items.end(), []( const auto & active_queue ) {
-        return active_queue.second.second.empty();
+    return std::all_of( active_items.begin(), active_items.end(), []( const auto & kv ) {
+        return kv.second.empty();
     } );
 }
 
 std::vector<item *> active_item_cache::get()
 {
     std::vector<item *> all_cached_items;
-    for( std::pair<const int, std::pair<int, std::vector<cache_reference<item>>>> &kv : active_items ) {
-        for( std::vector<cache_reference<item>>::iterator it = kv.second.second.begin();
-             it != kv.second.second.end(); ) {
-            if( *it ) {
-                all_cached_items.push_back( & **it );
-                ++it;
-            } else {
-                it = kv.second.second.erase( it );
+    for( auto &kv : active_items ) {
+        timing_wheel &wheel = kv.second;
+        for( size_t slot = 0; slot < wheel.slots.size(); slot++ ) {
+            wheel.erase_broken( slot );
+            for( const cache_reference<item> &ref : wheel.slots[slot] ) {
+                all_cached_items.push_back( &*ref );
             }
         }
     }
@@ -81,41 +127,16 @@ std::vector<item *> active_item_cache::get()
 std::vector<item *> active_item_cache::get_for_processing()
 {
     std::vector<item *> items_to_process;
-    for( std::pair < const int, std::pair<int, std::vector<cache_reference<item>>>> &kv :
-         active_items ) {
-        //The algorithm here is a bit weird. We're going to process a fraction of the list at a time, keeping track of where we are in the list with a simple int.
-        //But, the list could change between each run. As such the number will be reduced when items are removed from it (in ::remove) to prevent skips.
-
-        if( kv.second.second.empty() ) { //Prevents a div by 0 in the modulo operations
-            kv.second.first = 0; //May as well reset the position
+    for( auto &kv : active_items ) {
+        timing_wheel &wheel = kv.second;
+        if( wheel.slots.empty() ) {
             continue;
         }
-
-        // Rely on iteration logic to make sure the number is sane.
-        int num_to_process = std::max( 1, static_cast<int>( kv.second.second.size() / kv.first ) );
-        std::vector<cache_reference<item>>::iterator it = kv.second.second.begin();
-
-
-        kv.second.first = kv.second.first %
-                          kv.second.second.size(); //Make sure the key isn't larger than the array
-        std::advance( it, kv.second.first );
-
-        kv.second.first += num_to_process + 1;
-        while( num_to_process > 0 ) {
-            if( *it ) {
-                items_to_process.push_back( & **it );
-                --num_to_process;
-                ++it;
-            } else {
-                // The item has been destroyed, so remove the reference from the cache
-                it = kv.second.second.erase( it );
-                if( kv.second.second.empty() ) {
-                    break;
-                }
-            }
-            if( it == kv.second.second.end() ) {
-                it = kv.second.second.begin();
-            }
+        const size_t slot = wheel.next_slot;
+        wheel.next_slot = ( wheel.next_slot + 1 ) % wheel.slots.size();
+        wheel.erase_broken( slot );
+        for( const cache_reference<item> &ref : wheel.slots[slot] ) {
+            items_to_process.push_back( &*ref );
         }
     }
     return items_to_process;
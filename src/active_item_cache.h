@@ -28,17 +28,39 @@ struct hash<special_item_type> {
 };
 } // namespace std
 
+/**
+ * Active items are kept in one timing wheel per processing speed.  A wheel has one slot per
+ * turn of its period, every call to @ref get_for_processing hands out the items of the next
+ * slot of each wheel.  Each item is processed exactly once per period and the work of a call
+ * doesn't depend on how much of the period is left for the rest of the items.
+ */
 class active_item_cache
 {
     private:
-        std::unordered_map<int, std::pair<int, std::vector<cache_reference<item>>>> active_items;
+        struct timing_wheel {
+            std::vector<std::vector<cache_reference<item>>> slots;
+            // May refer to destroyed items, verified against the slot before use
+            std::unordered_map<const item *, size_t> slot_of;
+            size_t index_limit = 64;
+            // Slot handed out by the next call of get_for_processing
+            size_t next_slot = 0;
+            // Slot the next added item goes to, spreads items added at once over the period
+            size_t add_slot = 0;
+            // References in all slots, including those to destroyed items not dropped yet
+            size_t size = 0;
+
+            bool empty() const;
+            bool in_slot( const item *it, size_t slot ) const;
+            void rebuild_index();
+            void erase_broken( size_t slot );
+        };
+        std::unordered_map<int, timing_wheel> active_items;
         std::unordered_map<special_item_type, std::vector<cache_reference<item>>> special_items;
 
     public:
         /**
          * Removes the item if it is in the cache. Does nothing if the item is not in the cache.
-         * Relies on the fact that item::processing_speed() is a constant.
-         * Also removes any items that have been destroyed in the list containing it
+         * Also removes any items that have been destroyed in the slot containing it
          */
         void remove( const item *it );
 
@@ -60,9 +82,8 @@ class active_item_cache
         std::vector<item *> get();
 
         /**
-         * Returns the first size() / processing_speed() elements of each list, rounded up.
-         * Items returned are rotated to the back of their respective lists, otherwise only the
-         * first n items will ever be processed.
+         * Returns the items of the next slot of each wheel, so every item is returned once
+         * every item::processing_speed() calls.
          * Broken references encountered when collecting the items to be processed are removed from
          * the cache.
          * Relies on the fact that item::processing_speed() is a constant.
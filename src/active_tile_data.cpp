@@ -1,6 +1,10 @@
 #include "active_tile_data.h"
 #include "active_tile_data_def.h"
 
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+
 #include "coordinate_conversions.h"
 #include "debug.h"
 #include "distribution_grid.h"
@@ -48,6 +52,7 @@ template vehicle_connector_tile *furn_at<vehicle_connector_tile>( const tripoint
 template battery_tile *furn_at<battery_tile>( const tripoint_abs_ms & );
 template steady_consumer_tile *furn_at<steady_consumer_tile>( const tripoint_abs_ms & );
 template charge_watcher_tile *furn_at<charge_watcher_tile>( const tripoint_abs_ms & );
+template charger_tile *furn_at<charger_tile>( const tripoint_abs_ms & );
 
 void furn_transform::serialize( JsonOut &jsout ) const
 {
@@ -126,9 +131,8 @@ void solar_tile::update_internal( time_point to, const tripoint_abs_ms &p, distr
     time_duration rounded_then = ticks_then * tick_turns;
     time_duration rounded_now = ticks_now * tick_turns;
 
-    // TODO: Use something that doesn't calc a ton of worthless crap
-    float sunlight = sum_conditions( zero + rounded_then, zero + rounded_now,
-                                     p.raw() ).sunlight / default_daylight_level();
+    float sunlight = sum_sunlight( zero + rounded_then, zero + rounded_now,
+                                   p.raw() ) / default_daylight_level();
     // int64 because we can have years in here
     std::int64_t produced = power * static_cast<std::int64_t>( sunlight ) / 1000;
     grid.mod_resource( static_cast<int>( std::min( static_cast<std::int64_t>( INT_MAX ), produced ) ) );
@@ -253,31 +257,42 @@ void charger_tile::update_internal( time_point to, const tripoint_abs_ms &p,
     if( sm == nullptr ) {
         return;
     }
-    std::int64_t power = this->power * to_seconds<std::int64_t>( to - get_last_updated() );
+    // Whole kJ the charger can hand out, the rest of a kJ is rolled for.
+    // Done in one step, a base left alone for weeks would otherwise take one grid
+    // lookup per kJ.
+    const std::int64_t joules = this->power * to_seconds<std::int64_t>( to - get_last_updated() );
+    std::int64_t budget = joules / 1000 + ( x_in_y( joules % 1000, 1000 ) ? 1 : 0 );
     // TODO: Make not a copy from map.cpp
     for( item *const outer : sm->get_items( p_within_sm.raw() ) ) {
-        outer->visit_items( [&power, &grid]( item * it ) {
+        if( budget <= 0 ) {
+            break;
+        }
+        outer->visit_items( [&budget, &grid]( item * it ) {
             item &n = *it;
             if( !n.has_flag( flag_RECHARGE ) && !n.has_flag( flag_USE_UPS ) ) {
                 return VisitResponse::NEXT;
             }
-            if( n.ammo_capacity() > n.ammo_remaining() ||
-                ( n.type->battery && n.type->battery->max_capacity > n.energy_remaining() ) ) {
-                while( power >= 1000 || x_in_y( power, 1000 ) ) {
-                    const int missing = grid.mod_resource( -1 );
-                    if( missing == 0 ) {
-                        if( n.is_battery() ) {
-                            n.mod_energy( 1_kJ );
-                        } else {
-                            n.ammo_set( itype_battery, n.ammo_remaining() + 1 );
-                        }
-                    }
-                    power -= 1000;
-                }
-                return VisitResponse::ABORT;
+            std::int64_t room = 0;
+            if( n.is_battery() ) {
+                const units::energy missing = n.type->battery->max_capacity - n.energy_remaining();
+                room = ( units::to_joule( missing ) + 999 ) / 1000;
+            } else {
+                room = n.ammo_capacity() - n.ammo_remaining();
             }
-
-            return VisitResponse::SKIP;
+            if( room <= 0 ) {
+                return VisitResponse::SKIP;
+            }
+            const int wanted = static_cast<int>( std::min( { budget, room,
+                                                 static_cast<std::int64_t>( INT_MAX ) } ) );
+            // Returns the part it couldn't supply, negated
+            const int supplied = wanted + grid.mod_resource( -wanted );
+            if( n.is_battery() ) {
+                n.mod_energy( units::from_kilojoule( supplied ) );
+            } else {
+                n.ammo_set( itype_battery, n.ammo_remaining() + supplied );
+            }
+            budget -= wanted;
+            return VisitResponse::ABORT;
         } );
     }
 }
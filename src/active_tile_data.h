@@ -21,6 +21,9 @@ class active_tile_data
 
     protected:
         /**
+         * Catches the tile up from @ref get_last_updated to @p to.  Should not step through
+         * that time in small steps, grids that were away for weeks update all their tiles at
+         * once when they are loaded again.
          * @param to the time to update to
          * @param p absolute map coordinates (@ref map::getabs) of the tile being updated
          * @param grid distribution grid being updated, containing the tile being updated
@@ -41,6 +44,14 @@ class active_tile_data
             last_updated = t;
         }
 
+        /**
+         * Whether @ref update does anything for this tile.
+         * Passive tiles (storage) only react to other tiles and can be skipped by grid updates.
+         */
+        virtual bool is_passive() const {
+            return false;
+        }
+
         void serialize( JsonOut &jsout ) const;
         void deserialize( JsonIn &jsin );
 
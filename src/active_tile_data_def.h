@@ -27,6 +27,9 @@ class battery_tile : public active_tile_data
         void update_internal( time_point to, const tripoint_abs_ms &p, distribution_grid &grid ) override;
         active_tile_data *clone() const override;
         const std::string &get_type() const override;
+        bool is_passive() const override {
+            return true;
+        }
         void store( JsonOut &jsout ) const override;
         void load( JsonObject &jo ) override;
 
@@ -97,6 +100,9 @@ class vehicle_connector_tile : public active_tile_data
         void update_internal( time_point to, const tripoint_abs_ms &p, distribution_grid &grid ) override;
         active_tile_data *clone() const override;
         const std::string &get_type() const override;
+        bool is_passive() const override {
+            return true;
+        }
         void store( JsonOut &jsout ) const override;
         void load( JsonObject &jo ) override;
 };
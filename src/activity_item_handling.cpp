@@ -6,6 +6,7 @@
 #include <cstdlib>
 #include <iterator>
 #include <list>
+#include <map>
 #include <memory>
 #include <numeric>
 #include <optional>
@@ -123,6 +124,7 @@ static const zone_type_id zone_type_CONSTRUCTION_BLUEPRINT( "CONSTRUCTION_BLUEPR
 static const zone_type_id zone_type_FARM_PLOT( "FARM_PLOT" );
 static const zone_type_id zone_type_FISHING_SPOT( "FISHING_SPOT" );
 static const zone_type_id zone_type_LOOT_CORPSE( "LOOT_CORPSE" );
+static const zone_type_id zone_type_LOOT_CUSTOM( "LOOT_CUSTOM" );
 static const zone_type_id zone_type_LOOT_IGNORE( "LOOT_IGNORE" );
 static const zone_type_id zone_type_LOOT_IGNORE_FAVORITES( "LOOT_IGNORE_FAVORITES" );
 static const zone_type_id zone_type_MINING( "MINING" );
@@ -2352,6 +2354,10 @@ void activity_on_turn_move_loot( player_activity &act, player &p )
             items.emplace_back( it, false );
         }
 
+        // Destinations of each zone type, nearest to the source first.  Only custom zones
+        // depend on the item, those are filtered per item below.
+        std::map<zone_type_id, std::vector<tripoint>> dest_cache;
+
         //Skip items that have already been processed
         for( auto it = items.begin() + num_processed; it < items.end(); ++it ) {
             ++num_processed;
@@ -2377,9 +2383,15 @@ void activity_on_turn_move_loot( player_activity &act, player &p )
                 continue;
             }
 
-            const std::unordered_set<tripoint> &dest_set = mgr.get_near( id, abspos, ACTIVITY_SEARCH_DISTANCE,
-                    &thisitem );
-            for( const tripoint &dest : dest_set ) {
+            auto dest_iter = dest_cache.find( id );
+            if( dest_iter == dest_cache.end() ) {
+                dest_iter = dest_cache.emplace( id, get_sorted_tiles_by_distance( src,
+                                                mgr.get_near( id, abspos, ACTIVITY_SEARCH_DISTANCE ) ) ).first;
+            }
+            for( const tripoint &dest : dest_iter->second ) {
+                if( mgr.has( zone_type_LOOT_CUSTOM, dest ) && !mgr.custom_loot_has( dest, &thisitem ) ) {
+                    continue;
+                }
                 const tripoint &dest_loc = here.getlocal( dest );
 
                 //Check destination for cargo part
@@ -53,6 +53,7 @@ void advanced_inventory_pane::load_settings( int saved_area_idx,
     sortby = static_cast<advanced_inv_sortby>( save_state->sort_idx );
     index = save_state->selected_idx;
     filter = save_state->filter;
+    filter_fn = nullptr;
 }
 
 bool advanced_inventory_pane::is_filtered( const advanced_inv_listitem &it ) const
@@ -69,15 +70,10 @@ bool advanced_inventory_pane::is_filtered( const item &it ) const
         return false;
     }
 
-    const std::string str = it.tname();
-    if( filtercache.find( str ) == filtercache.end() ) {
-        const auto filter_fn = item_filter_from_string( filter );
-        filtercache[str] = filter_fn;
-
-        return !filter_fn( it );
+    if( !filter_fn ) {
+        filter_fn = item_filter_from_string( filter );
     }
-
-    return !filtercache[str]( it );
+    return !filter_fn( it );
 }
 
 void advanced_inventory_pane::add_items_from_area( advanced_inv_area &square,
@@ -276,6 +272,6 @@ void advanced_inventory_pane::set_filter( const std::string &new_filter )
         return;
     }
     filter = new_filter;
-    filtercache.clear();
+    filter_fn = nullptr;
     recalc = true;
 }
@@ -5,7 +5,6 @@
 #include <array>
 #include <cstddef>
 #include <functional>
-#include <map>
 #include <string>
 #include <vector>
 
@@ -126,6 +125,7 @@ class advanced_inventory_pane
         /** Only add offset to index, but wrap around! */
         void mod_index( int offset );
 
-        mutable std::map<std::string, std::function<bool( const item & )>> filtercache;
+        /** Predicate built from @ref filter, on first use after it changed */
+        mutable std::function<bool( const item & )> filter_fn;
 };
 #endif // CATA_SRC_ADVANCED_INV_PANE_H
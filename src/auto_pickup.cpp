@@ -3,8 +3,11 @@
 #include <algorithm>
 #include <cstddef>
 #include <functional>
+#include <locale>
 #include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "avatar.h"
 #include "color.h"
@@ -33,9 +36,6 @@
 
 using namespace auto_pickup;
 
-static bool check_special_rule( const std::vector<material_id> &materials,
-                                const std::string &rule );
-
 auto_pickup::player_settings &get_auto_pickup()
 {
     static auto_pickup::player_settings single_instance;
@@ -419,11 +419,12 @@ void rule::test_pattern() const
         return;
     }
 
+    const compiled_rule compiled( *this );
     //Loop through all itemfactory items
     //APU now ignores prefixes, bottled items and suffix combinations still not generated
     for( const itype *e : item_controller->all() ) {
         const std::string sItemName = e->nname( 1 );
-        if( !check_special_rule( e->materials, sRule ) && !wildcard_match( sItemName, sRule ) ) {
+        if( !compiled.matches( compiled_rule::prepare_name( sItemName ), e->materials ) ) {
             continue;
         }
 
@@ -541,7 +542,7 @@ bool player_settings::has_rule( const item *it )
 void player_settings::add_rule( const item *it )
 {
     character_rules.push_back( rule( it->tname( 1, false ), true, false ) );
-    create_rule( it );
+    invalidate();
 
     if( !get_option<bool>( "AUTO_PICKUP" ) &&
         query_yn( _( "Autopickup is not enabled in the options.  Enable it now?" ) ) ) {
@@ -569,74 +570,129 @@ bool player_settings::empty() const
     return global_rules.empty() && character_rules.empty();
 }
 
-bool check_special_rule( const std::vector<material_id> &materials, const std::string &rule )
+compiled_rule::compiled_rule( const rule &r )
+    : state( r.bExclude ? RULE_BLACKLISTED : RULE_WHITELISTED )
 {
-    char type = ' ';
-    std::vector<std::string> filter;
-    if( rule[1] == ':' ) {
-        type = rule[0];
-        filter = string_split( rule.substr( 2 ), ',' );
+    parts = string_split( prepare_name( wildcard_trim_rule( r.sRule ) ), '*' );
+
+    if( r.sRule.size() > 1 && r.sRule[1] == ':' && ( r.sRule[0] == 'm' || r.sRule[0] == 'M' ) ) {
+        material_type = r.sRule[0];
+        for( const std::string &search : string_split( r.sRule.substr( 2 ), ',' ) ) {
+            material_filter.emplace_back( search );
+        }
     }
+}
 
-    if( filter.empty() || materials.empty() ) {
-        return false;
+std::string compiled_rule::prepare_name( const std::string &name )
+{
+    // Same comparison as ci_find_substr, done once for the whole string
+    const std::locale loc = std::locale();
+    std::string result = name;
+    for( char &c : result ) {
+        c = std::toupper( c, loc );
     }
+    return result;
+}
 
-    if( type == 'm' ) {
-        return std::any_of( materials.begin(), materials.end(), [&filter]( const material_id & mat ) {
-            return std::any_of( filter.begin(), filter.end(), [&mat]( const std::string & search ) {
-                return lcmatch( mat->name(), search );
-            } );
-        } );
+bool compiled_rule::matches_materials( const std::vector<material_id> &materials ) const
+{
+    if( material_filter.empty() || materials.empty() ) {
+        return false;
+    }
 
-    } else if( type == 'M' ) {
-        return std::all_of( materials.begin(), materials.end(), [&filter]( const material_id & mat ) {
-            return std::any_of( filter.begin(), filter.end(), [&mat]( const std::string & search ) {
-                return lcmatch( mat->name(), search );
-            } );
+    const auto matches_filter = [this]( const material_id & mat ) {
+        const std::string name = mat->name();
+        return std::any_of( material_filter.begin(), material_filter.end(),
+        [&name]( const lcmatcher & search ) {
+            return search( name );
         } );
+    };
+    if( material_type == 'm' ) {
+        return std::any_of( materials.begin(), materials.end(), matches_filter );
+    } else if( material_type == 'M' ) {
+        return std::all_of( materials.begin(), materials.end(), matches_filter );
     }
 
     return false;
 }
 
-//Special case. Required for NPC harvest autopickup. Ignores material rules.
-void npc_settings::create_rule( const std::string &to_match )
+bool compiled_rule::matches( const std::string &name,
+                             const std::vector<material_id> &materials ) const
 {
-    rules.create_rule( map_items, to_match );
-}
+    if( matches_materials( materials ) ) {
+        return true;
+    }
 
-void rule_list::create_rule( cache &map_items, const std::string &to_match )
-{
-    for( const rule &elem : *this ) {
-        if( !elem.bActive || !wildcard_match( to_match, elem.sRule ) ) {
+    // Same rules as wildcard_match
+    if( name.empty() ) {
+        return false;
+    } else if( name == "*" ) {
+        return true;
+    }
+
+    if( parts.size() == 1 ) {
+        return name == parts.front();
+    }
+
+    // Start of the part of the name the rest of the pattern is matched against
+    size_t start = 0;
+    for( size_t i = 0; i < parts.size(); i++ ) {
+        const std::string &part = parts[i];
+        if( part.empty() ) {
             continue;
         }
-
-        map_items[ to_match ] = elem.bExclude ? RULE_BLACKLISTED : RULE_WHITELISTED;
+        if( i == 0 ) {
+            if( name.size() < part.size() || name.compare( 0, part.size(), part ) != 0 ) {
+                return false;
+            }
+            start = part.size();
+        } else if( i == parts.size() - 1 ) {
+            if( name.size() - start < part.size() ||
+                name.compare( name.size() - part.size(), part.size(), part ) != 0 ) {
+                return false;
+            }
+        } else {
+            const size_t pos = name.find( part, start );
+            if( pos == std::string::npos ) {
+                return false;
+            }
+            start = pos + part.size();
+        }
     }
+
+    return true;
+}
+
+//Special case. Required for NPC harvest autopickup. Ignores material rules.
+void npc_settings::create_rule( const std::string &to_match )
+{
+    match_rules( to_match, {} );
 }
 
 void player_settings::create_rule( const item *it )
 {
     // TODO: change it to be a reference
-    global_rules.create_rule( map_items, *it );
-    character_rules.create_rule( map_items, *it );
+    match_rules( it->tname( 1, false ), it->made_of() );
 }
 
-void rule_list::create_rule( cache &map_items, const item &it )
+void base_settings::match_rules( const std::string &to_match,
+                                 const std::vector<material_id> &materials ) const
 {
-    const std::string to_match = it.tname( 1, false );
+    if( !map_items.ready ) {
+        recreate();
+    }
 
-    for( const rule &elem : *this ) {
-        if( !elem.bActive ) {
-            continue;
-        } else if( !check_special_rule( it.made_of(), elem.sRule ) &&
-                   !wildcard_match( to_match, elem.sRule ) ) {
-            continue;
-        }
+    // Names are matched only once, items of the same name but other materials are rare enough
+    const auto inserted = map_items.emplace( to_match, RULE_NONE );
+    if( !inserted.second ) {
+        return;
+    }
 
-        map_items[ to_match ] = elem.bExclude ? RULE_BLACKLISTED : RULE_WHITELISTED;
+    const std::string name = compiled_rule::prepare_name( to_match );
+    for( const compiled_rule &elem : map_items.rules ) {
+        if( elem.matches( name, materials ) ) {
+            inserted.first->second = elem.state;
+        }
     }
 }
 
@@ -652,19 +708,24 @@ void player_settings::refresh_map_items( cache &map_items ) const
 void rule_list::refresh_map_items( cache &map_items ) const
 {
     for( const rule &elem : *this ) {
-        if( elem.sRule.empty() || !elem.bActive ) {
+        if( !elem.bActive ) {
             continue;
         }
+        map_items.rules.emplace_back( elem );
+        if( elem.sRule.empty() ) {
+            continue;
+        }
+        const compiled_rule &compiled = map_items.rules.back();
 
         if( !elem.bExclude ) {
             //Check include patterns against all itemfactory items
-            for( const itype *e : item_controller->all() ) {
-                const std::string &cur_item = e->nname( 1 );
-
-                if( !check_special_rule( e->materials, elem.sRule ) && !wildcard_match( cur_item, elem.sRule ) ) {
+            for( const auto &entry : map_items.temp_names ) {
+                const itype *e = entry.second;
+                if( !compiled.matches( entry.first, e->materials ) ) {
                     continue;
                 }
 
+                const std::string &cur_item = e->nname( 1 );
                 map_items[ cur_item ] = RULE_WHITELISTED;
                 map_items.temp_items[ cur_item ] = e;
             }
@@ -672,12 +733,12 @@ void rule_list::refresh_map_items( cache &map_items ) const
             //only re-exclude items from the existing mapping for now
             //new exclusions will process during pickup attempts
             for( auto &map_item : map_items ) {
-                if( !check_special_rule( map_items.temp_items[ map_item.first ]->materials, elem.sRule ) &&
-                    !wildcard_match( map_item.first, elem.sRule ) ) {
+                if( !compiled.matches( compiled_rule::prepare_name( map_item.first ),
+                                       map_items.temp_items[ map_item.first ]->materials ) ) {
                     continue;
                 }
 
-                map_items[ map_item.first ] = RULE_BLACKLISTED;
+                map_item.second = RULE_BLACKLISTED;
             }
         }
     }
@@ -831,10 +892,15 @@ bool npc_settings::empty() const
 void base_settings::recreate() const
 {
     map_items.clear();
+    map_items.rules.clear();
     map_items.temp_items.clear();
+    for( const itype *e : item_controller->all() ) {
+        map_items.temp_names.emplace_back( compiled_rule::prepare_name( e->nname( 1 ) ), e );
+    }
     refresh_map_items( map_items );
     map_items.ready = true;
     map_items.temp_items.clear();
+    map_items.temp_names.clear();
 }
 
 void base_settings::invalidate()
@@ -6,9 +6,12 @@
 #include <iosfwd>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "enums.h"
+#include "string_utils.h"
+#include "type_id.h"
 
 class JsonIn;
 class JsonOut;
@@ -18,22 +21,6 @@ struct itype;
 namespace auto_pickup
 {
 
-/**
- * The currently-active set of auto-pickup rules, in a form that allows quick
- * lookup. When this is filled (by @ref auto_pickup::create_rule()), every
- * item existing in the game that matches a rule (either white- or blacklist)
- * is added as the key, with RULE_WHITELISTED or RULE_BLACKLISTED as the values.
- */
-class cache : public std::unordered_map<std::string, rule_state>
-{
-    public:
-        /// Defines whether this cache has been filled.
-        bool ready = false;
-
-        /// Temporary data used while filling the cache.
-        std::unordered_map<std::string, const itype *> temp_items;
-};
-
 /**
  * A single entry in the list of auto pickup entries @ref rule_list.
  * The data contained can be edited by the player and determines what to pick/ignore.
@@ -56,6 +43,60 @@ class rule
         void test_pattern() const;
 };
 
+/**
+ * An active @ref rule, prepared for matching against many item names.  The pattern is
+ * split at its wildcards and upper cased once here instead of on every comparison.
+ */
+class compiled_rule
+{
+    public:
+        explicit compiled_rule( const rule &r );
+
+        /// What an item matching this rule becomes.
+        rule_state state;
+
+        /**
+         * Whether an item with this name and these materials matches the rule.
+         * @p name has to be prepared with @ref compiled_rule::prepare_name().
+         */
+        bool matches( const std::string &name, const std::vector<material_id> &materials ) const;
+
+        /// Upper cases an item name the same way the rule pattern is.
+        static std::string prepare_name( const std::string &name );
+
+    private:
+        /// Upper cased parts of the pattern between the wildcards.
+        std::vector<std::string> parts;
+        /// 'm' (any material) or 'M' (all materials) for material rules, ' ' otherwise.
+        char material_type = ' ';
+        std::vector<lcmatcher> material_filter;
+
+        bool matches_materials( const std::vector<material_id> &materials ) const;
+};
+
+/**
+ * The currently-active set of auto-pickup rules, in a form that allows quick
+ * lookup. When this is filled (by @ref auto_pickup::create_rule()), every
+ * item existing in the game that matches a rule (either white- or blacklist)
+ * is added as the key, with RULE_WHITELISTED or RULE_BLACKLISTED as the values.
+ * Names checked later on (by @ref base_settings::match_rules()) are added as well,
+ * RULE_NONE included, so every name goes through the rules only once.
+ */
+class cache : public std::unordered_map<std::string, rule_state>
+{
+    public:
+        /// Defines whether this cache has been filled.
+        bool ready = false;
+
+        /// Active rules of all lists, in the order they are applied.
+        std::vector<compiled_rule> rules;
+
+        /// Temporary data used while filling the cache.
+        std::unordered_map<std::string, const itype *> temp_items;
+        /// Prepared names of all item types, temporary data as well.
+        std::vector<std::pair<std::string, const itype *>> temp_names;
+};
+
 /**
  * A list of rules. This is primarily a container with a few convenient functions (like saving/loading).
  */
@@ -66,9 +107,6 @@ class rule_list : public std::vector<rule>
         void deserialize( JsonIn &jsin );
 
         void refresh_map_items( cache &map_items ) const;
-
-        void create_rule( cache &map_items, const std::string &to_match );
-        void create_rule( cache &map_items, const item &it );
 };
 
 class user_interface
@@ -99,6 +137,9 @@ class base_settings
         mutable cache map_items;
 
         void invalidate();
+        /** Checks a name that is not in the cache yet against all rules and adds it. */
+        void match_rules( const std::string &to_match,
+                          const std::vector<material_id> &materials ) const;
 
     private:
         virtual void refresh_map_items( cache &map_items ) const = 0;
@@ -94,6 +94,9 @@ class avatar : public player
 
         void toggle_map_memory();
         bool should_show_map_memory();
+        const map_memory &get_map_memory() const {
+            return *player_map_memory;
+        }
         void prepare_map_memory_region( const tripoint &p1, const tripoint &p2 );
         /** Memorizes a given tile in tiles mode; finalize_tile_memory needs to be called after it */
         void memorize_tile( const tripoint &pos, const std::string &ter, int subtile,
@@ -42,9 +42,9 @@ class tree
 {
     public:
         // Entry point, evaluates the tree and returns the selected goal.
-        std::string tick( const oracle_t *subject );
+        const std::string &tick( const oracle_t *subject );
         // Retrieves the most recently determined goal without re-evaluating the tree.
-        std::string goal() const;
+        const std::string &goal() const;
         // Set the root node of the tree.
         void add( const node_t *new_node );
     private:
@@ -58,7 +58,7 @@ class node_t
         node_t();
         // Entry point for tree traversal.
         behavior_return tick( const oracle_t *subject ) const;
-        std::string goal() const;
+        const std::string &goal() const;
 
         // Interface to construct a node.
         void set_strategy( const strategy_t *new_strategy );
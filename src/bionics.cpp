@@ -1578,26 +1578,32 @@ void Character::process_bionic( bionic &bio )
 {
     if( ( !bio.id->fuel_opts.empty() || bio.id->is_remote_fueled ) && bio.is_auto_start_on() ) {
         const float start_threshold = bio.get_auto_start_thresh();
-        std::vector<itype_id> fuel_available = get_fuel_available( bio.id );
-        if( bio.id->is_remote_fueled ) {
-            const itype_id rem_fuel = find_remote_fuel();
-            const std::string rem_amount = get_value( "rem_" + rem_fuel.str() );
-            int rem_fuel_stock = 0;
-            if( !rem_amount.empty() ) {
-                rem_fuel_stock = std::stoi( rem_amount );
+        const bool low_power = get_power_level() <= start_threshold * get_max_power_level();
+        // Also refreshes the stored remote stock, so it can't be skipped on full power
+        const itype_id rem_fuel = bio.id->is_remote_fueled ? find_remote_fuel() :
+                                  itype_id::NULL_ID();
+        // Nothing to start above the threshold, don't look for fuel then
+        if( low_power ) {
+            std::vector<itype_id> fuel_available = get_fuel_available( bio.id );
+            if( bio.id->is_remote_fueled ) {
+                const std::string rem_amount = get_value( "rem_" + rem_fuel.str() );
+                int rem_fuel_stock = 0;
+                if( !rem_amount.empty() ) {
+                    rem_fuel_stock = std::stoi( rem_amount );
+                }
+                if( !rem_fuel.is_empty() &&
+                    ( rem_fuel_stock > 0 || rem_fuel->has_flag( flag_PERPETUAL ) ) ) {
+                    fuel_available.emplace_back( rem_fuel );
+                }
             }
-            if( !rem_fuel.is_empty() && ( rem_fuel_stock > 0 || rem_fuel->has_flag( flag_PERPETUAL ) ) ) {
-                fuel_available.emplace_back( rem_fuel );
+            if( !fuel_available.empty() ) {
+                g->u.activate_bionic( bio );
+            } else if( calendar::once_every( 1_hours ) ) {
+                add_msg_player_or_npc( m_bad, _( "Your %s does not have enough fuel to use Auto Start." ),
+                                       _( "<npcname>'s %s does not have enough fuel to use Auto Start." ),
+                                       bio.info().name );
             }
         }
-        if( !fuel_available.empty() && get_power_level() <= start_threshold * get_max_power_level() ) {
-            g->u.activate_bionic( bio );
-        } else if( get_power_level() <= start_threshold * get_max_power_level() &&
-                   calendar::once_every( 1_hours ) ) {
-            add_msg_player_or_npc( m_bad, _( "Your %s does not have enough fuel to use Auto Start." ),
-                                   _( "<npcname>'s %s does not have enough fuel to use Auto Start." ),
-                                   bio.info().name );
-        }
     }
 
     // Only powered bionics should be processed
@@ -828,8 +828,9 @@ const char *trans_library::get_pl( const char *msgid, const char *msgid_pl, size
 
 const char *trans_library::get_ctx( const char *msgctxt, const char *msgid ) const
 {
-    std::string buf;
-    buf.reserve( strlen( msgctxt ) + 1 + strlen( msgid ) );
+    // Reused, so looking up a string with context doesn't allocate every time
+    static thread_local std::string buf;
+    buf.clear();
     buf += msgctxt;
     buf += '\4';
     buf += msgid;
@@ -840,8 +841,9 @@ const char *trans_library::get_ctx( const char *msgctxt, const char *msgid ) con
 const char *trans_library::get_ctx_pl( const char *msgctxt, const char *msgid, const char *msgid_pl,
                                        size_t n ) const
 {
-    std::string buf;
-    buf.reserve( strlen( msgctxt ) + 1 + strlen( msgid ) );
+    // Reused, so looking up a string with context doesn't allocate every time
+    static thread_local std::string buf;
+    buf.clear();
     buf += msgctxt;
     buf += '\4';
     buf += msgid;
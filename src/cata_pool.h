@@ -0,0 +1,109 @@
+#pragma once
+#ifndef CATA_SRC_CATA_POOL_H
+#define CATA_SRC_CATA_POOL_H
+
+#include <cstddef>
+#include <new>
+
+/**
+ * Free list allocator for objects of one size, used by class specific operator new.
+ *
+ * Memory is taken from the system in blocks of @ref slots_per_block slots and never given
+ * back.  Freed slots go to a free list of the thread that freed them, the next allocation
+ * of that thread reuses the most recently freed slot.  Objects that are created and
+ * destroyed in large numbers every turn (items) don't go through the general heap this way.
+ */
+template<size_t Size, size_t Align = alignof( std::max_align_t )>
+class cata_pool
+{
+        static_assert( Align <= alignof( std::max_align_t ), "blocks come from plain operator new" );
+
+    public:
+        static constexpr size_t slots_per_block = 256;
+
+        static void *allocate() {
+            slot *&head = free_list();
+            if( head == nullptr ) {
+                add_block( head );
+            }
+            slot *s = head;
+            head = s->next;
+            return s->storage;
+        }
+
+        static void deallocate( void *ptr ) {
+            if( ptr == nullptr ) {
+                return;
+            }
+            slot *s = static_cast<slot *>( ptr );
+            slot *&head = free_list();
+            s->next = head;
+            head = s;
+        }
+
+    private:
+        union slot {
+            slot *next;
+            alignas( Align ) unsigned char storage[Size];
+        };
+
+        // Trivially destructible, so objects freed during static destruction can still use it
+        static slot *&free_list() {
+            static thread_local slot *head = nullptr;
+            return head;
+        }
+
+        static void add_block( slot *&head ) {
+            slot *block = static_cast<slot *>( ::operator new( sizeof( slot ) * slots_per_block ) );
+            for( size_t i = 0; i < slots_per_block; i++ ) {
+                block[i].next = i + 1 < slots_per_block ? &block[i + 1] : head;
+            }
+            head = block;
+        }
+};
+
+/**
+ * Standard allocator that takes single objects from a @ref cata_pool, for node based
+ * containers: every node of a std::map with it is a pool slot.  Arrays of more than one
+ * object come from the general heap.
+ */
+template<typename T>
+class cata_pool_allocator
+{
+    public:
+        using value_type = T;
+
+        cata_pool_allocator() = default;
+        // Implicit, containers convert between the allocators of their value and node types
+        template<typename U>
+        cata_pool_allocator( const cata_pool_allocator<U> & ) noexcept {} // NOLINT
+
+        T *allocate( size_t n ) {
+            if( n == 1 ) {
+                return static_cast<T *>( pool::allocate() );
+            }
+            return static_cast<T *>( ::operator new( n * sizeof( T ) ) );
+        }
+
+        void deallocate( T *ptr, size_t n ) noexcept {
+            if( n == 1 ) {
+                pool::deallocate( ptr );
+            } else {
+                ::operator delete( ptr );
+            }
+        }
+
+        template<typename U>
+        bool operator==( const cata_pool_allocator<U> & ) const noexcept {
+            return true;
+        }
+        template<typename U>
+        bool operator!=( const cata_pool_allocator<U> & ) const noexcept {
+            return false;
+        }
+
+    private:
+        using pool = cata_pool<sizeof( T ), alignof( T )>;
+};
+
+#endif // CATA_SRC_CATA_POOL_H
@@ -70,6 +70,7 @@
 #include "string_id.h"
 #include "string_utils.h"
 #include "submap.h"
+#include "thread_pool.h"
 #include "tileray.h"
 #include "translations.h"
 #include "trap.h"
@@ -90,6 +91,9 @@ static const itype_id itype_corpse( "corpse" );
 static const std::string ITEM_HIGHLIGHT( "highlight_item" );
 static const std::string ZOMBIE_REVIVAL_INDICATOR( "zombie_revival_indicator" );
 
+static const option_handle<bool> option_animations( "ANIMATIONS" );
+static const option_handle<std::string> option_use_celsius( "USE_CELSIUS" );
+
 static const std::array<std::string, 8> multitile_keys = {{
         "center",
         "corner",
@@ -361,6 +365,12 @@ void cata_tiles::load_tileset(
     loader.load( tileset_id, precheck, /*pump_events=*/pump_events );
     tileset_ptr = std::move( new_tileset_ptr );
     tileset_mod_list_stamp = mod_list;
+    for( auto &category_cache : looks_like_cache ) {
+        category_cache.clear();
+    }
+    for( auto &category_cache : fallback_tile_cache ) {
+        category_cache.clear();
+    }
 
     set_draw_scale( 16 );
 
@@ -417,20 +427,24 @@ static void get_tile_information( const std::string &config_path, std::string &j
     }
 }
 
-template<typename PixelConverter>
-static SDL_Surface_Ptr apply_color_filter( const SDL_Surface_Ptr &original,
-        PixelConverter pixel_converter )
+static SDL_Surface_Ptr copy_surface_32( const SDL_Surface_Ptr &original )
 {
     assert( original );
     SDL_Surface_Ptr surf = create_surface_32( original->w, original->h );
     assert( surf );
     throwErrorIf( SDL_BlitSurface( original.get(), nullptr, surf.get(), nullptr ) != 0,
                   "SDL_BlitSurface failed" );
+    return surf;
+}
 
-    auto pix = reinterpret_cast<SDL_Color *>( surf->pixels );
+// Only touches the pixels of @p surf, so different surfaces can be filtered concurrently
+template<typename PixelConverter>
+static void apply_color_filter( SDL_Surface &surf, PixelConverter pixel_converter )
+{
+    auto pix = reinterpret_cast<SDL_Color *>( surf.pixels );
 
-    for( int y = 0, ey = surf->h; y < ey; ++y ) {
-        for( int x = 0, ex = surf->w; x < ex; ++x, ++pix ) {
+    for( int y = 0, ey = surf.h; y < ey; ++y ) {
+        for( int x = 0, ex = surf.w; x < ex; ++x, ++pix ) {
             if( pix->a == 0x00 ) {
                 // This check significantly improves the performance since
                 // vast majority of pixels in the tilesets are completely transparent.
@@ -439,8 +453,6 @@ static SDL_Surface_Ptr apply_color_filter( const SDL_Surface_Ptr &original,
             *pix = pixel_converter( *pix );
         }
     }
-
-    return surf;
 }
 
 static bool is_contained( const SDL_Rect &smaller, const SDL_Rect &larger )
@@ -485,7 +497,8 @@ bool tileset_loader::create_textures_from_tile_atlas( const SDL_Surface_Ptr &til
 
     /** perform color filter conversion here */
     using tiles_pixel_color_entry = std::tuple<std::vector<texture>*, std::string>;
-    std::array<tiles_pixel_color_entry, 6> tile_values_data = {{
+    constexpr size_t num_variants = 6;
+    std::array<tiles_pixel_color_entry, num_variants> tile_values_data = {{
             { std::make_tuple( &ts.tile_values, "color_pixel_none" ) },
             { std::make_tuple( &ts.shadow_tile_values, "color_pixel_grayscale" ) },
             { std::make_tuple( &ts.night_tile_values, "color_pixel_nightvision" ) },
@@ -494,19 +507,25 @@ bool tileset_loader::create_textures_from_tile_atlas( const SDL_Surface_Ptr &til
             { std::make_tuple( &ts.memory_tile_values, tilecontext->memory_map_mode ) }
         }
     };
-    for( tiles_pixel_color_entry &entry : tile_values_data ) {
-        std::vector<texture> *tile_values = std::get<0>( entry );
-        color_pixel_function_pointer color_pixel_function = get_color_pixel_function( std::get<1>
-                ( entry ) );
-        bool success;
-        if( !color_pixel_function ) {
-            // TODO: Move it inside apply_color_filter.
-            success = copy_surface_to_texture( tile_atlas, offset, *tile_values );
-        } else {
-            success = copy_surface_to_texture( apply_color_filter( tile_atlas, color_pixel_function ), offset,
-                                               *tile_values );
+    // Blitting and uploading go through SDL and stay on this thread, only the pixel
+    // conversion of the variants (the expensive part) is spread over the workers.
+    std::array<color_pixel_function_pointer, num_variants> color_pixel_functions;
+    std::array<SDL_Surface_Ptr, num_variants> filtered;
+    for( size_t i = 0; i < num_variants; i++ ) {
+        color_pixel_functions[i] = get_color_pixel_function( std::get<1>( tile_values_data[i] ) );
+        if( color_pixel_functions[i] ) {
+            filtered[i] = copy_surface_32( tile_atlas );
         }
-        if( !success ) {
+    }
+    get_thread_pool().parallel_for( 0, static_cast<int>( num_variants ), [&]( const int i ) {
+        if( color_pixel_functions[i] ) {
+            apply_color_filter( *filtered[i], color_pixel_functions[i] );
+        }
+    } );
+    for( size_t i = 0; i < num_variants; i++ ) {
+        std::vector<texture> &tile_values = *std::get<0>( tile_values_data[i] );
+        const SDL_Surface_Ptr &surf = color_pixel_functions[i] ? filtered[i] : tile_atlas;
+        if( !copy_surface_to_texture( surf, offset, tile_values ) ) {
             return false;
         }
     }
@@ -650,160 +669,179 @@ std::optional<tile_search_result> cata_tiles::tile_type_search(
 )
 {
     std::optional<tile_lookup_res> res = find_tile_looks_like( id, category );
-    const tile_type *tt = nullptr;
     if( res ) {
-        tt = &( res->tile() );
+        return std::optional{tile_search_result{&res->tile(), res->id()}};
     }
-    const std::string &found_id = res ? ( res->id() ) : id;
-
-    if( !tt ) {
-        uint32_t sym = UNKNOWN_UNICODE;
-        nc_color col = c_white;
-        if( category == C_FURNITURE ) {
-            const furn_str_id fid( found_id );
-            if( fid.is_valid() ) {
-                const furn_t &f = fid.obj();
-                sym = f.symbol();
-                col = f.color();
-            }
-        } else if( category == C_TERRAIN ) {
-            const ter_str_id tid( found_id );
-            if( tid.is_valid() ) {
-                const ter_t &t = tid.obj();
-                sym = t.symbol();
-                col = t.color();
-            }
-        } else if( category == C_MONSTER ) {
-            const mtype_id mid( found_id );
-            if( mid.is_valid() ) {
-                const mtype &mt = mid.obj();
-                sym = UTF8_getch( mt.sym );
-                col = mt.color;
-            }
-        } else if( category == C_VEHICLE_PART ) {
-            const vpart_id vpid( found_id.substr( 3 ) );
-            if( vpid.is_valid() ) {
-                const vpart_info &v = vpid.obj();
-
-                if( subtile == open_ ) {
-                    sym = '\'';
-                } else if( subtile == broken ) {
-                    sym = v.sym_broken;
-                } else {
-                    sym = v.sym;
-                }
-                subtile = -1;
 
-                tileray face = tileray( units::from_degrees( rota ) );
-                sym = special_symbol( face.dir_symbol( sym ) );
-                rota = 0;
+    // Falling back is slow (items are even spawned to get their symbol), but it only
+    // depends on these, and vehicle parts also pick their symbol from subtile and rotation
+    std::string key = id + '\n' + subcategory;
+    if( category == C_VEHICLE_PART ) {
+        key += string_format( "\n%d\n%d", subtile, rota );
+    }
+    auto &cache = fallback_tile_cache[category];
+    auto iter = cache.find( key );
+    if( iter == cache.end() ) {
+        iter = cache.emplace( std::move( key ),
+                              tile_type_fallback( id, category, subcategory, subtile, rota ) ).first;
+    }
+    return iter->second;
+}
 
-                col = v.color;
-            }
-        } else if( category == C_FIELD ) {
-            const field_type_id fid = field_type_id( found_id );
-            sym = fid.obj().get_codepoint();
-            // TODO: field intensity?
-            col = fid.obj().get_color();
-        } else if( category == C_TRAP ) {
-            const trap_str_id tmp( found_id );
-            if( tmp.is_valid() ) {
-                const trap &t = tmp.obj();
-                sym = t.sym;
-                col = t.color;
-            }
-        } else if( category == C_ITEM ) {
-            //TODO!: push this up, it's a bad one
-            item *tmp;
-            if( found_id.starts_with( "corpse_" ) ) {
-                tmp = item::spawn_temporary( itype_corpse, calendar::start_of_cataclysm );
+std::optional<tile_search_result> cata_tiles::tile_type_fallback(
+    const std::string &id, TILE_CATEGORY category,
+    const std::string &subcategory, int subtile, int rota
+)
+{
+    const tile_type *tt = nullptr;
+    const std::string &found_id = id;
+
+    uint32_t sym = UNKNOWN_UNICODE;
+    nc_color col = c_white;
+    if( category == C_FURNITURE ) {
+        const furn_str_id fid( found_id );
+        if( fid.is_valid() ) {
+            const furn_t &f = fid.obj();
+            sym = f.symbol();
+            col = f.color();
+        }
+    } else if( category == C_TERRAIN ) {
+        const ter_str_id tid( found_id );
+        if( tid.is_valid() ) {
+            const ter_t &t = tid.obj();
+            sym = t.symbol();
+            col = t.color();
+        }
+    } else if( category == C_MONSTER ) {
+        const mtype_id mid( found_id );
+        if( mid.is_valid() ) {
+            const mtype &mt = mid.obj();
+            sym = UTF8_getch( mt.sym );
+            col = mt.color;
+        }
+    } else if( category == C_VEHICLE_PART ) {
+        const vpart_id vpid( found_id.substr( 3 ) );
+        if( vpid.is_valid() ) {
+            const vpart_info &v = vpid.obj();
+
+            if( subtile == open_ ) {
+                sym = '\'';
+            } else if( subtile == broken ) {
+                sym = v.sym_broken;
             } else {
-                tmp = item::spawn_temporary( found_id, calendar::start_of_cataclysm );
-            }
-            sym = tmp->symbol().empty() ? ' ' : tmp->symbol().front();
-            col = tmp->color();
-        } else if( category == C_OVERMAP_TERRAIN ) {
-            const oter_type_str_id tmp( id );
-            if( tmp.is_valid() ) {
-                sym = tmp->symbol;
-                col = tmp->color;
+                sym = v.sym;
             }
-        } else if( category == C_OVERMAP_NOTE ) {
-            sym = id[5];
-            col = color_from_string( id.substr( 7, id.length() - 1 ) );
-        }
-        // Special cases for walls
-        switch( sym ) {
-            case LINE_XOXO:
-            case LINE_XOXO_UNICODE:
-                sym = LINE_XOXO_C;
-                break;
-            case LINE_OXOX:
-            case LINE_OXOX_UNICODE:
-                sym = LINE_OXOX_C;
-                break;
-            case LINE_XXOO:
-            case LINE_XXOO_UNICODE:
-                sym = LINE_XXOO_C;
-                break;
-            case LINE_OXXO:
-            case LINE_OXXO_UNICODE:
-                sym = LINE_OXXO_C;
-                break;
-            case LINE_OOXX:
-            case LINE_OOXX_UNICODE:
-                sym = LINE_OOXX_C;
-                break;
-            case LINE_XOOX:
-            case LINE_XOOX_UNICODE:
-                sym = LINE_XOOX_C;
-                break;
-            case LINE_XXXO:
-            case LINE_XXXO_UNICODE:
-                sym = LINE_XXXO_C;
-                break;
-            case LINE_XXOX:
-            case LINE_XXOX_UNICODE:
-                sym = LINE_XXOX_C;
-                break;
-            case LINE_XOXX:
-            case LINE_XOXX_UNICODE:
-                sym = LINE_XOXX_C;
-                break;
-            case LINE_OXXX:
-            case LINE_OXXX_UNICODE:
-                sym = LINE_OXXX_C;
-                break;
-            case LINE_XXXX:
-            case LINE_XXXX_UNICODE:
-                sym = LINE_XXXX_C;
-                break;
-            default:
-                // sym goes unchanged
-                break;
+            subtile = -1;
+
+            tileray face = tileray( units::from_degrees( rota ) );
+            sym = special_symbol( face.dir_symbol( sym ) );
+            rota = 0;
+
+            col = v.color;
+        }
+    } else if( category == C_FIELD ) {
+        const field_type_id fid = field_type_id( found_id );
+        sym = fid.obj().get_codepoint();
+        // TODO: field intensity?
+        col = fid.obj().get_color();
+    } else if( category == C_TRAP ) {
+        const trap_str_id tmp( found_id );
+        if( tmp.is_valid() ) {
+            const trap &t = tmp.obj();
+            sym = t.sym;
+            col = t.color;
         }
+    } else if( category == C_ITEM ) {
+        //TODO!: push this up, it's a bad one
+        item *tmp;
+        if( found_id.starts_with( "corpse_" ) ) {
+            tmp = item::spawn_temporary( itype_corpse, calendar::start_of_cataclysm );
+        } else {
+            tmp = item::spawn_temporary( found_id, calendar::start_of_cataclysm );
+        }
+        sym = tmp->symbol().empty() ? ' ' : tmp->symbol().front();
+        col = tmp->color();
+    } else if( category == C_OVERMAP_TERRAIN ) {
+        const oter_type_str_id tmp( id );
+        if( tmp.is_valid() ) {
+            sym = tmp->symbol;
+            col = tmp->color;
+        }
+    } else if( category == C_OVERMAP_NOTE ) {
+        sym = id[5];
+        col = color_from_string( id.substr( 7, id.length() - 1 ) );
+    }
+    // Special cases for walls
+    switch( sym ) {
+        case LINE_XOXO:
+        case LINE_XOXO_UNICODE:
+            sym = LINE_XOXO_C;
+            break;
+        case LINE_OXOX:
+        case LINE_OXOX_UNICODE:
+            sym = LINE_OXOX_C;
+            break;
+        case LINE_XXOO:
+        case LINE_XXOO_UNICODE:
+            sym = LINE_XXOO_C;
+            break;
+        case LINE_OXXO:
+        case LINE_OXXO_UNICODE:
+            sym = LINE_OXXO_C;
+            break;
+        case LINE_OOXX:
+        case LINE_OOXX_UNICODE:
+            sym = LINE_OOXX_C;
+            break;
+        case LINE_XOOX:
+        case LINE_XOOX_UNICODE:
+            sym = LINE_XOOX_C;
+            break;
+        case LINE_XXXO:
+        case LINE_XXXO_UNICODE:
+            sym = LINE_XXXO_C;
+            break;
+        case LINE_XXOX:
+        case LINE_XXOX_UNICODE:
+            sym = LINE_XXOX_C;
+            break;
+        case LINE_XOXX:
+        case LINE_XOXX_UNICODE:
+            sym = LINE_XOXX_C;
+            break;
+        case LINE_OXXX:
+        case LINE_OXXX_UNICODE:
+            sym = LINE_OXXX_C;
+            break;
+        case LINE_XXXX:
+        case LINE_XXXX_UNICODE:
+            sym = LINE_XXXX_C;
+            break;
+        default:
+            // sym goes unchanged
+            break;
+    }
 
-        if( sym != 0 && sym < 256 ) {
-            // see cursesport.cpp, function wattron
-            const int pairNumber = col.to_color_pair_index();
-            const cata_cursesport::pairs &colorpair = cata_cursesport::colorpairs[pairNumber];
-            // What about isBlink?
-            const bool isBold = col.is_bold();
-            const int FG = colorpair.FG + ( isBold ? 8 : 0 );
-            std::string generic_id = get_ascii_tile_id( sym, FG, -1 );
+    if( sym != 0 && sym < 256 ) {
+        // see cursesport.cpp, function wattron
+        const int pairNumber = col.to_color_pair_index();
+        const cata_cursesport::pairs &colorpair = cata_cursesport::colorpairs[pairNumber];
+        // What about isBlink?
+        const bool isBold = col.is_bold();
+        const int FG = colorpair.FG + ( isBold ? 8 : 0 );
+        std::string generic_id = get_ascii_tile_id( sym, FG, -1 );
 
-            // do not rotate fallback tiles!
-            if( sym != LINE_XOXO_C && sym != LINE_OXOX_C ) {
-                rota = 0;
-            }
-            if( tileset_ptr->find_tile_type( generic_id ) ) {
-                return tile_type_search( generic_id, C_NONE, subcategory, subtile, rota );
-            }
-            // Try again without color this time (using default color).
-            generic_id = get_ascii_tile_id( sym, -1, -1 );
-            if( tileset_ptr->find_tile_type( generic_id ) ) {
-                return tile_type_search( generic_id, C_NONE, subcategory, subtile, rota );
-            }
+        // do not rotate fallback tiles!
+        if( sym != LINE_XOXO_C && sym != LINE_OXOX_C ) {
+            rota = 0;
+        }
+        if( tileset_ptr->find_tile_type( generic_id ) ) {
+            return tile_type_search( generic_id, C_NONE, subcategory, subtile, rota );
+        }
+        // Try again without color this time (using default color).
+        generic_id = get_ascii_tile_id( sym, -1, -1 );
+        if( tileset_ptr->find_tile_type( generic_id ) ) {
+            return tile_type_search( generic_id, C_NONE, subcategory, subtile, rota );
         }
     }
 
@@ -1393,7 +1431,7 @@ void cata_tiles::draw( point dest, const tripoint &center, int width, int height
         here.getabs( tripoint( max_mm_reg, center.z ) )
     );
 
-    idle_animations.set_enabled( get_option<bool>( "ANIMATIONS" ) );
+    idle_animations.set_enabled( option_animations );
     idle_animations.prepare_for_redraw();
 
     //set up a default tile for the edges outside the render area
@@ -1515,7 +1553,7 @@ void cata_tiles::draw( point dest, const tripoint &center, int width, int height
                 } else {
                     color = catacurses::blue + bold;
                 }
-                const auto display_option = get_option<std::string>( "USE_CELSIUS" );
+                const std::string &display_option = option_use_celsius.get();
                 const int temp_value = display_option == "kelvin" ? units::to_kelvins( temp )
                                        : display_option == "fahrenheit" ? units::to_fahrenheit( temp )
                                        : units::to_celsius( temp );
@@ -2026,6 +2064,30 @@ cata_tiles::find_tile_looks_like_by_string_id( const std::string &id, TILE_CATEG
 std::optional<tile_lookup_res>
 cata_tiles::find_tile_looks_like( const std::string &id, TILE_CATEGORY category,
                                   const int looks_like_jumps_limit ) const
+{
+    // Only whole chains are remembered, the steps inside a chain have smaller limits
+    if( looks_like_jumps_limit != max_looks_like_jumps ) {
+        return find_tile_looks_like_uncached( id, category, looks_like_jumps_limit );
+    }
+    const season_type season = season_of_year( calendar::turn );
+    if( season != looks_like_cache_season ) {
+        for( auto &category_cache : looks_like_cache ) {
+            category_cache.clear();
+        }
+        looks_like_cache_season = season;
+    }
+    auto &cache = looks_like_cache[category];
+    auto iter = cache.find( id );
+    if( iter == cache.end() ) {
+        iter = cache.emplace( id, find_tile_looks_like_uncached( id, category,
+                              looks_like_jumps_limit ) ).first;
+    }
+    return iter->second;
+}
+
+std::optional<tile_lookup_res>
+cata_tiles::find_tile_looks_like_uncached( const std::string &id, TILE_CATEGORY category,
+        const int looks_like_jumps_limit ) const
 {
     if( id.empty() || looks_like_jumps_limit <= 0 ) {
         return std::nullopt;
@@ -2663,7 +2725,7 @@ bool cata_tiles::draw_terrain( const tripoint &p, const lit_level ll, int &heigh
 bool cata_tiles::has_memory_at( const tripoint &p ) const
 {
     if( g->u.should_show_map_memory() ) {
-        const memorized_terrain_tile t = g->u.get_memorized_tile( get_map().getabs( p ) );
+        const memorized_terrain_tile &t = g->u.get_memorized_tile( get_map().getabs( p ) );
         return !t.tile.empty();
     }
     return false;
@@ -2672,7 +2734,7 @@ bool cata_tiles::has_memory_at( const tripoint &p ) const
 bool cata_tiles::has_terrain_memory_at( const tripoint &p ) const
 {
     if( g->u.should_show_map_memory() ) {
-        const memorized_terrain_tile t = g->u.get_memorized_tile( get_map().getabs( p ) );
+        const memorized_terrain_tile &t = g->u.get_memorized_tile( get_map().getabs( p ) );
         if( t.tile.starts_with( "t_" ) ) {
             return true;
         }
@@ -2683,7 +2745,7 @@ bool cata_tiles::has_terrain_memory_at( const tripoint &p ) const
 bool cata_tiles::has_furniture_memory_at( const tripoint &p ) const
 {
     if( g->u.should_show_map_memory() ) {
-        const memorized_terrain_tile t = g->u.get_memorized_tile( get_map().getabs( p ) );
+        const memorized_terrain_tile &t = g->u.get_memorized_tile( get_map().getabs( p ) );
         if( t.tile.starts_with( "f_" ) ) {
             return true;
         }
@@ -2694,7 +2756,7 @@ bool cata_tiles::has_furniture_memory_at( const tripoint &p ) const
 bool cata_tiles::has_trap_memory_at( const tripoint &p ) const
 {
     if( g->u.should_show_map_memory() ) {
-        const memorized_terrain_tile t = g->u.get_memorized_tile( get_map().getabs( p ) );
+        const memorized_terrain_tile &t = g->u.get_memorized_tile( get_map().getabs( p ) );
         if( t.tile.starts_with( "tr_" ) ) {
             return true;
         }
@@ -2705,7 +2767,7 @@ bool cata_tiles::has_trap_memory_at( const tripoint &p ) const
 bool cata_tiles::has_vpart_memory_at( const tripoint &p ) const
 {
     if( g->u.should_show_map_memory() ) {
-        const memorized_terrain_tile t = g->u.get_memorized_tile( get_map().getabs( p ) );
+        const memorized_terrain_tile &t = g->u.get_memorized_tile( get_map().getabs( p ) );
         if( t.tile.starts_with( "vp_" ) ) {
             return true;
         }
@@ -2716,7 +2778,7 @@ bool cata_tiles::has_vpart_memory_at( const tripoint &p ) const
 memorized_terrain_tile cata_tiles::get_terrain_memory_at( const tripoint &p ) const
 {
     if( g->u.should_show_map_memory() ) {
-        const memorized_terrain_tile t = g->u.get_memorized_tile( get_map().getabs( p ) );
+        const memorized_terrain_tile &t = g->u.get_memorized_tile( get_map().getabs( p ) );
         if( t.tile.starts_with( "t_" ) ) {
             return t;
         }
@@ -2727,7 +2789,7 @@ memorized_terrain_tile cata_tiles::get_terrain_memory_at( const tripoint &p ) co
 memorized_terrain_tile cata_tiles::get_furniture_memory_at( const tripoint &p ) const
 {
     if( g->u.should_show_map_memory() ) {
-        const memorized_terrain_tile t = g->u.get_memorized_tile( get_map().getabs( p ) );
+        const memorized_terrain_tile &t = g->u.get_memorized_tile( get_map().getabs( p ) );
         if( t.tile.starts_with( "f_" ) ) {
             return t;
         }
@@ -2738,7 +2800,7 @@ memorized_terrain_tile cata_tiles::get_furniture_memory_at( const tripoint &p )
 memorized_terrain_tile cata_tiles::get_trap_memory_at( const tripoint &p ) const
 {
     if( g->u.should_show_map_memory() ) {
-        const memorized_terrain_tile t = g->u.get_memorized_tile( get_map().getabs( p ) );
+        const memorized_terrain_tile &t = g->u.get_memorized_tile( get_map().getabs( p ) );
         if( t.tile.starts_with( "tr_" ) ) {
             return t;
         }
@@ -2749,7 +2811,7 @@ memorized_terrain_tile cata_tiles::get_trap_memory_at( const tripoint &p ) const
 memorized_terrain_tile cata_tiles::get_vpart_memory_at( const tripoint &p ) const
 {
     if( g->u.should_show_map_memory() ) {
-        const memorized_terrain_tile t = g->u.get_memorized_tile( get_map().getabs( p ) );
+        const memorized_terrain_tile &t = g->u.get_memorized_tile( get_map().getabs( p ) );
         if( t.tile.starts_with( "vp_" ) ) {
             return t;
         }
@@ -2,9 +2,11 @@
 #ifndef CATA_SRC_CATA_TILES_H
 #define CATA_SRC_CATA_TILES_H
 
+#include <array>
 #include <cstddef>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <tuple>
 #include <unordered_map>
@@ -390,9 +392,20 @@ class cata_tiles
 
         std::optional<tile_lookup_res> find_tile_with_season( const std::string &id ) const;
 
+        /** Generic tile for an id without own tile, @ref tile_type_search remembers the results. */
+        std::optional<tile_search_result> tile_type_fallback(
+            const std::string &id, TILE_CATEGORY category, const std::string &subcategory,
+            int subtile, int rota
+        );
+
+        static constexpr int max_looks_like_jumps = 10;
+
         std::optional<tile_lookup_res>
         find_tile_looks_like( const std::string &id, TILE_CATEGORY category,
-                              int looks_like_jumps_limit = 10 ) const;
+                              int looks_like_jumps_limit = max_looks_like_jumps ) const;
+        std::optional<tile_lookup_res>
+        find_tile_looks_like_uncached( const std::string &id, TILE_CATEGORY category,
+                                       int looks_like_jumps_limit ) const;
 
         // this templated method is used only from it's own cpp file, so it's ok to declare it here
         template<typename T>
@@ -677,8 +690,10 @@ class cata_tiles
         static std::vector<options_manager::id_and_option> build_renderer_list();
         static std::vector<options_manager::id_and_option> build_display_list();
     private:
+        /** @param oter_at displayed terrain at a point, called for the point and its neighbours */
         std::string get_omt_id_rotation_and_subtile(
-            const tripoint_abs_omt &omp, int &rota, int &subtile );
+            const tripoint_abs_omt &omp, int &rota, int &subtile,
+            const std::function<oter_id( const tripoint_abs_omt & )> &oter_at );
     protected:
         template <typename maptype>
         void tile_loading_report( const maptype &tiletypemap, TILE_CATEGORY category,
@@ -707,6 +722,16 @@ class cata_tiles
         std::unique_ptr<tileset> tileset_ptr;
         /** List of mods with which @ref tileset_ptr was loaded. */
         std::vector<mod_id> tileset_mod_list_stamp;
+        /**
+         * Whole looks_like chains resolved by @ref find_tile_looks_like, by category and id.
+         * Points into @ref tileset_ptr, so it's cleared when the tileset or the season changes.
+         */
+        mutable std::array<std::unordered_map<std::string, std::optional<tile_lookup_res>>,
+                C_OVERMAP_NOTE + 1> looks_like_cache;
+        mutable season_type looks_like_cache_season = NUM_SEASONS;
+        /** Results of @ref tile_type_fallback by category, cleared when the tileset changes. */
+        std::array<std::unordered_map<std::string, std::optional<tile_search_result>>,
+            C_OVERMAP_NOTE + 1> fallback_tile_cache;
 
         int tile_height = 0;
         int tile_width = 0;
@@ -2,7 +2,9 @@
 
 #include <cstdlib>
 #include <cstring>
+#include <algorithm>
 #include <array>
+#include <string_view>
 
 #include "options.h"
 #include "output.h"
@@ -139,16 +141,19 @@ std::string utf32_to_utf8( uint32_t ch )
 //Calculate width of a Unicode string
 //Latin characters have a width of 1
 //CJK characters have a width of 2, etc
-int utf8_width( const char *s, const bool ignore_tags )
+// Width of the first len bytes of s
+static int utf8_width_bytes( const char *s, int len )
 {
-    if( ignore_tags ) {
-        return utf8_width( remove_color_tags( s ) );
-    }
-    int len = strlen( s );
-    const char *ptr = s;
     int w = 0;
     while( len > 0 ) {
-        uint32_t ch = UTF8_getch( &ptr, &len );
+        // Printable ASCII is always one column wide, no need to decode it
+        if( *s >= 0x20 && *s < 0x7f ) {
+            w++;
+            s++;
+            len--;
+            continue;
+        }
+        uint32_t ch = UTF8_getch( &s, &len );
         if( ch == UNKNOWN_UNICODE ) {
             continue;
         }
@@ -157,6 +162,33 @@ int utf8_width( const char *s, const bool ignore_tags )
     return w;
 }
 
+int utf8_width( const char *s, const bool ignore_tags )
+{
+    if( !ignore_tags ) {
+        return utf8_width_bytes( s, static_cast<int>( strlen( s ) ) );
+    }
+    // Same as measuring remove_color_tags( s ), but without building the string
+    static constexpr std::string_view open_tag = "<color_";
+    static constexpr std::string_view close_tag = "</color>";
+    const std::string_view str( s );
+    int w = 0;
+    size_t pos = 0;
+    while( true ) {
+        const size_t tag = std::min( str.find( open_tag, pos ), str.find( close_tag, pos ) );
+        if( tag == std::string_view::npos ) {
+            break;
+        }
+        const size_t tag_end = str.find( '>', tag );
+        if( tag_end == std::string_view::npos ) {
+            // Malformed, leave that to remove_color_tags
+            return utf8_width( remove_color_tags( s ) );
+        }
+        w += utf8_width_bytes( s + pos, static_cast<int>( tag - pos ) );
+        pos = tag_end + 1;
+    }
+    return w + utf8_width_bytes( s + pos, static_cast<int>( str.size() - pos ) );
+}
+
 int utf8_width( const std::string &str, const bool ignore_tags )
 {
     return utf8_width( str.c_str(), ignore_tags );
@@ -4,6 +4,23 @@
 
 constexpr int LUA_API_VERSION = 2;
 
+namespace cata
+{
+
+static std::map<std::string, lua_hook_stats> hook_stats;
+
+const std::map<std::string, lua_hook_stats> &get_lua_hook_stats()
+{
+    return hook_stats;
+}
+
+void reset_lua_hook_stats()
+{
+    hook_stats.clear();
+}
+
+} // namespace cata
+
 #ifndef LUA
 
 #include "popup.h"
@@ -27,6 +44,11 @@ std::string get_lapi_version_string()
     return "<none>";
 }
 
+size_t get_lua_memory_usage()
+{
+    return 0;
+}
+
 void startup_lua_test()
 {
     // Nothing to do here
@@ -90,6 +112,8 @@ template<typename... Args>
 void run_hooks( Args &&... ) {}
 
 void run_on_every_x_hooks( lua_state & ) {}
+void set_lua_gc_budget( int, int ) {}
+void run_lua_gc_step( lua_state & ) {}
 
 } // namespace cata
 
@@ -111,8 +135,11 @@ void run_on_every_x_hooks( lua_state & ) {}
 #include "mod_manager.h"
 #include "path_info.h"
 #include "point.h"
+#include "turn_profiler.h"
 #include "worldfactory.h"
 
+#include <algorithm>
+
 namespace cata
 {
 
@@ -175,6 +202,12 @@ void reload_lua_code()
     clear_mod_being_loaded( state );
 }
 
+size_t get_lua_memory_usage()
+{
+    const cata::lua_state *state = DynamicDataLoader::get_instance().lua.get();
+    return state ? state->lua.memory_used() : 0;
+}
+
 void debug_write_lua_backtrace( std::ostream &out )
 {
     cata::lua_state *state = DynamicDataLoader::get_instance().lua.get();
@@ -391,11 +424,14 @@ void run_on_every_x_hooks( lua_state &state )
 {
     std::vector<cata::on_every_x_hooks> &master_table =
         state.lua["game"]["cata_internal"]["on_every_x_hooks"];
+    const bool profile = turn_profiler::is_enabled();
     for( const auto &entry : master_table ) {
         if( calendar::once_every( entry.interval ) ) {
-            for( auto &func : entry.functions ) {
+            for( const on_every_x_hook &hook : entry.functions ) {
+                const auto start = profile ? std::chrono::steady_clock::now() :
+                                   std::chrono::steady_clock::time_point();
                 try {
-                    sol::protected_function_result res = func();
+                    sol::protected_function_result res = hook.func();
                     check_func_result( res );
                 } catch( std::runtime_error &e ) {
                     debugmsg(
@@ -403,11 +439,50 @@ void run_on_every_x_hooks( lua_state &state )
                         to_string( entry.interval ), e.what()
                     );
                 }
+                if( profile ) {
+                    lua_hook_stats &stats = hook_stats[hook.mod];
+                    stats.time += std::chrono::steady_clock::now() - start;
+                    stats.calls++;
+                }
             }
         }
     }
 }
 
+static int gc_step_kb = 0;
+static size_t gc_full_collect_bytes = 0;
+// Raised above the live heap after a full collection, so a heap that really is that large
+// isn't collected in full every turn
+static size_t gc_next_full_collect = 0;
+
+void set_lua_gc_budget( int step_kb, int full_collect_mb )
+{
+    gc_step_kb = step_kb;
+    gc_full_collect_bytes = static_cast<size_t>( full_collect_mb ) * 1024 * 1024;
+    gc_next_full_collect = gc_full_collect_bytes;
+}
+
+void run_lua_gc_step( lua_state &state )
+{
+    lua_State *L = state.lua.lua_state();
+    if( gc_step_kb <= 0 ) {
+        if( !lua_gc( L, LUA_GCISRUNNING, 0 ) ) {
+            lua_gc( L, LUA_GCRESTART, 0 );
+        }
+        return;
+    }
+    if( lua_gc( L, LUA_GCISRUNNING, 0 ) ) {
+        lua_gc( L, LUA_GCSTOP, 0 );
+    }
+    turn_profiler::scoped_phase profile( turn_profiler::phase::lua_gc );
+    if( state.lua.memory_used() > gc_next_full_collect ) {
+        lua_gc( L, LUA_GCCOLLECT, 0 );
+        gc_next_full_collect = std::max( gc_full_collect_bytes, state.lua.memory_used() * 2 );
+    } else {
+        lua_gc( L, LUA_GCSTEP, gc_step_kb );
+    }
+}
+
 } // namespace cata
 
 #endif // LUA
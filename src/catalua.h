@@ -4,7 +4,11 @@
 
 #include "type_id.h"
 
+#include <chrono>
+#include <cstddef>
+#include <map>
 #include <memory>
+#include <string>
 
 class Item_factory;
 class map;
@@ -27,6 +31,8 @@ bool generate_lua_docs();
 void show_lua_console();
 void reload_lua_code();
 void debug_write_lua_backtrace( std::ostream &out );
+/** Bytes used by the Lua heap of the game's Lua state, 0 without Lua. */
+size_t get_lua_memory_usage();
 
 bool save_world_lua_state( const world *world, const std::string &path );
 bool load_world_lua_state( const world *world, const std::string &path );
@@ -42,6 +48,27 @@ void run_mod_main_script( lua_state &state, const mod_id &mod );
 void run_on_game_load_hooks( lua_state &state );
 void run_on_game_save_hooks( lua_state &state );
 void run_on_every_x_hooks( lua_state &state );
+
+/**
+ * Sets how the game's Lua garbage is collected.  With @p step_kb above 0 Lua's own collector
+ * is stopped and @ref run_lua_gc_step does that much collection work once per turn, so
+ * collection doesn't happen in the middle of a hook.  A full collection is done instead
+ * when the heap grows beyond @p full_collect_mb megabytes.  0 leaves it all to Lua.
+ */
+void set_lua_gc_budget( int step_kb, int full_collect_mb );
+/** Does the collection work of one turn, called by the game between turns. */
+void run_lua_gc_step( lua_state &state );
+
+struct lua_hook_stats {
+    std::chrono::nanoseconds time{ 0 };
+    int calls = 0;
+};
+/**
+ * Time spent in the interval hooks of each mod (by id, empty for hooks added from
+ * the console), collected while the turn profiler is enabled.
+ */
+const std::map<std::string, lua_hook_stats> &get_lua_hook_stats();
+void reset_lua_hook_stats();
 void run_on_mapgen_postprocess_hooks( lua_state &state, map &m, const tripoint &p,
                                       const time_point &when );
 void reg_lua_iuse_actors( lua_state &state, Item_factory &ifactory );
@@ -21,6 +21,7 @@
 #include "game.h"
 #include "itype.h"
 #include "map.h"
+#include "map_iterator.h"
 #include "messages.h"
 #include "monfaction.h"
 #include "monster.h"
@@ -375,6 +376,38 @@ void cata::detail::reg_map( sol::state &lua )
             m.furn_set( p, id );
         } );
 
+        DOC( "Terrain of every point in the box, x first, then y, then z. Clipped to map bounds." );
+        luna::set_fx( ut, "get_ter_ids_in_rect", []( const map & m, const tripoint & from,
+        const tripoint & to ) -> std::vector<ter_id> {
+            const tripoint_range<tripoint> area = m.points_in_rectangle( from, to );
+            std::vector<ter_id> ret;
+            ret.reserve( area.size() );
+            for( const tripoint &p : area ) {
+                ret.push_back( m.ter( p ) );
+            }
+            return ret;
+        } );
+        DOC( "Furniture of every point in the box, same order as get_ter_ids_in_rect." );
+        luna::set_fx( ut, "get_furn_ids_in_rect", []( const map & m, const tripoint & from,
+        const tripoint & to ) -> std::vector<furn_id> {
+            const tripoint_range<tripoint> area = m.points_in_rectangle( from, to );
+            std::vector<furn_id> ret;
+            ret.reserve( area.size() );
+            for( const tripoint &p : area ) {
+                ret.push_back( m.furn( p ) );
+            }
+            return ret;
+        } );
+        DOC( "Sets terrain of every point in the box. Returns number of changed points." );
+        luna::set_fx( ut, "set_ter_in_rect", []( map & m, const tripoint & from, const tripoint & to,
+        const ter_id & id ) -> int {
+            int changed = 0;
+            for( const tripoint &p : m.points_in_rectangle( from, to ) ) {
+                changed += m.ter_set( p, id ) ? 1 : 0;
+            }
+            return changed;
+        } );
+
         luna::set_fx( ut, "has_field_at", []( const map & m, const tripoint & p,
         const field_type_id & fid ) -> bool {
             return !!m.field_at( p ).find_field( fid );
@@ -620,14 +653,15 @@ void cata::detail::reg_game_api( sol::state &lua )
     sol::protected_function f ) {
         sol::state_view lua( lua_this );
         std::vector<on_every_x_hooks> &hooks = lua["game"]["cata_internal"]["on_every_x_hooks"];
+        on_every_x_hook hook{ f, lua["game"]["current_mod"].get_or( std::string() ) };
         for( auto &entry : hooks ) {
             if( entry.interval == interval ) {
-                entry.functions.push_back( f );
+                entry.functions.push_back( std::move( hook ) );
                 return;
             }
         }
-        std::vector<sol::protected_function> vec;
-        vec.push_back( f );
+        std::vector<on_every_x_hook> vec;
+        vec.push_back( std::move( hook ) );
         hooks.push_back( on_every_x_hooks{ interval, vec } );
     } );
 
@@ -2,14 +2,23 @@
 #ifndef CATA_SRC_CATALUA_IMPL_H
 #define CATA_SRC_CATALUA_IMPL_H
 
+#include <string>
+#include <vector>
+
 #include "calendar.h"
 #include "catalua_sol.h"
 
 namespace cata
 {
+struct on_every_x_hook {
+    sol::protected_function func;
+    // Mod that was being loaded when the hook was added
+    std::string mod;
+};
+
 struct on_every_x_hooks {
     time_duration interval;
-    std::vector<sol::protected_function> functions;
+    std::vector<on_every_x_hook> functions;
 };
 
 /**
@@ -1,5 +1,8 @@
 #include "cellular_automata.h"
 
+#include <algorithm>
+#include <cstddef>
+
 int CellularAutomata::neighbor_count( const std::vector<std::vector<int>> &cells,
                                       point size,
                                       point p )
@@ -29,47 +32,56 @@ std::vector<std::vector<int>> CellularAutomata::generate_cellular_automaton(
                                const int birth_limit,
                                const int stasis_limit )
 {
-    std::vector<std::vector<int>> current( size.x, std::vector<int>( size.y, 0 ) );
-    std::vector<std::vector<int>> next( size.x, std::vector<int>( size.y, 0 ) );
+    // Flat buffers, cell (i, j) is at i * size.y + j
+    const size_t row_length = std::max( size.y, 0 );
+    const size_t cell_count = std::max( size.x, 0 ) * row_length;
+    std::vector<unsigned char> current( cell_count, 0 );
+    std::vector<unsigned char> next( cell_count, 0 );
+    // Sum of the three rows around the current one, for every column
+    std::vector<int> column_sums( row_length, 0 );
 
     // Initialize our initial set of cells.
-    for( int i = 0; i < size.x; i++ ) {
-        for( int j = 0; j < size.y; j++ ) {
-            current[i][j] = x_in_y( alive, 100 );
-        }
+    for( size_t c = 0; c < cell_count; c++ ) {
+        current[c] = x_in_y( alive, 100 );
     }
 
-    for( int iteration = 0; iteration < iterations; iteration++ ) {
+    for( int iteration = 0; iteration < iterations && row_length > 0; iteration++ ) {
+        // Skip the edges--no need to complicate this with more complex neighbor
+        // calculations, just keep them constant.
         for( int i = 0; i < size.x; i++ ) {
-            for( int j = 0; j < size.y; j++ ) {
-                // Skip the edges--no need to complicate this with more complex neighbor
-                // calculations, just keep them constant.
-                if( i == 0 || i == size.x - 1 || j == 0 || j == size.y - 1 ) {
-                    next[i][j] = 0;
-                    continue;
-                }
-
-                // Count our neighors.
-                const int neighbors = neighbor_count( current, size, point( i, j ) );
+            if( i == 0 || i == size.x - 1 ) {
+                std::fill_n( next.begin() + i * row_length, row_length, 0 );
+            } else {
+                next[i * row_length] = 0;
+                next[i * row_length + row_length - 1] = 0;
+            }
+        }
 
+        for( int i = 1; i < size.x - 1; i++ ) {
+            const unsigned char *above = &current[( i - 1 ) * row_length];
+            const unsigned char *row = &current[i * row_length];
+            const unsigned char *below = &current[( i + 1 ) * row_length];
+            unsigned char *out = &next[i * row_length];
+            for( size_t j = 0; j < row_length; j++ ) {
+                column_sums[j] = above[j] + row[j] + below[j];
+            }
+            for( size_t j = 1; j + 1 < row_length; j++ ) {
+                // Count our neighors, that's the 3x3 block without ourselves.
+                const int neighbors = column_sums[j - 1] + column_sums[j] + column_sums[j + 1] - row[j];
                 // Dead and > birth_limit neighbors, so become alive.
-                if( ( current[i][j] == 0 ) && ( neighbors > birth_limit ) ) {
-                    next[i][j] = 1;
-                }
                 // Alive and > statis_limit neighbors, so stay alive.
-                else if( ( current[i][j] == 1 ) && ( neighbors > stasis_limit ) ) {
-                    next[i][j] = 1;
-                }
                 // Else, die.
-                else {
-                    next[i][j] = 0;
-                }
+                out[j] = neighbors > ( row[j] == 0 ? birth_limit : stasis_limit );
             }
         }
 
-        // Swap our current and next vectors and repeat.
+        // Swap our current and next buffers and repeat.
         std::swap( current, next );
     }
 
-    return current;
+    std::vector<std::vector<int>> result( size.x, std::vector<int>( size.y, 0 ) );
+    for( int i = 0; i < size.x; i++ ) {
+        std::copy_n( current.begin() + i * row_length, row_length, result[i].begin() );
+    }
+    return result;
 }
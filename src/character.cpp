@@ -599,6 +599,7 @@ void Character::move_operator_common( Character &&source ) noexcept
     cached_moves = source.cached_moves ;
     cached_position = source.cached_position ;
     cached_crafting_inventory = std::move( source.cached_crafting_inventory );
+    cached_crafting_map_items = std::move( source.cached_crafting_map_items );
 
     npc_ai_info_cache = source.npc_ai_info_cache ;
 
@@ -2032,8 +2033,8 @@ bionic &Character::get_bionic_state( const bionic_id &id )
 
 bool Character::has_bionic( const bionic_id &b ) const
 {
-    for( const bionic_id &bid : get_bionics() ) {
-        if( bid == b ) {
+    for( const bionic &bio : *my_bionics ) {
+        if( bio.id == b ) {
             return true;
         }
     }
@@ -2525,6 +2526,7 @@ item &Character::i_add( detached_ptr<item> &&it, bool should_stack )
 
     clear_npc_ai_info_cache( npc_ai_info::reloadables );
     clear_npc_ai_info_cache( npc_ai_info::reloadable_cbms );
+    clear_npc_ai_info_cache( npc_ai_info::carried_items );
     return item_in_inv;
 }
 
@@ -3049,13 +3051,17 @@ bool Character::can_pick_weight( const item &it, bool safe ) const
 }
 
 bool Character::can_pick_weight( units::mass weight, bool safe ) const
+{
+    return weight_carried() + weight <= max_pick_weight( safe );
+}
+
+units::mass Character::max_pick_weight( bool safe ) const
 {
     if( !safe ) {
         // Character can carry up to four times their maximum weight
-        return ( weight_carried() + weight <= ( has_trait( trait_DEBUG_STORAGE ) ?
-                                                units::mass_max : weight_capacity() * 4 ) );
+        return has_trait( trait_DEBUG_STORAGE ) ? units::mass_max : weight_capacity() * 4;
     } else {
-        return ( weight_carried() + weight <= weight_capacity() );
+        return weight_capacity();
     }
 }
 
@@ -3590,6 +3596,35 @@ bool Character::has_artifact_with( const art_effect_passive effect ) const
     } );
 }
 
+enum_bitset<art_effect_passive> Character::passive_artifact_effects() const
+{
+    enum_bitset<art_effect_passive> result;
+    for( const item *weapon : wielded_items() ) {
+        if( weapon->type->artifact ) {
+            for( const art_effect_passive effect : weapon->type->artifact->effects_wielded ) {
+                result.set( effect );
+            }
+        }
+    }
+    for( const item *i : worn ) {
+        if( i->type->artifact ) {
+            for( const art_effect_passive effect : i->type->artifact->effects_worn ) {
+                result.set( effect );
+            }
+        }
+    }
+    // Contents are visited too, so there is no need to look into them like has_effect_when_carried
+    visit_items( [&result]( const item * it ) {
+        if( it->type->artifact ) {
+            for( const art_effect_passive effect : it->type->artifact->effects_carried ) {
+                result.set( effect );
+            }
+        }
+        return VisitResponse::NEXT;
+    } );
+    return result;
+}
+
 bool Character::is_wielding( const item &target ) const
 {
     return &primary_weapon() == &target;
@@ -4130,7 +4165,8 @@ bool Character::change_side( item *it, bool interactive )
 static void layer_item( char_encumbrance_data &vals,
                         const item &it,
                         std::map<bodypart_str_id, layer_level> &highest_layer_so_far,
-                        const Character &c )
+                        const Character &c, const units::volume &worn_storage,
+                        const units::volume &inv_volume )
 {
     body_part_set covered_parts = it.get_covered_body_parts();
     for( const bodypart_id bp : c.get_all_body_parts() ) {
@@ -4139,7 +4175,7 @@ static void layer_item( char_encumbrance_data &vals,
         }
 
         const auto item_layer = it.get_layer();
-        int encumber_val = it.get_encumber( c, bp );
+        int encumber_val = it.get_encumber( c, bp, worn_storage, inv_volume );
         // For the purposes of layering penalty, set a min of 2 and a max of 10 per item.
         int layering_encumbrance = std::min( 10, std::max( 2, encumber_val ) );
 
@@ -4370,15 +4406,22 @@ void Character::item_encumb( char_encumbrance_data &vals, const item &new_item )
         highest_layer_so_far[bp.id()] = PERSONAL_LAYER;
     }
 
+    // Same for every worn item and body part, and summing the inventory volume is not cheap
+    units::volume worn_storage( 0_ml );
+    for( const item * const &e : worn ) {
+        worn_storage += e->get_storage();
+    }
+    const units::volume carried = worn_storage != 0_ml ? inv_volume() : 0_ml;
+
     for( auto w_it = worn.begin(); w_it != worn.end(); ++w_it ) {
         if( w_it == new_item_position ) {
-            layer_item( vals, new_item, highest_layer_so_far, *this );
+            layer_item( vals, new_item, highest_layer_so_far, *this, worn_storage, carried );
         }
-        layer_item( vals, **w_it, highest_layer_so_far, *this );
+        layer_item( vals, **w_it, highest_layer_so_far, *this, worn_storage, carried );
     }
 
     if( worn.end() == new_item_position && !new_item.is_null() ) {
-        layer_item( vals, new_item, highest_layer_so_far, *this );
+        layer_item( vals, new_item, highest_layer_so_far, *this, worn_storage, carried );
     }
 
     // make sure values are sane
@@ -4515,11 +4558,11 @@ int Character::get_int_bonus() const
 
 int get_speedydex_bonus( const int dex )
 {
-    static const std::string speedydex_min_dex( "SPEEDYDEX_MIN_DEX" );
-    static const std::string speedydex_dex_speed( "SPEEDYDEX_DEX_SPEED" );
+    static const option_handle<int> speedydex_min_dex( "SPEEDYDEX_MIN_DEX" );
+    static const option_handle<int> speedydex_dex_speed( "SPEEDYDEX_DEX_SPEED" );
     // this is the number to be multiplied by the increment
-    const int modified_dex = std::max( dex - get_option<int>( speedydex_min_dex ), 0 );
-    return modified_dex * get_option<int>( speedydex_dex_speed );
+    const int modified_dex = std::max( dex - speedydex_min_dex.get(), 0 );
+    return modified_dex * speedydex_dex_speed.get();
 }
 
 int Character::get_speed() const
@@ -5147,18 +5190,21 @@ constexpr int metabolic_base_kcals = 2500;
 
 void Character::update_stomach( const time_point &from, const time_point &to )
 {
-    const needs_rates rates = calc_needs_rates();
     // No food/thirst/fatigue clock at all
     const bool debug_ls = has_trait( trait_DEBUG_LS );
     // No food/thirst, capped fatigue clock (only up to tired)
-    const bool npc_no_food = is_npc() && get_option<bool>( "NO_NPC_FOOD" );
+    static const option_handle<bool> no_npc_food( "NO_NPC_FOOD" );
+    const bool npc_no_food = is_npc() && no_npc_food;
     const bool foodless = debug_ls || npc_no_food;
     const bool mouse = has_trait( trait_NO_THIRST );
     const bool mycus = has_trait( trait_M_DEPENDENT );
-    const float kcal_per_time = rates.hunger * metabolic_base_kcals / ( 12.0f * 24.0f );
     const int five_mins = ticks_between( from, to, 5_minutes );
 
+    // Everything below scales with the number of 5 minute ticks.  The avatar gets here
+    // every turn, so only work out the rates on the turns that have a tick.
     if( five_mins > 0 ) {
+        const needs_rates rates = calc_needs_rates();
+        const float kcal_per_time = rates.hunger * metabolic_base_kcals / ( 12.0f * 24.0f );
         // Digest nutrients in stomach
         food_summary digested_to_body = stomach.digest( rates, five_mins );
         // Apply nutrients, unless this is an NPC and NO_NPC_FOOD is enabled.
@@ -5170,10 +5216,9 @@ void Character::update_stomach( const time_point &from, const time_point &to )
             // instead of hunger keeping track of how you're living, burn calories instead
             mod_stored_kcal( -roll_remainder( five_mins * kcal_per_time ) );
         }
-    }
-
-    if( !foodless && rates.thirst > 0.0f ) {
-        mod_thirst( roll_remainder( five_mins * rates.thirst ) );
+        if( !foodless && rates.thirst > 0.0f ) {
+            mod_thirst( roll_remainder( five_mins * rates.thirst ) );
+        }
     }
 
     if( npc_no_food ) {
@@ -5196,7 +5241,8 @@ void Character::update_needs( int rate_multiplier )
     // No food/thirst/fatigue clock at all
     const bool debug_ls = has_trait( trait_DEBUG_LS );
     // No food/thirst, capped fatigue clock (only up to tired)
-    const bool npc_no_food = is_npc() && get_option<bool>( "NO_NPC_FOOD" );
+    static const option_handle<bool> no_npc_food( "NO_NPC_FOOD" );
+    const bool npc_no_food = is_npc() && no_npc_food;
     const bool asleep = !sleep.is_null();
     const bool lying = asleep || has_effect( effect_lying_down ) ||
                        activity->id() == ACT_TRY_SLEEP;
@@ -5317,8 +5363,8 @@ needs_rates Character::calc_needs_rates() const
 
     add_msg_if_player( m_debug, "Metabolic rate: %.2f", rates.hunger );
 
-    static const std::string player_thirst_rate( "PLAYER_THIRST_RATE" );
-    rates.thirst = get_option< float >( player_thirst_rate );
+    static const option_handle<float> player_thirst_rate( "PLAYER_THIRST_RATE" );
+    rates.thirst = player_thirst_rate;
     static const std::string thirst_modifier( "thirst_modifier" );
     rates.thirst *= 1.0f + mutation_value( thirst_modifier ) +
                     bonus_from_enchantments( 1.0, enchant_vals::mod::THIRST );
@@ -5326,8 +5372,8 @@ needs_rates Character::calc_needs_rates() const
         rates.thirst *= 0.7f;
     }
 
-    static const std::string player_fatigue_rate( "PLAYER_FATIGUE_RATE" );
-    rates.fatigue = get_option< float >( player_fatigue_rate );
+    static const option_handle<float> player_fatigue_rate( "PLAYER_FATIGUE_RATE" );
+    rates.fatigue = player_fatigue_rate;
     static const std::string fatigue_modifier( "fatigue_modifier" );
     rates.fatigue *= 1.0f + mutation_value( fatigue_modifier ) +
                      bonus_from_enchantments( 1.0, enchant_vals::mod::FATIGUE );
@@ -7462,9 +7508,9 @@ int Character::get_stamina() const
 
 int Character::get_stamina_max() const
 {
-    static const std::string player_max_stamina( "PLAYER_MAX_STAMINA" );
+    static const option_handle<int> player_max_stamina( "PLAYER_MAX_STAMINA" );
     static const std::string max_stamina_modifier( "max_stamina_modifier" );
-    const int baseMaxStamina = get_option< int >( player_max_stamina );
+    const int baseMaxStamina = player_max_stamina;
     int maxStamina = baseMaxStamina;
     maxStamina *= Character::mutation_value( max_stamina_modifier );
     maxStamina += bonus_from_enchantments( maxStamina, enchant_vals::mod::STAMINA_CAP );
@@ -7537,9 +7583,10 @@ float Character::stamina_move_cost_modifier() const
 
 void Character::update_stamina( int turns )
 {
-    static const std::string player_base_stamina_regen_rate( "PLAYER_BASE_STAMINA_REGEN_RATE" );
+    static const option_handle<float> player_base_stamina_regen_rate(
+        "PLAYER_BASE_STAMINA_REGEN_RATE" );
     static const std::string stamina_regen_modifier( "stamina_regen_modifier" );
-    const float base_regen_rate = get_option<float>( player_base_stamina_regen_rate );
+    const float base_regen_rate = player_base_stamina_regen_rate;
     const int current_stim = get_stim();
     float stamina_recovery = 0.0f;
     // Recover some stamina every turn.
@@ -8239,7 +8286,7 @@ void Character::recalculate_enchantment_cache()
 
     visit_items( [&]( const item * it ) {
         for( const enchantment &ench : it->get_enchantments() ) {
-            if( ench.is_active( *this, *it ) ) {
+            if( ench.is_active_carried( *this, *it ) ) {
                 enchantment_cache->force_add( ench );
             }
         }
@@ -10728,7 +10775,8 @@ bool Character::is_visible_in_range( const Creature &critter, const int range )
 
 std::vector<Creature *> Character::get_visible_creatures( const int range ) const
 {
-    return g->get_creatures_if( [this, range]( const Creature & critter ) -> bool {
+    return g->get_creatures_in_radius( pos(), range, [this,
+    range]( const Creature & critter ) -> bool {
         return this != &critter && pos() != critter.pos() && // TODO: get rid of fake npcs (pos() check)
         rl_dist( pos(), critter.pos() ) <= range && sees( critter );
     } );
@@ -10736,7 +10784,8 @@ std::vector<Creature *> Character::get_visible_creatures( const int range ) cons
 
 std::vector<Creature *> Character::get_hostile_creatures( int range ) const
 {
-    return g->get_creatures_if( [this, range]( const Creature & critter ) -> bool {
+    return g->get_creatures_in_radius( pos(), range, [this,
+    range]( const Creature & critter ) -> bool {
         // Fixes circular distance range for ranged attacks
         float dist_to_creature = std::round( rl_dist_exact( pos(), critter.pos() ) );
         return this != &critter && pos() != critter.pos() && // TODO: get rid of fake npcs (pos() check)
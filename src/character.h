@@ -29,6 +29,7 @@
 #include "creature.h"
 #include "cursesdef.h"
 #include "damage.h"
+#include "enum_bitset.h"
 #include "enums.h"
 #include "enum_int_operators.h"
 #include "flat_set.h"
@@ -65,6 +66,7 @@ class player;
 class player_activity;
 class player_morale;
 class recipe_subset;
+class submap;
 class vehicle;
 class monster;
 class weather_manager;
@@ -104,6 +106,7 @@ enum npc_ai_info : size_t {
     reloadables,
     reloadable_cbms,
     range,
+    carried_items,
     num_npc_ai_info,
 };
 
@@ -1370,6 +1373,8 @@ class Character : public Creature, public location_visitable<Character>
         bool can_pick_volume( units::volume volume ) const;
         bool can_pick_weight( const item &it, bool safe = true ) const;
         bool can_pick_weight( units::mass weight, bool safe = true ) const;
+        /** Most weight that @ref can_pick_weight allows to be carried in total. */
+        units::mass max_pick_weight( bool safe = true ) const;
         /**
          * Checks if character stats and skills meet minimum requirements for the item.
          * Prints an appropriate message if requirements not met.
@@ -1460,6 +1465,11 @@ class Character : public Creature, public location_visitable<Character>
         virtual void drop( const drop_locations &what, const tripoint &target, bool stash = false );
 
         virtual bool has_artifact_with( art_effect_passive effect ) const;
+        /**
+         * All passive effects of wielded, worn and carried artifacts, the same as calling
+         * @ref has_artifact_with for each of them, but going through the items only once.
+         */
+        virtual enum_bitset<art_effect_passive> passive_artifact_effects() const;
 
         bool is_wielding( const item &target ) const;
 
@@ -2280,7 +2290,8 @@ class Character : public Creature, public location_visitable<Character>
         void suffer_mutation_power( const mutation_branch &mdata, char_trait_data &tdata );
         void suffer_while_underwater();
         void suffer_from_addictions();
-        void suffer_while_awake( int current_stim );
+        void suffer_while_awake( int current_stim,
+                                 const enum_bitset<art_effect_passive> &artifacts );
         void suffer_from_chemimbalance();
         void suffer_from_schizophrenia();
         void suffer_from_asthma( int current_stim );
@@ -2290,7 +2301,7 @@ class Character : public Creature, public location_visitable<Character>
         void suffer_from_other_mutations();
         void suffer_from_radiation();
         void suffer_from_bad_bionics();
-        void suffer_from_artifacts();
+        void suffer_from_artifacts( const enum_bitset<art_effect_passive> &artifacts );
         void suffer_from_stimulants( int current_stim );
         void suffer_without_sleep( int sleep_deprivation );
         /**
@@ -2333,6 +2344,20 @@ class Character : public Creature, public location_visitable<Character>
         int cached_moves = 0;
         tripoint cached_position;
         inventory cached_crafting_inventory;
+        /**
+         * The items lying on the map around the last crafting inventory origin.  They are kept
+         * across turns while none of the submaps in range change, so only the tools, vehicles
+         * and the character's own items have to be collected again.
+         */
+        struct crafting_map_items {
+            tripoint abs_origin = tripoint_min;
+            int radius = -1;
+            bool clear_path = false;
+            std::vector<std::pair<const submap *, std::uint64_t>> generations;
+            std::vector<tripoint> points;
+            inventory items;
+        };
+        crafting_map_items cached_crafting_map_items;
 
         mutable std::array<double, npc_ai_info::num_npc_ai_info> npc_ai_info_cache;
 
@@ -1109,9 +1109,9 @@ void search_surroundings( Character &who )
     // Search for traps in a larger area than before because this is the only
     // way we can "find" traps that aren't marked as visible.
     // Detection formula takes care of likelihood of seeing within this range.
-    for( const tripoint &tp : here.points_in_radius( who.pos(), 5 ) ) {
+    for( const tripoint &tp : here.trap_locations_in_radius( who.pos(), 5 ) ) {
         const trap &tr = here.tr_at( tp );
-        if( tr.is_null() || tp == who.pos() ) {
+        if( tp == who.pos() ) {
             continue;
         }
         if( who.has_active_bionic( bio_ground_sonar ) && !who.knows_trap( tp ) &&
@@ -581,6 +581,7 @@ bool zone_manager::has_defined( const zone_type_id &type, const faction_id &fac
 void zone_manager::cache_data()
 {
     area_cache.clear();
+    area_boxes.clear();
 
     for( auto &elem : zones ) {
         if( !elem.get_enabled() ) {
@@ -589,6 +590,7 @@ void zone_manager::cache_data()
 
         const std::string &type_hash = elem.get_type_hash();
         auto &cache = area_cache[type_hash];
+        area_boxes[type_hash].emplace_back( elem.get_start_point(), elem.get_end_point() );
 
         // Draw marked area
         for( const tripoint &p : tripoint_range<tripoint>( elem.get_start_point(),
@@ -601,6 +603,7 @@ void zone_manager::cache_data()
 void zone_manager::cache_vzones()
 {
     vzone_cache.clear();
+    vzone_boxes.clear();
     auto vzones = get_map().get_vehicle_zones( g->get_levz() );
     for( auto elem : vzones ) {
         if( !elem->get_enabled() ) {
@@ -609,6 +612,7 @@ void zone_manager::cache_vzones()
 
         const std::string &type_hash = elem->get_type_hash();
         auto &cache = vzone_cache[type_hash];
+        vzone_boxes[type_hash].emplace_back( elem->get_start_point(), elem->get_end_point() );
 
         // TODO: looks very similar to the above cache_data - maybe merge it?
 
@@ -620,12 +624,14 @@ void zone_manager::cache_vzones()
     }
 }
 
-std::unordered_set<tripoint> zone_manager::get_point_set( const zone_type_id &type,
+static const std::unordered_set<tripoint> no_points;
+
+const std::unordered_set<tripoint> &zone_manager::get_point_set( const zone_type_id &type,
         const faction_id &fac ) const
 {
     const auto &type_iter = area_cache.find( zone_data::make_type_hash( type, fac ) );
     if( type_iter == area_cache.end() ) {
-        return std::unordered_set<tripoint>();
+        return no_points;
     }
 
     return type_iter->second;
@@ -656,18 +662,57 @@ std::unordered_set<tripoint> zone_manager::get_point_set_loot( const tripoint &w
     return res;
 }
 
-std::unordered_set<tripoint> zone_manager::get_vzone_set( const zone_type_id &type,
+const std::unordered_set<tripoint> &zone_manager::get_vzone_set( const zone_type_id &type,
         const faction_id &fac ) const
 {
     //Only regenerate the vehicle zone cache if any vehicles have moved
     const auto &type_iter = vzone_cache.find( zone_data::make_type_hash( type, fac ) );
     if( type_iter == vzone_cache.end() ) {
-        return std::unordered_set<tripoint>();
+        return no_points;
     }
 
     return type_iter->second;
 }
 
+std::vector<const zone_manager::zone_boxes *> zone_manager::get_boxes( const zone_type_id &type,
+        const faction_id &fac ) const
+{
+    std::vector<const zone_boxes *> ret;
+    const std::string type_hash = zone_data::make_type_hash( type, fac );
+    for( const auto *boxes : {
+             &area_boxes, &vzone_boxes
+         } ) {
+        const auto &type_iter = boxes->find( type_hash );
+        if( type_iter != boxes->end() ) {
+            ret.push_back( &type_iter->second );
+        }
+    }
+    return ret;
+}
+
+// Visits the points of the boxes on the z-level of where within range of it.
+// Points covered by several zones are visited once per zone.
+template<typename Visitor>
+static void visit_points_near( const std::vector<inclusive_cuboid<tripoint>> &boxes,
+                               const tripoint &where, int range, Visitor &&visit )
+{
+    for( const inclusive_cuboid<tripoint> &box : boxes ) {
+        if( where.z < box.p_min.z || where.z > box.p_max.z ) {
+            continue;
+        }
+        const tripoint from( std::max( box.p_min.x, where.x - range ),
+                             std::max( box.p_min.y, where.y - range ), where.z );
+        const tripoint to( std::min( box.p_max.x, where.x + range ),
+                           std::min( box.p_max.y, where.y + range ), where.z );
+        if( from.x > to.x || from.y > to.y ) {
+            continue;
+        }
+        for( const tripoint &p : tripoint_range<tripoint>( from, to ) ) {
+            visit( p );
+        }
+    }
+}
+
 bool zone_manager::has( const zone_type_id &type, const tripoint &where,
                         const faction_id &fac ) const
 {
@@ -679,24 +724,16 @@ bool zone_manager::has( const zone_type_id &type, const tripoint &where,
 bool zone_manager::has_near( const zone_type_id &type, const tripoint &where, int range,
                              const faction_id &fac ) const
 {
-    const auto &point_set = get_point_set( type, fac );
-    for( auto &point : point_set ) {
-        if( point.z == where.z ) {
-            if( square_dist( point, where ) <= range ) {
-                return true;
+    for( const zone_boxes *boxes : get_boxes( type, fac ) ) {
+        for( const inclusive_cuboid<tripoint> &box : *boxes ) {
+            if( where.z < box.p_min.z || where.z > box.p_max.z ) {
+                continue;
             }
-        }
-    }
-
-    const auto &vzone_set = get_vzone_set( type, fac );
-    for( auto &point : vzone_set ) {
-        if( point.z == where.z ) {
-            if( square_dist( point, where ) <= range ) {
+            if( square_dist( clamp( where, box ), where ) <= range ) {
                 return true;
             }
         }
     }
-
     return false;
 }
 
@@ -749,36 +786,21 @@ bool zone_manager::custom_loot_has( const tripoint &where, const item *it ) cons
 std::unordered_set<tripoint> zone_manager::get_near( const zone_type_id &type,
         const tripoint &where, int range, const item *it, const faction_id &fac ) const
 {
-    const auto &point_set = get_point_set( type, fac );
     auto near_point_set = std::unordered_set<tripoint>();
 
-    for( auto &point : point_set ) {
-        if( point.z == where.z ) {
-            if( square_dist( point, where ) <= range ) {
-                if( it && has( zone_LOOT_CUSTOM, point ) ) {
-                    if( custom_loot_has( point, it ) ) {
-                        near_point_set.insert( point );
-                    }
-                } else {
-                    near_point_set.insert( point );
-                }
+    for( const zone_boxes *boxes : get_boxes( type, fac ) ) {
+        visit_points_near( *boxes, where, range, [&]( const tripoint & point ) {
+            if( near_point_set.contains( point ) ) {
+                return;
             }
-        }
-    }
-
-    const auto &vzone_set = get_vzone_set( type, fac );
-    for( auto &point : vzone_set ) {
-        if( point.z == where.z ) {
-            if( square_dist( point, where ) <= range ) {
-                if( it && has( zone_LOOT_CUSTOM, point ) ) {
-                    if( custom_loot_has( point, it ) ) {
-                        near_point_set.insert( point );
-                    }
-                } else {
+            if( it && has( zone_LOOT_CUSTOM, point ) ) {
+                if( custom_loot_has( point, it ) ) {
                     near_point_set.insert( point );
                 }
+            } else {
+                near_point_set.insert( point );
             }
-        }
+        } );
     }
 
     return near_point_set;
@@ -793,26 +815,17 @@ std::optional<tripoint> zone_manager::get_nearest( const zone_type_id &type, con
 
     tripoint nearest_pos = tripoint( INT_MIN, INT_MIN, INT_MIN );
     int nearest_dist = range + 1;
-    const std::unordered_set<tripoint> &point_set = get_point_set( type, fac );
-    for( const tripoint &p : point_set ) {
-        int cur_dist = square_dist( p, where );
-        if( cur_dist < nearest_dist ) {
-            nearest_dist = cur_dist;
-            nearest_pos = p;
-            if( nearest_dist == 0 ) {
-                return nearest_pos;
-            }
-        }
-    }
-
-    const std::unordered_set<tripoint> &vzone_set = get_vzone_set( type, fac );
-    for( const tripoint &p : vzone_set ) {
-        int cur_dist = square_dist( p, where );
-        if( cur_dist < nearest_dist ) {
-            nearest_dist = cur_dist;
-            nearest_pos = p;
-            if( nearest_dist == 0 ) {
-                return nearest_pos;
+    for( const zone_boxes *boxes : get_boxes( type, fac ) ) {
+        for( const inclusive_cuboid<tripoint> &box : *boxes ) {
+            // The point of the box closest to where
+            const tripoint p = clamp( where, box );
+            int cur_dist = square_dist( p, where );
+            if( cur_dist < nearest_dist ) {
+                nearest_dist = cur_dist;
+                nearest_pos = p;
+                if( nearest_dist == 0 ) {
+                    return nearest_pos;
+                }
             }
         }
     }
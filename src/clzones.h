@@ -14,6 +14,7 @@
 #include <utility>
 #include <vector>
 
+#include "cuboid_rectangle.h"
 #include "memory_fast.h"
 #include "point.h"
 #include "string_id.h"
@@ -356,10 +357,16 @@ class zone_manager
         std::map<zone_type_id, zone_type> types;
         std::unordered_map<std::string, std::unordered_set<tripoint>> area_cache;
         std::unordered_map<std::string, std::unordered_set<tripoint>> vzone_cache;
-        std::unordered_set<tripoint> get_point_set( const zone_type_id &type,
+        // Areas of the enabled zones of each type, so range queries don't visit every point
+        using zone_boxes = std::vector<inclusive_cuboid<tripoint>>;
+        std::unordered_map<std::string, zone_boxes> area_boxes;
+        std::unordered_map<std::string, zone_boxes> vzone_boxes;
+        const std::unordered_set<tripoint> &get_point_set( const zone_type_id &type,
                 const faction_id &fac = your_fac ) const;
-        std::unordered_set<tripoint> get_vzone_set( const zone_type_id &type,
+        const std::unordered_set<tripoint> &get_vzone_set( const zone_type_id &type,
                 const faction_id &fac = your_fac ) const;
+        std::vector<const zone_boxes *> get_boxes( const zone_type_id &type,
+                const faction_id &fac ) const;
 
         //Cache number of items already checked on each source tile when sorting
         std::unordered_map<tripoint, int> num_processed;
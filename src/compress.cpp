@@ -1,53 +1,192 @@
 #include "compress.h"
 
 #include <zlib.h>
+#include <algorithm>
 #include <vector>
 #include <string>
 #include <stdexcept>
 #include <cstddef>
 
-void zlib_compress( const std::string &input, std::vector<std::byte> &output )
+// Output grows as needed instead of reserving compressBound() of the whole input up front
+static void deflate_into( z_stream &stream, const char *data, size_t size, int flush,
+                          std::vector<std::byte> &output )
 {
-    uLongf compressedSize = compressBound( input.size() );
-    output.resize( compressedSize );
-
-    int result = compress2(
-                     reinterpret_cast<Bytef *>( output.data() ),
-                     &compressedSize,
-                     reinterpret_cast<const Bytef *>( input.data() ),
-                     input.size(),
-                     Z_BEST_SPEED
-                 );
+    stream.next_in = reinterpret_cast<Bytef *>( const_cast<char *>( data ) );
+    stream.avail_in = static_cast<uInt>( size );
+    int result = Z_OK;
+    do {
+        if( stream.total_out == output.size() ) {
+            output.resize( std::max<size_t>( output.size() * 2, 16 * 1024 ) );
+        }
+        stream.next_out = reinterpret_cast<Bytef *>( output.data() + stream.total_out );
+        stream.avail_out = static_cast<uInt>( output.size() - stream.total_out );
+        result = deflate( &stream, flush );
+        if( result == Z_STREAM_ERROR ) {
+            throw std::runtime_error( "Zlib compression error" );
+        }
+    } while( stream.avail_out == 0 || ( flush == Z_FINISH && result != Z_STREAM_END ) );
+}
 
-    if( result != Z_OK ) {
+void zlib_compress( const std::string &input, std::vector<std::byte> &output )
+{
+    z_stream stream{};
+    if( deflateInit( &stream, Z_BEST_SPEED ) != Z_OK ) {
         throw std::runtime_error( "Zlib compression error" );
     }
-
-    output.resize( compressedSize );
+    output.clear();
+    try {
+        deflate_into( stream, input.data(), input.size(), Z_FINISH, output );
+    } catch( ... ) {
+        deflateEnd( &stream );
+        throw;
+    }
+    output.resize( stream.total_out );
+    deflateEnd( &stream );
 }
 
 void zlib_decompress( const void *compressed_data, int compressed_size, std::string &output )
 {
+    z_stream stream{};
+    if( inflateInit( &stream ) != Z_OK ) {
+        throw std::runtime_error( "Zlib decompression failed" );
+    }
+    stream.next_in = reinterpret_cast<Bytef *>( const_cast<void *>( compressed_data ) );
+    stream.avail_in = static_cast<uInt>( compressed_size );
+
     // We need to guess at the decompressed size - we expect things to compress fairly well.
-    uLongf decompressedSize = static_cast<uLongf>( compressed_size ) * 8;
-    output.resize( decompressedSize );
+    // Unlike a one-shot uncompress(), inflating into a growing buffer never has to restart.
+    output.resize( std::max<size_t>( static_cast<size_t>( compressed_size ) * 8, 64 ) );
+    int result = Z_OK;
+    while( result == Z_OK ) {
+        if( stream.total_out == output.size() ) {
+            output.resize( output.size() * 2 );
+        }
+        stream.next_out = reinterpret_cast<Bytef *>( output.data() + stream.total_out );
+        stream.avail_out = static_cast<uInt>( output.size() - stream.total_out );
+        result = inflate( &stream, Z_NO_FLUSH );
+        // Z_BUF_ERROR only means no progress was possible with the space left
+        if( result == Z_BUF_ERROR && stream.avail_out == 0 ) {
+            result = Z_OK;
+        }
+    }
+    const size_t decompressed_size = stream.total_out;
+    inflateEnd( &stream );
+    if( result != Z_STREAM_END ) {
+        throw std::runtime_error( "Zlib decompression failed" );
+    }
 
-    int result;
-    do {
-        result = uncompress(
-                     reinterpret_cast<Bytef *>( output.data() ),
-                     &decompressedSize,
-                     reinterpret_cast<const Bytef *>( compressed_data ),
-                     compressed_size
-                 );
-
-        if( result == Z_BUF_ERROR ) {
-            decompressedSize *= 2; // Double the buffer size and retry
-            output.resize( decompressedSize );
-        } else if( result != Z_OK ) {
-            throw std::runtime_error( "Zlib decompression failed" );
+    output.resize( decompressed_size );
+}
+
+const char *compression_codec_name( compression_codec codec )
+{
+    switch( codec ) {
+        case compression_codec::none:
+            return "";
+        case compression_codec::zlib:
+            return "zlib";
+    }
+    throw std::runtime_error( "Unknown compression codec" );
+}
+
+std::optional<compression_codec> compression_codec_from_name( const std::string &name )
+{
+    for( compression_codec codec : { compression_codec::none, compression_codec::zlib } ) {
+        if( name == compression_codec_name( codec ) ) {
+            return codec;
         }
-    } while( result == Z_BUF_ERROR );
+    }
+    return std::nullopt;
+}
 
-    output.resize( decompressedSize );
-}
\ No newline at end of file
+void compress_blob( compression_codec codec, const std::string &input,
+                    std::vector<std::byte> &output )
+{
+    switch( codec ) {
+        case compression_codec::none:
+            output.assign( reinterpret_cast<const std::byte *>( input.data() ),
+                           reinterpret_cast<const std::byte *>( input.data() ) + input.size() );
+            return;
+        case compression_codec::zlib:
+            zlib_compress( input, output );
+            return;
+    }
+    throw std::runtime_error( "Unknown compression codec" );
+}
+
+void decompress_blob( compression_codec codec, const void *data, int size, std::string &output )
+{
+    switch( codec ) {
+        case compression_codec::none:
+            output.assign( static_cast<const char *>( data ), size );
+            return;
+        case compression_codec::zlib:
+            zlib_decompress( data, size, output );
+            return;
+    }
+    throw std::runtime_error( "Unknown compression codec" );
+}
+
+struct compress_streambuf::zlib_state {
+    z_stream stream{};
+};
+
+compress_streambuf::compress_streambuf( compression_codec codec, std::vector<std::byte> &output )
+    : output( output ), buffer( 64 * 1024 )
+{
+    output.clear();
+    if( codec == compression_codec::zlib ) {
+        zlib = std::make_unique<zlib_state>();
+        if( deflateInit( &zlib->stream, Z_BEST_SPEED ) != Z_OK ) {
+            zlib.reset();
+            throw std::runtime_error( "Zlib compression error" );
+        }
+    }
+    setp( buffer.data(), buffer.data() + buffer.size() );
+}
+
+compress_streambuf::~compress_streambuf()
+{
+    if( zlib ) {
+        deflateEnd( &zlib->stream );
+    }
+}
+
+void compress_streambuf::compress_buffer( bool last )
+{
+    const size_t size = pptr() - pbase();
+    if( zlib ) {
+        deflate_into( zlib->stream, pbase(), size, last ? Z_FINISH : Z_NO_FLUSH, output );
+        if( last ) {
+            output.resize( zlib->stream.total_out );
+        }
+    } else {
+        const std::byte *data = reinterpret_cast<const std::byte *>( pbase() );
+        output.insert( output.end(), data, data + size );
+    }
+    setp( buffer.data(), buffer.data() + buffer.size() );
+}
+
+compress_streambuf::int_type compress_streambuf::overflow( int_type ch )
+{
+    // The stream swallows exceptions from here, finish() reports them instead
+    try {
+        compress_buffer( false );
+    } catch( const std::exception & ) {
+        failed = true;
+        return traits_type::eof();
+    }
+    if( !traits_type::eq_int_type( ch, traits_type::eof() ) ) {
+        *pptr() = traits_type::to_char_type( ch );
+        pbump( 1 );
+    }
+    return traits_type::not_eof( ch );
+}
+
+void compress_streambuf::finish()
+{
+    if( failed ) {
+        throw std::runtime_error( "Compression error" );
+    }
+    compress_buffer( true );
+}
@@ -2,11 +2,62 @@
 #ifndef CATA_SRC_COMPRESS_H
 #define CATA_SRC_COMPRESS_H
 
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <streambuf>
 #include <string>
+#include <vector>
 
 #include "fstream_utils.h"
 
 void zlib_compress( const std::string &input, std::vector<std::byte> &output );
 void zlib_decompress( const void *compressed_data, int compressed_size, std::string &output );
 
+/** Codec a saved blob was written with.  Stored alongside each blob, so codecs can be mixed. */
+enum class compression_codec : std::uint8_t {
+    none,
+    zlib,
+};
+
+/** Name of @p codec as stored with the blob, e.g. in the world database. */
+const char *compression_codec_name( compression_codec codec );
+/** Inverse of @ref compression_codec_name.  Empty names are uncompressed legacy blobs. */
+std::optional<compression_codec> compression_codec_from_name( const std::string &name );
+
+void compress_blob( compression_codec codec, const std::string &input,
+                    std::vector<std::byte> &output );
+/** Throws if the blob is corrupt. */
+void decompress_blob( compression_codec codec, const void *data, int size, std::string &output );
+
+/**
+ * Stream buffer that compresses what is written to it into a blob, one chunk at a time, so
+ * a large save never has to be held in memory uncompressed.  The blob is complete once
+ * @ref finish was called.
+ */
+class compress_streambuf : public std::streambuf
+{
+    public:
+        compress_streambuf( compression_codec codec, std::vector<std::byte> &output );
+        compress_streambuf( const compress_streambuf & ) = delete;
+        compress_streambuf &operator=( const compress_streambuf & ) = delete;
+        ~compress_streambuf() override;
+
+        /** Compresses the rest of the data and ends the blob.  Throws on compression errors. */
+        void finish();
+
+    protected:
+        int_type overflow( int_type ch ) override;
+
+    private:
+        struct zlib_state;
+
+        void compress_buffer( bool last );
+
+        std::vector<std::byte> &output;
+        std::vector<char> buffer;
+        std::unique_ptr<zlib_state> zlib;
+        bool failed = false;
+};
+
 #endif // CATA_SRC_COMPRESS_H
@@ -5,6 +5,7 @@
 #include <array>
 #include <cstddef>
 #include <iterator>
+#include <map>
 #include <memory>
 #include <numeric>
 #include <utility>
@@ -139,6 +140,8 @@ namespace
 {
 generic_factory<construction> all_constructions( "construction" );
 std::vector<construction_id> constructions_sorted;
+// Same order as constructions_sorted within each group
+std::map<construction_group_str_id, std::vector<const construction *>> constructions_grouped;
 } // namespace
 
 IMPLEMENT_STRING_AND_INT_IDS( construction, all_constructions )
@@ -193,6 +196,7 @@ void reset()
 {
     all_constructions.reset();
     constructions_sorted.clear();
+    constructions_grouped.clear();
 }
 
 void check_consistency()
@@ -232,7 +236,8 @@ void finalize()
         inp_mngr.pump_events();
     }
 
-    constructions_sorted.resize( all_constructions.get_all().size() );
+    constructions_sorted.clear();
+    constructions_sorted.reserve( all_constructions.get_all().size() );
     for( const construction &c : all_constructions.get_all() ) {
         if( c.is_blacklisted() ) {
             continue;
@@ -244,6 +249,11 @@ void finalize()
         lexicographic<construction> cmp;
         return cmp( l->id, r->id );
     } );
+
+    constructions_grouped.clear();
+    for( const construction_id &c : constructions_sorted ) {
+        constructions_grouped[c->group].push_back( &*c );
+    }
 }
 
 const std::vector<construction_id> &get_all_sorted()
@@ -265,20 +275,16 @@ void override_build_times( time_duration time )
 
 } // namespace constructions
 
-static std::vector<const construction *> constructions_by_group( const construction_group_str_id
-        &group )
+static const std::vector<const construction *> &constructions_by_group(
+    const construction_group_str_id &group )
 {
+    static const std::vector<const construction *> none;
     if( !all_constructions.is_finalized() ) {
         debugmsg( "constructions_by_group called before finalization" );
-        return {};
-    }
-    std::vector<const construction *> result;
-    for( const construction_id &c : constructions::get_all_sorted() ) {
-        if( c->group == group ) {
-            result.push_back( &*c );
-        }
+        return none;
     }
-    return result;
+    const auto iter = constructions_grouped.find( group );
+    return iter == constructions_grouped.end() ? none : iter->second;
 }
 
 static void sort_constructions_by_name( std::vector<construction_group_str_id> &list )
@@ -351,7 +357,7 @@ static nc_color construction_color( const construction_group_str_id &group, bool
         col = c_white;
     } else if( can_construct( group ) ) {
         const construction *con_first = nullptr;
-        std::vector<const construction *> cons = constructions_by_group( group );
+        const std::vector<const construction *> &cons = constructions_by_group( group );
         const inventory &total_inv = player_character.crafting_inventory();
         for( const construction *con : cons ) {
             if( con->requirements->can_make_with_inventory( total_inv, is_crafting_component ) ) {
@@ -475,7 +481,8 @@ std::optional<construction_id> construction_menu( const bool blueprint )
             //construct the project list buffer
 
             // Print stages and their requirement.
-            std::vector<const construction *> options = constructions_by_group( current_group );
+            const std::vector<const construction *> &options =
+                constructions_by_group( current_group );
 
             construct_buffers.clear();
             current_construct_breakpoint = 0;
@@ -928,7 +935,7 @@ std::optional<construction_id> construction_menu( const bool blueprint )
 bool player_can_build( Character &ch, const inventory &inv, const construction_group_str_id &group )
 {
     // check all with the same group to see if player can build any
-    std::vector<const construction *> cons = constructions_by_group( group );
+    const std::vector<const construction *> &cons = constructions_by_group( group );
     for( const construction *con : cons ) {
         if( player_can_build( ch, inv, *con ) ) {
             return true;
@@ -955,7 +962,7 @@ bool player_can_see_to_build( Character &ch, const construction_group_str_id &gr
     if( character_funcs::can_see_fine_details( ch ) || ch.has_trait( trait_DEBUG_HS ) ) {
         return true;
     }
-    std::vector<const construction *> cons = constructions_by_group( group );
+    const std::vector<const construction *> &cons = constructions_by_group( group );
     for( const construction *con : cons ) {
         if( con->dark_craftable ) {
             return true;
@@ -967,7 +974,7 @@ bool player_can_see_to_build( Character &ch, const construction_group_str_id &gr
 bool can_construct( const construction_group_str_id &group )
 {
     // check all with the same group to see if player can build any
-    std::vector<const construction *> cons = constructions_by_group( group );
+    const std::vector<const construction *> &cons = constructions_by_group( group );
     for( const construction *con : cons ) {
         if( can_construct( *con ) ) {
             return true;
@@ -979,12 +986,12 @@ bool can_construct( const construction_group_str_id &group )
 bool can_construct( const construction &con, const tripoint &p )
 {
     const map &here = get_map();
-    // see if the special pre-function checks out
-    bool place_okay = con.pre_special( p );
-    // see if the terrain type checks out
-    place_okay &= has_pre_terrain( con, p );
+    // Cheapest and most selective check first, most constructions need a specific terrain
+    if( !has_pre_terrain( con, p ) ) {
+        return false;
+    }
     // see if the (deny) flags check out
-    place_okay &= std::none_of( con.deny_flags.begin(), con.deny_flags.end(),
+    bool place_okay = std::none_of( con.deny_flags.begin(), con.deny_flags.end(),
     [&p, &here]( const std::string & flag ) -> bool {
         const furn_id &furn = here.furn( p );
         const ter_id &ter = here.ter( p );
@@ -1004,7 +1011,8 @@ bool can_construct( const construction &con, const tripoint &p )
     if( !con.post_furniture.is_empty() ) {
         place_okay &= here.furn( p ) != con.post_furniture;
     }
-    return place_okay;
+    // see if the special pre-function checks out
+    return place_okay && con.pre_special( p );
 }
 
 bool can_construct( const construction &con )
@@ -1021,7 +1029,7 @@ void place_construction( const construction_group_str_id &group )
 {
     const inventory &total_inv = g->u.crafting_inventory();
 
-    std::vector<const construction *> cons = constructions_by_group( group );
+    const std::vector<const construction *> &cons = constructions_by_group( group );
     std::map<tripoint, const construction *> valid;
     map &here = get_map();
     for( const tripoint &p : here.points_in_radius( g->u.pos(), 1 ) ) {
@@ -11,7 +11,7 @@
 #include <optional>
 #include <string>
 #include <tuple>
-#include <type_id.h>
+#include "type_id.h"
 
 #include "activity_handlers.h"
 #include "addiction.h"
@@ -557,7 +557,35 @@ const inventory &Character::crafting_inventory( const tripoint &src_pos, int rad
         && cached_position == inv_pos ) {
         return cached_crafting_inventory;
     }
-    cached_crafting_inventory.form_from_map( inv_pos, radius, this, false, clear_path );
+    map &here = get_map();
+    crafting_map_items &map_items = cached_crafting_map_items;
+    const tripoint corner( radius, radius, 0 );
+    // Vehicles move, change where the flood fill can go and carry items that don't belong
+    // to any submap in range, so nothing is kept while one is nearby
+    const bool vehicles_in_range = !here.get_vehicles( inv_pos - corner, inv_pos + corner ).empty();
+    if( vehicles_in_range ||
+        map_items.abs_origin != here.getabs( inv_pos ) || map_items.radius != radius ||
+        map_items.clear_path != clear_path ||
+        map_items.generations != here.submap_generations( inv_pos - corner, inv_pos + corner ) ) {
+        map_items.points = inventory::points_in_range( here, inv_pos, radius, clear_path );
+        map_items.items.clear();
+        map_items.items.build_items_type_cache();
+        map_items.items.add_map_items( here, map_items.points, this, false );
+    }
+    // Copied stacks, the type cache has to point into the new ones
+    cached_crafting_inventory = map_items.items;
+    cached_crafting_inventory.build_items_type_cache();
+    cached_crafting_inventory.add_map_tools( here, map_items.points );
+    if( vehicles_in_range ) {
+        map_items.abs_origin = tripoint_min;
+    } else {
+        // Taken last, looking at map items counts as a change
+        map_items.abs_origin = here.getabs( inv_pos );
+        map_items.radius = radius;
+        map_items.clear_path = clear_path;
+        map_items.generations = here.submap_generations( inv_pos - corner, inv_pos + corner );
+    }
+
     cached_crafting_inventory += inv;
     cached_crafting_inventory += primary_weapon();
     cached_crafting_inventory += worn;
@@ -9,6 +9,7 @@
 #include <optional>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -21,6 +22,7 @@
 #include "crafting.h"
 #include "cursesdef.h"
 #include "game.h"
+#include "hash_utils.h"
 #include "input.h"
 #include "inventory.h"
 #include "item.h"
@@ -43,6 +45,10 @@
 #include "ui_manager.h"
 #include "uistate.h"
 
+static const itype_id itype_UPS( "UPS" );
+
+static const trait_id trait_DEBUG_HS( "DEBUG_HS" );
+
 static const std::string flag_BLIND_EASY( "BLIND_EASY" );
 static const std::string flag_BLIND_HARD( "BLIND_HARD" );
 
@@ -128,29 +134,191 @@ static void translate_all()
     }
 }
 
-void reset_recipe_categories()
-{
-    craft_cat_list.clear();
-    craft_subcat_list.clear();
-}
-
 namespace
 {
-struct availability {
-    explicit availability( const recipe *r, int batch_size, bool known ) {
-        this->known = known;
+// The part of @ref availability that only depends on the crafting inventory
+struct requirement_checks {
+    requirement_checks( const recipe &r, int batch_size ) {
         const inventory &inv = get_avatar().crafting_inventory();
-        auto all_items_filter = r->get_component_filter( recipe_filter_flags::none );
-        auto no_rotten_filter = r->get_component_filter( recipe_filter_flags::no_rotten );
-        const deduped_requirement_data &req = r->deduped_requirements();
+        auto all_items_filter = r.get_component_filter( recipe_filter_flags::none );
+        auto no_rotten_filter = r.get_component_filter( recipe_filter_flags::no_rotten );
+        const deduped_requirement_data &req = r.deduped_requirements();
         could_craft_if_knew = req.can_make_with_inventory(
                                   inv, all_items_filter, batch_size, cost_adjustment::start_only );
-        can_craft = known && could_craft_if_knew;
         can_craft_non_rotten = req.can_make_with_inventory(
                                    inv, no_rotten_filter, batch_size, cost_adjustment::start_only );
-        const requirement_data &simple_req = r->simple_requirements();
+        const requirement_data &simple_req = r.simple_requirements();
         apparently_craftable = simple_req.can_make_with_inventory(
                                    inv, all_items_filter, batch_size, cost_adjustment::start_only );
+    }
+    bool could_craft_if_knew;
+    bool can_craft_non_rotten;
+    bool apparently_craftable;
+};
+
+/**
+ * Requirement checks of single crafts, kept between openings of the crafting menu.
+ *
+ * Each opening compares a summary of the crafting inventory with the one of the previous
+ * opening: a hash of the relevant state of all items of each type, the quality totals and
+ * the UPS charges.  Only the recipes depending on something that changed are checked again,
+ * they are found through an index from item types and qualities to the recipes using them.
+ */
+class requirement_memo
+{
+    public:
+        void update( const inventory &crafting_inv );
+        const requirement_checks &get( const recipe &r );
+        void reset() {
+            *this = requirement_memo();
+        }
+
+    private:
+        void index( const recipe &r );
+        void drop_users( const std::vector<const recipe *> &users );
+
+        std::unordered_map<itype_id, std::size_t> type_hashes;
+        std::map<quality_id, std::map<int, int>> qualities;
+        int ups_charges = 0;
+        bool debug_hammerspace = false;
+
+        std::unordered_map<const recipe *, requirement_checks> checks;
+        std::set<const recipe *> indexed;
+        std::unordered_map<itype_id, std::vector<const recipe *>> type_users;
+        std::unordered_map<quality_id, std::vector<const recipe *>> quality_users;
+        std::vector<const recipe *> charge_users;
+};
+
+requirement_memo &get_requirement_memo()
+{
+    static requirement_memo memo;
+    return memo;
+}
+
+void requirement_memo::index( const recipe &r )
+{
+    if( !indexed.insert( &r ).second ) {
+        return;
+    }
+    std::set<itype_id> types;
+    std::set<quality_id> quals;
+    bool uses_charges = false;
+    const auto add_requirements = [&]( const requirement_data & req ) {
+        for( const std::vector<item_comp> &alts : req.get_components() ) {
+            for( const item_comp &c : alts ) {
+                types.insert( c.type );
+            }
+        }
+        for( const std::vector<tool_comp> &alts : req.get_tools() ) {
+            for( const tool_comp &t : alts ) {
+                types.insert( t.type );
+                uses_charges = uses_charges || t.by_charges();
+            }
+        }
+        for( const std::vector<quality_requirement> &alts : req.get_qualities() ) {
+            for( const quality_requirement &q : alts ) {
+                quals.insert( q.type );
+            }
+        }
+    };
+    add_requirements( r.simple_requirements() );
+    for( const requirement_data &alt : r.deduped_requirements().alternatives() ) {
+        add_requirements( alt );
+    }
+    for( const itype_id &t : types ) {
+        type_users[t].push_back( &r );
+    }
+    for( const quality_id &q : quals ) {
+        quality_users[q].push_back( &r );
+    }
+    if( uses_charges ) {
+        charge_users.push_back( &r );
+    }
+}
+
+void requirement_memo::drop_users( const std::vector<const recipe *> &users )
+{
+    for( const recipe *r : users ) {
+        checks.erase( r );
+    }
+}
+
+void requirement_memo::update( const inventory &crafting_inv )
+{
+    // Everything the component filters and the requirement checks look at
+    std::unordered_map<itype_id, std::size_t> new_hashes;
+    crafting_inv.visit_items( [&new_hashes]( const item * e ) {
+        std::size_t h = 0;
+        cata::hash_combine( h, e->charges );
+        cata::hash_combine( h, e->ammo_remaining() );
+        cata::hash_combine( h, e->damage() );
+        cata::hash_combine( h, e->rotten() );
+        cata::hash_combine( h, e->is_filthy() );
+        cata::hash_combine( h, e->contents.num_item_stacks() );
+        // Summed, so the order of the items doesn't matter
+        new_hashes[e->typeId()] += h * 0x9e3779b97f4a7c15ULL + 1;
+        return VisitResponse::NEXT;
+    } );
+    const bool new_debug_hammerspace = get_avatar().has_trait( trait_DEBUG_HS );
+    if( new_debug_hammerspace != debug_hammerspace ) {
+        checks.clear();
+        debug_hammerspace = new_debug_hammerspace;
+    }
+
+    for( const auto &e : new_hashes ) {
+        auto old = type_hashes.find( e.first );
+        if( old == type_hashes.end() || old->second != e.second ) {
+            drop_users( type_users[e.first] );
+        }
+    }
+    for( const auto &e : type_hashes ) {
+        if( !new_hashes.contains( e.first ) ) {
+            drop_users( type_users[e.first] );
+        }
+    }
+    type_hashes = std::move( new_hashes );
+
+    const std::map<quality_id, std::map<int, int>> &new_qualities = crafting_inv.get_quality_cache();
+    for( const auto &e : new_qualities ) {
+        auto old = qualities.find( e.first );
+        if( old == qualities.end() || old->second != e.second ) {
+            drop_users( quality_users[e.first] );
+        }
+    }
+    for( const auto &e : qualities ) {
+        if( !new_qualities.contains( e.first ) ) {
+            drop_users( quality_users[e.first] );
+        }
+    }
+    qualities = new_qualities;
+
+    // Tools using UPS charges can draw on UPS of any type
+    const int new_ups_charges = crafting_inv.charges_of( itype_UPS );
+    if( new_ups_charges != ups_charges ) {
+        drop_users( charge_users );
+        ups_charges = new_ups_charges;
+    }
+}
+
+const requirement_checks &requirement_memo::get( const recipe &r )
+{
+    auto iter = checks.find( &r );
+    if( iter == checks.end() ) {
+        index( r );
+        iter = checks.emplace( &r, requirement_checks( r, 1 ) ).first;
+    }
+    return iter->second;
+}
+
+struct availability {
+    explicit availability( const recipe *r, int batch_size, bool known ) {
+        this->known = known;
+        const requirement_checks reqs = batch_size == 1 ? get_requirement_memo().get( *r ) :
+                                        requirement_checks( *r, batch_size );
+        could_craft_if_knew = reqs.could_craft_if_knew;
+        can_craft = known && could_craft_if_knew;
+        can_craft_non_rotten = reqs.can_craft_non_rotten;
+        apparently_craftable = reqs.apparently_craftable;
         has_all_skills = r->skill_used.is_null() ||
                          get_player_character().get_skill_level( r->skill_used ) >= r->difficulty;
         for( const std::pair<const skill_id, int> &e : r->required_skills ) {
@@ -183,6 +351,13 @@ struct availability {
 };
 } // namespace
 
+void reset_recipe_categories()
+{
+    craft_cat_list.clear();
+    craft_subcat_list.clear();
+    get_requirement_memo().reset();
+}
+
 static std::vector<std::string> recipe_info(
     const recipe &recp,
     const availability &avail,
@@ -483,6 +658,7 @@ const recipe *select_crafting_recipe( int &batch_size_out )
     std::string filterstring;
 
     const auto &available_recipes = u.get_available_recipes( crafting_inv, &helpers );
+    get_requirement_memo().update( crafting_inv );
     std::unordered_map<const recipe *, availability> availability_cache( available_recipes.size() );
 
     std::vector<const recipe *> all_recipes_flat;
@@ -53,6 +53,8 @@ extern "C" {
 #if defined(_WIN32)
         dump_to( ".core" );
 #endif
+        // Whatever was logged right before the crash is the most interesting part
+        debug_flush_log();
         const std::string crash_log_file = PATH_INFO::crash();
         std::ostringstream log_text;
 #if defined(__ANDROID__)
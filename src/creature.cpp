@@ -306,6 +306,10 @@ bool Creature::sees( const Creature &critter ) const
                     std::abs( posz() - critter.posz() ) <= 1 ) ) ) {
         return false;
     }
+    if( critter.is_npc() && posz() == critter.posz() ) {
+        // There are few NPCs and many monsters looking at them
+        here.share_fov( critter.pos() );
+    }
     if( ch != nullptr ) {
         if( ch->movement_mode_is( CMM_CROUCH ) ) {
             const int coverage = here.obstacle_coverage( pos(), critter.pos() );
@@ -376,7 +380,7 @@ bool Creature::sees( const tripoint &t, bool is_avatar, int range_mod ) const
             return adj_range >= wanted_range &&
                    here.get_cache_ref( pos().z ).seen_cache[pos().x][pos().y] > LIGHT_TRANSPARENCY_SOLID;
         } else {
-            return here.sees( pos(), t, range );
+            return here.sees_shared( pos(), t, range );
         }
     } else {
         return false;
@@ -435,6 +439,11 @@ Creature *Creature::auto_find_hostile_target( int range, int &boo_hoo, int area
     }
 
     std::vector<Creature *> targets = g->get_creatures_if( [&]( const Creature & critter ) {
+        // Too near or too far, checked first so that line of sight is only looked up in range
+        const int dist = rl_dist( pos(), critter.pos() ) + 1; // rl_dist can be 0
+        if( dist > range + 1 || dist < area ) {
+            return false;
+        }
         if( critter.is_monster() ) {
             // friendly to the player, not a target for us
             return static_cast<const monster *>( &critter )->friendly == 0;
@@ -481,10 +490,6 @@ Creature *Creature::auto_find_hostile_target( int range, int &boo_hoo, int area
             }
         }
         int dist = rl_dist( pos(), m->pos() ) + 1; // rl_dist can be 0
-        if( dist > range + 1 || dist < area ) {
-            // Too near or too far
-            continue;
-        }
         // Prioritize big, armed and hostile stuff
         float mon_rating = m->power_rating();
         float target_rating = mon_rating / dist;
@@ -7,6 +7,7 @@
 #include <utility>
 
 #include "debug.h"
+#include "game_constants.h"
 #include "mongroup.h"
 #include "monster.h"
 #include "mtype.h"
@@ -32,20 +33,41 @@ shared_ptr_fast<monster> Creature_tracker::find( const tripoint &pos ) const
     return nullptr;
 }
 
+void Creature_tracker::compact() const
+{
+    if( removed_slots == 0 ) {
+        return;
+    }
+    monsters_list.erase( std::remove( monsters_list.begin(), monsters_list.end(), nullptr ),
+                         monsters_list.end() );
+    for( size_t i = 0; i < monsters_list.size(); i++ ) {
+        monster_slots[monsters_list[i].get()] = i;
+    }
+    removed_slots = 0;
+}
+
+shared_ptr_fast<monster> *Creature_tracker::find_entry( const monster &critter )
+{
+    const auto iter = monster_slots.find( &critter );
+    if( iter == monster_slots.end() ) {
+        return nullptr;
+    }
+    return &monsters_list[iter->second];
+}
+
 int Creature_tracker::temporary_id( const monster &critter ) const
 {
-    const auto iter = std::find_if( monsters_list.begin(), monsters_list.end(),
-    [&]( const shared_ptr_fast<monster> &ptr ) {
-        return ptr.get() == &critter;
-    } );
-    if( iter == monsters_list.end() ) {
+    compact();
+    const auto iter = monster_slots.find( &critter );
+    if( iter == monster_slots.end() ) {
         return -1;
     }
-    return iter - monsters_list.begin();
+    return static_cast<int>( iter->second );
 }
 
 shared_ptr_fast<monster> Creature_tracker::from_temporary_id( const int id )
 {
+    compact();
     if( static_cast<size_t>( id ) < monsters_list.size() ) {
         return monsters_list[id];
     } else {
@@ -85,8 +107,9 @@ bool Creature_tracker::add( const shared_ptr_fast<monster> &critter_ptr )
         return false;
     }
 
+    monster_slots[critter_ptr.get()] = monsters_list.size();
     monsters_list.emplace_back( critter_ptr );
-    monsters_by_location[critter.pos()] = critter_ptr;
+    set_location( critter.pos(), critter_ptr );
     add_to_faction_map( critter_ptr );
     return true;
 }
@@ -108,11 +131,8 @@ void Creature_tracker::add_to_faction_map( const shared_ptr_fast<monster> &critt
 void Creature_tracker::update_faction( const monster &critter )
 {
     // find critter in monsters_list and obtain shared_ptr
-    const auto critter_ptr = std::find_if( monsters_list.begin(), monsters_list.end(),
-    [&]( const shared_ptr_fast<monster> &ptr ) {
-        return ptr.get() == &critter;
-    } );
-    if( critter_ptr == monsters_list.end() ) {
+    const shared_ptr_fast<monster> *critter_ptr = find_entry( critter );
+    if( critter_ptr == nullptr ) {
         debugmsg( "Tried to update faction for invalid monster %s", critter.name() );
         return;
     }
@@ -135,7 +155,7 @@ void Creature_tracker::update_faction( const monster &critter )
 
 size_t Creature_tracker::size() const
 {
-    return monsters_list.size();
+    return monsters_list.size() - removed_slots;
 }
 
 bool Creature_tracker::update_pos( const monster &critter, const tripoint &new_pos )
@@ -159,13 +179,12 @@ bool Creature_tracker::update_pos( const monster &critter, const tripoint &new_p
         }
     }
 
-    const auto iter = std::find_if( monsters_list.begin(), monsters_list.end(),
-    [&]( const shared_ptr_fast<monster> &ptr ) {
-        return ptr.get() == &critter;
-    } );
-    if( iter != monsters_list.end() ) {
-        monsters_by_location.erase( critter.pos() );
-        monsters_by_location[new_pos] = *iter;
+    if( const shared_ptr_fast<monster> *entry = find_entry( critter ) ) {
+        const auto old_iter = monsters_by_location.find( critter.pos() );
+        if( old_iter != monsters_by_location.end() ) {
+            erase_location( old_iter );
+        }
+        set_location( new_pos, *entry );
         return true;
     } else {
         const tripoint &old_pos = critter.pos();
@@ -180,11 +199,110 @@ bool Creature_tracker::update_pos( const monster &critter, const tripoint &new_p
     }
 }
 
+tripoint Creature_tracker::bucket_of( const tripoint &pos )
+{
+    return tripoint( divide_round_to_minus_infinity( pos.x, SEEX ), divide_round_to_minus_infinity( pos.y, SEEY ), pos.z );
+}
+
+void Creature_tracker::set_location( const tripoint &pos, const shared_ptr_fast<monster> &critter )
+{
+    shared_ptr_fast<monster> &entry = monsters_by_location[pos];
+    if( entry ) {
+        remove_from_bucket( pos, entry.get() );
+    }
+    entry = critter;
+    monsters_by_bucket[bucket_of( pos )].push_back( critter.get() );
+}
+
+void Creature_tracker::erase_location(
+    std::unordered_map<tripoint, shared_ptr_fast<monster>>::iterator iter )
+{
+    remove_from_bucket( iter->first, iter->second.get() );
+    monsters_by_location.erase( iter );
+}
+
+void Creature_tracker::remove_from_bucket( const tripoint &pos, const monster *critter )
+{
+    const auto bucket_iter = monsters_by_bucket.find( bucket_of( pos ) );
+    if( bucket_iter == monsters_by_bucket.end() ) {
+        return;
+    }
+    std::vector<monster *> &bucket = bucket_iter->second;
+    const auto iter = std::find( bucket.begin(), bucket.end(), critter );
+    if( iter != bucket.end() ) {
+        *iter = bucket.back();
+        bucket.pop_back();
+    }
+    if( bucket.empty() ) {
+        monsters_by_bucket.erase( bucket_iter );
+    }
+}
+
+void Creature_tracker::clear_locations()
+{
+    monsters_by_location.clear();
+    monsters_by_bucket.clear();
+}
+
+std::vector<monster *> Creature_tracker::find_in_rectangle( const tripoint &min,
+        const tripoint &max ) const
+{
+    std::vector<monster *> result;
+    const auto add_matches = [&]( const std::vector<monster *> &bucket ) {
+        for( monster *critter : bucket ) {
+            const tripoint &p = critter->pos();
+            if( !critter->is_dead() && p.x >= min.x && p.x <= max.x && p.y >= min.y && p.y <= max.y &&
+                p.z >= min.z && p.z <= max.z ) {
+                result.push_back( critter );
+            }
+        }
+    };
+
+    const tripoint bucket_min = bucket_of( min );
+    const tripoint bucket_max = bucket_of( max );
+    const tripoint extent = bucket_max - bucket_min + tripoint( 1, 1, 1 );
+    if( extent.x <= 0 || extent.y <= 0 || extent.z <= 0 ) {
+        return result;
+    }
+    // For huge boxes looking at every occupied bucket is cheaper than probing all of them
+    if( static_cast<size_t>( extent.x ) * extent.y * extent.z > monsters_by_bucket.size() ) {
+        for( const auto &bucket : monsters_by_bucket ) {
+            const tripoint &b = bucket.first;
+            if( b.x >= bucket_min.x && b.x <= bucket_max.x && b.y >= bucket_min.y &&
+                b.y <= bucket_max.y && b.z >= bucket_min.z && b.z <= bucket_max.z ) {
+                add_matches( bucket.second );
+            }
+        }
+        return result;
+    }
+    for( int z = bucket_min.z; z <= bucket_max.z; z++ ) {
+        for( int y = bucket_min.y; y <= bucket_max.y; y++ ) {
+            for( int x = bucket_min.x; x <= bucket_max.x; x++ ) {
+                const auto iter = monsters_by_bucket.find( tripoint( x, y, z ) );
+                if( iter != monsters_by_bucket.end() ) {
+                    add_matches( iter->second );
+                }
+            }
+        }
+    }
+    return result;
+}
+
+std::vector<monster *> Creature_tracker::find_in_radius( const tripoint &center, int radius ) const
+{
+    const tripoint offset( radius, radius, radius );
+    tripoint min = center - offset;
+    tripoint max = center + offset;
+    min.z = std::max( min.z, -OVERMAP_DEPTH );
+    max.z = std::min( max.z, OVERMAP_HEIGHT );
+    return find_in_rectangle( min, max );
+}
+
 void Creature_tracker::remove_from_location_map( const monster &critter )
 {
     const auto pos_iter = monsters_by_location.find( critter.pos() );
     if( pos_iter != monsters_by_location.end() && pos_iter->second.get() == &critter ) {
-        monsters_by_location.erase( pos_iter );
+        erase_location( pos_iter );
         return;
     }
 
@@ -195,23 +313,20 @@ void Creature_tracker::remove_from_location_map( const monster &critter )
         return v.second.get() == &critter;
     } );
     if( iter != monsters_by_location.end() ) {
-        monsters_by_location.erase( iter );
+        erase_location( iter );
     }
 }
 
 void Creature_tracker::remove( const monster &critter )
 {
-    const auto iter = std::find_if( monsters_list.begin(), monsters_list.end(),
-    [&]( const shared_ptr_fast<monster> &ptr ) {
-        return ptr.get() == &critter;
-    } );
-    if( iter == monsters_list.end() ) {
+    shared_ptr_fast<monster> *entry = find_entry( critter );
+    if( entry == nullptr ) {
         debugmsg( "Tried to remove invalid monster %s", critter.name() );
         return;
     }
 
     for( auto &pair : monster_faction_map_ ) {
-        const auto fac_iter = pair.second.find( *iter );
+        const auto fac_iter = pair.second.find( *entry );
         if( fac_iter != pair.second.end() ) {
             // Need to do this manually because the shared pointer containing critter is kept valid
             // within removed_ and so the weak pointer in monster_faction_map_ is also valid.
@@ -220,24 +335,29 @@ void Creature_tracker::remove( const monster &critter )
         }
     }
     remove_from_location_map( critter );
-    removed_.push_back( *iter );
-    monsters_list.erase( iter );
+    monster_slots.erase( &critter );
+    removed_.push_back( std::move( *entry ) );
+    *entry = nullptr;
+    removed_slots++;
 }
 
 void Creature_tracker::clear()
 {
     monsters_list.clear();
-    monsters_by_location.clear();
+    monster_slots.clear();
+    removed_slots = 0;
+    clear_locations();
     monster_faction_map_.clear();
     removed_.clear();
 }
 
 void Creature_tracker::rebuild_cache()
 {
-    monsters_by_location.clear();
+    clear_locations();
     monster_faction_map_.clear();
+    compact();
     for( const shared_ptr_fast<monster> &mon_ptr : monsters_list ) {
-        monsters_by_location[mon_ptr->pos()] = mon_ptr;
+        set_location( mon_ptr->pos(), mon_ptr );
         add_to_faction_map( mon_ptr );
     }
 }
@@ -256,13 +376,13 @@ void Creature_tracker::swap_positions( monster &first, monster &second )
     shared_ptr_fast<monster> first_ptr;
     if( first_iter != monsters_by_location.end() ) {
         first_ptr = first_iter->second;
-        monsters_by_location.erase( first_iter );
+        erase_location( first_iter );
     }
 
     shared_ptr_fast<monster> second_ptr;
     if( second_iter != monsters_by_location.end() ) {
         second_ptr = second_iter->second;
-        monsters_by_location.erase( second_iter );
+        erase_location( second_iter );
     }
     // implied: (first_ptr != second_ptr) or (first_ptr == nullptr && second_ptr == nullptr)
 
@@ -272,10 +392,10 @@ void Creature_tracker::swap_positions( monster &first, monster &second )
 
     // If the pointers have been taken out of the list, put them back in.
     if( first_ptr ) {
-        monsters_by_location[first.pos()] = first_ptr;
+        set_location( first.pos(), first_ptr );
     }
     if( second_ptr ) {
-        monsters_by_location[second.pos()] = second_ptr;
+        set_location( second.pos(), second_ptr );
     }
 }
 
@@ -286,7 +406,7 @@ bool Creature_tracker::kill_marked_for_death()
     bool monster_is_dead = false;
     // Copy the list so we can iterate the copy safely *and* add new monsters from within monster::die
     // This happens for example with blob monsters (they split into two smaller monsters).
-    const auto copy = monsters_list;
+    const auto copy = get_monsters_list();
     for( const shared_ptr_fast<monster> &mon_ptr : copy ) {
         assert( mon_ptr );
         monster &critter = *mon_ptr;
@@ -306,15 +426,15 @@ bool Creature_tracker::kill_marked_for_death()
 void Creature_tracker::remove_dead()
 {
     // Can't use game::all_monsters() as it would not contain *dead* monsters.
-    for( auto iter = monsters_list.begin(); iter != monsters_list.end(); ) {
-        const monster &critter = **iter;
-        if( critter.is_dead() ) {
-            remove_from_location_map( critter );
-            iter = monsters_list.erase( iter );
-        } else {
-            ++iter;
+    for( shared_ptr_fast<monster> &entry : monsters_list ) {
+        if( entry && entry->is_dead() ) {
+            remove_from_location_map( *entry );
+            monster_slots.erase( entry.get() );
+            entry = nullptr;
+            removed_slots++;
         }
     }
+    compact();
 
     removed_.clear();
 }
@@ -83,9 +83,19 @@ class Creature_tracker
         void remove_dead();
 
         const std::vector<shared_ptr_fast<monster>> &get_monsters_list() const {
+            compact();
             return monsters_list;
         }
 
+        /**
+         * Living monsters inside the box from @p min to @p max (inclusive).
+         * Looks only at the buckets of the spatial index overlapping the box.
+         * The order of the result is unspecified.
+         */
+        std::vector<monster *> find_in_rectangle( const tripoint &min, const tripoint &max ) const;
+        /** Living monsters with a @ref square_dist of at most @p radius to @p center. */
+        std::vector<monster *> find_in_radius( const tripoint &center, int radius ) const;
+
         void serialize( JsonOut &jsout ) const;
         void deserialize( JsonIn &jsin );
 
@@ -94,8 +104,31 @@ class Creature_tracker
         }
 
     private:
-        std::vector<shared_ptr_fast<monster>> monsters_list;
+        /**
+         * Monsters in the order they were added.  @ref remove only clears the entry, the
+         * holes are dropped in one go by @ref compact before anything depends on the order
+         * or on the indices, so removing many monsters costs a single pass over the list.
+         */
+        mutable std::vector<shared_ptr_fast<monster>> monsters_list;
+        /** Index of every monster in @ref monsters_list. */
+        mutable std::unordered_map<const monster *, size_t> monster_slots;
+        /** Cleared entries in @ref monsters_list. */
+        mutable size_t removed_slots = 0;
+        void compact() const;
+        /** Entry of @p critter in @ref monsters_list, nullptr if it isn't tracked. */
+        shared_ptr_fast<monster> *find_entry( const monster &critter );
         std::unordered_map<tripoint, shared_ptr_fast<monster>> monsters_by_location;
+        /**
+         * Spatial index over @ref monsters_by_location: every entry is also listed in the
+         * bucket of its location, buckets are submap sized.
+         */
+        std::unordered_map<tripoint, std::vector<monster *>> monsters_by_bucket;
+        static tripoint bucket_of( const tripoint &pos );
+        /** Sets the entry of @ref monsters_by_location and keeps the buckets in sync. */
+        void set_location( const tripoint &pos, const shared_ptr_fast<monster> &critter );
+        void erase_location( std::unordered_map<tripoint, shared_ptr_fast<monster>>::iterator iter );
+        void remove_from_bucket( const tripoint &pos, const monster *critter );
+        void clear_locations();
         /** Remove the monsters entry in @ref monsters_by_location */
         void remove_from_location_map( const monster &critter );
 };
@@ -16,6 +16,7 @@
 #include <locale>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <ostream>
 #include <regex>
@@ -1373,6 +1374,24 @@ detail::DebugLogGuard::~DebugLogGuard()
     *s << '\n';
 }
 
+static std::recursive_mutex &debug_log_mutex()
+{
+    static std::recursive_mutex mutex;
+    return mutex;
+}
+
+bool detail::debug_log_enabled( DL lev, DC cl )
+{
+    return checkDebugLevelClass( lev, cl );
+}
+
+void debug_flush_log()
+{
+    if( debugFile().file ) {
+        debugFile().file->flush();
+    }
+}
+
 detail::DebugLogGuard detail::realDebugLog( DL lev, DC cl, const char *filename,
         const char *line, const char *funcname )
 {
@@ -1381,6 +1400,7 @@ detail::DebugLogGuard detail::realDebugLog( DL lev, DC cl, const char *filename,
     }
 
     if( checkDebugLevelClass( lev, cl ) ) {
+        std::unique_lock<std::recursive_mutex> lock( debug_log_mutex() );
         std::ostream &out = debugFile().get_file();
 
         output_repetitions( out );
@@ -1423,7 +1443,7 @@ detail::DebugLogGuard detail::realDebugLog( DL lev, DC cl, const char *filename,
         }
 #endif
 
-        return DebugLogGuard( out );
+        return DebugLogGuard( out, std::move( lock ) );
     }
 
     static NullStream null_stream;
@@ -48,6 +48,7 @@
 // Includes                                                         {{{1
 // ---------------------------------------------------------------------
 #include <iostream>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <type_traits>
@@ -263,8 +264,12 @@ namespace detail
 class DebugLogGuard
 {
         std::ostream *s;
+        // Held while the message is written, so messages of different threads don't interleave
+        std::unique_lock<std::recursive_mutex> lock;
     public:
         explicit DebugLogGuard( std::ostream &s ) : s( &s ) {}
+        DebugLogGuard( std::ostream &s, std::unique_lock<std::recursive_mutex> &&lock ) :
+            s( &s ), lock( std::move( lock ) ) {}
         ~DebugLogGuard();
 
         std::ostream &operator*() {
@@ -277,17 +282,36 @@ class DebugLogGuard
 
 DebugLogGuard realDebugLog( DL lev, DC cl, const char *filename,
                             const char *line, const char *funcname );
+
+/** Whether a message of this level and class would be written to the log at all. */
+bool debug_log_enabled( DL lev, DC cl );
+
+/** Turns a finished log statement into void, so it can be used in a conditional expression. */
+struct DebugLogVoidify {
+    void operator&( const std::ostream & ) const {}
+};
 } // namespace detail
 
 /**
  * DebugLog. See documentation at the top of the file.
+ * The message is only formatted if its level and class are enabled.
  */
-#define DebugLog(lev, cl) *detail::realDebugLog(lev, cl, nullptr, nullptr, nullptr)
+#define DebugLog(lev, cl) \
+    !detail::debug_log_enabled( lev, cl ) ? static_cast<void>( 0 ) : \
+    detail::DebugLogVoidify() & *detail::realDebugLog(lev, cl, nullptr, nullptr, nullptr)
 
 /**
  * Like DebugLog, but includes source file name and line number.
  */
-#define DebugLogFL(lev, cl) *detail::realDebugLog(lev, cl, __FILE__, STRING(__LINE__), nullptr)
+#define DebugLogFL(lev, cl) \
+    !detail::debug_log_enabled( lev, cl ) ? static_cast<void>( 0 ) : \
+    detail::DebugLogVoidify() & *detail::realDebugLog(lev, cl, __FILE__, STRING(__LINE__), nullptr)
+
+/**
+ * Writes out everything logged so far. Also used by the crash handlers, so it doesn't
+ * wait for other threads that are writing to the log.
+ */
+void debug_flush_log();
 
 #if defined(BACKTRACE)
 /**
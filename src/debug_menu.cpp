@@ -63,6 +63,7 @@
 #include "mapgendata.h"
 #include "martialarts.h"
 #include "memory_fast.h"
+#include "memory_report.h"
 #include "messages.h"
 #include "mission.h"
 #include "monster.h"
@@ -77,6 +78,7 @@
 #include "overmap.h"
 #include "overmap_ui.h"
 #include "overmapbuffer.h"
+#include "path_info.h"
 #include "pimpl.h"
 #include "player.h"
 #include "pldata.h"
@@ -92,6 +94,7 @@
 #include "string_utils.h"
 #include "trait_group.h"
 #include "translations.h"
+#include "turn_profiler.h"
 #include "type_id.h"
 #include "ui.h"
 #include "ui_manager.h"
@@ -190,6 +193,8 @@ enum debug_menu_index {
     DEBUG_NESTED_MAPGEN,
     DEBUG_RESET_IGNORED_MESSAGES,
     DEBUG_RELOAD_TILES,
+    DEBUG_TURN_PROFILER,
+    DEBUG_MEMORY_REPORT,
 };
 
 class mission_debug
@@ -213,6 +218,8 @@ static int info_uilist( bool display_all_entries = true )
         { uilist_entry( DEBUG_BUG_REPORT, true, 'U', _( "Submit a bug report on github" ) ) },
         { uilist_entry( DEBUG_GAME_REPORT, true, 'r', _( "Generate game report" ) ) },
         { uilist_entry( DEBUG_JOIN_DISCORD, true, 'J', _( "Join the Discord" ) ) },
+        { uilist_entry( DEBUG_TURN_PROFILER, true, 'P', _( "Turn phase profiler" ) ) },
+        { uilist_entry( DEBUG_MEMORY_REPORT, true, 'k', _( "Memory usage report" ) ) },
     };
 
     if( display_all_entries ) {
@@ -1391,6 +1398,80 @@ void benchmark( const int max_difference, bench_kind kind )
              difference / 1000.0, 1000.0 * draw_counter / static_cast<double>( difference ) );
 }
 
+static void turn_profiler_menu()
+{
+    const std::string csv_path = PATH_INFO::config_dir() + "turn_profile.csv";
+    uilist menu;
+    menu.text = _( "Turn phase profiler" );
+    if( turn_profiler::is_enabled() ) {
+        menu.addentry( 0, true, 's', _( "Show results" ) );
+        menu.addentry( 1, true, 'S', _( "Stop profiling" ) );
+    } else {
+        menu.addentry( 2, true, 'p', _( "Start profiling" ) );
+        menu.addentry( 3, true, 'c', _( "Start profiling and log every turn to %s" ), csv_path );
+    }
+    menu.query();
+
+    switch( menu.ret ) {
+        case 0: {
+            int turns = 0;
+            const turn_profiler::turn_stats totals = turn_profiler::recent_totals( turns );
+            if( turns == 0 ) {
+                popup( _( "No turn has finished since profiling started." ) );
+                break;
+            }
+            std::string msg = string_format( _( "Average over the last %d turns:\n\n" ), turns );
+            msg += string_format( "%-16s %10s %8s\n", _( "Phase" ), _( "ms/turn" ), _( "calls" ) );
+            for( size_t i = 0; i < turn_profiler::num_phases; ++i ) {
+                const double ms = std::chrono::duration<double, std::milli>( totals[i].time ).count();
+                msg += string_format( "%-16s %10.3f %8.1f\n",
+                                      turn_profiler::phase_name( static_cast<turn_profiler::phase>( i ) ),
+                                      ms / turns, static_cast<double>( totals[i].calls ) / turns );
+            }
+            const std::map<std::string, cata::lua_hook_stats> &hook_stats = cata::get_lua_hook_stats();
+            if( !hook_stats.empty() ) {
+                msg += _( "\nLua interval hooks since profiling started:\n\n" );
+                msg += string_format( "%-16s %10s %8s\n", _( "Mod" ), _( "ms" ), _( "calls" ) );
+                for( const auto &[mod, stats] : hook_stats ) {
+                    const double ms = std::chrono::duration<double, std::milli>( stats.time ).count();
+                    msg += string_format( "%-16s %10.3f %8d\n", mod.empty() ? _( "(console)" ) : mod, ms,
+                                          stats.calls );
+                }
+            }
+            popup( msg, PF_NONE );
+            break;
+        }
+        case 1:
+            turn_profiler::set_enabled( false );
+            break;
+        case 2:
+            cata::reset_lua_hook_stats();
+            turn_profiler::set_enabled( true );
+            break;
+        case 3:
+            cata::reset_lua_hook_stats();
+            turn_profiler::set_enabled( true, csv_path );
+            break;
+        default:
+            break;
+    }
+}
+
+static void memory_report_menu()
+{
+    const std::vector<memory_report::entry> entries = memory_report::collect();
+    const std::string json_path = PATH_INFO::config_dir() + "memory_report.json";
+    const bool written = write_to_file( json_path, [&]( std::ostream & fout ) {
+        JsonOut jsout( fout, true );
+        memory_report::serialize( jsout, entries );
+    }, _( "memory report" ) );
+    std::string msg = memory_report::format( entries );
+    if( written ) {
+        msg += string_format( _( "\nWritten to %s" ), json_path );
+    }
+    popup( msg, PF_NONE );
+}
+
 // prompts player to select 2 points that will form a rectangular area
 static std::optional<tripoint_range<tripoint>> select_area()
 {
@@ -2180,6 +2261,12 @@ void debug()
         case DEBUG_RESET_IGNORED_MESSAGES:
             debug_reset_ignored_messages();
             break;
+        case DEBUG_TURN_PROFILER:
+            turn_profiler_menu();
+            break;
+        case DEBUG_MEMORY_REPORT:
+            memory_report_menu();
+            break;
         case DEBUG_RELOAD_TILES:
             std::ostringstream ss;
             g->reload_tileset( [&ss]( const std::string & str ) {
@@ -20,6 +20,7 @@ void dialogue_window::resize_dialogue( ui_adaptor &ui )
     d_win = catacurses::newwin( maxy, maxx, point( win_beginx, win_beginy ) );
     ui.position_from_window( d_win );
     curr_page = 0;
+    paged_responses = nullptr;
     draw_cache.clear();
     for( size_t idx = 0; idx < history.size(); idx++ ) {
         cache_msg( history[idx], idx );
@@ -72,15 +73,6 @@ void dialogue_window::print_history()
     }
 }
 
-struct page_entry {
-    nc_color col;
-    std::vector<std::string> lines;
-};
-
-struct page {
-    std::vector<page_entry> entries;
-};
-
 static std::vector<page> split_to_pages( const std::vector<talk_data> &responses, int page_w,
         int page_h )
 {
@@ -155,6 +147,7 @@ void dialogue_window::cache_msg( const std::string &msg, size_t idx )
 void dialogue_window::refresh_response_display()
 {
     curr_page = 0;
+    paged_responses = nullptr;
     can_scroll_down = false;
     can_scroll_up = false;
 }
@@ -185,11 +178,13 @@ void dialogue_window::display_responses( const std::vector<talk_data> &responses
     clear_window_texts();
     print_history();
 
-    // TODO: cache paged entries
-    // -2 for borders, -2 for your name + newline, -4 for keybindings
-    const int page_h = getmaxy( d_win ) - 2 - 2 - 4;
-    const int page_w = getmaxx( d_win ) / 2 - 4; // -4 for borders + padding
-    const std::vector<page> pages = split_to_pages( responses, page_w, page_h );
+    if( paged_responses != &responses ) {
+        // -2 for borders, -2 for your name + newline, -4 for keybindings
+        const int page_h = getmaxy( d_win ) - 2 - 2 - 4;
+        const int page_w = getmaxx( d_win ) / 2 - 4; // -4 for borders + padding
+        pages = split_to_pages( responses, page_w, page_h );
+        paged_responses = &responses;
+    }
     if( !pages.empty() ) {
         if( curr_page >= pages.size() ) {
             curr_page = pages.size() - 1;
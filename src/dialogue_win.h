@@ -19,6 +19,16 @@ struct talk_data {
 
 class ui_adaptor;
 
+/** Response as printed: folded to the window width and prefixed with its letter */
+struct page_entry {
+    nc_color col;
+    std::vector<std::string> lines;
+};
+
+struct page {
+    std::vector<page_entry> entries;
+};
+
 class dialogue_window
 {
     public:
@@ -46,6 +56,13 @@ class dialogue_window
          * window width and with separators between. Used for rendering, recalculated each time window size changes.
          */
         std::vector<std::pair<std::string, size_t>> draw_cache;
+        /**
+         * Responses last given to @ref display_responses, split to pages.  Folding them is
+         * the expensive part of a redraw, recalculated only when the responses or the window
+         * size change.
+         */
+        std::vector<page> pages;
+        const std::vector<talk_data> *paged_responses = nullptr;
         /** Scroll position in response window (page number) */
         size_t curr_page = 0;
         bool can_scroll_up = false;
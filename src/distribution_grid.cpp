@@ -32,6 +32,9 @@ distribution_grid::distribution_grid( const std::vector<tripoint_abs_sm> &global
             const tripoint_abs_ms abs_pos = project_combine( sm_coord, active.first );
             contents[sm_coord].emplace_back( active.first, abs_pos );
             flat_contents.emplace_back( abs_pos );
+            if( active.second && !active.second->is_passive() ) {
+                updated_contents[sm_coord].emplace_back( active.first, abs_pos );
+            }
         }
     }
 }
@@ -46,9 +49,14 @@ distribution_grid::operator bool() const
     return !empty() && !submap_coords.empty();
 }
 
+bool distribution_grid::requires_updates() const
+{
+    return !updated_contents.empty();
+}
+
 void distribution_grid::update( time_point to )
 {
-    for( const auto &c : contents ) {
+    for( const auto &c : updated_contents ) {
         submap *sm = mb.lookup_submap( c.first );
         if( sm == nullptr ) {
             return;
@@ -59,6 +67,7 @@ void distribution_grid::update( time_point to )
             if( !active ) {
                 debugmsg( "No active furniture at %s", loc.absolute.to_string() );
                 contents.clear();
+                updated_contents.clear();
                 return;
             }
             active->update( to, loc.absolute, *this );
@@ -207,7 +216,7 @@ distribution_grid &distribution_grid_tracker::make_distribution_grid_at(
         }
     }
 
-    if( !dist_grid->empty() ) {
+    if( dist_grid->requires_updates() ) {
         grids_requiring_updates.emplace( dist_grid );
     }
 
@@ -43,6 +43,11 @@ class distribution_grid
          * that contain an active tile.
          */
         std::map<tripoint_abs_sm, std::vector<tile_location>> contents;
+        /**
+         * Part of @ref contents that has to be updated over time.
+         * Passive tiles (batteries, connectors) are only changed by the other tiles.
+         */
+        std::map<tripoint_abs_sm, std::vector<tile_location>> updated_contents;
         std::vector<tripoint_abs_ms> flat_contents;
         std::vector<tripoint_abs_sm> submap_coords;
 
@@ -54,6 +59,8 @@ class distribution_grid
         distribution_grid( const std::vector<tripoint_abs_sm> &global_submap_coords, mapbuffer &buffer );
         bool empty() const;
         explicit operator bool() const;
+        /** False if only passive tiles are on this grid, then @ref update does nothing. */
+        bool requires_updates() const;
         void update( time_point to );
         int mod_resource( int amt, bool recurse = true );
         int get_resource( bool recurse = true ) const;
@@ -925,6 +925,10 @@ std::vector<efftype_id> effect::get_blocks_effects() const
 
 int effect::get_mod( const std::string &arg, bool reduced ) const
 {
+    // Most effects have no modifiers at all, skip the lookups for them
+    if( eff_type->mod_data.empty() ) {
+        return 0;
+    }
     auto &mod_data = eff_type->mod_data;
     double min = 0;
     double max = 0;
@@ -957,6 +961,9 @@ int effect::get_mod( const std::string &arg, bool reduced ) const
 
 int effect::get_avg_mod( const std::string &arg, bool reduced ) const
 {
+    if( eff_type->mod_data.empty() ) {
+        return 0;
+    }
     auto &mod_data = eff_type->mod_data;
     double min = 0;
     double max = 0;
@@ -989,6 +996,9 @@ int effect::get_avg_mod( const std::string &arg, bool reduced ) const
 
 int effect::get_amount( const std::string &arg, bool reduced ) const
 {
+    if( eff_type->mod_data.empty() ) {
+        return 0;
+    }
     int intensity_capped = eff_type->max_effective_intensity > 0 ? std::min(
                                eff_type->max_effective_intensity, intensity ) : intensity;
     auto &mod_data = eff_type->mod_data;
@@ -1006,6 +1016,9 @@ int effect::get_amount( const std::string &arg, bool reduced ) const
 
 int effect::get_min_val( const std::string &arg, bool reduced ) const
 {
+    if( eff_type->mod_data.empty() ) {
+        return 0;
+    }
     auto &mod_data = eff_type->mod_data;
     double ret = 0;
     auto found = mod_data.find( std::make_tuple( "base_mods", reduced, arg, "min_val" ) );
@@ -1021,6 +1034,9 @@ int effect::get_min_val( const std::string &arg, bool reduced ) const
 
 int effect::get_max_val( const std::string &arg, bool reduced ) const
 {
+    if( eff_type->mod_data.empty() ) {
+        return 0;
+    }
     auto &mod_data = eff_type->mod_data;
     double ret = 0;
     auto found = mod_data.find( std::make_tuple( "base_mods", reduced, arg, "max_val" ) );
@@ -1124,6 +1140,10 @@ double effect::get_percentage( const std::string &arg, int val, bool reduced ) c
 bool effect::activated( const time_point &when, const std::string &arg, int val, bool reduced,
                         double mod ) const
 {
+    // Without chances a valueless effect never triggers, see below
+    if( val == 0 && eff_type->mod_data.empty() ) {
+        return false;
+    }
     auto &mod_data = eff_type->mod_data;
     auto found_top_base = mod_data.find( std::make_tuple( "base_mods", reduced, arg, "chance_top" ) );
     auto found_top_scale = mod_data.find( std::make_tuple( "scaling_mods", reduced, arg,
@@ -2,6 +2,7 @@
 #ifndef CATA_SRC_EVENT_BUS_H
 #define CATA_SRC_EVENT_BUS_H
 
+#include <array>
 #include <utility>
 #include <vector>
 
@@ -17,6 +18,14 @@ class event_subscriber
         event_subscriber &operator=( const event_subscriber & ) = delete;
         virtual ~event_subscriber();
         virtual void notify( const cata::event & ) = 0;
+        /**
+         * Whether @ref notify should be called for events of this type. Subscribers that only
+         * care about a few types should override this, the bus then skips them for all others.
+         * Checked once when subscribing, so the answer must not change afterwards.
+         */
+        virtual bool wants( event_type ) const {
+            return true;
+        }
     private:
         friend class event_bus;
         void on_subscribe( event_bus * );
@@ -41,6 +50,9 @@ class event_bus
         }
     private:
         std::vector<event_subscriber *> subscribers;
+        /** Subscribers by the event types they want, in order of subscription. */
+        std::array<std::vector<event_subscriber *>, static_cast<size_t>( event_type::num_event_types )>
+        subscribers_by_type;
 };
 
 event_bus &get_event_bus();
@@ -315,6 +315,12 @@ struct event_source {
     virtual ~event_source() = default;
 
     virtual event_multiset get( stats_tracker &stats ) const = 0;
+    // Same as get, but sources that keep the events themselves return them without a copy.
+    // Otherwise the result is computed into storage.
+    virtual const event_multiset &get_ref( stats_tracker &stats, event_multiset &storage ) const {
+        storage = get( stats );
+        return storage;
+    }
     virtual std::string debug_description() const = 0;
     virtual bool is_game_start() const = 0;
     virtual void add_watcher( stats_tracker &stats, event_multiset_watcher *watcher ) const = 0;
@@ -332,6 +338,10 @@ struct event_type_event_source : event_source {
         return stats.get_events( type );
     }
 
+    const event_multiset &get_ref( stats_tracker &stats, event_multiset & ) const override {
+        return stats.get_events( type );
+    }
+
     std::string debug_description() const override {
         return "event type " + io::enum_to_string( type );
     }
@@ -480,7 +490,8 @@ struct event_transformation_impl : public event_transformation::impl {
     }
 
     event_multiset initialize( stats_tracker &stats ) const override {
-        return initialize( source_->get( stats ).counts(), stats );
+        event_multiset storage;
+        return initialize( source_->get_ref( stats, storage ).counts(), stats );
     }
 
     void check( const std::string &name ) const override {
@@ -631,7 +642,8 @@ struct event_statistic_count : event_statistic::impl {
     cata::clone_ptr<event_source> source;
 
     cata_variant value( stats_tracker &stats ) const override {
-        int count = source->get( stats ).count();
+        event_multiset storage;
+        int count = source->get_ref( stats, storage ).count();
         return cata_variant::make<cata_variant_type::int_>( count );
     }
 
@@ -684,7 +696,8 @@ struct event_statistic_total : event_statistic::impl {
     std::string field;
 
     cata_variant value( stats_tracker &stats ) const override {
-        int total = source->get( stats ).total( field );
+        event_multiset storage;
+        int total = source->get_ref( stats, storage ).total( field );
         return cata_variant::make<cata_variant_type::int_>( total );
     }
 
@@ -746,7 +759,8 @@ struct event_statistic_maximum : event_statistic::impl {
     std::string field;
 
     cata_variant value( stats_tracker &stats ) const override {
-        int maximum = source->get( stats ).maximum( field );
+        event_multiset storage;
+        int maximum = source->get_ref( stats, storage ).maximum( field );
         return cata_variant::make<cata_variant_type::int_>( maximum );
     }
 
@@ -811,7 +825,8 @@ struct event_statistic_minimum : event_statistic::impl {
     std::string field;
 
     cata_variant value( stats_tracker &stats ) const override {
-        int minimum = source->get( stats ).minimum( field );
+        event_multiset storage;
+        int minimum = source->get_ref( stats, storage ).minimum( field );
         return cata_variant::make<cata_variant_type::int_>( minimum );
     }
 
@@ -883,7 +898,8 @@ struct event_statistic_unique_value : event_statistic::impl {
     std::string field_;
 
     cata_variant value( stats_tracker &stats ) const override {
-        const event_multiset::counts_type counts = source_->get( stats ).counts();
+        event_multiset storage;
+        const event_multiset::counts_type &counts = source_->get_ref( stats, storage ).counts();
         if( counts.size() != 1 ) {
             return cata_variant();
         }
@@ -904,7 +920,8 @@ struct event_statistic_unique_value : event_statistic::impl {
         }
 
         void init( stats_tracker &stats ) {
-            count = stat->source_->get( stats ).count();
+            event_multiset storage;
+            count = stat->source_->get_ref( stats, storage ).count();
             value = stat->value( stats );
         }
 
@@ -1015,14 +1015,23 @@ void ExplosionProcess::run()
         g->toggle_pixel_minimap();
     }
 
+    std::sort( recombination_targets.begin(), recombination_targets.end() );
+    auto end = std::unique( recombination_targets.begin(), recombination_targets.end() );
+    recombination_targets.erase( end, recombination_targets.end() );
+
     // Remove temporary flags
-    for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
-        for( const auto &pos : here.points_on_zlevel( z ) ) {
-            for( auto &it : here.i_at( pos ) ) {
-                it->unset_flag( flag_EXPLOSION_SMASHED );
-                it->unset_flag( flag_EXPLOSION_PROPELLED );
-            }
+    // Items are only flagged on blasted tiles, flung items end up on a recombination target
+    const auto unset_temporary_flags = [&here]( const tripoint & pos ) {
+        for( auto &it : here.i_at( pos ) ) {
+            it->unset_flag( flag_EXPLOSION_SMASHED );
+            it->unset_flag( flag_EXPLOSION_PROPELLED );
         }
+    };
+    for( const dist_point_pair &blasted : blast_map ) {
+        unset_temporary_flags( blasted.second );
+    }
+    for( const tripoint &pos : recombination_targets ) {
+        unset_temporary_flags( pos );
     }
 
     // Make sure the map is centered around the player
@@ -1031,9 +1040,6 @@ void ExplosionProcess::run()
     }
 
     // Finally, recombine thrown items into full stacks again
-    std::sort( recombination_targets.begin(), recombination_targets.end() );
-    auto end = std::unique( recombination_targets.begin(), recombination_targets.end() );
-    recombination_targets.erase( end, recombination_targets.end() );
 
     for( const auto &position : recombination_targets ) {
         for( detached_ptr<item> &it : here.i_clear( position ) ) {
@@ -226,7 +226,7 @@ bool field::remove_field( const field_type_id &field_to_remove )
     return true;
 }
 
-void field::remove_field( std::map<field_type_id, field_entry>::iterator const it )
+void field::remove_field( entry_map::iterator const it )
 {
     _field_type_list.erase( it );
     _displayed_field_type = fd_null;
@@ -248,22 +248,22 @@ unsigned int field::field_count() const
     return _field_type_list.size();
 }
 
-std::map<field_type_id, field_entry>::iterator field::begin()
+field::entry_map::iterator field::begin()
 {
     return _field_type_list.begin();
 }
 
-std::map<field_type_id, field_entry>::const_iterator field::begin() const
+field::entry_map::const_iterator field::begin() const
 {
     return _field_type_list.begin();
 }
 
-std::map<field_type_id, field_entry>::iterator field::end()
+field::entry_map::iterator field::end()
 {
     return _field_type_list.end();
 }
 
-std::map<field_type_id, field_entry>::const_iterator field::end() const
+field::entry_map::const_iterator field::end() const
 {
     return _field_type_list.end();
 }
@@ -2,11 +2,14 @@
 #ifndef CATA_SRC_FIELD_H
 #define CATA_SRC_FIELD_H
 
+#include <functional>
 #include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "calendar.h"
+#include "cata_pool.h"
 #include "color.h"
 #include "enums.h"
 #include "field_type.h"
@@ -86,7 +89,7 @@ class field_entry
         }
 
         //Returns true if this is an active field, false if it should be removed.
-        bool is_field_alive() {
+        bool is_field_alive() const {
             return is_alive;
         }
 
@@ -130,6 +133,10 @@ class field_entry
 class field
 {
     public:
+        // Entries are pool allocated, tiles full of smoke or fire add and remove them every turn
+        using entry_map = std::map<field_type_id, field_entry, std::less<field_type_id>,
+              cata_pool_allocator<std::pair<const field_type_id, field_entry>>>;
+
         field();
 
         /**
@@ -169,7 +176,7 @@ class field
          * Make sure to decrement the field counter in the submap.
          * Removes the field entry, the iterator must point into @ref _field_type_list and must be valid.
          */
-        void remove_field( std::map<field_type_id, field_entry>::iterator );
+        void remove_field( entry_map::iterator );
 
         // Returns the number of fields existing on the current tile.
         unsigned int field_count() const;
@@ -182,12 +189,12 @@ class field
         description_affix displayed_description_affix() const;
 
         //Returns the vector iterator to begin searching through the list.
-        std::map<field_type_id, field_entry>::iterator begin();
-        std::map<field_type_id, field_entry>::const_iterator begin() const;
+        entry_map::iterator begin();
+        entry_map::const_iterator begin() const;
 
         //Returns the vector iterator to end searching through the list.
-        std::map<field_type_id, field_entry>::iterator end();
-        std::map<field_type_id, field_entry>::const_iterator end() const;
+        entry_map::iterator end();
+        entry_map::const_iterator end() const;
 
         /**
          * Returns the total move cost from all fields.
@@ -196,7 +203,7 @@ class field
 
     private:
         // A pointer lookup table of all field effects on the current tile.
-        std::map<field_type_id, field_entry> _field_type_list;
+        entry_map _field_type_list;
         //_displayed_field_type currently is equal to the last field added to the square. You can modify this behavior in the class functions if you wish.
         field_type_id _displayed_field_type;
 };
@@ -178,6 +178,8 @@ struct field_type {
         time_duration half_life = 0_turns;
         phase_id phase = PNULL;
         bool accelerated_decay = false;
+        // Gas spreads through gas_diffusion instead of map::spread_gas
+        bool buffered_diffusion = false;
         bool display_items = true;
         bool display_field = false;
         field_type_id wandering_field;
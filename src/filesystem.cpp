@@ -459,6 +459,13 @@ std::vector<std::string> get_directories_with( const std::vector<std::string> &p
     return files;
 }
 
+std::vector<std::string> get_subdirectories( const std::string &root_path )
+{
+    return find_file_if_bfs( root_path, false, [&]( const dirent &, bool is_dir ) {
+        return is_dir;
+    } );
+}
+
 bool copy_file( const std::string &source_path, const std::string &dest_path )
 {
     cata_ifstream source_stream = std::move( cata_ifstream().mode( cata_ios_mode::binary ).open(
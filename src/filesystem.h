@@ -98,6 +98,9 @@ std::vector<std::string> get_directories_with( const std::vector<std::string> &p
 std::vector<std::string> get_directories_with( const std::string &pattern,
         const std::string &root_path = "", bool recursive_search = false );
 
+/** Returns the directories directly inside @p root_path, in lexical order. */
+std::vector<std::string> get_subdirectories( const std::string &root_path = "" );
+
 /**
  *  Replace invalid characters in a string with a default character; can be used to ensure that a file name is compliant with most file systems.
  *  @param file_name Name of the file to check.
@@ -0,0 +1,119 @@
+#pragma once
+#ifndef CATA_SRC_FLAT_HASH_MAP_H
+#define CATA_SRC_FLAT_HASH_MAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <utility>
+#include <vector>
+
+/**
+ * Hash map using open addressing with linear probing, keeping all entries in one
+ * flat array.  Unlike the node based std::unordered_map, a lookup usually touches
+ * a single cache line.
+ *
+ * Meant for small keys that are cheap to hash and compare, like interned string_ids.
+ * Inserting or erasing invalidates pointers to the values.
+ */
+template<typename K, typename V, typename Hash = std::hash<K>>
+class flat_hash_map
+{
+    public:
+        /** Returns the value stored for @p key, or null if there is none. */
+        const V *find( const K &key ) const {
+            if( slots.empty() ) {
+                return nullptr;
+            }
+            for( size_t i = bucket( key ); slots[i]; i = ( i + 1 ) & mask() ) {
+                if( slots[i]->first == key ) {
+                    return &slots[i]->second;
+                }
+            }
+            return nullptr;
+        }
+        V *find( const K &key ) {
+            return const_cast<V *>( std::as_const( *this ).find( key ) );
+        }
+        bool contains( const K &key ) const {
+            return find( key ) != nullptr;
+        }
+
+        /** Returns the value stored for @p key, inserting a default constructed one if needed. */
+        V &operator[]( const K &key ) {
+            // Keep the load factor below 3/4 so probe sequences stay short
+            if( ( count + 1 ) * 4 > slots.size() * 3 ) {
+                rehash( std::max<size_t>( slots.size() * 2, 16 ) );
+            }
+            size_t i = bucket( key );
+            for( ; slots[i]; i = ( i + 1 ) & mask() ) {
+                if( slots[i]->first == key ) {
+                    return slots[i]->second;
+                }
+            }
+            slots[i].emplace( key, V() );
+            count++;
+            return slots[i]->second;
+        }
+
+        /** Removes every entry for which @p pred( key, value ) returns true. */
+        template<typename Pred>
+        void erase_if( Pred pred ) {
+            std::vector<std::optional<std::pair<K, V>>> old_slots = std::move( slots );
+            slots.assign( old_slots.size(), std::nullopt );
+            count = 0;
+            for( std::optional<std::pair<K, V>> &slot : old_slots ) {
+                if( slot && !pred( slot->first, slot->second ) ) {
+                    insert_new( std::move( *slot ) );
+                }
+            }
+        }
+
+        void clear() {
+            slots.clear();
+            count = 0;
+        }
+        size_t size() const {
+            return count;
+        }
+        bool empty() const {
+            return count == 0;
+        }
+
+    private:
+        size_t mask() const {
+            return slots.size() - 1;
+        }
+        size_t bucket( const K &key ) const {
+            // Fibonacci hashing spreads sequential hashes (e.g. interned ids) over the table
+            const uint64_t h = static_cast<uint64_t>( Hash()( key ) ) * UINT64_C( 11400714819323198485 );
+            return static_cast<size_t>( h >> 32 ) & mask();
+        }
+        // Key must not be present yet, and there must be room for it
+        void insert_new( std::pair<K, V> &&entry ) {
+            size_t i = bucket( entry.first );
+            while( slots[i] ) {
+                i = ( i + 1 ) & mask();
+            }
+            slots[i].emplace( std::move( entry ) );
+            count++;
+        }
+        void rehash( size_t new_size ) {
+            std::vector<std::optional<std::pair<K, V>>> old_slots = std::move( slots );
+            slots.assign( new_size, std::nullopt );
+            count = 0;
+            for( std::optional<std::pair<K, V>> &slot : old_slots ) {
+                if( slot ) {
+                    insert_new( std::move( *slot ) );
+                }
+            }
+        }
+
+        // Size is zero or a power of two
+        std::vector<std::optional<std::pair<K, V>>> slots;
+        size_t count = 0;
+};
+
+#endif // CATA_SRC_FLAT_HASH_MAP_H
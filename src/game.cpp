@@ -116,6 +116,7 @@
 #include "mapdata.h"
 #include "mapsharing.h"
 #include "memorial_logger.h"
+#include "memory_report.h"
 #include "messages.h"
 #include "mission.h"
 #include "mod_manager.h"
@@ -162,6 +163,7 @@
 #include "timed_event.h"
 #include "translations.h"
 #include "trap.h"
+#include "turn_profiler.h"
 #include "ui.h"
 #include "ui_manager.h"
 #include "uistate.h"
@@ -1348,6 +1350,29 @@ void game::calc_driving_offset( vehicle *veh )
     set_driving_view_offset( point( offset.x, offset.y ) );
 }
 
+#if defined(USE_TRACY)
+// What the turn had to work through, next to its zones in the profiler
+static void plot_turn_contents()
+{
+    if( !TracyIsConnected ) {
+        return;
+    }
+    ZoneScoped;
+    int64_t monsters = 0;
+    for( monster &critter : g->all_monsters() ) {
+        ( void )critter;
+        monsters++;
+    }
+    TracyPlot( "Monsters", monsters );
+    const map &here = get_map();
+    const map::content_counts counts = here.count_contents();
+    TracyPlot( "Items in the bubble", counts.items );
+    TracyPlot( "Fields in the bubble", counts.fields );
+    TracyPlot( "Submaps with active items",
+               static_cast<int64_t>( here.get_submaps_with_active_items().size() ) );
+}
+#endif
+
 // MAIN GAME LOOP
 // Returns true if game is over (death, saved, quit, etc)
 bool game::do_turn()
@@ -1362,6 +1387,11 @@ bool game::do_turn()
         new_game = false;
     } else {
         gamemode->per_turn();
+        turn_profiler::end_turn( to_turns<int>( calendar::turn - calendar::turn_zero ) );
+        memory_report::plot();
+#if defined(USE_TRACY)
+        plot_turn_contents();
+#endif
         calendar::turn += 1_turns;
     }
 
@@ -1496,9 +1526,25 @@ bool game::do_turn()
 
     m.process_falling();
     autopilot_vehicles();
-    m.vehmove();
-    m.process_fields();
-    m.process_items();
+    {
+        turn_profiler::scoped_phase profile( turn_profiler::phase::vehmove );
+        m.vehmove();
+    }
+    if( const optional_vpart_position vp = m.veh_at( u.pos() ) ) {
+        // Get the submaps we're driving into ready before the map shifts onto them
+        const vehicle &veh = vp->vehicle();
+        if( veh.velocity != 0 ) {
+            m.prefetch_submaps( ( veh.dir_vec() * ( veh.velocity > 0 ? 1.0f : -1.0f ) ).as_point() );
+        }
+    }
+    {
+        turn_profiler::scoped_phase profile( turn_profiler::phase::process_fields );
+        m.process_fields();
+    }
+    {
+        turn_profiler::scoped_phase profile( turn_profiler::phase::process_items );
+        m.process_items();
+    }
     m.creature_in_field( u );
     grid_tracker_ptr->update( calendar::turn );
 
@@ -1506,7 +1552,10 @@ bool game::do_turn()
     sounds::process_sounds();
     // Update vision caches for monsters. If this turns out to be expensive,
     // consider a stripped down cache just for monsters.
-    m.build_map_cache( get_levz(), true );
+    {
+        turn_profiler::scoped_phase profile( turn_profiler::phase::build_map_cache );
+        m.build_map_cache( get_levz(), true );
+    }
     monmove();
     if( calendar::once_every( 5_minutes ) ) {
         overmap_npc_move();
@@ -1524,14 +1573,18 @@ bool game::do_turn()
     mon_info_update();
     u.process_turn();
 
-    cata::run_on_every_x_hooks( *DynamicDataLoader::get_instance().lua );
+    {
+        turn_profiler::scoped_phase profile( turn_profiler::phase::lua_hooks );
+        cata::run_on_every_x_hooks( *DynamicDataLoader::get_instance().lua );
+    }
 
     explosion_handler::get_explosion_queue().execute();
     cleanup_dead();
+    cata::run_lua_gc_step( *DynamicDataLoader::get_instance().lua );
 
-    if( u.moves < 0 && get_option<bool>( "FORCE_REDRAW" ) ) {
-        ui_manager::redraw();
-        refresh_display();
+    if( u.moves < 0 && !fast_forwarding && get_option<bool>( "FORCE_REDRAW" ) ) {
+        // Turns can pass much faster than frames can be shown
+        ui_manager::present_if_due();
     }
 
     if( get_levz() >= 0 && !u.is_underwater() ) {
@@ -1564,9 +1617,13 @@ bool game::do_turn()
     }
     if( wait_redraw ) {
         ZoneScopedN( "wait_redraw" );
+        // Nothing on the map needs to be watched during long waits, so they only show the
+        // popup until something interrupts them.  Travelling and driving keep the map.
+        fast_forwarding = wait_refresh_rate >= 5_minutes;
         if( first_redraw_since_waiting_started ||
             calendar::once_every( std::min( 1_minutes, wait_refresh_rate ) ) ) {
-            if( first_redraw_since_waiting_started || calendar::once_every( wait_refresh_rate ) ) {
+            if( first_redraw_since_waiting_started ||
+                ( !fast_forwarding && calendar::once_every( wait_refresh_rate ) ) ) {
                 ui_manager::redraw();
             }
 
@@ -1574,14 +1631,20 @@ bool game::do_turn()
             ui_adaptor dummy( ui_adaptor::disable_uis_below {} );
             wait_popup = std::make_unique<static_popup>();
             wait_popup->on_top( true ).wait_message( "%s", wait_message );
-            ui_manager::redraw();
-            refresh_display();
+            if( fast_forwarding && !first_redraw_since_waiting_started ) {
+                static constexpr std::chrono::milliseconds popup_interval( 100 );
+                ui_manager::present_if_due( popup_interval );
+            } else {
+                ui_manager::redraw();
+                refresh_display();
+            }
             first_redraw_since_waiting_started = false;
         }
     } else {
         // Nothing to wait for now
         wait_popup.reset();
         first_redraw_since_waiting_started = true;
+        fast_forwarding = false;
     }
 
     u.update_bodytemp( m, weather );
@@ -1809,14 +1872,12 @@ static int maptile_field_intensity( maptile &mt, field_type_id fld )
     return field_ptr == nullptr ? 0 : field_ptr->get_field_intensity();
 }
 
-int get_heat_radiation( const tripoint &location, bool direct )
+static weather_manager::heat_radiation scan_heat_radiation( const tripoint &location,
+        bool avatar_there )
 {
     // Direct heat from fire sources
-    // Cache fires to avoid scanning the map around us bp times
-    // Stored as intensity-distance pairs
-    int temp_mod = 0;
-    int best_fire = 0;
-    Character &player_character = get_avatar();
+    weather_manager::heat_radiation heat;
+    heat.avatar_there = avatar_there;
     map &here = get_map();
     // Convert it to an int id once, instead of 139 times per turn
     const field_type_id fd_fire_int = fd_fire.id();
@@ -1835,7 +1896,7 @@ int get_heat_radiation( const tripoint &location, bool direct )
             // No heat source here
             continue;
         }
-        if( player_character.pos() == location ) {
+        if( avatar_there ) {
             if( !here.pl_line_of_sight( dest, -1 ) ) {
                 continue;
             }
@@ -1844,13 +1905,24 @@ int get_heat_radiation( const tripoint &location, bool direct )
         }
         // Ensure fire_dist >= 1 to avoid divide-by-zero errors.
         const int fire_dist = std::max( 1, square_dist( dest, location ) );
-        temp_mod += 6 * heat_intensity * heat_intensity / fire_dist;
-        best_fire = std::max( best_fire, heat_intensity );
+        heat.temp_mod += 6 * heat_intensity * heat_intensity / fire_dist;
+        heat.best_fire = std::max( heat.best_fire, heat_intensity );
     }
-    if( direct ) {
-        return best_fire;
+    return heat;
+}
+
+int get_heat_radiation( const tripoint &location, bool direct )
+{
+    // Every character asks twice per turn and temperature lookups ask again, share the scan.
+    // Fires can change during the turn, temperatures are only updated once per turn anyway.
+    const bool avatar_there = get_avatar().pos() == location;
+    std::unordered_map<tripoint, weather_manager::heat_radiation> &cache =
+        get_weather().heat_radiation_cache;
+    auto cached = cache.find( location );
+    if( cached == cache.end() || cached->second.avatar_there != avatar_there ) {
+        cached = cache.insert_or_assign( location, scan_heat_radiation( location, avatar_there ) ).first;
     }
-    return temp_mod;
+    return direct ? cached->second.best_fire : cached->second.temp_mod;
 }
 
 int get_convection_temperature( const tripoint &location )
@@ -2745,7 +2817,7 @@ bool game::save( bool quitting )
         return false;
     }
 
-    world->start_save_tx();
+    world->start_save_tx( !quitting && get_option<bool>( "ASYNC_SAVE" ) );
 
     cata::run_on_game_save_hooks( *DynamicDataLoader::get_instance().lua );
     try {
@@ -3109,6 +3181,7 @@ void game::draw( ui_adaptor &ui )
     if( test_mode ) {
         return;
     }
+    turn_profiler::scoped_phase profile( turn_profiler::phase::draw );
 
     //temporary fix for updating visibility for minimap
     ter_view_p.z = ( u.pos() + u.view_offset ).z;
@@ -3147,21 +3220,27 @@ void game::draw_panels( bool force_draw )
     const bool sidebar_right = get_option<std::string>( "SIDEBAR_POSITION" ) == "right";
     int spacer = get_option<bool>( "SIDEBAR_SPACERS" ) ? 1 : 0;
     int log_height = 0;
-    for( const window_panel &panel : mgr.get_current_layout() ) {
-        if( panel.get_height() != -2 && panel.toggle && panel.render() ) {
+    const std::vector<window_panel> &layout = mgr.get_current_layout();
+    // Render conditions look up options, ask each panel only once per draw
+    std::vector<bool> rendered( layout.size() );
+    for( size_t i = 0; i < layout.size(); i++ ) {
+        const window_panel &panel = layout[i];
+        rendered[i] = panel.render();
+        if( panel.get_height() != -2 && panel.toggle && rendered[i] ) {
             log_height += panel.get_height() + spacer;
         }
     }
     log_height = std::max( TERMY - log_height, 3 );
-    for( const window_panel &panel : mgr.get_current_layout() ) {
-        if( panel.render() ) {
+    for( size_t i = 0; i < layout.size(); i++ ) {
+        const window_panel &panel = layout[i];
+        if( rendered[i] ) {
             // height clamped to window height.
             int h = std::min( panel.get_height(), TERMY - y );
             if( h == -2 ) {
                 h = log_height;
             }
             h += spacer;
-            if( panel.toggle && panel.render() && h > 0 ) {
+            if( panel.toggle && h > 0 ) {
                 if( panel.always_draw || draw_this_turn ) {
                     panel.draw( u, catacurses::newwin( h, panel.get_width(),
                                                        point( sidebar_right ? TERMX - panel.get_width() : 0, y ) ) );
@@ -3884,6 +3963,8 @@ void game::mon_info_update( )
     static time_point previous_turn = calendar::start_of_cataclysm;
     const time_duration sm_ignored_time = time_duration::from_turns(
             get_option<int>( "SAFEMODEIGNORETURNS" ) );
+    const safemode &rules = get_safemode();
+    const bool safemode_empty = rules.empty();
 
     for( Creature *c : u.get_visible_creatures( MAPSIZE_X ) ) {
         monster *m = dynamic_cast<monster *>( c );
@@ -3947,19 +4028,22 @@ void game::mon_info_update( )
             }
         }
 
-        rule_state safemode_state = RULE_NONE;
-        const bool safemode_empty = get_safemode().empty();
-
         if( m != nullptr ) {
             //Safemode monster check
             monster &critter = *m;
 
-            const monster_attitude matt = critter.attitude( &u );
             const int mon_dist = rl_dist( u.pos(), critter.pos() );
-            safemode_state = get_safemode().check_monster( critter.name(), critter.attitude_to( u ), mon_dist );
+            // The rules are looked up by name, only build it when there are rules
+            bool alarming;
+            if( safemode_empty ) {
+                const monster_attitude matt = critter.attitude( &u );
+                alarming = MATT_ATTACK == matt || MATT_FOLLOW == matt;
+            } else {
+                alarming = rules.check_monster( critter.name(), critter.attitude_to( u ),
+                                                mon_dist ) == RULE_BLACKLISTED;
+            }
 
-            if( ( !safemode_empty && safemode_state == RULE_BLACKLISTED ) || ( safemode_empty &&
-                    ( MATT_ATTACK == matt || MATT_FOLLOW == matt ) ) ) {
+            if( alarming ) {
                 if( index < 8 && critter.sees( g->u ) ) {
                     dangerous[index] = true;
                 }
@@ -3998,11 +4082,11 @@ void game::mon_info_update( )
             //Safe mode NPC check
 
             const int npc_dist = rl_dist( u.pos(), p->pos() );
-            safemode_state = get_safemode().check_monster( get_safemode().npc_type_name(), p->attitude_to( u ),
-                             npc_dist );
+            const bool alarming = safemode_empty ? p->get_attitude() == NPCATT_KILL :
+                                  rules.check_monster( get_safemode().npc_type_name(), p->attitude_to( u ),
+                                          npc_dist ) == RULE_BLACKLISTED;
 
-            if( ( !safemode_empty && safemode_state == RULE_BLACKLISTED ) || ( safemode_empty &&
-                    p->get_attitude() == NPCATT_KILL ) ) {
+            if( alarming ) {
                 if( !safemode_empty || npc_dist <= iProxyDist ) {
                     newseen++;
                 }
@@ -4092,10 +4176,63 @@ void game::cleanup_dead()
     critter_died = false;
 }
 
+namespace
+{
+
+// Lets idle monsters far away from the player plan less often, see the MONSTER_AI_* options
+class monster_plan_scheduler
+{
+    public:
+        monster_plan_scheduler() :
+            lod_distance( get_option<int>( "MONSTER_AI_LOD_DISTANCE" ) ),
+            interval( time_duration::from_turns( get_option<int>( "MONSTER_AI_LOD_INTERVAL" ) ) ),
+            budget( std::chrono::milliseconds( get_option<int>( "MONSTER_AI_BUDGET" ) ) ) {
+        }
+
+        bool is_reduced( const monster &critter, const tripoint &player_pos ) const {
+            return lod_distance > 0 && critter.friendly == 0 && critter.wander() &&
+                   rl_dist( critter.pos(), player_pos ) > lod_distance;
+        }
+
+        bool may_plan( const monster &critter ) const {
+            if( calendar::turn < critter.next_plan ) {
+                return false;
+            }
+            // Plans that are late by a whole interval ignore the budget, so nobody starves
+            return budget.count() == 0 || spent < budget ||
+                   calendar::turn >= critter.next_plan + interval;
+        }
+
+        void plan( monster &critter, bool reduced ) {
+            turn_profiler::scoped_phase plan_phase( turn_profiler::phase::monster_plan );
+            if( !reduced || budget.count() == 0 ) {
+                critter.plan();
+                return;
+            }
+            const auto start = std::chrono::steady_clock::now();
+            critter.plan();
+            spent += std::chrono::steady_clock::now() - start;
+        }
+
+        void planned( monster &critter ) const {
+            critter.next_plan = calendar::turn + interval;
+        }
+
+    private:
+        const int lod_distance;
+        const time_duration interval;
+        const std::chrono::steady_clock::duration budget;
+        std::chrono::steady_clock::duration spent{ 0 };
+};
+
+} // namespace
+
 void game::monmove()
 {
     ZoneScoped;
+    turn_profiler::scoped_phase monster_phase( turn_profiler::phase::monmove );
     cleanup_dead();
+    monster_plan_scheduler scheduler;
 
     for( monster &critter : all_monsters() ) {
         // Critters in impassable tiles get pushed away, unless it's not impassable for them
@@ -4133,17 +4270,25 @@ void game::monmove()
             }
             critter.try_reproduce();
         }
+        // Far away idle monsters keep following their last plan in between their own
+        const bool reduced = scheduler.is_reduced( critter, u.pos() );
+        const bool plans = !reduced || scheduler.may_plan( critter );
+        bool planned = false;
         while( critter.moves > 0 && !critter.is_dead() && !critter.has_effect( effect_ridden ) ) {
             critter.made_footstep = false;
             // Controlled critters don't make their own plans
-            if( !critter.has_effect( effect_ai_controlled ) ) {
+            if( plans && !critter.has_effect( effect_ai_controlled ) ) {
                 // Formulate a path to follow
-                critter.plan();
+                scheduler.plan( critter, reduced );
+                planned = true;
             }
             critter.move(); // Move one square, possibly hit u
             critter.process_triggers();
             m.creature_in_field( critter );
         }
+        if( reduced && planned ) {
+            scheduler.planned( critter );
+        }
 
         const bionic_id bio_alarm( "bio_alarm" );
         if( !critter.is_dead() &&
@@ -4175,7 +4320,10 @@ void game::monmove()
         }
     }
 
+    monster_phase.stop();
+
     // Now, do active NPCs.
+    turn_profiler::scoped_phase npc_phase( turn_profiler::phase::npc_moves );
     for( npc &guy : g->all_npcs() ) {
         int turns = 0;
         if( guy.is_mounted() ) {
@@ -4234,8 +4382,10 @@ void game::overmap_npc_move()
             travelling_npcs.push_back( npc_to_add );
         }
     }
+    bool npcs_moved = false;
     for( auto &elem : travelling_npcs ) {
         if( elem->has_omt_destination() ) {
+            npcs_moved = true;
             if( !elem->omt_path.empty() && rl_dist( elem->omt_path.back(), elem->global_omt_location() ) > 2 ) {
                 //recalculate path, we got distracted doing something else probably
                 elem->omt_path.clear();
@@ -4259,10 +4409,12 @@ void game::overmap_npc_move()
                 elem->travel_overmap(
                     project_to<coords::sm>( elem->omt_path.back() ).raw() );
             }
-            reload_npcs();
         }
     }
-    return;
+    // Unloading and loading every active NPC is expensive, do it once for all of the moves
+    if( npcs_moved ) {
+        reload_npcs();
+    }
 }
 
 /* Knockback target at t by force number of tiles in direction from s to t
@@ -10823,6 +10975,8 @@ point game::update_map( int &x, int &y )
         m.shift( this_shift );
         remaining_shift -= this_shift;
     }
+    // Cached temperatures are keyed by local coordinates
+    get_weather().clear_temp_cache();
 
     grid_tracker_ptr->load( m );
 
@@ -10884,6 +11038,17 @@ void game::update_overmap_seen()
     const int dist_squared = dist * dist;
     // We can always see where we're standing
     overmap_buffer.set_seen( ompos, true );
+    // Every sight line crosses tiles near the center, look up the cost of each tile only once
+    const int side = 2 * dist + 1;
+    std::vector<int> see_costs( static_cast<size_t>( side ) * side, -1 );
+    const auto see_cost_at = [&]( const tripoint_abs_omt & p ) {
+        const point_rel_omt offset = p.xy() - ompos.xy() + point_rel_omt( dist, dist );
+        int &cost = see_costs[offset.x() + offset.y() * side];
+        if( cost < 0 ) {
+            cost = static_cast<int>( overmap_buffer.ter( p )->get_see_cost() );
+        }
+        return cost;
+    };
     for( const tripoint_abs_omt &p : points_in_radius( ompos, dist ) ) {
         const point_rel_omt delta = p.xy() - ompos.xy();
         const int h_squared = delta.x() * delta.x() + delta.y() * delta.y();
@@ -10903,8 +11068,7 @@ void game::update_overmap_seen()
         float sight_points = dist;
         for( auto it = line.begin();
              it != line.end() && sight_points >= 0; ++it ) {
-            const oter_id &ter = overmap_buffer.ter( *it );
-            sight_points -= static_cast<int>( ter->get_see_cost() ) * multiplier;
+            sight_points -= see_cost_at( *it ) * multiplier;
         }
         if( sight_points >= 0 ) {
             tripoint_abs_omt seen( p );
@@ -12062,6 +12226,26 @@ std::vector<Creature *> game::get_creatures_if( const std::function<bool( const
     return result;
 }
 
+std::vector<Creature *> game::get_creatures_in_radius( const tripoint &center, int radius,
+        const std::function<bool( const Creature & )> &pred )
+{
+    std::vector<Creature *> result;
+    for( monster *critter : critter_tracker->find_in_radius( center, radius ) ) {
+        if( pred( *critter ) ) {
+            result.push_back( critter );
+        }
+    }
+    for( npc &guy : all_npcs() ) {
+        if( square_dist( guy.pos(), center ) <= radius && pred( guy ) ) {
+            result.push_back( &guy );
+        }
+    }
+    if( square_dist( u.pos(), center ) <= radius && pred( u ) ) {
+        result.push_back( &u );
+    }
+    return result;
+}
+
 std::vector<npc *> game::get_npcs_if( const std::function<bool( const npc & )> &pred )
 {
     std::vector<npc *> result;
@@ -413,6 +413,13 @@ class game
          * are checked ( and returned ). Returned pointers are never null.
          */
         std::vector<Creature *> get_creatures_if( const std::function<bool( const Creature & )> &pred );
+        /**
+         * Same as @ref get_creatures_if, but only creatures with a @ref square_dist of at most
+         * @p radius to @p center are checked.  Monsters are found through the spatial index
+         * of the creature tracker, so this is cheap for small radii.
+         */
+        std::vector<Creature *> get_creatures_in_radius( const tripoint &center, int radius,
+                const std::function<bool( const Creature & )> &pred );
         std::vector<npc *> get_npcs_if( const std::function<bool( const npc & )> &pred );
         /**
          * Returns a creature matching a predicate. Only living (not dead) creatures
@@ -800,6 +807,7 @@ class game
                        int hor_padding = 0 ); // Prints a list of nearby monsters
         void mon_info_update( );    //Update seen monsters information
         void cleanup_dead();     // Delete any dead NPCs/monsters
+        void monmove();          // Monster and NPC movement
         bool is_dangerous_tile( const tripoint &dest_loc ) const;
         std::vector<std::string> get_dangerous_tile( const tripoint &dest_loc ) const;
         bool prompt_dangerous_tile( const tripoint &dest_loc ) const;
@@ -855,7 +863,6 @@ class game
         void perhaps_add_random_npc();
 
         // Routine loop functions, approximately in order of execution
-        void monmove();          // Monster movement
         void overmap_npc_move(); // NPC overmap movement
         void process_voluntary_act_interrupt(); // Process
         void process_activity(); // Processes and enacts the player's activity
@@ -1031,6 +1038,8 @@ class game
         bool critter_died = false;
         /** Is this the first redraw since waiting (sleeping or activity) started */
         bool first_redraw_since_waiting_started = true;
+        /** Is a long wait in progress, during which only the wait popup is redrawn */
+        bool fast_forwarding = false;
         /** Is Zone manager open or not - changes graphics of some zone tiles */
         bool zones_manager_open = false;
 
@@ -29,6 +29,10 @@ class game_object
         friend location_visitable<location_inventory>;
         template<typename U>
         friend void ::std::swap( location_vector<U> &, location_vector<U> & ) noexcept ;
+        friend safe_reference<T>;
+
+        /** Record of the safe references to this object, managed by safe_reference. Not copied. */
+        mutable typename safe_reference<T>::record *safe_ref_record = nullptr;
     protected:
         location<T> *saved_loc = nullptr;
         location<T> *loc = nullptr;
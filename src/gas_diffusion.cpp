@@ -0,0 +1,226 @@
+#include "gas_diffusion.h"
+
+#include <algorithm>
+
+#include "thread_pool.h"
+
+namespace gas_diffusion
+{
+
+layer::layer( int size ) : size( size )
+{
+    const size_t tiles = static_cast<size_t>( size ) * size;
+    intensity.assign( tiles, 0 );
+    age.assign( tiles, 0 );
+    permeability.assign( tiles, 0 );
+    windpower.assign( tiles, 0 );
+    sheltered.assign( tiles, false );
+    next_intensity.assign( tiles, 0 );
+    next_age.assign( tiles, 0 );
+    target.assign( tiles, -1 );
+}
+
+std::array<point, 3> wind_blockers( int winddirection )
+{
+    static const std::array<std::pair<int, std::array<point, 3>>, 9> outputs = {{
+            { 330, { point_east, point_north_east, point_south_east } },
+            { 301, { point_south_east, point_east, point_south } },
+            { 240, { point_south, point_south_west, point_south_east } },
+            { 211, { point_south_west, point_west, point_south } },
+            { 150, { point_west, point_north_west, point_south_west } },
+            { 121, { point_north_west, point_north, point_west } },
+            { 60, { point_north, point_north_west, point_north_east } },
+            { 31, { point_north_east, point_east, point_north } },
+            { 0, { point_east, point_north_east, point_south_east } }
+        }
+    };
+    for( const std::pair<int, std::array<point, 3>> &val : outputs ) {
+        if( winddirection >= val.first ) {
+            return val.second;
+        }
+    }
+    return {};
+}
+
+namespace
+{
+
+constexpr int down_target = 8;
+constexpr int up_target = 9;
+
+// Stateless replacement for the global rng, so decisions don't depend on the order
+// (or thread) in which tiles are visited.
+class tile_rng
+{
+    public:
+        explicit tile_rng( std::uint64_t seed ) : state( seed ) {}
+
+        int roll( int lo, int hi ) {
+            // splitmix64
+            state += UINT64_C( 0x9e3779b97f4a7c15 );
+            std::uint64_t z = state;
+            z = ( z ^ ( z >> 30 ) ) * UINT64_C( 0xbf58476d1ce4e5b9 );
+            z = ( z ^ ( z >> 27 ) ) * UINT64_C( 0x94d049bb133111eb );
+            z ^= z >> 31;
+            return lo + static_cast<int>( z % static_cast<std::uint64_t>( hi - lo + 1 ) );
+        }
+        bool one_in( int chance ) {
+            return chance <= 1 || roll( 0, chance - 1 ) == 0;
+        }
+        bool x_in_y( int x, int y ) {
+            return roll( 1, y ) <= x;
+        }
+
+    private:
+        std::uint64_t state;
+};
+
+int intensity_at( const layer &l, int idx )
+{
+    return l.empty() ? 0 : l.intensity[idx];
+}
+
+// Mirrors the choices of map::spread_gas, using only the state at the start of the pass
+int choose_target( const std::vector<layer> &layers, int z, int x, int y,
+                   const settings &opts, const std::array<point, 3> &blockers )
+{
+    const layer &cur = layers[z];
+    const int idx = x + y * cur.size;
+    const int current_intensity = cur.intensity[idx];
+    if( current_intensity <= 1 ) {
+        return -1;
+    }
+
+    tile_rng rng( opts.seed ^ ( static_cast<std::uint64_t>( z ) << 40 ) ^
+                  static_cast<std::uint64_t>( idx ) * UINT64_C( 0x100000001b3 ) );
+    const int windpower = cur.windpower[idx];
+    if( rng.roll( 1, std::max( 1, 100 - windpower ) ) > opts.percent_spread ) {
+        return -1;
+    }
+
+    const std::uint16_t open = cur.permeability[idx];
+    const bool can_fall = opts.zlevels && z > 0 && ( open & open_below ) &&
+                          !layers[z - 1].empty();
+    if( can_fall && intensity_at( layers[z - 1], idx ) < current_intensity ) {
+        return down_target;
+    }
+
+    std::array<int, 8> spread;
+    size_t num_spread = 0;
+    const int start = rng.roll( 0, 7 );
+    for( int count = 0; count < 8; count++ ) {
+        const int i = ( start + 1 + count ) % 8;
+        if( !( open & ( 1 << i ) ) ) {
+            continue;
+        }
+        const point n = point( x, y ) + eight_horizontal_neighbors[i].xy();
+        if( n.x < 0 || n.y < 0 || n.x >= cur.size || n.y >= cur.size ) {
+            continue;
+        }
+        if( cur.intensity[n.x + n.y * cur.size] < current_intensity ) {
+            spread[num_spread++] = i;
+        }
+    }
+
+    if( num_spread > 0 && ( !opts.zlevels || rng.one_in( num_spread ) ) ) {
+        if( cur.sheltered[idx] || windpower < 5 ) {
+            return spread[rng.roll( 0, num_spread - 1 )];
+        }
+        // Spreading into the wind only succeeds sometimes
+        std::array<int, 8> downwind;
+        size_t num_downwind = 0;
+        for( size_t i = 0; i < num_spread; i++ ) {
+            const point offset = eight_horizontal_neighbors[spread[i]].xy();
+            const bool upwind = std::find( blockers.begin(), blockers.end(), offset ) != blockers.end();
+            if( !upwind || rng.x_in_y( 1, std::max( 2, windpower ) ) ) {
+                downwind[num_downwind++] = spread[i];
+            }
+        }
+        if( num_downwind > 0 ) {
+            return downwind[rng.roll( 0, num_downwind - 1 )];
+        }
+        return -1;
+    }
+
+    const bool can_rise = opts.zlevels && z + 1 < static_cast<int>( layers.size() ) &&
+                          ( open & open_above ) && !layers[z + 1].empty();
+    if( can_rise && intensity_at( layers[z + 1], idx ) < current_intensity ) {
+        return up_target;
+    }
+    return -1;
+}
+
+// Gas moves one intensity level at a time, taking its share of the age along
+int moved_age( const layer &l, int idx )
+{
+    return l.age[idx] / l.intensity[idx];
+}
+
+void gather( std::vector<layer> &layers, int z, int y, const settings &opts )
+{
+    layer &cur = layers[z];
+    const layer *below = z > 0 && !layers[z - 1].empty() ? &layers[z - 1] : nullptr;
+    const layer *above = z + 1 < static_cast<int>( layers.size() ) &&
+                         !layers[z + 1].empty() ? &layers[z + 1] : nullptr;
+    for( int x = 0; x < cur.size; x++ ) {
+        const int idx = x + y * cur.size;
+        int intensity = cur.intensity[idx];
+        int age = cur.age[idx];
+        if( cur.target[idx] >= 0 ) {
+            intensity--;
+            age -= moved_age( cur, idx );
+        }
+        for( int i = 0; i < 8; i++ ) {
+            // The neighbour on the opposite side has to target this tile
+            const point src = point( x, y ) - eight_horizontal_neighbors[i].xy();
+            if( src.x < 0 || src.y < 0 || src.x >= cur.size || src.y >= cur.size ) {
+                continue;
+            }
+            const int src_idx = src.x + src.y * cur.size;
+            if( cur.target[src_idx] == i ) {
+                intensity++;
+                age += moved_age( cur, src_idx );
+            }
+        }
+        if( below != nullptr && below->target[idx] == up_target ) {
+            intensity++;
+            age += moved_age( *below, idx );
+        }
+        if( above != nullptr && above->target[idx] == down_target ) {
+            intensity++;
+            age += moved_age( *above, idx );
+        }
+        cur.next_intensity[idx] = static_cast<std::uint8_t>( std::min( intensity, opts.max_intensity ) );
+        cur.next_age[idx] = std::max( age, 0 );
+    }
+}
+
+} // namespace
+
+void diffuse( std::vector<layer> &layers, const settings &opts )
+{
+    // Work items are rows, the layers may have different sizes if some are empty
+    std::vector<std::pair<int, int>> rows;
+    for( size_t z = 0; z < layers.size(); z++ ) {
+        for( int y = 0; y < layers[z].size; y++ ) {
+            rows.emplace_back( static_cast<int>( z ), y );
+        }
+    }
+    const std::array<point, 3> blockers = wind_blockers( opts.winddirection );
+
+    thread_pool &pool = get_thread_pool();
+    pool.parallel_for( 0, static_cast<int>( rows.size() ), [&]( int i ) {
+        const int z = rows[i].first;
+        const int y = rows[i].second;
+        layer &cur = layers[z];
+        for( int x = 0; x < cur.size; x++ ) {
+            cur.target[x + y * cur.size] = static_cast<std::int8_t>(
+                                               choose_target( layers, z, x, y, opts, blockers ) );
+        }
+    } );
+    pool.parallel_for( 0, static_cast<int>( rows.size() ), [&]( int i ) {
+        gather( layers, rows[i].first, rows[i].second, opts );
+    } );
+}
+
+} // namespace gas_diffusion
@@ -0,0 +1,80 @@
+#pragma once
+#ifndef CATA_SRC_GAS_DIFFUSION_H
+#define CATA_SRC_GAS_DIFFUSION_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "point.h"
+
+/**
+ * Double buffered spreading of gas fields, used by field types with `buffered_diffusion`.
+ *
+ * Unlike @ref map::spread_gas, which moves gas between live fields while iterating over
+ * them, every decision here is made from the state at the start of the pass and written
+ * to a second buffer.  The result doesn't depend on the processing order, so rows and
+ * z-levels are processed in parallel.  Random rolls come from a hash of the seed and the
+ * tile instead of the shared rng for the same reason.
+ *
+ * The kernel knows nothing about the map: the caller fills the layers with the current
+ * intensities and the precomputed per tile properties, and applies the result.
+ */
+namespace gas_diffusion
+{
+
+/** @ref permeability bit for the tile below, bits 0-7 follow eight_horizontal_neighbors. */
+constexpr std::uint16_t open_below = 1 << 8;
+constexpr std::uint16_t open_above = 1 << 9;
+
+/**
+ * One z-level of one gas type.  All vectors are indexed by x + y * size.
+ * A layer constructed with size 0 stands for a z-level without gas that can't receive any.
+ */
+struct layer {
+    explicit layer( int size = 0 );
+
+    bool empty() const {
+        return intensity.empty();
+    }
+
+    int size;
+
+    // Current state.  Intensity 0 means there is no field.
+    std::vector<std::uint8_t> intensity;
+    std::vector<int> age;
+
+    // Only needed for tiles with an intensity above 1, which are the only ones that spread.
+    // Bit i of permeability is set if gas can move to the i-th neighbour.
+    std::vector<std::uint16_t> permeability;
+    std::vector<int> windpower;
+    std::vector<bool> sheltered;
+
+    // Results of @ref diffuse.
+    std::vector<std::uint8_t> next_intensity;
+    std::vector<int> next_age;
+
+    // Index into eight_horizontal_neighbors, 8 for down, 9 for up, -1 for staying put
+    std::vector<std::int8_t> target;
+};
+
+struct settings {
+    int percent_spread = 0;
+    int max_intensity = 1;
+    int winddirection = 0;
+    bool zlevels = false;
+    std::uint64_t seed = 0;
+};
+
+/** The three offsets facing into the wind, which gas only rarely spreads to. */
+std::array<point, 3> wind_blockers( int winddirection );
+
+/**
+ * Computes next_intensity and next_age of every layer.  Layers are consecutive z-levels,
+ * starting with the lowest one.  Gas never leaves the layers or the square they cover.
+ */
+void diffuse( std::vector<layer> &layers, const settings &opts );
+
+} // namespace gas_diffusion
+
+#endif // CATA_SRC_GAS_DIFFUSION_H
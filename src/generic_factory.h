@@ -12,6 +12,7 @@
 #include "catacharset.h"
 #include "debug.h"
 #include "enum_bitset.h"
+#include "flat_hash_map.h"
 #include "generic_readers.h"
 #include "init.h"
 #include "int_id.h"
@@ -127,7 +128,7 @@ class generic_factory
         // it's incremented when any changes to the inner id containers occur
         // version value corresponds to the string_id::_version,
         // so incrementing the version here effectively invalidates all cached string_id::_cid
-        int64_t  version = 0;
+        factory_version version = 0;
 
         void inc_version() {
             do {
@@ -143,7 +144,7 @@ class generic_factory
         }
 
         std::vector<T> list;
-        std::unordered_map<string_id<T>, int_id<T>> map;
+        flat_hash_map<string_id<T>, int_id<T>> map;
         std::unordered_map<std::string, T> abstracts;
 
         std::string type_name;
@@ -158,14 +159,14 @@ class generic_factory
                 return is_valid( result );
             }
 
-            const auto iter = map.find( id );
+            const int_id<T> *found = map.find( id );
             // map lookup happens at most once per string_id instance per generic_factory::version
             // id was not found, explicitly marking it as "invalid"
-            if( iter == map.end() ) {
+            if( !found ) {
                 id.set_cid_version( INVALID_CID, version );
                 return false;
             }
-            result = iter->second;
+            result = *found;
             id.set_cid_version( result.to_i(), version );
             return true;
         }
@@ -175,15 +176,9 @@ class generic_factory
             if( !find_id( id, i_id ) ) {
                 return;
             }
-            auto iter = map.begin();
-            const auto end = map.end();
-            for( ; iter != end; ) {
-                if( iter->second == i_id && iter->first != id ) {
-                    map.erase( iter++ );
-                } else {
-                    ++iter;
-                }
-            }
+            map.erase_if( [&]( const string_id<T> &key, const int_id<T> &value ) {
+                return value == i_id && key != id;
+            } );
         }
 
         const T dummy_obj;
@@ -227,10 +222,10 @@ class generic_factory
             static const std::string abstract_member_name( "abstract" );
             if( jo.has_string( copy_from_member_name ) ) {
                 const std::string source = jo.get_string( copy_from_member_name );
-                auto base = map.find( string_id<T>( source ) );
+                const int_id<T> *base = map.find( string_id<T>( source ) );
 
-                if( base != map.end() ) {
-                    def = obj( base->second );
+                if( base ) {
+                    def = obj( *base );
                 } else {
                     auto ab = abstracts.find( source );
 
@@ -357,11 +352,11 @@ class generic_factory
             // in the common scenario there is no loss of performance, as `finalize` will make cache
             // for all ids valid again
             inc_version();
-            const auto iter = map.find( obj.id );
-            if( iter != map.end() ) {
-                T &result = list[iter->second.to_i()];
+            if( const int_id<T> *existing = map.find( obj.id ) ) {
+                const int cid = existing->to_i();
+                T &result = list[cid];
                 result = obj;
-                result.id.set_cid_version( iter->second.to_i(), version );
+                result.id.set_cid_version( cid, version );
                 return result;
             }
 
@@ -510,8 +505,8 @@ class generic_factory
             public:
                 Version() = default;
             private:
-                Version( int64_t version ) : version( version ) {}
-                int64_t  version = -1;
+                Version( factory_version version ) : version( version ) {}
+                factory_version version = INVALID_VERSION;
             public:
                 bool operator==( const Version &rhs ) const {
                     return version == rhs.version;
@@ -1,6 +1,8 @@
 #include "init.h"
 
+#include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <cstddef>
 #include <exception>
 #include <fstream>
@@ -73,6 +75,7 @@
 #include "mutation.h"
 #include "npc.h"
 #include "npc_class.h"
+#include "options.h"
 #include "omdata.h"
 #include "overlay_ordering.h"
 #include "overmap.h"
@@ -81,6 +84,7 @@
 #include "overmap_location.h"
 #include "overmap_special.h"
 #include "profession.h"
+#include "profile.h"
 #include "recipe_dictionary.h"
 #include "recipe_groups.h"
 #include "regional_settings.h"
@@ -96,6 +100,7 @@
 #include "start_location.h"
 #include "string_formatter.h"
 #include "text_snippets.h"
+#include "thread_pool.h"
 #include "translations.h"
 #include "trap.h"
 #include "type_id.h"
@@ -486,24 +491,28 @@ void DynamicDataLoader::load_data_from_path( const std::string &path, const std:
             files.push_back( path );
         }
     }
-    // iterate over each file
-    for( auto &files_i : files ) {
-        const std::string &file = files_i;
-        // open the file as a stream
-        cata_ifstream infile = std::move( cata_ifstream().mode( cata_ios_mode::binary ).open( file ) );
-        // and stuff it into ram
-        std::istringstream iss(
-            std::string(
-                ( std::istreambuf_iterator<char>( *infile ) ),
-                std::istreambuf_iterator<char>()
-            )
-        );
-        try {
-            // parse it
-            JsonIn jsin( iss, file );
-            load_all_from_json( jsin, src, ui, path, file );
-        } catch( const JsonError &err ) {
-            throw std::runtime_error( err.what() );
+    // Files are read from disk in parallel, a batch at a time to bound memory use,
+    // and then parsed one after another in their original order.
+    static constexpr size_t read_batch_size = 64;
+    std::vector<std::string> contents;
+    for( size_t batch_start = 0; batch_start < files.size(); batch_start += read_batch_size ) {
+        const size_t batch_end = std::min( files.size(), batch_start + read_batch_size );
+        contents.assign( batch_end - batch_start, std::string() );
+        get_thread_pool().parallel_for( static_cast<int>( batch_start ), static_cast<int>( batch_end ),
+        [&]( int i ) {
+            contents[i - batch_start] = read_entire_file( files[i] );
+        } );
+
+        for( size_t i = batch_start; i < batch_end; ++i ) {
+            const std::string &file = files[i];
+            std::istringstream iss( std::move( contents[i - batch_start] ) );
+            try {
+                // parse it
+                JsonIn jsin( iss, file );
+                load_all_from_json( jsin, src, ui, path, file );
+            } catch( const JsonError &err ) {
+                throw std::runtime_error( err.what() );
+            }
         }
     }
 }
@@ -722,13 +731,33 @@ void DynamicDataLoader::finalize_loaded_data( loading_ui &ui )
     }
 
     ui.show();
+    // Stages run one after another: they read and write each others' registries, and
+    // looking up a string_id caches the result in the id itself, which isn't thread safe.
+    // Timing every stage at least shows where startup time goes.
     for( const named_entry &e : entries ) {
-        e.second();
+        const auto start = std::chrono::steady_clock::now();
+        {
+            ZoneScopedN( "finalize_stage" );
+            ZoneText( e.first.c_str(), e.first.size() );
+            e.second();
+        }
+        const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                                 std::chrono::steady_clock::now() - start );
+        DebugLog( DL::Info, DC::Main ) << "Finalized " << e.first << " in " << elapsed.count() << " ms";
         ui.proceed();
     }
 }
 
 void DynamicDataLoader::check_consistency( loading_ui &ui )
+{
+    if( !get_option<bool>( "CHECK_DATA_ON_LOAD" ) ) {
+        finalized = true;
+        return;
+    }
+    force_check_consistency( ui );
+}
+
+void DynamicDataLoader::force_check_consistency( loading_ui &ui )
 {
     ui.new_context( _( "Verifying" ) );
 
@@ -832,7 +861,7 @@ void DynamicDataLoader::check_consistency( loading_ui &ui )
  * @param packs content packs to load in correct dependent order
  */
 static void load_and_finalize_packs( loading_ui &ui, const std::string &msg,
-                                     const std::vector<mod_id> &packs )
+                                     const std::vector<mod_id> &packs, bool force_checks = false )
 {
     ui.new_context( msg );
     std::vector<mod_id> missing;
@@ -899,7 +928,11 @@ static void load_and_finalize_packs( loading_ui &ui, const std::string &msg,
         }
     }
 
-    loader.check_consistency( ui );
+    if( force_checks ) {
+        loader.force_check_consistency( ui );
+    } else {
+        loader.check_consistency( ui );
+    }
 
     if( cata::has_lua() ) {
         init::load_main_lua_scripts( *loader.lua, packs );
@@ -1037,7 +1070,7 @@ bool init::check_mods_for_errors( loading_ui &ui, const std::vector<mod_id> &opt
         mods_list.push_back( id );
 
         try {
-            load_and_finalize_packs( ui, _( "Checking mods" ), mods_list );
+            load_and_finalize_packs( ui, _( "Checking mods" ), mods_list, true );
         } catch( const std::exception &err ) {
             std::cerr << "Error loading data: " << err.what() << '\n';
         }
@@ -118,11 +118,14 @@ class DynamicDataLoader
 
     public:
         /**
-         * Check the consistency of all the loaded data.
+         * Check the consistency of all the loaded data, unless disabled by the
+         * CHECK_DATA_ON_LOAD option.
          * May print a debugmsg if something seems wrong.
          * @param ui Finalization status display.
          */
         void check_consistency( loading_ui &ui );
+        /** Like @ref check_consistency, but ignores the option (e.g. for --check-mods). */
+        void force_check_consistency( loading_ui &ui );
 
         /**
          * Returns the single instance of this class.
@@ -22,11 +22,13 @@
 #include "game.h"
 #include "help.h"
 #include "ime.h"
+#include "input_replay.h"
 #include "json.h"
 #include "options.h"
 #include "output.h"
 #include "path_info.h"
 #include "popup.h"
+#include "stall_watchdog.h"
 #include "string_formatter.h"
 #include "string_input_popup.h"
 #include "string_utils.h"
@@ -1410,6 +1412,20 @@ input_event input_context::get_raw_input()
     return next_action;
 }
 
+input_event input_manager::get_input_event()
+{
+    if( std::optional<input_event> replayed = input_replay::next_event() ) {
+        previously_pressed_key = replayed->type == input_event_t::keyboard ?
+                                 replayed->get_first_input() : 0;
+        return *replayed;
+    }
+    stall_watchdog::idle();
+    input_event evt = get_platform_input_event();
+    stall_watchdog::busy();
+    input_replay::record( evt );
+    return evt;
+}
+
 int input_manager::get_previously_pressed_key() const
 {
     return previously_pressed_key;
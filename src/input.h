@@ -280,7 +280,7 @@ class input_manager
         /**
          * curses getch() replacement.
          *
-         * Defined in the respective platform wrapper, e.g. sdlcurse.cpp
+         * Comes from the running input replay if there is one, see input_replay.h.
          */
         input_event get_input_event();
         /**
@@ -310,6 +310,9 @@ class input_manager
     private:
         friend class input_context;
 
+        /** Reads the next event from the terminal or window, defined in the platform wrapper. */
+        input_event get_platform_input_event();
+
         using t_input_event_list = std::vector<input_event>;
         using t_actions = std::map<std::string, action_attributes>;
         using t_action_contexts = std::map<std::string, t_actions>;
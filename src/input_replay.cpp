@@ -0,0 +1,125 @@
+#include "input_replay.h"
+
+#include <deque>
+#include <fstream>
+#include <istream>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include "debug.h"
+#include "fstream_utils.h"
+#include "input.h"
+#include "json.h"
+
+static const std::string header_tag = "input-replay";
+static constexpr int format_version = 1;
+
+static std::unique_ptr<std::ofstream> recording;
+static std::deque<input_event> replay_events;
+
+bool input_replay::start_recording( const std::string &path, unsigned int seed )
+{
+    recording = std::make_unique<std::ofstream>( path, std::ios::binary | std::ios::trunc );
+    if( !recording->is_open() ) {
+        recording.reset();
+        return false;
+    }
+    {
+        JsonOut jsout( *recording );
+        jsout.start_array();
+        jsout.write( header_tag );
+        jsout.write( format_version );
+        jsout.write( seed );
+        jsout.end_array();
+    }
+    *recording << '\n';
+    recording->flush();
+    return !recording->fail();
+}
+
+bool input_replay::start_replay( const std::string &path, unsigned int &seed )
+{
+    std::deque<input_event> events;
+    bool header_ok = false;
+    const bool read = read_from_file( path, [&]( std::istream & fin ) {
+        std::string line;
+        if( std::getline( fin, line ) ) {
+            std::istringstream iss( line );
+            JsonIn jsin( iss );
+            jsin.start_array();
+            if( jsin.get_string() == header_tag && jsin.get_int() == format_version ) {
+                seed = jsin.get_uint();
+                header_ok = true;
+            }
+        }
+        while( header_ok && std::getline( fin, line ) ) {
+            if( !line.empty() ) {
+                events.push_back( deserialize_event( line ) );
+            }
+        }
+    } );
+    if( !read || !header_ok ) {
+        return false;
+    }
+    replay_events = std::move( events );
+    DebugLog( DL::Info, DC::Main ) << "Replaying " << replay_events.size() << " input events from "
+                                   << path;
+    return true;
+}
+
+std::optional<input_event> input_replay::next_event()
+{
+    if( replay_events.empty() ) {
+        return std::nullopt;
+    }
+    input_event evt = std::move( replay_events.front() );
+    replay_events.pop_front();
+    if( replay_events.empty() ) {
+        DebugLog( DL::Info, DC::Main ) << "Input replay finished";
+    }
+    return evt;
+}
+
+void input_replay::record( const input_event &evt )
+{
+    if( !recording ) {
+        return;
+    }
+    *recording << serialize_event( evt ) << '\n';
+    // Flushed every time, so a crash doesn't lose the events leading up to it
+    recording->flush();
+}
+
+std::string input_replay::serialize_event( const input_event &evt )
+{
+    std::ostringstream oss;
+    JsonOut jsout( oss );
+    jsout.start_array();
+    jsout.write( static_cast<int>( evt.type ) );
+    jsout.write( evt.mouse_pos.x );
+    jsout.write( evt.mouse_pos.y );
+    jsout.write( evt.sequence );
+    jsout.write( evt.modifiers );
+    jsout.write( evt.text );
+    jsout.end_array();
+    return oss.str();
+}
+
+input_event input_replay::deserialize_event( const std::string &line )
+{
+    std::istringstream iss( line );
+    JsonIn jsin( iss );
+    input_event evt;
+    jsin.start_array();
+    evt.type = static_cast<input_event_t>( jsin.get_int() );
+    evt.mouse_pos.x = jsin.get_int();
+    evt.mouse_pos.y = jsin.get_int();
+    jsin.read( evt.sequence, true );
+    jsin.read( evt.modifiers, true );
+    evt.text = jsin.get_string();
+    if( !jsin.end_array() ) {
+        jsin.error( "too many values in input event" );
+    }
+    return evt;
+}
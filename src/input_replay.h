@@ -0,0 +1,45 @@
+#pragma once
+#ifndef CATA_SRC_INPUT_REPLAY_H
+#define CATA_SRC_INPUT_REPLAY_H
+
+#include <optional>
+#include <string>
+
+struct input_event;
+
+/**
+ * Recording and replaying of input sessions.
+ *
+ * A recording holds the RNG seed of the session and every event returned by
+ * @ref input_manager::get_input_event, one JSON array per line.  Replaying it feeds the
+ * events back instead of reading the terminal or window, as fast as they are asked for,
+ * so a slow session can be reproduced under a profiler.  Once the recording is used up
+ * input comes from the player again.
+ *
+ * Things that depend on wall clock time (autosave by real time, animations) are not
+ * recorded, so sessions relying on them may diverge.
+ */
+namespace input_replay
+{
+
+/** Starts writing a recording to @p path.  Returns false if the file can't be opened. */
+bool start_recording( const std::string &path, unsigned int seed );
+/**
+ * Loads the recording at @p path and sets @p seed to the one it was made with.
+ * Returns false if the file can't be read.
+ */
+bool start_replay( const std::string &path, unsigned int &seed );
+
+/** Next event of the replay, or nothing if no replay is running (anymore). */
+std::optional<input_event> next_event();
+/** Adds @p evt to the recording, if one is being written. */
+void record( const input_event &evt );
+
+/** One line of a recording. */
+std::string serialize_event( const input_event &evt );
+/** Inverse of @ref serialize_event, throws JsonError on malformed input. */
+input_event deserialize_event( const std::string &line );
+
+} // namespace input_replay
+
+#endif // CATA_SRC_INPUT_REPLAY_H
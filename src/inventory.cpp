@@ -483,6 +483,12 @@ void inventory::form_from_zone( map &m, std::unordered_set<tripoint> &zone_pts,
 void inventory::form_from_map( map &m, const tripoint &origin, int range, const Character *pl,
                                bool assign_invlet,
                                bool clear_path )
+{
+    form_from_map( m, points_in_range( m, origin, range, clear_path ), pl, assign_invlet );
+}
+
+std::vector<tripoint> inventory::points_in_range( const map &m, const tripoint &origin, int range,
+        bool clear_path )
 {
     // populate a grid of spots that can be reached
     std::vector<tripoint> reachable_pts = {};
@@ -496,17 +502,43 @@ void inventory::form_from_map( map &m, const tripoint &origin, int range, const
             reachable_pts.emplace_back( p );
         }
     }
-    form_from_map( m, reachable_pts, pl, assign_invlet );
+    return reachable_pts;
 }
 
 //TODO!: check that not stacking the crafting inventory works ok
 void inventory::form_from_map( map &m, std::vector<tripoint> pts, const Character *pl,
                                bool assign_invlet )
 {
-    const time_point bday = calendar::start_of_cataclysm;
-    std::unordered_map<const vehicle *, std::unordered_set<const vpart_reference *>> checked_vehi;
     items.clear();
     build_items_type_cache();
+    add_map_items( m, pts, pl, assign_invlet );
+    add_map_tools( m, pts );
+}
+
+void inventory::add_map_items( map &m, const std::vector<tripoint> &pts, const Character *pl,
+                               bool assign_invlet )
+{
+    for( const tripoint &p : pts ) {
+        if( m.has_items( p ) && m.accessible_items( p ) ) {
+            bool allow_liquids = m.has_flag_ter_or_furn( "LIQUIDCONT", p );
+            for( auto &i : m.i_at( p ) ) {
+                // if it's *the* player requesting this from from map inventory
+                // then don't allow items owned by another faction to be factored into recipe components etc.
+                if( pl && !i->is_owned_by( *pl, true ) && i->get_owner()->likes_u >= -10 ) {
+                    continue;
+                }
+                if( allow_liquids || !i->made_of( LIQUID ) ) {
+                    add_item_by_items_type_cache( *i, false, assign_invlet, false );
+                }
+            }
+        }
+    }
+}
+
+void inventory::add_map_tools( map &m, const std::vector<tripoint> &pts )
+{
+    const time_point bday = calendar::start_of_cataclysm;
+    std::unordered_map<const vehicle *, std::unordered_set<const vpart_reference *>> checked_vehi;
     for( const tripoint &p : pts ) {
         if( m.has_furn( p ) ) {
             const furn_t &f = m.furn( p ).obj();
@@ -527,19 +559,6 @@ void inventory::form_from_map( map &m, std::vector<tripoint> pts, const Characte
                 }
             }
         }
-        if( m.has_items( p ) && m.accessible_items( p ) ) {
-            bool allow_liquids = m.has_flag_ter_or_furn( "LIQUIDCONT", p );
-            for( auto &i : m.i_at( p ) ) {
-                // if it's *the* player requesting this from from map inventory
-                // then don't allow items owned by another faction to be factored into recipe components etc.
-                if( pl && !i->is_owned_by( *pl, true ) && i->get_owner()->likes_u >= -10 ) {
-                    continue;
-                }
-                if( allow_liquids || !i->made_of( LIQUID ) ) {
-                    add_item_by_items_type_cache( *i, false, assign_invlet, false );
-                }
-            }
-        }
         // Kludges for now!
         if( m.has_nearby_fire( p, 0 ) ) {
             item &fire = *item::spawn_temporary( "fire", bday );
@@ -701,7 +720,6 @@ void inventory::form_from_map( map &m, std::vector<tripoint> pts, const Characte
             found_parts.insert( &*autoclavepart );
         }
     }
-    pts.clear();
 }
 
 std::vector<detached_ptr<item>> location_inventory::reduce_stack( const int position,
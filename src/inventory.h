@@ -141,6 +141,18 @@ class inventory : public temp_visitable<inventory>
                             bool clear_path = true );
         void form_from_map( map &m, std::vector<tripoint> pts, const Character *pl,
                             bool assign_invlet = true );
+        /** The points form_from_map looks at for the given @p origin and @p range. */
+        static std::vector<tripoint> points_in_range( const map &m, const tripoint &origin, int range,
+                bool clear_path );
+        /**
+         * The two halves of form_from_map.  The first adds the items lying on the map at @p pts,
+         * the second the rest: furniture and vehicle tools, fires, water sources and vehicle cargo.
+         * Only the first half consists solely of items that stay in place, so it is the one that
+         * can be kept around.  Both require build_items_type_cache() to have been called.
+         */
+        void add_map_items( map &m, const std::vector<tripoint> &pts, const Character *pl,
+                            bool assign_invlet );
+        void add_map_tools( map &m, const std::vector<tripoint> &pts );
         /**
          * Remove a specific item from the inventory. The item is compared
          * by pointer. Contents of the item are removed as well.
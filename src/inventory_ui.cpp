@@ -84,7 +84,8 @@ struct inventory_input {
 
 bool inventory_entry::operator==( const inventory_entry &other ) const
 {
-    return get_category_ptr() == other.get_category_ptr() && locations == other.locations;
+    // Locations first, they usually differ at the first element and that check is cheap
+    return locations == other.locations && get_category_ptr() == other.get_category_ptr();
 }
 
 class selection_column_preset : public inventory_selector_preset
@@ -774,12 +775,14 @@ void inventory_column::prepare_paging( const std::string &filter )
     // Then sort them with respect to categories
     auto from = entries.begin();
     while( from != entries.end() ) {
+        const item_category *category = from->get_category_ptr();
+        from->update_cache();
         auto to = std::next( from );
-        while( to != entries.end() && from->get_category_ptr() == to->get_category_ptr() ) {
+        while( to != entries.end() && to->get_category_ptr() == category ) {
             to->update_cache();
             std::advance( to, 1 );
         }
-        if( !ordered_categories.contains( from->get_category_ptr()->get_id().c_str() ) ) {
+        if( !ordered_categories.contains( category->get_id().c_str() ) ) {
             std::sort( from, to, [ this ]( const inventory_entry & lhs, const inventory_entry & rhs ) {
                 if( lhs.is_selectable() != rhs.is_selectable() ) {
                     return lhs.is_selectable(); // Disabled items always go last
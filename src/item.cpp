@@ -23,6 +23,7 @@
 #include "avatar.h"
 #include "bionics.h"
 #include "bodypart.h"
+#include "cata_pool.h"
 #include "cata_utility.h"
 #include "catacharset.h"
 #include "cached_item_options.h"
@@ -84,6 +85,7 @@
 #include "player_activity.h"
 #include "pldata.h"
 #include "point.h"
+#include "profile.h"
 #include "projectile.h"
 #include "ranged.h"
 #include "recipe.h"
@@ -115,6 +117,10 @@
 static const std::string GUN_MODE_VAR_NAME( "item::mode" );
 static const std::string CLOTHING_MOD_VAR_PREFIX( "clothing_mod_" );
 
+static const option_handle<bool> ammo_in_names( "AMMO_IN_NAMES" );
+static const option_handle<bool> filthy_morale( "FILTHY_MORALE" );
+static const option_handle<bool> item_health_bar( "ITEM_HEALTH_BAR" );
+
 static const ammo_effect_str_id ammo_effect_BLACKPOWDER( "BLACKPOWDER" );
 static const ammo_effect_str_id ammo_effect_INCENDIARY( "INCENDIARY" );
 static const ammo_effect_str_id ammo_effect_NEVER_MISFIRES( "NEVER_MISFIRES" );
@@ -490,6 +496,7 @@ item &item::operator=( const item &source )
     active = source.active;
     activated_by = source.activated_by;
     is_favorite = source.is_favorite;
+    tname_cache_.reset();
 
     contents.clear_items();
 
@@ -515,6 +522,29 @@ void item::on_destroy()
 
 item::~item() = default;
 
+using item_pool = cata_pool<sizeof( item ), alignof( item )>;
+
+// Name of the memory pool in the profiler, compared by address
+[[maybe_unused]] static const char *const item_memory = "items";
+
+void *item::operator new( size_t size )
+{
+    // Classes derived from item don't fit into the slots
+    void *ptr = size != sizeof( item ) ? ::operator new( size ) : item_pool::allocate();
+    TracyAllocN( ptr, size, item_memory );
+    return ptr;
+}
+
+void item::operator delete( void *ptr, size_t size )
+{
+    TracyFreeN( ptr, item_memory );
+    if( size != sizeof( item ) ) {
+        ::operator delete( ptr );
+        return;
+    }
+    item_pool::deallocate( ptr );
+}
+
 detached_ptr<item> item::make_corpse( const mtype_id &mt, time_point turn, const std::string &name,
                                       const int upgrade_time )
 {
@@ -4762,7 +4792,101 @@ void item::on_damage( int qty, damage_type )
     }
 }
 
+struct item::tname_state {
+    // The parts that are cheap to copy
+    struct inputs {
+        unsigned int quantity = 0;
+        bool with_prefix = false;
+        unsigned int truncate = 0;
+        int turn = 0;
+        int language_version = 0;
+        bool health_bar = false;
+        const itype *type = nullptr;
+        int charges = 0;
+        int damage = 0;
+        int burnt = 0;
+        int item_counter = 0;
+        bool active = false;
+        bool is_favorite = false;
+        size_t num_item_stacks = 0;
+        const avatar *you = nullptr;
+        sizing fit = sizing::ignore;
+        int survival = 0;
+        bool identified = false;
+
+        inputs( const item &it, unsigned int quantity, bool with_prefix, unsigned int truncate )
+            : quantity( quantity ), with_prefix( with_prefix ), truncate( truncate ),
+              turn( to_turn<int>( calendar::turn ) ),
+              language_version( detail::get_current_language_version() ),
+              health_bar( item_health_bar.get() ), type( it.type ), charges( it.charges ),
+              damage( it.damage_ ), burnt( it.burnt ), item_counter( it.item_counter ),
+              active( it.active ), is_favorite( it.is_favorite ),
+              num_item_stacks( it.contents.num_item_stacks() ), you( &get_avatar() ),
+              fit( it.get_sizing( *you ) ),
+              survival( it.is_food() ? you->get_skill_level( skill_survival ) : 0 ),
+              identified( it.is_book() && you->has_identified( it.typeId() ) ) {}
+
+        bool operator==( const inputs & ) const = default;
+    };
+
+    tname_state( const item &it, unsigned int quantity, bool with_prefix, unsigned int truncate )
+        : values( it, quantity, with_prefix, truncate ), faults( it.faults ),
+          item_tags( it.item_tags ), item_vars( it.item_vars ) {
+        if( it.contents.num_item_stacks() == 1 ) {
+            content = std::make_unique<tname_state>( it.contents.front(), 1, with_prefix, 0 );
+        }
+    }
+
+    /** Compares with the state of @p it without copying it. */
+    bool matches( const item &it, unsigned int quantity, bool with_prefix,
+                  unsigned int truncate ) const {
+        if( !( values == inputs( it, quantity, with_prefix, truncate ) ) || faults != it.faults ||
+            item_tags != it.item_tags || item_vars != it.item_vars ) {
+            return false;
+        }
+        if( it.contents.num_item_stacks() != 1 ) {
+            return content == nullptr;
+        }
+        return content != nullptr && content->matches( it.contents.front(), 1, with_prefix, 0 );
+    }
+
+    inputs values;
+    std::set<fault_id> faults;
+    FlagsSetType item_tags;
+    std::map<std::string, std::string> item_vars;
+    // The name of a single stack of contents is part of the name
+    std::unique_ptr<tname_state> content;
+};
+
+struct item::tname_cache {
+    struct entry {
+        std::unique_ptr<tname_state> state;
+        std::string name;
+    };
+    // Lists usually ask for two variants, with and without prefix
+    std::array<entry, 2> entries;
+    size_t next = 0;
+};
+
 std::string item::tname( unsigned int quantity, bool with_prefix, unsigned int truncate ) const
+{
+    if( !tname_cache_ ) {
+        tname_cache_ = std::make_unique<tname_cache>();
+    }
+    for( const tname_cache::entry &e : tname_cache_->entries ) {
+        if( e.state && e.state->matches( *this, quantity, with_prefix, truncate ) ) {
+            return e.name;
+        }
+    }
+    tname_cache::entry &e = tname_cache_->entries[tname_cache_->next];
+    tname_cache_->next = ( tname_cache_->next + 1 ) % tname_cache_->entries.size();
+    e.state = std::make_unique<tname_state>( *this, quantity, with_prefix, truncate );
+    e.name = build_tname( quantity, with_prefix, truncate );
+    return e.name;
+}
+
+std::string item::build_tname( unsigned int quantity, bool with_prefix,
+                               unsigned int truncate ) const
 {
     int dirt_level = get_var( "dirt", 0 ) / 2000;
     std::string dirt_symbol;
@@ -4798,10 +4922,10 @@ std::string item::tname( unsigned int quantity, bool with_prefix, unsigned int t
     // for portions of string that have <color_ etc in them, this aims to truncate the whole string correctly
     unsigned int truncate_override = 0;
 
-    if( ( damage() != 0 || ( get_option<bool>( "ITEM_HEALTH_BAR" ) && is_armor() ) ) && !is_null() &&
+    if( ( damage() != 0 || ( item_health_bar.get() && is_armor() ) ) && !is_null() &&
         with_prefix ) {
         damtext = durability_indicator();
-        if( get_option<bool>( "ITEM_HEALTH_BAR" ) ) {
+        if( item_health_bar.get() ) {
             // get the utf8 width of the tags
             truncate_override = utf8_width( damtext, false ) - utf8_width( damtext, true );
         }
@@ -5100,7 +5224,7 @@ std::string item::display_name( unsigned int quantity ) const
     }
 
     std::string ammotext;
-    if( ( ( is_gun() && ammo_required() ) || is_magazine() ) && get_option<bool>( "AMMO_IN_NAMES" ) ) {
+    if( ( ( is_gun() && ammo_required() ) || is_magazine() ) && ammo_in_names.get() ) {
         if( !ammo_current().is_null() ) {
             ammotext = ammo_current()->nname( 1 );
         } else {
@@ -5214,23 +5338,27 @@ units::mass item::weight( bool include_contents, bool integral ) const
         return ret;
     }
 
+    // This runs for every item in every container on every weight query, so look the
+    // variable up without building the key or copying the value
+    static const std::string var_weight( "weight" );
+    static const std::string var_integral_weight( "integral_weight" );
+    const auto local_mass = item_vars.find( integral ? var_integral_weight : var_weight );
     units::mass ret;
-    std::string local_str_mass = integral ? get_var( "integral_weight" ) : get_var( "weight" );
-    if( local_str_mass.empty() ) {
+    if( local_mass == item_vars.end() || local_mass->second.empty() ) {
         ret = integral ? type->integral_weight : type->weight;
     } else {
-        ret = units::from_milligram( std::stoll( local_str_mass ) );
+        ret = units::from_milligram( std::stoll( local_mass->second ) );
     }
 
     if( has_flag( flag_REDUCED_WEIGHT ) ) {
         ret *= 0.75;
     }
 
+    const bool gun = is_gun();
+    const std::vector<const item *> mods = gun ? gunmods() : std::vector<const item *>();
     // if this is a gun apply all of its gunmods' weight multipliers
-    if( is_gun() ) {
-        for( const item *mod : gunmods() ) {
-            ret *= mod->type->gunmod->weight_multiplier;
-        }
+    for( const item *mod : mods ) {
+        ret *= mod->type->gunmod->weight_multiplier;
     }
 
     if( count_by_charges() ) {
@@ -5272,7 +5400,10 @@ units::mass item::weight( bool include_contents, bool integral ) const
     }
 
     // reduce weight for sawn-off weapons capped to the apportioned weight of the barrel
-    if( gunmod_find( itype_barrel_small ) ) {
+    const bool sawn_off = std::any_of( mods.begin(), mods.end(), []( const item * mod ) {
+        return mod->typeId() == itype_barrel_small;
+    } );
+    if( sawn_off ) {
         const units::volume b = type->gun->barrel_length;
         const units::mass max_barrel_weight = units::from_gram( to_milliliter( b ) );
         const units::mass barrel_weight = units::from_gram( b.value() * type->weight.value() /
@@ -5280,8 +5411,8 @@ units::mass item::weight( bool include_contents, bool integral ) const
         ret -= std::min( max_barrel_weight, barrel_weight );
     }
 
-    if( is_gun() ) {
-        for( const item *elem : gunmods() ) {
+    if( gun ) {
+        for( const item *elem : mods ) {
             ret += elem->weight( true, true );
         }
         if( !magazine_integral() && magazine_current() ) {
@@ -5362,7 +5493,8 @@ units::volume item::volume( bool integral ) const
         return ret;
     }
 
-    const int local_volume = get_var( "volume", -1 );
+    static const std::string var_volume( "volume" );
+    const int local_volume = get_var( var_volume, -1 );
     units::volume ret;
     if( local_volume >= 0 ) {
         ret = local_volume * units::legacy_volume_factor;
@@ -6008,6 +6140,12 @@ auto get_hourly_rotpoints_at_temp( const units::temperature temp ) -> int
 }
 
 auto item::calc_rot( time_point time, const units::temperature temp ) const -> time_duration
+{
+    const time_duration time_delta = time - last_rot_check;
+    return calc_rot_from_points( time_delta / 1_hours * get_hourly_rotpoints_at_temp( temp ) );
+}
+
+auto item::calc_rot_from_points( double rot_hours ) const -> time_duration
 {
     // Avoid needlessly calculating already rotten things.  Corpses should
     // always rot away and food rots away at twice the shelf life.  If the food
@@ -6032,8 +6170,7 @@ auto item::calc_rot( time_point time, const units::temperature temp ) const -> t
         time_duration spoil_variation = get_shelf_life() * 0.2f;
         added_rot += rng( -spoil_variation, spoil_variation );
     }
-    time_duration time_delta = time - last_rot_check;
-    added_rot += factor * time_delta / 1_hours * get_hourly_rotpoints_at_temp( temp ) * 1_turns;
+    added_rot += factor * rot_hours * 1_turns;
     return added_rot;
 }
 
@@ -6180,30 +6317,36 @@ int item::get_avg_encumber( const Character &p ) const
 }
 
 int item::get_encumber( const Character &p, const bodypart_id &bodypart ) const
+{
+    if( !p.is_worn( *this ) ) {
+        return get_encumber( p, bodypart, 0_ml, 0_ml );
+    }
+    units::volume char_storage( 0_ml );
+    for( const item * const &e : p.worn ) {
+        char_storage += e->get_storage();
+    }
+    return get_encumber( p, bodypart, char_storage,
+                         char_storage != 0_ml ? p.inv_volume() : 0_ml );
+}
+
+int item::get_encumber( const Character &p, const bodypart_id &bodypart,
+                        const units::volume &worn_storage, const units::volume &inv_volume ) const
 {
 
     units::volume contents_volume( 0_ml );
 
     contents_volume += contents.item_size_modifier();
 
-    if( p.is_worn( *this ) ) {
+    if( worn_storage != 0_ml && p.is_worn( *this ) ) {
         const islot_armor *armor = find_armor_data();
 
         if( armor != nullptr ) {
             for( const armor_portion_data &entry : armor->data ) {
                 if( entry.covers.test( bodypart.id() ) ) {
                     if( entry.max_encumber != 0 ) {
-                        units::volume char_storage( 0_ml );
-
-                        for( const item * const &e : p.worn ) {
-                            char_storage += e->get_storage();
-                        }
-
-                        if( char_storage != 0_ml ) {
-                            // Cast up to 64 to prevent overflow. Dividing before would prevent this but lose data.
-                            contents_volume += units::from_milliliter( static_cast<int64_t>( armor->storage.value() ) *
-                                               p.inv_volume().value() / char_storage.value() );
-                        }
+                        // Cast up to 64 to prevent overflow. Dividing before would prevent this but lose data.
+                        contents_volume += units::from_milliliter( static_cast<int64_t>( armor->storage.value() ) *
+                                           inv_volume.value() / worn_storage.value() );
                     }
                 }
             }
@@ -6759,7 +6902,7 @@ std::string item::durability_indicator( bool include_intact ) const
     std::string outputstring;
 
     if( damage() < 0 )  {
-        if( get_option<bool>( "ITEM_HEALTH_BAR" ) ) {
+        if( item_health_bar.get() ) {
             outputstring = colorize( damage_symbol() + "\u00A0", damage_color() );
         } else if( is_gun() ) {
             outputstring = pgettext( "damage adjective", "accurized " );
@@ -6783,7 +6926,7 @@ std::string item::durability_indicator( bool include_intact ) const
                     break;
             }
         }
-    } else if( get_option<bool>( "ITEM_HEALTH_BAR" ) ) {
+    } else if( item_health_bar.get() ) {
         outputstring = colorize( damage_symbol() + "\u00A0", damage_color() );
     } else {
         outputstring = string_format( "%s ", get_base_material().dmg_adj( damage_level( 4 ) ) );
@@ -9440,6 +9583,79 @@ static units::temperature clip_by_temperature_flag( units::temperature temperatu
     return temperature;
 }
 
+namespace
+{
+
+namespace rot_history
+{
+
+/** Temperature conditions of one spot, the hourly rot points only depend on these. */
+struct conditions {
+    point_abs_ms location;
+    bool underground = false;
+    int local_mod = 0;
+    temperature_flag flag = temperature_flag::TEMP_NORMAL;
+    unsigned seed = 0;
+    const weather_generator *wgen = nullptr;
+
+    bool operator<( const conditions &rhs ) const {
+        return std::tie( location, underground, local_mod, flag, seed, wgen ) <
+               std::tie( rhs.location, rhs.underground, rhs.local_mod, rhs.flag, rhs.seed, rhs.wgen );
+    }
+};
+
+/** Index of the first full hour that starts after @p t. */
+int hour_after( const time_point &t )
+{
+    return to_turns<int>( t - calendar::turn_zero ) / to_turns<int>( 1_hours ) + 1;
+}
+
+time_point hour_start( int hour )
+{
+    return calendar::turn_zero + time_duration::from_hours( hour );
+}
+
+/** Prefix sums of the rot points of consecutive hours, each taken at the end of the hour. */
+class hourly_points
+{
+    public:
+        /** Sum of the rot points of the hours ending at hour_start( from ) to hour_start( to ). */
+        template<typename F>
+        std::int64_t sum( int from, int to, const F &rotpoints_at ) {
+            if( from > to ) {
+                return 0;
+            }
+            if( sums.empty() || from < first ) {
+                first = from;
+                sums.assign( 1, 0 );
+            }
+            while( first + static_cast<int>( sums.size() ) - 1 <= to ) {
+                const int hour = first + static_cast<int>( sums.size() ) - 1;
+                sums.push_back( sums.back() + rotpoints_at( hour_start( hour ) ) );
+            }
+            return sums[to - first + 1] - sums[from - first];
+        }
+
+    private:
+        int first = 0;
+        std::vector<std::int64_t> sums;
+};
+
+hourly_points &get( const conditions &key )
+{
+    // The keys include the map temperature of the spot, which changes over time, so only
+    // keep the tables while a few bases are loaded.
+    static std::map<conditions, hourly_points> tables;
+    if( tables.size() >= 256 && tables.find( key ) == tables.end() ) {
+        tables.clear();
+    }
+    return tables[key];
+}
+
+} // namespace rot_history
+
+} // namespace
+
 detached_ptr<item>  item::process_rot( detached_ptr<item> &&self, const bool seals,
                                        const tripoint &pos,
                                        player *carrier, const temperature_flag flag,
@@ -9476,34 +9692,48 @@ detached_ptr<item>  item::process_rot( detached_ptr<item> &&self, const bool sea
         units::temperature local_mod = units::from_fahrenheit( g->new_game
                                        ? 0
                                        : get_map().get_temperature( pos ) ) - 0_f;
-
-        // Process the past of this item since the last time it was processed
-        while( now - time > 1_hours ) {
-            // Get the environment temperature
-            time_duration time_delta = std::min( 1_hours, now - 1_hours - time );
-            time += time_delta;
-
-            //Use weather if above ground, use map temp if below
-            units::temperature env_temperature_raw;
-            if( pos.z >= 0 ) {
-                tripoint_abs_ms location = tripoint_abs_ms( get_map().getabs( pos ) );
-                units::temperature weather_temperature = wgen.get_weather_temperature( location, time,
-                        calendar::config, seed );
-                env_temperature_raw = weather_temperature + local_mod;
-            } else {
-                env_temperature_raw = temperatures::annual_average + local_mod;
+        //Use weather if above ground, use map temp if below
+        const bool underground = pos.z < 0;
+        const tripoint_abs_ms location = underground ? tripoint_abs_ms() :
+                                         tripoint_abs_ms( get_map().getabs( pos ) );
+        const auto rotpoints_at = [&]( const time_point & t ) {
+            const units::temperature env_temperature_raw = underground
+                    ? temperatures::annual_average + local_mod
+                    : wgen.get_weather_temperature( location, t, calendar::config, seed ) + local_mod;
+            return get_hourly_rotpoints_at_temp( clip_by_temperature_flag( env_temperature_raw, flag ) );
+        };
+        rot_history::hourly_points &history = rot_history::get( { location.xy(), underground,
+                                               units::to_millidegree_celsius( local_mod ), flag, seed, &wgen } );
+
+        // Process the past of this item since the last time it was processed.  The rot of each
+        // hour uses the temperature at its end, full hours are shared by all items at the spot.
+        const time_point end = now - 1_hours;
+        const int first_hour = rot_history::hour_after( time );
+        const int last_hour = rot_history::hour_after( end ) - 1;
+        double rot_hours = 0;
+        if( first_hour > last_hour ) {
+            rot_hours = ( end - time ) / 1_hours * rotpoints_at( end );
+        } else {
+            rot_hours = ( rot_history::hour_start( first_hour ) - time ) / 1_hours *
+                        history.sum( first_hour, first_hour, rotpoints_at );
+            rot_hours += history.sum( first_hour + 1, last_hour, rotpoints_at );
+            const time_point last_full = rot_history::hour_start( last_hour );
+            if( end > last_full ) {
+                rot_hours += ( end - last_full ) / 1_hours * rotpoints_at( end );
             }
+        }
+        const bool was_rotten = !self->is_corpse() && self->get_relative_rot() > 2.0;
+        self->rot += self->calc_rot_from_points( rot_hours );
+        self->last_rot_check = end;
+        time = end;
+        if( !was_rotten && !self->is_corpse() && self->get_relative_rot() > 2.0 ) {
+            // Rot stops growing within an hour after passing twice the shelf life
+            self->rot = std::min( self->rot, self->get_shelf_life() * 2 + 1_hours );
+        }
 
-            units::temperature env_temperature_clipped = clip_by_temperature_flag( env_temperature_raw, flag );
-
-            // Calculate item rot
-            self->rot += self->calc_rot( time, env_temperature_clipped );
-            self->last_rot_check = time;
-
-            if( self->has_rotten_away() && carrier == nullptr && !seals ) {
-                // No need to track item that will be gone
-                return detached_ptr<item>();
-            }
+        if( self->has_rotten_away() && carrier == nullptr && !seals ) {
+            // No need to track item that will be gone
+            return detached_ptr<item>();
         }
     }
 
@@ -10538,7 +10768,7 @@ skill_id item::contextualize_skill( const skill_id &id ) const
 
 bool item::is_filthy() const
 {
-    return has_flag( flag_FILTHY ) && ( get_option<bool>( "FILTHY_MORALE" ) ||
+    return has_flag( flag_FILTHY ) && ( filthy_morale.get() ||
                                         get_avatar().has_trait( trait_SQUEAMISH ) );
 }
 
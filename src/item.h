@@ -7,6 +7,7 @@
 #include <functional>
 #include <list>
 #include <map>
+#include <memory>
 #include <optional>
 #include <set>
 #include <string>
@@ -273,6 +274,10 @@ class item : public location_visitable<item>, public game_object<item>
         ~item();
         void on_destroy();
 
+        // Items come from a pool, see cata_pool.h
+        static void *operator new( size_t size );
+        static void operator delete( void *ptr, size_t size );
+
         inline static detached_ptr<item> spawn( JsonIn &jsin ) {
             detached_ptr<item> p = spawn();
             p->deserialize( jsin );
@@ -868,6 +873,11 @@ class item : public location_visitable<item>, public game_object<item>
          * @param temp Temperature at which the rot is calculated
          */
         auto calc_rot( time_point time, const units::temperature temp ) const -> time_duration;
+        /**
+         * Like @ref calc_rot, but for a temperature that changed since the last rot calculation.
+         * @param rot_hours Sum of the hourly rot points times the hours spent at them
+         */
+        auto calc_rot_from_points( double rot_hours ) const -> time_duration;
 
         /**
          * Time that this item is guaranteed to stay fresh.
@@ -1720,6 +1730,13 @@ class item : public location_visitable<item>, public game_object<item>
          */
         int get_avg_encumber( const Character & ) const;
         int get_encumber( const Character &, const bodypart_id &bodypart ) const;
+        /**
+         * Same as above, with the summed @ref get_storage of the items worn by the character
+         * and the volume of their inventory already known.  For callers that ask about
+         * many items or body parts at once.
+         */
+        int get_encumber( const Character &, const bodypart_id &bodypart,
+                          const units::volume &worn_storage, const units::volume &inv_volume ) const;
         /**
          * Returns the storage amount (@ref islot_armor::storage) that this item provides when worn.
          * For non-armor it returns 0. The storage amount increases the volume capacity of the
@@ -2422,6 +2439,16 @@ class item : public location_visitable<item>, public game_object<item>
         int damage_ = 0;
         light_emission light = nolight;
 
+        /**
+         * The last results of @ref tname.  Most of the state tname reads is public and changed
+         * directly, so entries aren't invalidated by mutators but stored with a copy of that
+         * state (@ref tname_state), which also covers the turn and the language.
+         */
+        struct tname_state;
+        struct tname_cache;
+        mutable std::unique_ptr<tname_cache> tname_cache_;
+        std::string build_tname( unsigned int quantity, bool with_prefix, unsigned int truncate ) const;
+
     public:
         char invlet = 0;      // Inventory letter
         //TODO! old safe reference type here
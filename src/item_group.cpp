@@ -23,6 +23,14 @@ bool string_id<Item_group>::is_valid() const
     return item_group::group_is_defined( *this );
 }
 
+std::vector<detached_ptr<item>> Item_spawn_data::create( const time_point &birthday,
+                             RecursionList &rec ) const
+{
+    std::vector<detached_ptr<item>> result;
+    create_into( result, birthday, rec );
+    return result;
+}
+
 std::vector<detached_ptr<item>> Item_spawn_data::create( const time_point &birthday ) const
 {
     RecursionList rec;
@@ -80,10 +88,9 @@ detached_ptr<item> Single_item_creator::create_single( const time_point &birthda
     return tmp;
 }
 
-std::vector<detached_ptr<item>> Single_item_creator::create( const time_point &birthday,
-                             RecursionList &rec ) const
+void Single_item_creator::create_into( std::vector<detached_ptr<item>> &out,
+                                       const time_point &birthday, RecursionList &rec ) const
 {
-    std::vector<detached_ptr<item>> result;
     int cnt = 1;
     if( modifier ) {
         auto modifier_count = modifier->count;
@@ -94,31 +101,29 @@ std::vector<detached_ptr<item>> Single_item_creator::create( const time_point &b
         if( type == S_ITEM ) {
             detached_ptr<item> itm = create_single( birthday, rec );
             if( itm && !itm->is_null() ) {
-                result.push_back( std::move( itm ) );
+                out.push_back( std::move( itm ) );
             }
         } else {
             if( std::find( rec.begin(), rec.end(), id ) != rec.end() ) {
                 debugmsg( "recursion in item spawn list %s", id.c_str() );
-                return result;
+                return;
             }
             rec.push_back( id );
             Item_spawn_data *isd = item_controller->get_group( item_group_id( id ) );
             if( isd == nullptr ) {
                 debugmsg( "unknown item spawn list %s", id.c_str() );
-                return result;
+                return;
             }
-            std::vector<detached_ptr<item>> tmplist = isd->create( birthday, rec );
+            const size_t first_new = out.size();
+            isd->create_into( out, birthday, rec );
             rec.erase( rec.end() - 1 );
             if( modifier ) {
-                for( auto &elem : tmplist ) {
-                    elem = modifier->modify( std::move( elem ) );
+                for( size_t i = first_new; i < out.size(); i++ ) {
+                    out[i] = modifier->modify( std::move( out[i] ) );
                 }
             }
-            result.insert( result.end(), std::make_move_iterator( tmplist.begin() ),
-                           std::make_move_iterator( tmplist.end() ) );
         }
     }
-    return result;
 }
 
 void Single_item_creator::check_consistency( const std::string &context ) const
@@ -476,18 +481,15 @@ void Item_group::add_entry( std::unique_ptr<Item_spawn_data> ptr )
     items.push_back( std::move( ptr ) );
 }
 
-std::vector<detached_ptr<item>> Item_group::create( const time_point &birthday,
-                             RecursionList &rec ) const
+void Item_group::create_into( std::vector<detached_ptr<item>> &out, const time_point &birthday,
+                              RecursionList &rec ) const
 {
-    std::vector<detached_ptr<item>> result;
     if( type == G_COLLECTION ) {
         for( const auto &elem : items ) {
             if( rng( 0, 99 ) >= ( elem )->probability ) {
                 continue;
             }
-            std::vector<detached_ptr<item>> tmp = ( elem )->create( birthday, rec );
-            result.insert( result.end(), std::make_move_iterator( tmp.begin() ),
-                           std::make_move_iterator( tmp.end() ) );
+            ( elem )->create_into( out, birthday, rec );
         }
     } else if( type == G_DISTRIBUTION ) {
         int p = rng( 0, sum_prob - 1 );
@@ -496,14 +498,10 @@ std::vector<detached_ptr<item>> Item_group::create( const time_point &birthday,
             if( p >= 0 ) {
                 continue;
             }
-            std::vector<detached_ptr<item>> tmp = ( elem )->create( birthday, rec );
-            result.insert( result.end(), std::make_move_iterator( tmp.begin() ),
-                           std::make_move_iterator( tmp.end() ) );
+            ( elem )->create_into( out, birthday, rec );
             break;
         }
     }
-
-    return result;
 }
 
 detached_ptr<item> Item_group::create_single( const time_point &birthday, RecursionList &rec ) const
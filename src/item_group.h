@@ -116,9 +116,15 @@ class Item_spawn_data
          * @param[in] birthday All items have that value as birthday.
          * @param[out] rec Recursion list, output goes here
          */
-        virtual std::vector<detached_ptr<item>> create( const time_point &birthday,
-                                             RecursionList &rec ) const = 0;
+        std::vector<detached_ptr<item>> create( const time_point &birthday,
+                                                RecursionList &rec ) const;
         std::vector<detached_ptr<item>> create( const time_point &birthday ) const;
+        /**
+         * Same as create, but appends the items to @p out. Nested groups append to the
+         * same vector, so no temporary list is built per level.
+         */
+        virtual void create_into( std::vector<detached_ptr<item>> &out, const time_point &birthday,
+                                  RecursionList &rec ) const = 0;
         /**
          * The same as create, but create a single item only.
          * The returned item might be a null item!
@@ -244,8 +250,8 @@ class Single_item_creator : public Item_spawn_data
 
         void inherit_ammo_mag_chances( int ammo, int mag );
 
-        std::vector<detached_ptr<item>> create( const time_point &birthday,
-                                                RecursionList &rec ) const override;
+        void create_into( std::vector<detached_ptr<item>> &out, const time_point &birthday,
+                          RecursionList &rec ) const override;
         detached_ptr<item>create_single( const time_point &birthday, RecursionList &rec ) const override;
         void check_consistency( const std::string &context ) const override;
         bool remove_item( const itype_id &itemid ) override;
@@ -291,8 +297,8 @@ class Item_group : public Item_spawn_data
          */
         void add_entry( std::unique_ptr<Item_spawn_data> ptr );
 
-        std::vector<detached_ptr<item>> create( const time_point &birthday,
-                                                RecursionList &rec ) const override;
+        void create_into( std::vector<detached_ptr<item>> &out, const time_point &birthday,
+                          RecursionList &rec ) const override;
         detached_ptr<item> create_single( const time_point &birthday, RecursionList &rec ) const override;
         void check_consistency( const std::string &context ) const override;
         bool remove_item( const itype_id &itemid ) override;
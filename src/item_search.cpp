@@ -28,38 +28,41 @@ std::function<bool( const item & )> basic_item_filter( std::string filter )
     switch( flag ) {
         // category
         case 'c':
-            return [filter]( const item & i ) {
-                return lcmatch( i.get_category().name(), filter );
+            return [match = lcmatcher( filter )]( const item & i ) {
+                return match( i.get_category().name() );
             };
         // material
         case 'm':
-            return [filter]( const item & i ) {
-                return std::any_of( i.made_of().begin(), i.made_of().end(),
-                [&filter]( const material_id & mat ) {
-                    return lcmatch( mat->name(), filter );
+            return [match = lcmatcher( filter )]( const item & i ) {
+                const std::vector<material_id> &mats = i.made_of();
+                return std::any_of( mats.begin(), mats.end(), [&match]( const material_id & mat ) {
+                    return match( mat->name() );
                 } );
             };
         // qualities
         case 'q':
-            return [filter]( const item & i ) {
-                return std::any_of( i.quality_of().begin(), i.quality_of().end(),
-                [&filter]( const std::pair<quality_id, int> &e ) {
-                    return lcmatch( e.first->name, filter );
+            return [match = lcmatcher( filter )]( const item & i ) {
+                const std::map<quality_id, int> &qualities = i.quality_of();
+                return std::any_of( qualities.begin(), qualities.end(),
+                [&match]( const std::pair<const quality_id, int> &e ) {
+                    return match( e.first->name );
                 } );
             };
         // both
         case 'b':
-            return [filter]( const item & i ) {
-                auto pair = get_both( filter );
-                return item_filter_from_string( pair.first )( i )
-                       && item_filter_from_string( pair.second )( i );
+        {
+            const std::pair<std::string, std::string> pair = get_both( filter );
+            return [first = item_filter_from_string( pair.first ),
+                    second = item_filter_from_string( pair.second )]( const item & i ) {
+                return first( i ) && second( i );
             };
+        }
         // disassembled components
         case 'd':
-            return [filter]( const item & i ) {
+            return [match = lcmatcher( filter )]( const item & i ) {
                 const auto &components = i.get_uncraft_components();
                 for( auto &component : components ) {
-                    if( lcmatch( component.to_string(), filter ) ) {
+                    if( match( component.to_string() ) ) {
                         return true;
                     }
                 }
@@ -67,23 +70,23 @@ std::function<bool( const item & )> basic_item_filter( std::string filter )
             };
         // item notes
         case 'n':
-            return [filter]( const item & i ) {
+            return [match = lcmatcher( filter )]( const item & i ) {
                 const std::string note = i.get_var( "item_note" );
-                return !note.empty() && lcmatch( note, filter );
+                return !note.empty() && match( note );
             };
         // skill taught
         case 'k':
-            return [filter]( const item & i ) {
+            return [match = lcmatcher( filter )]( const item & i ) {
                 if( i.is_book() ) {
                     const islot_book &book = *i.type->book;
-                    return lcmatch( book.skill->name(), filter );
+                    return match( book.skill->name() );
                 }
                 return false;
             };
         // by name
         default:
-            return [filter]( const item & a ) {
-                return lcmatch( a.tname(), filter );
+            return [match = lcmatcher( filter )]( const item & a ) {
+                return match( a.tname() );
             };
     }
 }
@@ -13,6 +13,7 @@
 #include <locale> // ensure user's locale doesn't interfere with output
 #include <set>
 #include <sstream>
+#include <streambuf>
 #include <string>
 #include <utility>
 #include <vector>
@@ -32,6 +33,21 @@ static bool is_whitespace( char ch )
     return ( ch == ' ' || ch == '\n' || ch == '\t' || ch == '\r' );
 }
 
+/**
+ * Consumes the run of plain ASCII string characters at the read position, appending
+ * them to @p s if it's not null.  Stops in front of anything that needs checking.
+ */
+static void read_plain_chars( std::istream &stream, std::string *s )
+{
+    std::streambuf *buf = stream.rdbuf();
+    for( int ch = buf->sgetc(); ch >= 0x20 && ch < 0x80 && ch != '"' && ch != '\\';
+         ch = buf->snextc() ) {
+        if( s ) {
+            *s += static_cast<char>( ch );
+        }
+    }
+}
+
 // for parsing \uxxxx escapes
 static std::string utf16_to_utf8( uint32_t ch )
 {
@@ -813,9 +829,19 @@ int JsonIn::tell()
 {
     return stream->tellg();
 }
+// The hot paths below read the stream buffer directly.  Going through the istream
+// members constructs a sentry for every single character, which used to dominate parsing.
 char JsonIn::peek()
 {
-    return static_cast<char>( stream->peek() );
+    // Same as stream->peek()
+    if( !stream->good() ) {
+        return static_cast<char>( EOF );
+    }
+    const int ch = stream->rdbuf()->sgetc();
+    if( ch == EOF ) {
+        stream->setstate( std::ios::eofbit );
+    }
+    return static_cast<char>( ch );
 }
 bool JsonIn::good()
 {
@@ -832,7 +858,7 @@ void JsonIn::seek( int pos )
 void JsonIn::eat_whitespace()
 {
     while( is_whitespace( peek() ) ) {
-        stream->get();
+        stream->rdbuf()->sbumpc();
     }
 }
 
@@ -918,7 +944,10 @@ void JsonIn::skip_string()
         error( err.str(), -1 );
     }
     while( stream->good() ) {
-        stream->get( ch );
+        read_plain_chars( *stream, nullptr );
+        if( !stream->get( ch ) ) {
+            break;
+        }
         if( ch == '\\' ) {
             stream->get( ch );
             continue;
@@ -1197,7 +1226,8 @@ std::string JsonIn::get_string()
         }
         // add chars to the string, one at a time
         do {
-            ch = stream->peek();
+            read_plain_chars( *stream, &s );
+            ch = peek();
             if( !stream->good() ) {
                 err = "read operation failed";
                 break;
@@ -101,6 +101,16 @@ void map::add_light_from_items( const tripoint &p, const item_stack::iterator &b
     }
 }
 
+void map::update_weather_transparency_lookup()
+{
+    const float sight_penalty = get_weather().weather_id->sight_penalty;
+
+    if( sight_penalty != 1.0f &&
+        LIGHT_TRANSPARENCY_OPEN_AIR * sight_penalty != weather_transparency_lookup.transparency ) {
+        weather_transparency_lookup.reset( LIGHT_TRANSPARENCY_OPEN_AIR * sight_penalty );
+    }
+}
+
 // TODO: Consider making this just clear the cache and dynamically fill it in as is_transparent() is called
 bool map::build_transparency_cache( const int zlev )
 {
@@ -117,19 +127,17 @@ bool map::build_transparency_cache( const int zlev )
     // if true, all submaps are invalid (can use batch init)
     bool rebuild_all = map_cache.transparency_cache_dirty.all();
 
-    if( rebuild_all ) {
+    // Every submap below is written in full, so only the part of the cache past the edge of
+    // a smaller map has to be filled up front.
+    if( rebuild_all && my_MAPSIZE < MAPSIZE ) {
         // Default to just barely not transparent.
         std::uninitialized_fill_n( &transparency_cache[0][0], MAPSIZE_X * MAPSIZE_Y,
                                    static_cast<float>( LIGHT_TRANSPARENCY_OPEN_AIR ) );
     }
 
+    // The weather lookup was brought up to date by build_map_cache, before the levels
     const float sight_penalty = get_weather().weather_id->sight_penalty;
 
-    if( sight_penalty != 1.0f &&
-        LIGHT_TRANSPARENCY_OPEN_AIR * sight_penalty != weather_transparency_lookup.transparency ) {
-        weather_transparency_lookup.reset( LIGHT_TRANSPARENCY_OPEN_AIR * sight_penalty );
-    }
-
     // Traverse the submaps in order
     for( int smx = 0; smx < my_MAPSIZE; ++smx ) {
         for( int smy = 0; smy < my_MAPSIZE; ++smy ) {
@@ -171,12 +179,9 @@ bool map::build_transparency_cache( const int zlev )
 
             if( cur_submap->is_uniform ) {
                 float value = calc_transp( sm_offset );
-                // if rebuild_all==true all values were already set to LIGHT_TRANSPARENCY_OPEN_AIR
-                if( !rebuild_all || value != LIGHT_TRANSPARENCY_OPEN_AIR ) {
-                    for( int sx = 0; sx < SEEX; ++sx ) {
-                        // init all sy indices in one go
-                        std::uninitialized_fill_n( &transparency_cache[sm_offset.x + sx][sm_offset.y], SEEY, value );
-                    }
+                for( int sx = 0; sx < SEEX; ++sx ) {
+                    // init all sy indices in one go
+                    std::uninitialized_fill_n( &transparency_cache[sm_offset.x + sx][sm_offset.y], SEEY, value );
                 }
             } else {
                 for( int sx = 0; sx < SEEX; ++sx ) {
@@ -270,11 +275,35 @@ void map::apply_character_light( Character &p )
 
     const float held_luminance = p.active_light();
     if( held_luminance > LIGHT_AMBIENT_LOW ) {
-        apply_light_source( p.pos(), held_luminance );
+        lightmap_source held{ lightmap_source::source_type::immediate, p.pos(), held_luminance };
+        held.carrier = &p;
+        if( recorded_light_sources != nullptr ) {
+            recorded_light_sources->sources.push_back( held );
+        } else {
+            apply_lightmap_source( held );
+        }
     }
+}
 
-    if( held_luminance >= 4 && held_luminance > ambient_light_at( p.pos() ) - 0.5f ) {
-        p.add_effect( effect_haslight, 1_turns );
+void map::apply_lightmap_source( lightmap_source &src )
+{
+    switch( src.type ) {
+        case lightmap_source::source_type::immediate:
+            apply_light_source( src.p, src.luminance );
+            break;
+        case lightmap_source::source_type::buffered:
+            add_light_source( src.p, src.luminance );
+            break;
+        case lightmap_source::source_type::arc:
+            apply_light_arc( src.p, src.direction, src.luminance, src.width );
+            break;
+    }
+
+    if( src.carrier != nullptr ) {
+        src.carrier_lit = src.luminance >= 4 && src.luminance > ambient_light_at( src.p ) - 0.5f;
+        if( src.carrier_lit ) {
+            src.carrier->add_effect( effect_haslight, 1_turns );
+        }
     }
 }
 
@@ -442,42 +471,24 @@ void map::generate_lightmap( const int zlev )
     auto &outside_cache = map_cache.outside_cache;
     auto &prev_floor_cache = get_cache( clamp( zlev + 1, -OVERMAP_DEPTH, OVERMAP_DEPTH ) ).floor_cache;
     bool top_floor = zlev == OVERMAP_DEPTH;
-    std::memset( lm, 0, sizeof( lm ) );
-    std::memset( sm, 0, sizeof( sm ) );
-
-    /* Bulk light sources wastefully cast rays into neighbors; a burning hospital can produce
-         significant slowdown, so for stuff like fire and lava:
-     * Step 1: Store the position and luminance in buffer via add_light_source, for efficient
-         checking of neighbors.
-     * Step 2: After everything else, iterate buffer and apply_light_source only in non-redundant
-         directions
-     * Step 3: ????
-     * Step 4: Profit!
-     */
-    auto &light_source_buffer = map_cache.light_source_buffer;
-    std::memset( light_source_buffer, 0, sizeof( light_source_buffer ) );
-
-    constexpr std::array<int, 4> dir_x = { {  0, -1, 1, 0 } };    //    [0]
-    constexpr std::array<int, 4> dir_y = { { -1,  0, 0, 1 } };    // [1][X][2]
-    constexpr std::array<int, 4> dir_d = { { 90, 0, 180, 270 } }; //    [3]
-    constexpr std::array<std::array<quadrant, 2>, 4> dir_quadrants = { {
-            {{ quadrant::NE, quadrant::NW }},
-            {{ quadrant::SW, quadrant::NW }},
-            {{ quadrant::SE, quadrant::NE }},
-            {{ quadrant::SE, quadrant::SW }},
-        }
-    };
 
     const float natural_light = g->natural_light_level( zlev );
 
-    build_sunlight_cache( zlev );
+    // Gather the light sources first. If neither they nor the caches they are cast over
+    // changed since the last call, the current lightmap is still correct and casting can be skipped.
+    lightmap_sources sources;
+    sources.zlev = zlev;
+    sources.natural_light = natural_light;
+    sources.surface_light = g->natural_light_level( 0 );
+    sources.sight_penalty = get_weather().weather_id->sight_penalty;
+    recorded_light_sources = &sources;
 
     apply_character_light( get_player_character() );
     for( npc &guy : g->all_npcs() ) {
         apply_character_light( guy );
     }
 
-    std::vector<std::pair<tripoint, float>> lm_override;
+    sources.first_tile_source = sources.sources.size();
     // Traverse the submaps in order
     for( int smx = 0; smx < my_MAPSIZE; ++smx ) {
         for( int smy = 0; smy < my_MAPSIZE; ++smy ) {
@@ -488,27 +499,6 @@ void map::generate_lightmap( const int zlev )
                     const int x = sx + smx * SEEX;
                     const int y = sy + smy * SEEY;
                     const tripoint p( x, y, zlev );
-                    // Project light into any openings into buildings.
-                    if( !outside_cache[p.x][p.y] || ( !top_floor && prev_floor_cache[p.x][p.y] ) ) {
-                        // Apply light sources for external/internal divide
-                        for( int i = 0; i < 4; ++i ) {
-                            point neighbour = p.xy() + point( dir_x[i], dir_y[i] );
-                            if( lightmap_boundaries.contains( neighbour )
-                                && outside_cache[neighbour.x][neighbour.y] &&
-                                ( top_floor || !prev_floor_cache[neighbour.x][neighbour.y] )
-                              ) {
-                                const float source_light =
-                                    std::min( natural_light, lm[neighbour.x][neighbour.y].max() );
-                                if( light_transparency( p ) > LIGHT_TRANSPARENCY_SOLID ) {
-                                    update_light_quadrants( lm[p.x][p.y], source_light, quadrant::default_ );
-                                    apply_directional_light( p, dir_d[i], source_light );
-                                } else {
-                                    update_light_quadrants( lm[p.x][p.y], source_light, dir_quadrants[i][0] );
-                                    update_light_quadrants( lm[p.x][p.y], source_light, dir_quadrants[i][1] );
-                                }
-                            }
-                        }
-                    }
 
                     if( cur_submap->get_lum( { sx, sy } ) && has_items( p ) ) {
                         auto items = i_at( p );
@@ -532,13 +522,14 @@ void map::generate_lightmap( const int zlev )
                         }
                         const float light_override = cur->local_light_override();
                         if( light_override >= 0.0 ) {
-                            lm_override.emplace_back( p, light_override );
+                            sources.overrides.emplace_back( p, light_override );
                         }
                     }
                 }
             }
         }
     }
+    sources.end_tile_source = sources.sources.size();
 
     for( monster &critter : g->all_monsters() ) {
         if( critter.is_hallucination() ) {
@@ -629,6 +620,93 @@ void map::generate_lightmap( const int zlev )
             }
         }
     }
+    recorded_light_sources = nullptr;
+
+    if( !lightmap_inputs_dirty && sources == last_lightmap_sources ) {
+        // Characters' haslight effect is the only thing that has to be refreshed every turn
+        for( const lightmap_source &src : last_lightmap_sources.sources ) {
+            if( src.carrier_lit ) {
+                src.carrier->add_effect( effect_haslight, 1_turns );
+            }
+        }
+        return;
+    }
+
+    std::memset( lm, 0, sizeof( lm ) );
+    std::memset( sm, 0, sizeof( sm ) );
+
+    /* Bulk light sources wastefully cast rays into neighbors; a burning hospital can produce
+         significant slowdown, so for stuff like fire and lava:
+     * Step 1: Store the position and luminance in buffer via add_light_source, for efficient
+         checking of neighbors.
+     * Step 2: After everything else, iterate buffer and apply_light_source only in non-redundant
+         directions
+     * Step 3: ????
+     * Step 4: Profit!
+     */
+    auto &light_source_buffer = map_cache.light_source_buffer;
+    std::memset( light_source_buffer, 0, sizeof( light_source_buffer ) );
+
+    constexpr std::array<int, 4> dir_x = { {  0, -1, 1, 0 } };    //    [0]
+    constexpr std::array<int, 4> dir_y = { { -1,  0, 0, 1 } };    // [1][X][2]
+    constexpr std::array<int, 4> dir_d = { { 90, 0, 180, 270 } }; //    [3]
+    constexpr std::array<std::array<quadrant, 2>, 4> dir_quadrants = { {
+            {{ quadrant::NE, quadrant::NW }},
+            {{ quadrant::SW, quadrant::NW }},
+            {{ quadrant::SE, quadrant::NE }},
+            {{ quadrant::SE, quadrant::SW }},
+        }
+    };
+
+    build_sunlight_cache( zlev );
+
+    std::vector<lightmap_source> &applied = sources.sources;
+    size_t next_source = 0;
+    for( ; next_source < sources.first_tile_source; ++next_source ) {
+        apply_lightmap_source( applied[next_source] );
+    }
+
+    // Same traversal order as above, so tile sources come up in the order they were gathered
+    for( int smx = 0; smx < my_MAPSIZE; ++smx ) {
+        for( int smy = 0; smy < my_MAPSIZE; ++smy ) {
+            for( int sx = 0; sx < SEEX; ++sx ) {
+                for( int sy = 0; sy < SEEY; ++sy ) {
+                    const int x = sx + smx * SEEX;
+                    const int y = sy + smy * SEEY;
+                    const tripoint p( x, y, zlev );
+                    // Project light into any openings into buildings.
+                    if( !outside_cache[p.x][p.y] || ( !top_floor && prev_floor_cache[p.x][p.y] ) ) {
+                        // Apply light sources for external/internal divide
+                        for( int i = 0; i < 4; ++i ) {
+                            point neighbour = p.xy() + point( dir_x[i], dir_y[i] );
+                            if( lightmap_boundaries.contains( neighbour )
+                                && outside_cache[neighbour.x][neighbour.y] &&
+                                ( top_floor || !prev_floor_cache[neighbour.x][neighbour.y] )
+                              ) {
+                                const float source_light =
+                                    std::min( natural_light, lm[neighbour.x][neighbour.y].max() );
+                                if( light_transparency( p ) > LIGHT_TRANSPARENCY_SOLID ) {
+                                    update_light_quadrants( lm[p.x][p.y], source_light, quadrant::default_ );
+                                    apply_directional_light( p, dir_d[i], source_light );
+                                } else {
+                                    update_light_quadrants( lm[p.x][p.y], source_light, dir_quadrants[i][0] );
+                                    update_light_quadrants( lm[p.x][p.y], source_light, dir_quadrants[i][1] );
+                                }
+                            }
+                        }
+                    }
+
+                    while( next_source < sources.end_tile_source && applied[next_source].p == p ) {
+                        apply_lightmap_source( applied[next_source++] );
+                    }
+                }
+            }
+        }
+    }
+
+    for( ; next_source < applied.size(); ++next_source ) {
+        apply_lightmap_source( applied[next_source] );
+    }
 
     /* Now that we have position and intensity of all bulk light sources, apply_ them
       This may seem like extra work, but take a 12x12 raging inferno:
@@ -642,13 +720,22 @@ void map::generate_lightmap( const int zlev )
             apply_light_source( p, light_source_buffer[p.x][p.y] );
         }
     }
-    for( const std::pair<tripoint, float> &elem : lm_override ) {
+    for( const std::pair<tripoint, float> &elem : sources.overrides ) {
         lm[elem.first.x][elem.first.y].fill( elem.second );
     }
+
+    last_lightmap_sources = std::move( sources );
+    lightmap_inputs_dirty = false;
 }
 
 void map::add_light_source( const tripoint &p, float luminance )
 {
+    if( recorded_light_sources != nullptr ) {
+        recorded_light_sources->sources.push_back( {
+            lightmap_source::source_type::buffered, p, luminance
+        } );
+        return;
+    }
     auto &light_source_buffer = get_cache( p.z ).light_source_buffer;
     light_source_buffer[p.x][p.y] = std::max( luminance, light_source_buffer[p.x][p.y] );
 }
@@ -1190,6 +1277,23 @@ static inline bool eq_nullptr_gcc_hack( const void *check )
     return check == nullptr;
 }
 
+// Narrows [lo, hi] to the values of d for which base + c * d lies within [0, size)
+template<int c>
+static inline void clamp_row_to_bounds( const int base, const int size, int &lo, int &hi )
+{
+    if constexpr( c == 0 ) {
+        if( base < 0 || base >= size ) {
+            hi = lo - 1;
+        }
+    } else if constexpr( c > 0 ) {
+        lo = std::max( lo, -base );
+        hi = std::min( hi, size - 1 - base );
+    } else {
+        lo = std::max( lo, base - ( size - 1 ) );
+        hi = std::min( hi, base );
+    }
+}
+
 template<int xx, int xy, int yx, int yy, typename T, typename Out,
          T( *calc )( const T &, const T &, const int & ),
          bool( *check )( const T &, const T & ),
@@ -1258,16 +1362,15 @@ void castLight( Out( &output_cache )[MAPSIZE_X][MAPSIZE_Y],
         int x_limit = std::floor( std::min( 0.0f,
                                             ( ( -distance + 0.5f ) * end ) - 0.5f ) ) + 1;
 
+        // Tiles outside of the map don't affect the span, so clip the row to the map once
+        // instead of bounds checking every tile
+        const point row_origin( offset.x + delta.y * xy, offset.y + delta.y * yy );
+        clamp_row_to_bounds<xx>( row_origin.x, MAPSIZE_X, delta.x, x_limit );
+        clamp_row_to_bounds<yx>( row_origin.y, MAPSIZE_Y, delta.x, x_limit );
+
         int last_dist = -1;
         for( ; delta.x <= x_limit; delta.x++ ) {
-            point current( offset.x + delta.x * xx + delta.y * xy, offset.y + delta.x * yx + delta.y * yy );
-
-            if( !( current.x >= 0 && current.y >= 0 && current.x < MAPSIZE_X &&
-                   current.y < MAPSIZE_Y ) /* || start < leadingEdge */ ) {
-                continue;
-            } /*else if( end > trailingEdge ) {
-                break;
-            }*/
+            const point current( row_origin.x + delta.x * xx, row_origin.y + delta.x * yx );
 
             if( check_blocked( current ) ) {
                 continue;
@@ -1682,6 +1785,7 @@ void map::build_seen_cache( const tripoint &origin, const int target_z )
         }
     }
 
+    std::vector<std::pair<tripoint, int>> cameras;
     for( int mirror : mirrors ) {
         bool is_camera = veh->part_info( mirror ).has_flag( "CAMERA" );
         if( is_camera && cam_control < 0 ) {
@@ -1692,14 +1796,13 @@ void map::build_seen_cache( const tripoint &origin, const int target_z )
 
         // Determine how far the light has already traveled so mirrors
         // don't cheat the light distance falloff.
-        int offsetDistance;
-        if( !is_camera ) {
-            offsetDistance = rl_dist( origin, mirror_pos );
-        } else {
-            offsetDistance = 60 - veh->part_info( mirror ).bonus *
-                             veh->part( mirror ).hp() / veh->part_info( mirror ).durability;
-            camera_cache[mirror_pos.x][mirror_pos.y] = LIGHT_TRANSPARENCY_OPEN_AIR;
+        if( is_camera ) {
+            const int offsetDistance = 60 - veh->part_info( mirror ).bonus *
+                                       veh->part( mirror ).hp() / veh->part_info( mirror ).durability;
+            cameras.emplace_back( mirror_pos, offsetDistance );
+            continue;
         }
+        const int offsetDistance = rl_dist( origin, mirror_pos );
 
         // TODO: Factor in the mirror facing and only cast in the
         // directions the player's line of sight reflects to.
@@ -1710,6 +1813,71 @@ void map::build_seen_cache( const tripoint &origin, const int target_z )
         (
             camera_cache, transparency_cache, blocked_cache, mirror_pos.xy(), offsetDistance );
     }
+    if( !cameras.empty() ) {
+        apply_camera_view( cameras, map_cache );
+    }
+}
+
+void map::apply_camera_view( const std::vector<std::pair<tripoint, int>> &cameras,
+                             level_cache &map_cache )
+{
+    camera_view *view = cached_camera_view.get();
+    const bool unchanged = view != nullptr && view->cameras == cameras &&
+                           std::memcmp( view->transparency, map_cache.transparency_cache,
+                                        sizeof( view->transparency ) ) == 0 &&
+                           std::memcmp( view->blocked, map_cache.vehicle_obscured_cache,
+                                        sizeof( view->blocked ) ) == 0;
+    if( !unchanged ) {
+        if( view == nullptr ) {
+            cached_camera_view = std::make_unique<camera_view>();
+            view = cached_camera_view.get();
+        }
+        view->cameras = cameras;
+        std::memcpy( view->transparency, map_cache.transparency_cache, sizeof( view->transparency ) );
+        std::memcpy( view->blocked, map_cache.vehicle_obscured_cache, sizeof( view->blocked ) );
+        std::uninitialized_fill_n( &view->seen[0][0], MAPSIZE_X * MAPSIZE_Y, LIGHT_TRANSPARENCY_SOLID );
+        for( const std::pair<tripoint, int> &camera : cameras ) {
+            view->seen[camera.first.x][camera.first.y] = LIGHT_TRANSPARENCY_OPEN_AIR;
+            castLightAllWithLookup<float, float, sight_calc, sight_check, update_light, accumulate_transparency, sight_from_lookup>
+            ( view->seen, view->transparency, view->blocked, camera.first.xy(), camera.second );
+        }
+    }
+
+    float ( &camera_cache )[MAPSIZE_X][MAPSIZE_Y] = map_cache.camera_cache;
+    for( int x = 0; x < MAPSIZE_X; x++ ) {
+        for( int y = 0; y < MAPSIZE_Y; y++ ) {
+            camera_cache[x][y] = std::max( camera_cache[x][y], view->seen[x][y] );
+        }
+    }
+}
+
+void map::share_fov( const tripoint &origin )
+{
+    // Each one is as big as a seen cache.  Once there are this many, the rest keep using
+    // plain line of sight checks instead of evicting (and then recasting) older ones.
+    static constexpr size_t max_shared_fovs = 64;
+    if( !inbounds( origin ) || shared_fovs.size() >= max_shared_fovs ||
+        shared_fovs.count( origin ) > 0 ) {
+        return;
+    }
+    std::unique_ptr<shared_fov> fov = std::make_unique<shared_fov>();
+    std::uninitialized_fill_n( &fov->seen[0][0], MAPSIZE_X * MAPSIZE_Y, LIGHT_TRANSPARENCY_SOLID );
+    fov->seen[origin.x][origin.y] = VISIBILITY_FULL;
+    level_cache &map_cache = get_cache( origin.z );
+    castLightAllWithLookup<float, float, sight_calc, sight_check, update_light, accumulate_transparency, sight_from_lookup>
+    ( fov->seen, map_cache.transparency_cache, map_cache.vehicle_obscured_cache, origin.xy(), 0 );
+    shared_fovs.emplace( origin, std::move( fov ) );
+}
+
+bool map::has_shared_fov( const tripoint &origin ) const
+{
+    return find_shared_fov( origin ) != nullptr;
+}
+
+const map::shared_fov *map::find_shared_fov( const tripoint &origin ) const
+{
+    const auto it = shared_fovs.find( origin );
+    return it == shared_fovs.end() ? nullptr : it->second.get();
 }
 
 //Schraudolph's algorithm with John's constants
@@ -1750,6 +1918,12 @@ static float light_from_lookup( const float &numerator, const float &transparenc
 
 void map::apply_light_source( const tripoint &p, float luminance )
 {
+    if( recorded_light_sources != nullptr ) {
+        recorded_light_sources->sources.push_back( {
+            lightmap_source::source_type::immediate, p, luminance
+        } );
+        return;
+    }
     auto &cache = get_cache( p.z );
     four_quadrants( &lm )[MAPSIZE_X][MAPSIZE_Y] = cache.lm;
     float ( &sm )[MAPSIZE_X][MAPSIZE_Y] = cache.sm;
@@ -1875,6 +2049,12 @@ void map::apply_light_arc( const tripoint &p, units::angle angle, float luminanc
     if( luminance <= LIGHT_SOURCE_LOCAL ) {
         return;
     }
+    if( recorded_light_sources != nullptr ) {
+        recorded_light_sources->sources.push_back( {
+            lightmap_source::source_type::arc, p, luminance, angle, wideangle
+        } );
+        return;
+    }
 
     bool lit[LIGHTMAP_CACHE_X][LIGHTMAP_CACHE_Y] {};
 
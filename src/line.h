@@ -11,6 +11,7 @@
 #include "math_defines.h"
 #include "point.h"
 #include "cached_options.h"
+#include "enums.h"
 #include "units_angle.h"
 
 template <typename T> struct enum_traits;
@@ -138,11 +139,241 @@ std::string direction_suffix( const tripoint &p, const tripoint &q );
 /**
  * The actual Bresenham algorithm in 2D and 3D, everything else should call these
  * and pass in an interact functor to iterate across a line between two points.
+ * The functor returns false to stop.  These are templates so that the functor is
+ * called directly, without wrapping it in a std::function that may allocate.
  */
-void bresenham( point p1, point p2, int t,
-                const std::function<bool( point )> &interact );
+template<typename Interact>
+void bresenham( point p1, point p2, int t, Interact &&interact )
+{
+    // The slope components.
+    const point d = p2 - p1;
+    // Signs of slope values.
+    const point s( ( d.x == 0 ) ? 0 : sgn( d.x ), ( d.y == 0 ) ? 0 : sgn( d.y ) );
+    // Absolute values of slopes x2 to avoid rounding errors.
+    const point a = d.abs() * 2;
+
+    point cur = p1;
+
+    if( a.x == a.y ) {
+        while( cur.x != p2.x ) {
+            cur.y += s.y;
+            cur.x += s.x;
+            if( !interact( cur ) ) {
+                break;
+            }
+        }
+    } else if( a.x > a.y ) {
+        while( cur.x != p2.x ) {
+            if( t > 0 ) {
+                cur.y += s.y;
+                t -= a.x;
+            }
+            cur.x += s.x;
+            t += a.y;
+            if( !interact( cur ) ) {
+                break;
+            }
+        }
+    } else {
+        while( cur.y != p2.y ) {
+            if( t > 0 ) {
+                cur.x += s.x;
+                t -= a.y;
+            }
+            cur.y += s.y;
+            t += a.x;
+            if( !interact( cur ) ) {
+                break;
+            }
+        }
+    }
+}
+
+template<typename Interact>
 void bresenham( const tripoint &loc1, const tripoint &loc2, int t, int t2,
-                const std::function<bool( const tripoint & )> &interact );
+                Interact &&interact )
+{
+    // The slope components.
+    const tripoint d( -loc1 + loc2 );
+    // The signs of the slopes.
+    const tripoint s( ( d.x == 0 ? 0 : sgn( d.x ) ), ( d.y == 0 ? 0 : sgn( d.y ) ),
+                      ( d.z == 0 ? 0 : sgn( d.z ) ) );
+    // Absolute values of slope components, x2 to avoid rounding errors.
+    const tripoint a( std::abs( d.x ) * 2, std::abs( d.y ) * 2, std::abs( d.z ) * 2 );
+
+    tripoint cur( loc1 );
+
+    if( a.z == 0 ) {
+        if( a.x == a.y ) {
+            while( cur.x != loc2.x ) {
+                cur.y += s.y;
+                cur.x += s.x;
+                if( !interact( cur ) ) {
+                    break;
+                }
+            }
+        } else if( a.x > a.y ) {
+            while( cur.x != loc2.x ) {
+                if( t > 0 ) {
+                    cur.y += s.y;
+                    t -= a.x;
+                }
+                cur.x += s.x;
+                t += a.y;
+                if( !interact( cur ) ) {
+                    break;
+                }
+            }
+        } else {
+            while( cur.y != loc2.y ) {
+                if( t > 0 ) {
+                    cur.x += s.x;
+                    t -= a.y;
+                }
+                cur.y += s.y;
+                t += a.x;
+                if( !interact( cur ) ) {
+                    break;
+                }
+            }
+        }
+    } else {
+        if( a.x == a.y && a.y == a.z ) {
+            while( cur.x != loc2.x ) {
+                cur.z += s.z;
+                cur.y += s.y;
+                cur.x += s.x;
+                if( !interact( cur ) ) {
+                    break;
+                }
+            }
+        } else if( ( a.z > a.x ) && ( a.z > a.y ) ) {
+            while( cur.z != loc2.z ) {
+                if( t > 0 ) {
+                    cur.x += s.x;
+                    t -= a.z;
+                }
+                if( t2 > 0 ) {
+                    cur.y += s.y;
+                    t2 -= a.z;
+                }
+                cur.z += s.z;
+                t += a.x;
+                t2 += a.y;
+                if( !interact( cur ) ) {
+                    break;
+                }
+            }
+        } else if( ( a.x > a.y ) && ( a.x > a.z ) ) {
+            while( cur.x != loc2.x ) {
+                if( t > 0 ) {
+                    cur.y += s.y;
+                    t -= a.x;
+                }
+                if( t2 > 0 ) {
+                    cur.z += s.z;
+                    t2 -= a.x;
+                }
+                cur.x += s.x;
+                t += a.y;
+                t2 += a.z;
+                if( !interact( cur ) ) {
+                    break;
+                }
+            }
+        } else if( ( a.y > a.z ) && ( a.y > a.x ) ) {
+            while( cur.y != loc2.y ) {
+                if( t > 0 ) {
+                    cur.z += s.z;
+                    t -= a.y;
+                }
+                if( t2 > 0 ) {
+                    cur.x += s.x;
+                    t2 -= a.y;
+                }
+                cur.y += s.y;
+                t += a.z;
+                t2 += a.x;
+                if( !interact( cur ) ) {
+                    break;
+                }
+            }
+        } else if( a.x == a.y ) {
+            while( cur.x != loc2.x ) {
+                if( t > 0 ) {
+                    cur.z += s.z;
+                    t -= a.x;
+                }
+                cur.y += s.y;
+                cur.x += s.x;
+                t += a.z;
+                if( !interact( cur ) ) {
+                    break;
+                }
+            }
+        } else if( a.x == a.z ) {
+            while( cur.x != loc2.x ) {
+                if( t > 0 ) {
+                    cur.y += s.y;
+                    t -= a.x;
+                }
+                cur.z += s.z;
+                cur.x += s.x;
+                t += a.y;
+                if( !interact( cur ) ) {
+                    break;
+                }
+            }
+        } else if( a.y == a.z ) {
+            while( cur.y != loc2.y ) {
+                if( t > 0 ) {
+                    cur.x += s.x;
+                    t -= a.z;
+                }
+                cur.y += s.y;
+                cur.z += s.z;
+                t += a.x;
+                if( !interact( cur ) ) {
+                    break;
+                }
+            }
+        } else if( a.x > a.y ) {
+            while( cur.x != loc2.x ) {
+                if( t > 0 ) {
+                    cur.y += s.y;
+                    t -= a.x;
+                }
+                if( t2 > 0 ) {
+                    cur.z += s.z;
+                    t2 -= a.x;
+                }
+                cur.x += s.x;
+                t += a.y;
+                t2 += a.z;
+                if( !interact( cur ) ) {
+                    break;
+                }
+            }
+        } else { //dy > dx >= dz
+            while( cur.y != loc2.y ) {
+                if( t > 0 ) {
+                    cur.x += s.x;
+                    t -= a.y;
+                }
+                if( t2 > 0 ) {
+                    cur.z += s.z;
+                    t2 -= a.y;
+                }
+                cur.y += s.y;
+                t += a.x;
+                t2 += a.z;
+                if( !interact( cur ) ) {
+                    break;
+                }
+            }
+        }
+    }
+}
 
 tripoint move_along_line( const tripoint &loc, const std::vector<tripoint> &line,
                           int distance );
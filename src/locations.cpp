@@ -1,5 +1,6 @@
 #include "locations.h"
 
+#include "cata_pool.h"
 #include "character.h"
 #include "coordinates.h"
 #include "detached_ptr.h"
@@ -232,6 +233,24 @@ tile_item_location::tile_item_location( tripoint position )
     pos = position;
 }
 
+using tile_location_pool = cata_pool<sizeof( tile_item_location ), alignof( tile_item_location )>;
+
+void *tile_item_location::operator new( size_t size )
+{
+    // Derived locations with members of their own don't fit into the slots
+    return size != sizeof( tile_item_location ) ? ::operator new( size ) :
+           tile_location_pool::allocate();
+}
+
+void tile_item_location::operator delete( void *ptr, size_t size )
+{
+    if( size != sizeof( tile_item_location ) ) {
+        ::operator delete( ptr );
+        return;
+    }
+    tile_location_pool::deallocate( ptr );
+}
+
 detached_ptr<item> tile_item_location::detach( item *it )
 {
     map &here = get_map();
@@ -2,6 +2,8 @@
 #ifndef CATA_SRC_LOCATIONS_H
 #define CATA_SRC_LOCATIONS_H
 
+#include <cstddef>
+
 #include "point.h"
 #include "type_id.h"
 
@@ -91,6 +93,9 @@ class tile_item_location : public item_location
         tripoint pos;//abs coords
     public:
         tile_item_location( tripoint position );
+        // Every submap tile has one, so they come from a pool, see cata_pool.h
+        static void *operator new( size_t size );
+        static void operator delete( void *ptr, size_t size );
         detached_ptr<item> detach( item *it ) override;
         void attach( detached_ptr<item> &&obj ) override;
         bool is_loaded( const item *it ) const override;
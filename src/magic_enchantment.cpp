@@ -173,7 +173,11 @@ bool enchantment::is_active( const Character &guy, const item &parent ) const
     if( !guy.has_item( parent ) ) {
         return false;
     }
+    return is_active_carried( guy, parent );
+}
 
+bool enchantment::is_active_carried( const Character &guy, const item &parent ) const
+{
     if( active_conditions.first == has::WIELD && !guy.is_wielding( parent ) ) {
         return false;
     }
@@ -291,13 +295,14 @@ void enchantment::load( const JsonObject &jo, const std::string & )
 
             const int add = value_obj.get_int( "add", 0 );
             const double mult = value_obj.get_float( "multiply", 0.0 );
-            if( add != 0 ) {
-                values_add.emplace( value, add );
+            const size_t idx = static_cast<size_t>( value );
+            // The first entry for a value wins
+            if( add != 0 && values_add[idx] == 0 ) {
+                values_add[idx] = add;
             }
-            if( mult != 0.0 ) {
+            if( mult != 0.0 && values_multiply[idx] == 0.0 ) {
                 // Limit precision to minimize inconsistencies between platforms / compilers
-                const double mul = static_cast<int>( std::round( mult * 100'000 ) ) / 100'000.0;
-                values_multiply.emplace( value, mul );
+                values_multiply[idx] = static_cast<int>( std::round( mult * 100'000 ) ) / 100'000.0;
             }
         }
     }
@@ -401,13 +406,11 @@ bool enchantment::add( const enchantment &rhs )
 
 void enchantment::force_add( const enchantment &rhs )
 {
-    for( const std::pair<const enchant_vals::mod, int> &pair_values : rhs.values_add ) {
-        values_add[pair_values.first] += pair_values.second;
-    }
-    for( const std::pair<const enchant_vals::mod, double> &pair_values : rhs.values_multiply ) {
+    for( size_t i = 0; i < num_mods; i++ ) {
+        values_add[i] += rhs.values_add[i];
         // values do not multiply against each other, they add.
         // so +10% and -10% will add to 0%
-        values_multiply[pair_values.first] += pair_values.second;
+        values_multiply[i] += rhs.values_multiply[i];
     }
 
     hit_me_effect.insert( hit_me_effect.end(), rhs.hit_me_effect.begin(), rhs.hit_me_effect.end() );
@@ -434,20 +437,12 @@ void enchantment::force_add( const enchantment &rhs )
 
 int enchantment::get_value_add( const enchant_vals::mod value ) const
 {
-    const auto found = values_add.find( value );
-    if( found == values_add.cend() ) {
-        return 0;
-    }
-    return found->second;
+    return values_add[static_cast<size_t>( value )];
 }
 
 double enchantment::get_value_multiply( const enchant_vals::mod value ) const
 {
-    const auto found = values_multiply.find( value );
-    if( found == values_multiply.cend() ) {
-        return 0;
-    }
-    return found->second;
+    return values_multiply[static_cast<size_t>( value )];
 }
 
 double enchantment::calc_bonus( enchant_vals::mod value, double base, bool round ) const
@@ -2,6 +2,7 @@
 #ifndef CATA_SRC_MAGIC_ENCHANTMENT_H
 #define CATA_SRC_MAGIC_ENCHANTMENT_H
 
+#include <array>
 #include <map>
 #include <optional>
 #include <string>
@@ -115,6 +116,8 @@ class enchantment
 
         // this enchantment has a valid condition and is in the right location
         bool is_active( const Character &guy, const item &parent ) const;
+        // same as above, for a parent already known to be in the possession of guy
+        bool is_active_carried( const Character &guy, const item &parent ) const;
 
         // @active means the container for the enchantment is active, for comparison to active flag.
         bool is_active( const Character &guy, bool active ) const;
@@ -153,11 +156,12 @@ class enchantment
         std::set<trait_id> mutations;
         std::optional<emit_id> emitter;
         std::map<efftype_id, int> ench_effects;
-        // values that add to the base value
-        std::map<enchant_vals::mod, int> values_add;
+        static constexpr size_t num_mods = static_cast<size_t>( enchant_vals::mod::NUM_MOD );
+        // values that add to the base value, indexed by enchant_vals::mod
+        std::array<int, num_mods> values_add = {};
         // values that get multiplied to the base value
         // multipliers add to each other instead of multiply against themselves
-        std::map<enchant_vals::mod, double> values_multiply;
+        std::array<double, num_mods> values_multiply = {};
 
         std::vector<fake_spell> hit_me_effect;
         std::vector<fake_spell> hit_you_effect;
@@ -161,8 +161,52 @@ void spell_effect::pain_split( const spell &sp, Creature &caster, const tripoint
     p->set_all_parts_hp_cur( hp_each );
 }
 
+namespace
+{
+
+/**
+ * Remembers which tiles in a square around a spell's origin stop the spell.  The lines to
+ * all the tiles of an area cross the same tiles near the origin over and over again, this
+ * looks each of them up on the map only once.
+ */
+class spell_wall_cache
+{
+    public:
+        spell_wall_cache( const tripoint &center, int radius ) : center( center ), radius( radius ),
+            state( static_cast<size_t>( 2 * radius + 1 ) * ( 2 * radius + 1 ), unknown ) {
+        }
+
+        bool blocks( const tripoint &p ) {
+            const point d = p.xy() - center.xy();
+            if( p.z != center.z || std::abs( d.x ) > radius || std::abs( d.y ) > radius ) {
+                return lookup( p );
+            }
+            char &s = state[( d.y + radius ) * ( 2 * radius + 1 ) + d.x + radius];
+            if( s == unknown ) {
+                s = lookup( p ) ? blocked : clear;
+            }
+            return s == blocked;
+        }
+
+    private:
+        static constexpr char unknown = 0;
+        static constexpr char clear = 1;
+        static constexpr char blocked = 2;
+
+        static bool lookup( const tripoint &p ) {
+            const map &here = get_map();
+            return here.impassable( p ) && !here.has_flag( "THIN_OBSTACLE", p );
+        }
+
+        tripoint center;
+        int radius;
+        std::vector<char> state;
+};
+
+} // namespace
+
 static bool in_spell_aoe( const tripoint &start, const tripoint &end, const int &radius,
-                          const bool ignore_walls )
+                          const bool ignore_walls, spell_wall_cache &walls )
 {
     if( rl_dist( start, end ) > radius ) {
         return false;
@@ -174,8 +218,7 @@ static bool in_spell_aoe( const tripoint &start, const tripoint &end, const int
     const std::vector<tripoint> trajectory = line_to( start, end );
     tripoint last_point = start;
     for( const tripoint &pt : trajectory ) {
-        if( ( here.impassable( pt ) && !here.has_flag( "THIN_OBSTACLE", pt ) ) ||
-            here.obstructed_by_vehicle_rotation( pt, last_point ) ) {
+        if( walls.blocks( pt ) || here.obstructed_by_vehicle_rotation( pt, last_point ) ) {
             return false;
         }
         last_point = pt;
@@ -187,9 +230,10 @@ std::set<tripoint> spell_effect::spell_effect_blast( const spell &, const tripoi
         const tripoint &target, const int aoe_radius, const bool ignore_walls )
 {
     std::set<tripoint> targets;
+    spell_wall_cache walls( target, ignore_walls ? 0 : aoe_radius );
     // TODO: Make this breadth-first
     for( const tripoint &potential_target : get_map().points_in_radius( target, aoe_radius ) ) {
-        if( in_spell_aoe( target, potential_target, aoe_radius, ignore_walls ) ) {
+        if( in_spell_aoe( target, potential_target, aoe_radius, ignore_walls, walls ) ) {
             targets.emplace( potential_target );
         }
     }
@@ -211,12 +255,13 @@ static std::set<tripoint> spell_effect_cone_range_override( const tripoint &sour
         end_points.emplace( potential );
     }
     map &here = get_map();
+    spell_wall_cache walls( source, ignore_walls ? 0 : range );
     for( const tripoint &ep : end_points ) {
         std::vector<tripoint> trajectory = line_to( source, ep );
         tripoint last_point = source;
         for( const tripoint &tp : trajectory ) {
             if( ignore_walls || ( !here.obstructed_by_vehicle_rotation( tp, last_point ) &&
-                                  ( here.passable( tp ) || here.has_flag( "THIN_OBSTACLE", tp ) ) ) ) {
+                                  !walls.blocks( tp ) ) ) {
                 targets.emplace( tp );
             } else {
                 break;
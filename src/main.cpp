@@ -32,6 +32,7 @@
 #include "game_ui.h"
 #include "init.h"
 #include "input.h"
+#include "input_replay.h"
 #include "language.h"
 #include "loading_ui.h"
 #include "runtime_handlers.h"
@@ -41,6 +42,7 @@
 #include "options.h"
 #include "output.h"
 #include "path_info.h"
+#include "profile.h"
 #include "rng.h"
 #include "type_id.h"
 #include "ui_manager.h"
@@ -198,6 +200,7 @@ int main( int argc, char *argv[] )
 {
 #endif
     init_crash_handlers();
+    set_profiler_thread_name( "main" );
     int seed = time( nullptr );
     bool verifyexit = false;
     bool check_mods = false;
@@ -206,6 +209,8 @@ int main( int argc, char *argv[] )
     dump_mode dmode = dump_mode::TSV;
     std::vector<std::string> opts;
     std::string world; /** if set try to load first save in this world on startup */
+    std::string record_input;
+    std::string replay_input;
 
 #if defined(__ANDROID__)
     // Start the standard output logging redirector
@@ -241,7 +246,7 @@ int main( int argc, char *argv[] )
         const char *section_default = nullptr;
         const char *section_map_sharing = "Map sharing";
         const char *section_user_directory = "User directories";
-        const std::array<arg_handler, 14> first_pass_arguments = {{
+        const std::array<arg_handler, 16> first_pass_arguments = {{
                 {
                     "--seed", "<string of letters and or numbers>",
                     "Sets the random number generator's seed value",
@@ -256,6 +261,32 @@ int main( int argc, char *argv[] )
                         return 1;
                     }
                 },
+                {
+                    "--record-input", "<file>",
+                    "Records the seed and all input of the session to the file",
+                    section_default,
+                    [&record_input]( int num_args, const char **params ) -> int {
+                        if( num_args < 1 )
+                        {
+                            return -1;
+                        }
+                        record_input = params[0];
+                        return 1;
+                    }
+                },
+                {
+                    "--replay-input", "<file>",
+                    "Replays a session recorded with --record-input",
+                    section_default,
+                    [&replay_input]( int num_args, const char **params ) -> int {
+                        if( num_args < 1 )
+                        {
+                            return -1;
+                        }
+                        replay_input = params[0];
+                        return 1;
+                    }
+                },
                 {
                     "--jsonverify", nullptr,
                     "Checks the BN json files",
@@ -707,6 +738,18 @@ int main( int argc, char *argv[] )
     set_language();
 #endif
 
+    if( !replay_input.empty() ) {
+        unsigned int recorded_seed = 0;
+        if( !input_replay::start_replay( replay_input, recorded_seed ) ) {
+            std::cerr << "Failed to read input recording " << replay_input << '\n';
+            return 1;
+        }
+        seed = static_cast<int>( recorded_seed );
+    } else if( !record_input.empty() && !input_replay::start_recording( record_input,
+               static_cast<unsigned int>( seed ) ) ) {
+        std::cerr << "Failed to open " << record_input << " for recording input\n";
+        return 1;
+    }
     rng_set_engine_seed( seed );
 
     g = std::make_unique<game>();
@@ -4,12 +4,14 @@
 #include <array>
 #include <cassert>
 #include <climits>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <limits>
 #include <optional>
 #include <ostream>
 #include <queue>
+#include <set>
 #include <type_traits>
 #include <unordered_map>
 
@@ -86,6 +88,7 @@
 #include "string_formatter.h"
 #include "string_id.h"
 #include "submap.h"
+#include "thread_pool.h"
 #include "tileray.h"
 #include "timed_event.h"
 #include "translations.h"
@@ -100,6 +103,7 @@
 #include "vpart_range.h"
 #include "weather.h"
 #include "weighted_list.h"
+#include "world.h"
 
 struct ammo_effect;
 using ammo_effect_str_id = string_id<ammo_effect>;
@@ -185,17 +189,14 @@ map::map( int mapsize, bool zlev )
     zlevels = zlev;
     if( zlevels ) {
         grid.resize( static_cast<size_t>( my_MAPSIZE * my_MAPSIZE * OVERMAP_LAYERS ), nullptr );
+        grid_stride = tripoint( OVERMAP_LAYERS, my_MAPSIZE * OVERMAP_LAYERS, 1 );
     } else {
         grid.resize( static_cast<size_t>( my_MAPSIZE * my_MAPSIZE ), nullptr );
+        // Only one z-level is held, the one at abs_sub.z
+        grid_stride = tripoint( 1, my_MAPSIZE, 0 );
     }
 
-    for( auto &ptr : caches ) {
-        ptr = std::make_unique<level_cache>();
-    }
-
-    for( auto &ptr : pathfinding_caches ) {
-        ptr = std::make_unique<pathfinding_cache>();
-    }
+    route_results = std::make_unique<route_cache>();
 
     dbg( DL::Info ) << "map::map(): my_MAPSIZE: " << my_MAPSIZE << " z-levels enabled:" << zlevels;
     traplocs.resize( trap::count() );
@@ -206,59 +207,83 @@ map &map::operator=( map && )  noexcept = default;
 
 void map::set_transparency_cache_dirty( const int zlev )
 {
-    if( inbounds_z( zlev ) ) {
-        get_cache( zlev ).transparency_cache_dirty.set();
+    if( level_cache *ch = inbounds_z( zlev ) ? find_cache( zlev ) : nullptr ) {
+        ch->transparency_cache_dirty.set();
     }
 }
 
 void map::set_seen_cache_dirty( const tripoint change_location )
 {
-    if( inbounds( change_location ) ) {
-        level_cache &cache = get_cache( change_location.z );
-        if( cache.seen_cache_dirty ) {
+    if( level_cache *cache = inbounds( change_location ) ? find_cache( change_location.z ) :
+                             nullptr ) {
+        if( cache->seen_cache_dirty ) {
             return;
         }
-        if( cache.seen_cache[change_location.x][change_location.y] != 0.0 ||
-            cache.camera_cache[change_location.x][change_location.y] != 0.0 ) {
-            cache.seen_cache_dirty = true;
+        if( cache->seen_cache[change_location.x][change_location.y] != 0.0 ||
+            cache->camera_cache[change_location.x][change_location.y] != 0.0 ) {
+            cache->seen_cache_dirty = true;
         }
     }
 }
 
 void map::set_outside_cache_dirty( const int zlev )
 {
-    if( inbounds_z( zlev ) ) {
-        get_cache( zlev ).outside_cache_dirty = true;
+    if( level_cache *ch = inbounds_z( zlev ) ? find_cache( zlev ) : nullptr ) {
+        ch->outside_cache_dirty.set();
+    }
+}
+
+void map::set_outside_cache_dirty( const tripoint &p )
+{
+    level_cache *ch = inbounds( p ) ? find_cache( p.z ) : nullptr;
+    if( ch == nullptr ) {
+        return;
+    }
+    // A roof shelters its neighbours too, so those may be in the next submap
+    const point min_sm = ms_to_sm_copy( point( std::max( p.x - 1, 0 ), std::max( p.y - 1, 0 ) ) );
+    const point max_sm = ms_to_sm_copy( point( std::min( p.x + 1, SEEX * my_MAPSIZE - 1 ),
+                                        std::min( p.y + 1, SEEY * my_MAPSIZE - 1 ) ) );
+    for( int smx = min_sm.x; smx <= max_sm.x; smx++ ) {
+        for( int smy = min_sm.y; smy <= max_sm.y; smy++ ) {
+            ch->outside_cache_dirty.set( smx * MAPSIZE + smy );
+        }
     }
 }
 
 void map::set_suspension_cache_dirty( const int zlev )
 {
-    if( inbounds_z( zlev ) ) {
-        get_cache( zlev ).suspension_cache_dirty = true;
+    if( level_cache *ch = inbounds_z( zlev ) ? find_cache( zlev ) : nullptr ) {
+        ch->suspension_cache_dirty = true;
     }
 }
 
 void map::set_floor_cache_dirty( const int zlev )
 {
-    if( inbounds_z( zlev ) ) {
-        get_cache( zlev ).floor_cache_dirty = true;
+    if( level_cache *ch = inbounds_z( zlev ) ? find_cache( zlev ) : nullptr ) {
+        ch->floor_cache_dirty.set();
+    }
+}
+
+void map::set_floor_cache_dirty( const tripoint &p )
+{
+    if( level_cache *ch = inbounds( p ) ? find_cache( p.z ) : nullptr ) {
+        const point smp = ms_to_sm_copy( p.xy() );
+        ch->floor_cache_dirty.set( smp.x * MAPSIZE + smp.y );
     }
 }
 
 void map::set_seen_cache_dirty( const int zlevel )
 {
-    if( inbounds_z( zlevel ) ) {
-        level_cache &cache = get_cache( zlevel );
-        cache.seen_cache_dirty = true;
+    if( level_cache *cache = inbounds_z( zlevel ) ? find_cache( zlevel ) : nullptr ) {
+        cache->seen_cache_dirty = true;
     }
 }
 
 void map::set_transparency_cache_dirty( const tripoint &p )
 {
-    if( inbounds( p ) ) {
-        const tripoint smp = ms_to_sm_copy( p );
-        get_cache( smp.z ).transparency_cache_dirty.set( smp.x * MAPSIZE + smp.y );
+    if( level_cache *ch = inbounds( p ) ? find_cache( p.z ) : nullptr ) {
+        const point smp = ms_to_sm_copy( p.xy() );
+        ch->transparency_cache_dirty.set( smp.x * MAPSIZE + smp.y );
     }
 }
 
@@ -350,9 +375,9 @@ void map::add_vehicle_to_cache( vehicle *veh )
         const tripoint p = veh->global_part_pos3( vpr.part() );
         level_cache &ch = get_cache( p.z );
         ch.veh_in_active_range = true;
-        ch.veh_cached_parts[p] = std::make_pair( veh,  static_cast<int>( vpr.part_index() ) );
         if( inbounds( p ) ) {
             ch.veh_exists_at[p.x][p.y] = true;
+            ch.veh_cached_parts[p.x][p.y] = std::make_pair( veh, static_cast<int>( vpr.part_index() ) );
         }
     }
 
@@ -370,11 +395,6 @@ void map::clear_vehicle_point_from_cache( vehicle *veh, const tripoint &pt )
     if( inbounds( pt ) ) {
         ch.veh_exists_at[pt.x][pt.y] = false;
     }
-    auto it = ch.veh_cached_parts.find( pt );
-    if( it != ch.veh_cached_parts.end() && it->second.first == veh ) {
-        ch.veh_cached_parts.erase( it );
-    }
-
 }
 
 void map::clear_vehicle_cache( )
@@ -383,14 +403,7 @@ void map::clear_vehicle_cache( )
     const int zmax = zlevels ? OVERMAP_HEIGHT : abs_sub.z;
     for( int zlev = zmin; zlev <= zmax; zlev++ ) {
         level_cache &ch = get_cache( zlev );
-        while( !ch.veh_cached_parts.empty() ) {
-            const auto part = ch.veh_cached_parts.begin();
-            const auto &p = part->first;
-            if( inbounds( p ) ) {
-                ch.veh_exists_at[p.x][p.y] = false;
-            }
-            ch.veh_cached_parts.erase( part );
-        }
+        std::fill_n( &ch.veh_exists_at[0][0], MAPSIZE_X * MAPSIZE_Y, false );
         ch.veh_in_active_range = false;
     }
 }
@@ -1133,15 +1146,9 @@ const vehicle *map::veh_at_internal( const tripoint &p, int &part_num ) const
         return nullptr; // Clear cache indicates no vehicle. This should optimize a great deal.
     }
 
-    const auto it = ch.veh_cached_parts.find( p );
-    if( it != ch.veh_cached_parts.end() ) {
-        part_num = it->second.second;
-        return it->second.first;
-    }
-
-    debugmsg( "vehicle part cache indicated vehicle not found: %d %d %d", p.x, p.y, p.z );
-    part_num = -1;
-    return nullptr;
+    const std::pair<vehicle *, int> &part = ch.veh_cached_parts[p.x][p.y];
+    part_num = part.second;
+    return part.first;
 }
 
 vehicle *map::veh_at_internal( const tripoint &p, int &part_num )
@@ -1455,7 +1462,7 @@ furn_id map::furn( const tripoint &p ) const
     }
 
     point l;
-    submap *const current_submap = get_submap_at( p, l );
+    submap *const current_submap = unsafe_get_submap_at( p, l );
 
     return current_submap->get_furn( l );
 }
@@ -1468,7 +1475,7 @@ void map::furn_set( const tripoint &p, const furn_id &new_furniture,
     }
 
     point l;
-    submap *const current_submap = get_submap_at( p, l );
+    submap *const current_submap = unsafe_get_submap_at( p, l );
     const furn_id old_id = current_submap->get_furn( l );
     if( old_id == new_furniture ) {
         // Nothing changed
@@ -1502,16 +1509,16 @@ void map::furn_set( const tripoint &p, const furn_id &new_furniture,
     }
 
     if( old_t.has_flag( TFLAG_INDOORS ) != new_t.has_flag( TFLAG_INDOORS ) ) {
-        set_outside_cache_dirty( p.z );
+        set_outside_cache_dirty( p );
     }
 
     if( old_t.has_flag( TFLAG_NO_FLOOR ) != new_t.has_flag( TFLAG_NO_FLOOR ) ) {
-        set_floor_cache_dirty( p.z );
+        set_floor_cache_dirty( p );
         set_seen_cache_dirty( p );
     }
 
     if( old_t.has_flag( TFLAG_SUN_ROOF_ABOVE ) != new_t.has_flag( TFLAG_SUN_ROOF_ABOVE ) ) {
-        set_floor_cache_dirty( p.z + 1 );
+        set_floor_cache_dirty( p + tripoint_above );
     }
 
     invalidate_max_populated_zlev( p.z );
@@ -1606,7 +1613,7 @@ ter_id map::ter( const tripoint &p ) const
     }
 
     point l;
-    submap *const current_submap = get_submap_at( p, l );
+    submap *const current_submap = unsafe_get_submap_at( p, l );
 
     return current_submap->get_ter( l );
 }
@@ -1801,7 +1808,7 @@ bool map::ter_set( const tripoint &p, const ter_id &new_terrain )
     }
 
     point l;
-    submap *const current_submap = get_submap_at( p, l );
+    submap *const current_submap = unsafe_get_submap_at( p, l );
     const ter_id old_id = current_submap->get_ter( l );
     if( old_id == new_terrain ) {
         // Nothing changed
@@ -1825,6 +1832,10 @@ bool map::ter_set( const tripoint &p, const ter_id &new_terrain )
     if( new_t.trap != tr_null && new_t.trap != tr_ledge ) {
         traplocs[new_t.trap.to_i()].push_back( p );
     }
+    if( new_t.trap != tr_null ) {
+        const tripoint smp = ms_to_sm_copy( p );
+        get_cache( smp.z ).trap_cache.set( smp.x + smp.y * MAPSIZE );
+    }
 
     if( old_t.transparent != new_t.transparent ) {
         set_transparency_cache_dirty( p );
@@ -1832,13 +1843,12 @@ bool map::ter_set( const tripoint &p, const ter_id &new_terrain )
     }
 
     if( old_t.has_flag( TFLAG_INDOORS ) != new_t.has_flag( TFLAG_INDOORS ) ) {
-        set_outside_cache_dirty( p.z );
+        set_outside_cache_dirty( p );
     }
 
     if( new_t.has_flag( TFLAG_NO_FLOOR ) != old_t.has_flag( TFLAG_NO_FLOOR ) ) {
-        set_floor_cache_dirty( p.z );
-        // It's a set, not a flag
-        support_cache_dirty.insert( p );
+        set_floor_cache_dirty( p );
+        support_dirty( p );
         set_seen_cache_dirty( p );
     }
 
@@ -1846,7 +1856,11 @@ bool map::ter_set( const tripoint &p, const ter_id &new_terrain )
         set_suspension_cache_dirty( p.z );
         if( new_t.has_flag( TFLAG_SUSPENDED ) ) {
             level_cache &ch = get_cache( p.z );
-            ch.suspension_cache.emplace_back( getabs( p ).xy() );
+            const point abs_p = getabs( p ).xy();
+            if( std::find( ch.suspension_cache.begin(), ch.suspension_cache.end(),
+                           abs_p ) == ch.suspension_cache.end() ) {
+                ch.suspension_cache.push_back( abs_p );
+            }
         }
     }
 
@@ -1942,6 +1956,16 @@ int map::move_cost( const tripoint &p, const vehicle *ignored_vehicle ) const
         return 0;
     }
 
+    int cached_part;
+    if( veh_at_internal( p, cached_part ) == nullptr ) {
+        // Tiles without vehicles are stored by the pathfinding cache, as long as it's up to date
+        const pathfinding_cache &pf_cache = get_pathfinding_cache( p.z );
+        const std::uint8_t cost = pf_cache.move_cost[p.x][p.y];
+        if( !pf_cache.dirty && cost != pathfinding_cache::unknown_move_cost ) {
+            return cost;
+        }
+    }
+
     const furn_t &furniture = furn( p ).obj();
     const ter_t &terrain = ter( p ).obj();
     const optional_vpart_position vp = veh_at( p );
@@ -1968,7 +1992,7 @@ int map::move_cost_ter_furn( const tripoint &p ) const
     }
 
     point l;
-    submap *const current_submap = get_submap_at( p, l );
+    submap *const current_submap = unsafe_get_submap_at( p, l );
 
     const int tercost = current_submap->get_ter( l ).obj().movecost;
     if( tercost == 0 ) {
@@ -2435,11 +2459,28 @@ void map::drop_fields( const tripoint &p )
     }
 }
 
+static size_t support_mask_index( const tripoint &p )
+{
+    return p.x + ( p.y + ( p.z + OVERMAP_DEPTH ) * MAPSIZE_Y ) * MAPSIZE_X;
+}
+
 void map::support_dirty( const tripoint &p )
 {
-    if( zlevels ) {
-        support_cache_dirty.insert( p );
+    if( !zlevels ) {
+        return;
     }
+    // Tiles outside of the map are rare and harmless, process_falling drops the duplicates
+    if( inbounds( p ) ) {
+        if( support_dirty_mask.empty() ) {
+            support_dirty_mask.resize( MAPSIZE_X * MAPSIZE_Y * OVERMAP_LAYERS );
+        }
+        const size_t idx = support_mask_index( p );
+        if( support_dirty_mask[idx] ) {
+            return;
+        }
+        support_dirty_mask[idx] = true;
+    }
+    support_cache_dirty.push_back( p );
 }
 
 void map::process_falling()
@@ -2455,8 +2496,16 @@ void map::process_falling()
         add_msg( m_debug, "Checking %d tiles for falling objects",
                  support_cache_dirty.size() );
         // We want the cache to stay constant, but falling can change it
-        std::set<tripoint> last_cache = std::move( support_cache_dirty );
+        std::vector<tripoint> last_cache = std::move( support_cache_dirty );
         support_cache_dirty.clear();
+        for( const tripoint &p : last_cache ) {
+            if( inbounds( p ) ) {
+                support_dirty_mask[support_mask_index( p )] = false;
+            }
+        }
+        // Same order as before, lower tiles of a column go first
+        std::sort( last_cache.begin(), last_cache.end() );
+        last_cache.erase( std::unique( last_cache.begin(), last_cache.end() ), last_cache.end() );
         for( const tripoint &p : last_cache ) {
             drop_everything( p );
         }
@@ -2499,7 +2548,7 @@ bool map::has_flag_ter_or_furn( const std::string &flag, const tripoint &p ) con
     }
 
     point l;
-    submap *const current_submap = get_submap_at( p, l );
+    submap *const current_submap = unsafe_get_submap_at( p, l );
 
     return current_submap && //FIXME: can be null during mapgen
            ( current_submap->get_ter( l ).obj().has_flag( flag ) ||
@@ -2539,7 +2588,7 @@ bool map::has_flag_ter_or_furn( const ter_bitflags flag, const tripoint &p ) con
     }
 
     point l;
-    submap *const current_submap = get_submap_at( p, l );
+    submap *const current_submap = unsafe_get_submap_at( p, l );
 
     return current_submap && //FIXME: can be null during mapgen
            ( current_submap->get_ter( l ).obj().has_flag( flag ) ||
@@ -2906,15 +2955,22 @@ bool map::has_adjacent_furniture_with( const tripoint &p,
 
 bool map::has_nearby_fire( const tripoint &p, int radius )
 {
-    for( const tripoint &pt : points_in_radius( p, radius ) ) {
-        if( get_field( pt, fd_fire ) != nullptr ) {
-            return true;
+    static const std::string usable_fire( "USABLE_FIRE" );
+    bool found = false;
+    for_each_submap_run( p, radius, [&]( const submap_run & run ) {
+        if( found || run.sm == nullptr ) {
+            return;
         }
-        if( has_flag_ter_or_furn( "USABLE_FIRE", pt ) ) {
-            return true;
+        for( point l = run.local; l.y < run.local.y + run.length; l.y++ ) {
+            if( run.sm->get_field( l ).find_field( fd_fire ) != nullptr ||
+                run.sm->get_ter( l ).obj().has_flag( usable_fire ) ||
+                run.sm->get_furn( l ).obj().has_flag( usable_fire ) ) {
+                found = true;
+                return;
+            }
         }
-    }
-    return false;
+    } );
+    return found;
 }
 
 bool map::has_nearby_table( const tripoint &p, int radius )
@@ -4252,7 +4308,7 @@ std::string map::get_signage( const tripoint &p ) const
     }
 
     point l;
-    submap *const current_submap = get_submap_at( p, l );
+    submap *const current_submap = unsafe_get_submap_at( p, l );
 
     return current_submap->get_signage( l );
 }
@@ -4263,7 +4319,7 @@ void map::set_signage( const tripoint &p, const std::string &message ) const
     }
 
     point l;
-    submap *const current_submap = get_submap_at( p, l );
+    submap *const current_submap = unsafe_get_submap_at( p, l );
 
     current_submap->set_signage( l, message );
 }
@@ -4274,7 +4330,7 @@ void map::delete_signage( const tripoint &p ) const
     }
 
     point l;
-    submap *const current_submap = get_submap_at( p, l );
+    submap *const current_submap = unsafe_get_submap_at( p, l );
 
     current_submap->delete_signage( l );
 }
@@ -4286,7 +4342,7 @@ int map::get_radiation( const tripoint &p ) const
     }
 
     point l;
-    submap *const current_submap = get_submap_at( p, l );
+    submap *const current_submap = unsafe_get_submap_at( p, l );
 
     return current_submap->get_radiation( l );
 }
@@ -4298,7 +4354,7 @@ void map::set_radiation( const tripoint &p, const int value )
     }
 
     point l;
-    submap *const current_submap = get_submap_at( p, l );
+    submap *const current_submap = unsafe_get_submap_at( p, l );
 
     current_submap->set_radiation( l, value );
 }
@@ -4310,7 +4366,7 @@ void map::adjust_radiation( const tripoint &p, const int delta )
     }
 
     point l;
-    submap *const current_submap = get_submap_at( p, l );
+    submap *const current_submap = unsafe_get_submap_at( p, l );
 
     int current_radiation = current_submap->get_radiation( l );
     current_submap->set_radiation( l, current_radiation + delta );
@@ -4343,7 +4399,7 @@ map_stack map::i_at( const tripoint &p )
     }
 
     point l;
-    submap *const current_submap = get_submap_at( p, l );
+    submap *const current_submap = unsafe_get_submap_at( p, l );
 
     return map_stack{ &current_submap->get_items( l ), p, this };
 }
@@ -4908,6 +4964,10 @@ void map::process_items_in_submap( submap &current_submap, const tripoint &gridp
     // If they are destroyed before processing, they don't get processed.
     std::vector<item *> active_items = current_submap.active_items.get_for_processing();
     const point grid_offset( gridp.x * SEEX, gridp.y * SEEY );
+    // Active items come in stacks (food in a fridge), look the tile up once per stack.
+    // An item that got destroyed may have taken the furniture with it, look again after it.
+    std::optional<tripoint> flag_location;
+    temperature_flag flag = temperature_flag::TEMP_NORMAL;
     for( item *&active_item_ref : active_items ) {
         if( !active_item_ref || !active_item_ref->is_loaded() ) {
             // The item was destroyed, so skip it.
@@ -4915,8 +4975,13 @@ void map::process_items_in_submap( submap &current_submap, const tripoint &gridp
         }
 
         const tripoint map_location = active_item_ref->position();
-        temperature_flag flag = temperature_flag_at_point( *this, map_location );
-        process_map_items( active_item_ref, map_location, flag );
+        if( flag_location != map_location ) {
+            flag = temperature_flag_at_point( *this, map_location );
+            flag_location = map_location;
+        }
+        if( process_map_items( active_item_ref, map_location, flag ) ) {
+            flag_location.reset();
+        }
     }
 }
 
@@ -5053,7 +5118,7 @@ bool map::has_items( const tripoint &p ) const
     }
 
     point l;
-    submap *const current_submap = get_submap_at( p, l );
+    submap *const current_submap = unsafe_get_submap_at( p, l );
 
     return !current_submap->get_items( l ).empty();
 }
@@ -5433,7 +5498,7 @@ const trap &map::tr_at( const tripoint &p ) const
     }
 
     point l;
-    submap *const current_submap = get_submap_at( p, l );
+    submap *const current_submap = unsafe_get_submap_at( p, l );
 
     if( current_submap->get_ter( l ).obj().trap != tr_null ) {
         return current_submap->get_ter( l ).obj().trap.obj();
@@ -5448,7 +5513,7 @@ partial_con *map::partial_con_at( const tripoint &p )
         return nullptr;
     }
     point l;
-    submap *const current_submap = get_submap_at( p, l );
+    submap *const current_submap = unsafe_get_submap_at( p, l );
     auto it = current_submap->partial_constructions.find( tripoint( l, p.z ) );
     if( it != current_submap->partial_constructions.end() ) {
         return &*it->second;
@@ -5462,7 +5527,7 @@ void map::partial_con_remove( const tripoint &p )
         return;
     }
     point l;
-    submap *const current_submap = get_submap_at( p, l );
+    submap *const current_submap = unsafe_get_submap_at( p, l );
     current_submap->partial_constructions.erase( tripoint( l, p.z ) );
 }
 
@@ -5472,7 +5537,7 @@ void map::partial_con_set( const tripoint &p, std::unique_ptr<partial_con> con )
         return;
     }
     point l;
-    submap *const current_submap = get_submap_at( p, l );
+    submap *const current_submap = unsafe_get_submap_at( p, l );
     if( !current_submap->partial_constructions.emplace( tripoint( l, p.z ),
             std::move( con ) ).second ) {
         debugmsg( "set partial con on top of terrain which already has a partial con" );
@@ -5486,7 +5551,7 @@ void map::trap_set( const tripoint &p, const trap_id &type )
     }
 
     point l;
-    submap *const current_submap = get_submap_at( p, l );
+    submap *const current_submap = unsafe_get_submap_at( p, l );
     const ter_t &ter = current_submap->get_ter( l ).obj();
     if( ter.trap != tr_null ) {
         debugmsg( "set trap %s on top of terrain %s which already has a builit-in trap",
@@ -5502,7 +5567,10 @@ void map::trap_set( const tripoint &p, const trap_id &type )
     current_submap->set_trap( l, type );
     if( type != tr_null ) {
         traplocs[type.to_i()].push_back( p );
+        const tripoint smp = ms_to_sm_copy( p );
+        get_cache( smp.z ).trap_cache.set( smp.x + smp.y * MAPSIZE );
     }
+    set_pathfinding_cache_dirty( p.z );
 }
 
 void map::disarm_trap( const tripoint &p )
@@ -5570,7 +5638,7 @@ void map::remove_trap( const tripoint &p )
     }
 
     point l;
-    submap *const current_submap = get_submap_at( p, l );
+    submap *const current_submap = unsafe_get_submap_at( p, l );
 
     trap_id tid = current_submap->get_trap( l );
     if( tid != tr_null ) {
@@ -5584,6 +5652,7 @@ void map::remove_trap( const tripoint &p )
         if( iter != traps.end() ) {
             traps.erase( iter );
         }
+        set_pathfinding_cache_dirty( p.z );
     }
 }
 /*
@@ -5597,7 +5666,7 @@ const field &map::field_at( const tripoint &p ) const
     }
 
     point l;
-    submap *const current_submap = get_submap_at( p, l );
+    submap *const current_submap = unsafe_get_submap_at( p, l );
 
     return current_submap->get_field( l );
 }
@@ -5613,7 +5682,7 @@ field &map::field_at( const tripoint &p )
     }
 
     point l;
-    submap *const current_submap = get_submap_at( p, l );
+    submap *const current_submap = unsafe_get_submap_at( p, l );
 
     return current_submap->get_field( l );
 }
@@ -5728,6 +5797,7 @@ bool map::add_field( const tripoint &p, const field_type_id &type_id, int intens
     current_submap->is_uniform = false;
     invalidate_max_populated_zlev( p.z );
 
+    current_submap->mark_field_tile( l );
     if( current_submap->get_field( l ).add_field( type_id, intensity, age ) ) {
         //Only adding it to the count if it doesn't exist.
         if( !current_submap->field_count++ ) {
@@ -5769,7 +5839,7 @@ void map::remove_field( const tripoint &p, const field_type_id &field_to_remove
     }
 
     point l;
-    submap *const current_submap = get_submap_at( p, l );
+    submap *const current_submap = unsafe_get_submap_at( p, l );
 
     if( current_submap->get_field( l ).remove_field( field_to_remove ) ) {
         // Only adjust the count if the field actually existed.
@@ -5858,7 +5928,7 @@ computer *map::computer_at( const tripoint &p )
     }
 
     point l;
-    submap *const sm = get_submap_at( p, l );
+    submap *const sm = unsafe_get_submap_at( p, l );
     return sm->get_computer( l );
 }
 
@@ -6430,10 +6500,23 @@ bool map::sees( const tripoint &F, const tripoint &T, const int range,
         min.x << 16 | min.y << 8 | ( min.z + OVERMAP_DEPTH ),
         max.x << 16 | max.y << 8 | ( max.z + OVERMAP_DEPTH )
     );
-    char cached = skew_vision_cache.get( key, -1 );
-    if( cached >= 0 ) {
-        return cached > 0;
+    // Only the default line is cached, find_clear_path tries other slopes for the same pair
+    const bool use_cache = bresenham_slope == 0;
+    if( use_cache ) {
+        const auto cached = skew_vision_cache.find( key );
+        if( cached != skew_vision_cache.end() ) {
+            return cached->second;
+        }
     }
+    const auto remember = [&]( const bool visible ) {
+        if( use_cache ) {
+            static constexpr size_t max_cached_pairs = 100000;
+            if( skew_vision_cache.size() >= max_cached_pairs ) {
+                skew_vision_cache.clear();
+            }
+            skew_vision_cache.emplace( key, visible );
+        }
+    };
 
     bool visible = true;
 
@@ -6455,7 +6538,7 @@ bool map::sees( const tripoint &F, const tripoint &T, const int range,
             last_point = new_point;
             return true;
         } );
-        skew_vision_cache.insert( 100000, key, visible ? 1 : 0 );
+        remember( visible );
         return visible;
     }
 
@@ -6488,10 +6571,31 @@ bool map::sees( const tripoint &F, const tripoint &T, const int range,
         last_point = new_point;
         return true;
     } );
-    skew_vision_cache.insert( 100000, key, visible ? 1 : 0 );
+    remember( visible );
     return visible;
 }
 
+bool map::sees_shared( const tripoint &viewer, const tripoint &target, const int range ) const
+{
+    if( viewer.z != target.z || !inbounds( viewer ) || !inbounds( target ) ) {
+        return sees( viewer, target, range );
+    }
+    // Shadowcasting is symmetric enough to look up either end in the other's field of view
+    const shared_fov *fov = find_shared_fov( target );
+    tripoint other = viewer;
+    if( fov == nullptr ) {
+        fov = find_shared_fov( viewer );
+        other = target;
+    }
+    if( fov == nullptr ) {
+        return sees( viewer, target, range );
+    }
+    if( range >= 0 && range < rl_dist( viewer, target ) ) {
+        return false;
+    }
+    return fov->seen[other.x][other.y] > LIGHT_TRANSPARENCY_SOLID;
+}
+
 int map::obstacle_coverage( const tripoint &loc1, const tripoint &loc2 ) const
 {
     // Can't hide if you are standing on furniture, or non-flat slowing-down terrain tile.
@@ -6893,6 +6997,10 @@ void map::load( const tripoint &w, const bool update_vehicle, const bool pump_ev
     field_furn_locs.clear();
     submaps_with_active_items.clear();
     set_abs_sub( w );
+    world *active_world = g->get_active_world();
+    if( active_world != nullptr ) {
+        active_world->prefetch_map_quads( quads_to_load() );
+    }
     for( int gridx = 0; gridx < my_MAPSIZE; gridx++ ) {
         for( int gridy = 0; gridy < my_MAPSIZE; gridy++ ) {
             loadn( point( gridx, gridy ), update_vehicle );
@@ -6901,9 +7009,36 @@ void map::load( const tripoint &w, const bool update_vehicle, const bool pump_ev
             }
         }
     }
+    if( active_world != nullptr ) {
+        active_world->end_map_prefetch();
+    }
     reset_vehicle_cache( );
 }
 
+std::vector<tripoint> map::quads_to_load() const
+{
+    const int zmin = zlevels ? -OVERMAP_DEPTH : abs_sub.z;
+    const int zmax = zlevels ? OVERMAP_HEIGHT : abs_sub.z;
+    std::vector<tripoint> result;
+    std::set<tripoint> seen;
+    // Same order as the grid is loaded in
+    for( int gridx = 0; gridx < my_MAPSIZE; gridx++ ) {
+        for( int gridy = 0; gridy < my_MAPSIZE; gridy++ ) {
+            for( int gridz = zmin; gridz <= zmax; gridz++ ) {
+                const tripoint sm = tripoint( abs_sub.xy() + point( gridx, gridy ), gridz );
+                if( MAPBUFFER.is_submap_loaded( sm ) ) {
+                    continue;
+                }
+                const tripoint om_addr = sm_to_omt_copy( sm );
+                if( seen.insert( om_addr ).second ) {
+                    result.push_back( om_addr );
+                }
+            }
+        }
+    }
+    return result;
+}
+
 void map::load( const tripoint_abs_sm &w, const bool update_vehicle, const bool pump_events )
 {
     // TODO: fix point types
@@ -6969,19 +7104,6 @@ shift_bitset_cache<MAPSIZE_X, SEEX>( std::bitset<MAPSIZE_X *MAPSIZE_X> &cache,
 template void
 shift_bitset_cache<MAPSIZE, 1>( std::bitset<MAPSIZE *MAPSIZE> &cache, point s );
 
-static inline void shift_tripoint_set( std::set<tripoint> &set, point offset,
-                                       const half_open_rectangle<point> &boundaries )
-{
-    std::set<tripoint> old_set = std::move( set );
-    set.clear();
-    for( const tripoint &pt : old_set ) {
-        tripoint new_pt = pt + offset;
-        if( boundaries.contains( new_pt.xy() ) ) {
-            set.insert( new_pt );
-        }
-    }
-}
-
 template <typename T>
 static inline void shift_tripoint_map( std::map<tripoint, T> &map, point offset,
                                        const half_open_rectangle<point> &boundaries )
@@ -7089,6 +7211,7 @@ void map::shift( point sp )
         clear_vehicle_list( gridz );
         shift_bitset_cache<MAPSIZE_X, SEEX>( get_cache( gridz ).map_memory_seen_cache, sp );
         shift_bitset_cache<MAPSIZE, 1>( get_cache( gridz ).field_cache, sp );
+        shift_bitset_cache<MAPSIZE, 1>( get_cache( gridz ).trap_cache, sp );
         if( sp.x >= 0 ) {
             for( int gridx = 0; gridx < my_MAPSIZE; gridx++ ) {
                 if( sp.y >= 0 ) {
@@ -7181,7 +7304,15 @@ void map::shift( point sp )
     g->setremoteveh( remoteveh );
 
     if( !support_cache_dirty.empty() ) {
-        shift_tripoint_set( support_cache_dirty, shift_offset_pt, boundaries_2d );
+        std::vector<tripoint> old_dirty = std::move( support_cache_dirty );
+        support_cache_dirty.clear();
+        std::fill( support_dirty_mask.begin(), support_dirty_mask.end(), false );
+        for( const tripoint &pt : old_dirty ) {
+            const tripoint new_pt = pt + shift_offset_pt;
+            if( boundaries_2d.contains( new_pt.xy() ) ) {
+                support_dirty( new_pt );
+            }
+        }
     }
 }
 
@@ -7246,6 +7377,7 @@ void map::saven( const tripoint &grid )
     }
 
     submap_to_save->last_touched = calendar::turn;
+    submap_to_save->set_modified();
     MAPBUFFER.add_submap( abs, submap_to_save );
 }
 
@@ -7268,12 +7400,88 @@ static void generate_uniform( const tripoint &p, const ter_id &terrain_type )
     }
 }
 
-void map::loadn( const tripoint &grid, const bool update_vehicles )
+// Generates the overmap terrain containing the submap and stores it in the mapbuffer.
+// Returns false if that was trivial because the overmap terrain is uniform.
+static bool generate_submaps( const tripoint &grid_abs_sub )
 {
     // Cache empty overmap types
     static const oter_id rock( "empty_rock" );
     static const oter_id air( "open_air" );
 
+    // Each overmap square is two nonants; to prevent overlap, generate only at
+    //  squares divisible by 2.
+    // TODO: fix point types
+    const tripoint_abs_omt grid_abs_omt( sm_to_omt_copy( grid_abs_sub ) );
+    const tripoint grid_abs_sub_rounded = omt_to_sm_copy( grid_abs_omt.raw() );
+
+    const oter_id terrain_type = overmap_buffer.ter( grid_abs_omt );
+
+    // Short-circuit if the map tile is uniform
+    // TODO: Replace with json mapgen functions.
+    if( terrain_type == air ) {
+        generate_uniform( grid_abs_sub_rounded, t_open_air );
+        return false;
+    } else if( terrain_type == rock ) {
+        generate_uniform( grid_abs_sub_rounded, t_rock );
+        return false;
+    }
+    tinymap tmp_map;
+    tmp_map.generate( grid_abs_sub_rounded, calendar::turn );
+    return true;
+}
+
+// Overmap terrains prefetch_submaps may generate or read from disk per call
+static constexpr int max_prefetched_omts = 2;
+
+void map::prefetch_submaps( const point dir )
+{
+    if( dir == point_zero ) {
+        return;
+    }
+    const int zmin = zlevels ? -OVERMAP_DEPTH : abs_sub.z;
+    const int zmax = zlevels ? OVERMAP_HEIGHT : abs_sub.z;
+    // Column and row entering the map on the next shift along dir
+    const int edge_x = dir.x > 0 ? my_MAPSIZE : -1;
+    const int edge_y = dir.y > 0 ? my_MAPSIZE : -1;
+    std::vector<point> grids;
+    for( int i = -1; i <= my_MAPSIZE; i++ ) {
+        if( dir.x != 0 ) {
+            grids.emplace_back( edge_x, i );
+        }
+        // The corner is already covered by the column
+        if( dir.y != 0 && ( dir.x == 0 || i != edge_x ) ) {
+            grids.emplace_back( i, edge_y );
+        }
+    }
+
+    int budget = max_prefetched_omts;
+    // Closest z-levels first, they are the most likely to be looked at
+    for( int dz = 0; dz < OVERMAP_LAYERS; dz++ ) {
+        for( const int sign : { -1, 1 } ) {
+            const int z = abs_sub.z + sign * dz;
+            if( z < zmin || z > zmax || ( dz == 0 && sign > 0 ) ) {
+                continue;
+            }
+            for( const point &grid : grids ) {
+                if( budget <= 0 ) {
+                    return;
+                }
+                const tripoint grid_abs_sub( abs_sub.xy() + grid, z );
+                if( MAPBUFFER.is_submap_loaded( grid_abs_sub ) ) {
+                    continue;
+                }
+                // Reading from disk isn't free either, so it counts against the budget
+                if( MAPBUFFER.lookup_submap( grid_abs_sub ) != nullptr ||
+                    generate_submaps( grid_abs_sub ) ) {
+                    budget--;
+                }
+            }
+        }
+    }
+}
+
+void map::loadn( const tripoint &grid, const bool update_vehicles )
+{
     const tripoint grid_abs_sub = abs_sub.xy() + grid;
     const size_t gridn = get_nonant( grid );
 
@@ -7284,25 +7492,7 @@ void map::loadn( const tripoint &grid, const bool update_vehicles )
     if( tmpsub == nullptr ) {
         // It doesn't exist; we must generate it!
         dbg( DL::Info ) << "map::loadn: Missing mapbuffer data.  Regenerating.";
-
-        // Each overmap square is two nonants; to prevent overlap, generate only at
-        //  squares divisible by 2.
-        // TODO: fix point types
-        const tripoint_abs_omt grid_abs_omt( sm_to_omt_copy( grid_abs_sub ) );
-        const tripoint grid_abs_sub_rounded = omt_to_sm_copy( grid_abs_omt.raw() );
-
-        const oter_id terrain_type = overmap_buffer.ter( grid_abs_omt );
-
-        // Short-circuit if the map tile is uniform
-        // TODO: Replace with json mapgen functions.
-        if( terrain_type == air ) {
-            generate_uniform( grid_abs_sub_rounded, t_open_air );
-        } else if( terrain_type == rock ) {
-            generate_uniform( grid_abs_sub_rounded, t_rock );
-        } else {
-            tinymap tmp_map;
-            tmp_map.generate( grid_abs_sub_rounded, calendar::turn );
-        }
+        generate_submaps( grid_abs_sub );
 
         // This is the same call to MAPBUFFER as above!
         tmpsub = MAPBUFFER.lookup_submap( grid_abs_sub );
@@ -7779,6 +7969,7 @@ void map::actualize( const tripoint &grid )
 
     const time_duration time_since_last_actualize = calendar::turn - tmpsub->last_touched;
     const bool do_funnels = ( grid.z >= 0 );
+    bool has_traps = false;
 
     // check spoiled stuff, and fill up funnels while we're at it
     for( int x = 0; x < SEEX; x++ ) {
@@ -7798,11 +7989,13 @@ void map::actualize( const tripoint &grid )
             const auto trap_here = tmpsub->get_trap( p );
             if( trap_here != tr_null ) {
                 traplocs[trap_here.to_i()].push_back( pnt );
+                has_traps = true;
             }
             const ter_t &ter = tmpsub->get_ter( p ).obj();
             if( ter.trap != tr_null && ter.trap != tr_ledge ) {
                 traplocs[ter.trap.to_i()].push_back( pnt );
             }
+            has_traps |= ter.trap != tr_null;
 
             if( do_funnels ) {
                 fill_funnels( pnt, tmpsub->last_touched );
@@ -7820,6 +8013,8 @@ void map::actualize( const tripoint &grid )
         }
     }
 
+    get_cache( grid.z ).trap_cache.set( grid.x + grid.y * MAPSIZE, has_traps );
+
     // the last time we touched the submap, is right now.
     tmpsub->last_touched = calendar::turn;
 }
@@ -7886,6 +8081,7 @@ void map::spawn_monsters_submap_group( const tripoint &gp, mongroup &group, bool
                                   g->u.sight_range( g->light_level( g->u.posz() ) ) );
     int pop = group.population;
     std::vector<tripoint> locations;
+    locations.reserve( SEEX * SEEY );
     if( !ignore_sight ) {
         // If the submap is one of the outermost submaps, assume that monsters are
         // invisible there.
@@ -7899,7 +8095,7 @@ void map::spawn_monsters_submap_group( const tripoint &gp, mongroup &group, bool
         ignore_sight = true;
     }
 
-    static const auto allow_on_terrain = [&]( const tripoint & p ) {
+    const auto allow_on_terrain = [this]( const tripoint & p ) {
         // TODO: flying creatures should be allowed to spawn without a floor,
         // but the new creature is created *after* determining the terrain, so
         // we can't check for it here.
@@ -7929,22 +8125,23 @@ void map::spawn_monsters_submap_group( const tripoint &gp, mongroup &group, bool
             int fx = x + SEEX * gp.x;
             int fy = y + SEEY * gp.y;
             tripoint fp{ fx, fy, gp.z };
-            if( g->critter_at( fp ) != nullptr ) {
-                continue; // there is already some creature
-            }
-
+            // Cheapest checks first, the line of sight check is by far the most expensive
             if( !ignore_terrain_checks && !allow_on_terrain( fp ) ) {
                 continue; // solid area, impassable
             }
 
-            if( !ignore_sight && sees( g->u.pos(), fp, s_range ) ) {
-                continue; // monster must spawn outside the viewing range of the player
-            }
-
             if( !ignore_inside_checks && has_flag_ter_or_furn( TFLAG_INDOORS, fp ) ) {
                 continue; // monster must spawn outside.
             }
 
+            if( g->critter_at( fp ) != nullptr ) {
+                continue; // there is already some creature
+            }
+
+            if( !ignore_sight && sees( g->u.pos(), fp, s_range ) ) {
+                continue; // monster must spawn outside the viewing range of the player
+            }
+
             locations.push_back( fp );
         }
     }
@@ -7989,7 +8186,11 @@ void map::spawn_monsters_submap_group( const tripoint &gp, mongroup &group, bool
     sm_to_ms( horde_target );
     for( auto &tmp : group.monsters ) {
         for( int tries = 0; tries < 10 && !locations.empty(); tries++ ) {
-            const tripoint p = random_entry_removed( locations );
+            // The order of the candidates does not matter, so remove by swapping with the last
+            const size_t picked = rng( 0, locations.size() - 1 );
+            const tripoint p = locations[picked];
+            locations[picked] = locations.back();
+            locations.pop_back();
             if( !tmp.can_move_to( p ) ) {
                 continue; // target can not contain the monster
             }
@@ -8003,7 +8204,9 @@ void map::spawn_monsters_submap_group( const tripoint &gp, mongroup &group, bool
                          tmp.wander_pos.x, tmp.wander_pos.y, tmp.wander_pos.z );
             }
 
-            monster *const placed = g->place_critter_at( make_shared_fast<monster>( tmp ), p );
+            // The group is cleared below, so the monster can be moved out of it
+            monster *const placed = g->place_critter_at( make_shared_fast<monster>( std::move( tmp ) ),
+                                    p );
             if( placed ) {
                 placed->on_load();
             }
@@ -8102,7 +8305,10 @@ void map::clear_traps()
         for( int x = 0; x < SEEX; x++ ) {
             for( int y = 0; y < SEEY; y++ ) {
                 const point p( x, y );
-                smap->set_trap( p, tr_null );
+                // Don't mark submaps without traps as modified
+                if( smap->get_trap( p ) != tr_null ) {
+                    smap->set_trap( p, tr_null );
+                }
             }
         }
     }
@@ -8113,6 +8319,46 @@ void map::clear_traps()
     }
 }
 
+map::content_counts map::count_contents() const
+{
+    content_counts counts;
+    for( const submap *sm : grid ) {
+        if( sm == nullptr ) {
+            continue;
+        }
+        counts.fields += sm->field_count;
+        for( int x = 0; x < SEEX; x++ ) {
+            for( int y = 0; y < SEEY; y++ ) {
+                counts.items += static_cast<std::int64_t>( sm->get_items( point( x, y ) ).size() );
+            }
+        }
+    }
+    return counts;
+}
+
+std::vector<map::submap_stamp> map::stamp_submaps() const
+{
+    std::vector<submap_stamp> stamps( grid.size() );
+    for( size_t i = 0; i < grid.size(); i++ ) {
+        if( grid[i] != nullptr ) {
+            stamps[i] = { grid[i], grid[i]->get_generation() };
+        }
+    }
+    return stamps;
+}
+
+bool map::submap_unchanged_since( const std::vector<submap_stamp> &stamps,
+                                  const tripoint &gridp ) const
+{
+    const size_t idx = get_nonant( gridp );
+    if( idx >= stamps.size() || idx >= grid.size() ) {
+        return false;
+    }
+    const submap *sm = grid[idx];
+    return sm != nullptr && stamps[idx].sm == sm && stamps[idx].generation == sm->get_generation() &&
+           sm->vehicles.empty() && sm->active_items.empty() && sm->active_furniture.empty();
+}
+
 const std::vector<tripoint> &map::get_furn_field_locations() const
 {
     return field_furn_locs;
@@ -8123,6 +8369,24 @@ const std::vector<tripoint> &map::trap_locations( const trap_id &type ) const
     return traplocs[type.to_i()];
 }
 
+std::vector<tripoint> map::trap_locations_in_radius( const tripoint &center, int radius ) const
+{
+    std::vector<tripoint> result;
+    if( !inbounds_z( center.z ) ) {
+        return result;
+    }
+    const std::bitset<MAPSIZE *MAPSIZE> &trap_cache = get_cache_ref( center.z ).trap_cache;
+    if( trap_cache.none() ) {
+        return result;
+    }
+    for( const tripoint &p : points_in_radius( center, radius ) ) {
+        if( trap_cache[p.x / SEEX + p.y / SEEY * MAPSIZE] && !tr_at( p ).is_null() ) {
+            result.push_back( p );
+        }
+    }
+    return result;
+}
+
 bool map::inbounds( const tripoint_abs_ms &p ) const
 {
     return inbounds( getlocal( p ) );
@@ -8180,7 +8444,7 @@ void map::set_graffiti( const tripoint &p, const std::string &contents )
         return;
     }
     point l;
-    submap *const current_submap = get_submap_at( p, l );
+    submap *const current_submap = unsafe_get_submap_at( p, l );
     current_submap->set_graffiti( l, contents );
 }
 
@@ -8190,7 +8454,7 @@ void map::delete_graffiti( const tripoint &p )
         return;
     }
     point l;
-    submap *const current_submap = get_submap_at( p, l );
+    submap *const current_submap = unsafe_get_submap_at( p, l );
     current_submap->delete_graffiti( l );
 }
 
@@ -8201,7 +8465,7 @@ const std::string &map::graffiti_at( const tripoint &p ) const
         return empty_string;
     }
     point l;
-    submap *const current_submap = get_submap_at( p, l );
+    submap *const current_submap = unsafe_get_submap_at( p, l );
     return current_submap->get_graffiti( l );
 }
 
@@ -8211,7 +8475,7 @@ bool map::has_graffiti_at( const tripoint &p ) const
         return false;
     }
     point l;
-    submap *const current_submap = get_submap_at( p, l );
+    submap *const current_submap = unsafe_get_submap_at( p, l );
     return current_submap->has_graffiti( l );
 }
 
@@ -8269,16 +8533,10 @@ int map::determine_wall_corner( const tripoint &p ) const
 void map::build_outside_cache( const int zlev )
 {
     auto &ch = get_cache( zlev );
-    if( !ch.outside_cache_dirty ) {
+    if( ch.outside_cache_dirty.none() ) {
         return;
     }
 
-    // Make a bigger cache to avoid bounds checking
-    // We will later copy it to our regular cache
-    const size_t padded_w = ( MAPSIZE_X ) + 2;
-    const size_t padded_h = ( MAPSIZE_Y ) + 2;
-    bool padded_cache[padded_w][padded_h];
-
     auto &outside_cache = ch.outside_cache;
     if( zlev < 0 ) {
         std::uninitialized_fill_n(
@@ -8286,6 +8544,50 @@ void map::build_outside_cache( const int zlev )
         return;
     }
 
+    if( !ch.outside_cache_dirty.all() ) {
+        // Only some roofs changed: redo the dirty submaps, looking one tile into their
+        // neighbours for roofs that shelter the border
+        const int map_x = SEEX * my_MAPSIZE;
+        const int map_y = SEEY * my_MAPSIZE;
+        for( int smx = 0; smx < my_MAPSIZE; ++smx ) {
+            for( int smy = 0; smy < my_MAPSIZE; ++smy ) {
+                if( !ch.outside_cache_dirty[smx * MAPSIZE + smy] ) {
+                    continue;
+                }
+                const point sm_min( smx * SEEX, smy * SEEY );
+                const point sm_max( sm_min.x + SEEX - 1, sm_min.y + SEEY - 1 );
+                for( int x = sm_min.x; x <= sm_max.x; x++ ) {
+                    std::fill_n( &outside_cache[x][sm_min.y], SEEY, true );
+                }
+                const point roof_min( std::max( sm_min.x - 1, 0 ), std::max( sm_min.y - 1, 0 ) );
+                const point roof_max( std::min( sm_max.x + 1, map_x - 1 ),
+                                      std::min( sm_max.y + 1, map_y - 1 ) );
+                for( int x = roof_min.x; x <= roof_max.x; x++ ) {
+                    for( int y = roof_min.y; y <= roof_max.y; y++ ) {
+                        if( !has_flag_ter_or_furn( TFLAG_INDOORS, tripoint( x, y, zlev ) ) ) {
+                            continue;
+                        }
+                        const int max_sx = std::min( x + 1, sm_max.x );
+                        const int max_sy = std::min( y + 1, sm_max.y );
+                        for( int sx = std::max( x - 1, sm_min.x ); sx <= max_sx; sx++ ) {
+                            for( int sy = std::max( y - 1, sm_min.y ); sy <= max_sy; sy++ ) {
+                                outside_cache[sx][sy] = false;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        ch.outside_cache_dirty.reset();
+        return;
+    }
+
+    // Make a bigger cache to avoid bounds checking
+    // We will later copy it to our regular cache
+    const size_t padded_w = ( MAPSIZE_X ) + 2;
+    const size_t padded_h = ( MAPSIZE_Y ) + 2;
+    bool padded_cache[padded_w][padded_h];
+
     std::uninitialized_fill_n(
         &padded_cache[0][0], padded_w * padded_h, true );
 
@@ -8317,7 +8619,7 @@ void map::build_outside_cache( const int zlev )
         std::copy_n( &padded_cache[x + 1][1], SEEX * my_MAPSIZE, &outside_cache[x][0] );
     }
 
-    ch.outside_cache_dirty = false;
+    ch.outside_cache_dirty.reset();
 }
 
 void map::build_obstacle_cache( const tripoint &start, const tripoint &end,
@@ -8376,17 +8678,28 @@ void map::build_obstacle_cache( const tripoint &start, const tripoint &end,
 bool map::build_floor_cache( const int zlev )
 {
     auto &ch = get_cache( zlev );
-    if( !ch.floor_cache_dirty ) {
+    if( ch.floor_cache_dirty.none() ) {
         return false;
     }
 
     auto &floor_cache = ch.floor_cache;
-    std::uninitialized_fill_n(
-        &floor_cache[0][0], ( MAPSIZE_X ) * ( MAPSIZE_Y ), true );
+    const bool rebuild_all = ch.floor_cache_dirty.all();
+    if( rebuild_all ) {
+        std::uninitialized_fill_n(
+            &floor_cache[0][0], ( MAPSIZE_X ) * ( MAPSIZE_Y ), true );
+    }
 
     bool lowest_z_lev = zlev <= -OVERMAP_DEPTH;
     for( int smx = 0; smx < my_MAPSIZE; ++smx ) {
         for( int smy = 0; smy < my_MAPSIZE; ++smy ) {
+            if( !rebuild_all ) {
+                if( !ch.floor_cache_dirty[smx * MAPSIZE + smy] ) {
+                    continue;
+                }
+                for( int sx = 0; sx < SEEX; ++sx ) {
+                    std::fill_n( &floor_cache[sx + smx * SEEX][smy * SEEY], SEEY, true );
+                }
+            }
             const submap *cur_submap = get_submap_at_grid( { smx, smy, zlev } );
             const submap *below_submap = !lowest_z_lev ? get_submap_at_grid( { smx, smy, zlev - 1 } ) : nullptr;
 
@@ -8417,7 +8730,7 @@ bool map::build_floor_cache( const int zlev )
         }
     }
 
-    ch.floor_cache_dirty = false;
+    ch.floor_cache_dirty.reset();
     return zlevels;
 }
 
@@ -8438,7 +8751,7 @@ void map::update_suspension_cache( const int &z )
     if( !ch.suspension_cache_dirty ) {
         return;
     }
-    std::list<point> &suspension_cache = ch.suspension_cache;
+    std::vector<point> &suspension_cache = ch.suspension_cache;
     if( !ch.suspension_cache_initialized ) {
         for( int smx = 0; smx < my_MAPSIZE; ++smx ) {
             for( int smy = 0; smy < my_MAPSIZE; ++smy ) {
@@ -8466,31 +8779,30 @@ void map::update_suspension_cache( const int &z )
         ch.suspension_cache_initialized = true;
     }
 
-    for( auto iter = suspension_cache.begin(); iter != suspension_cache.end(); ) {
-        const point absp = *iter;
-        const point locp = getlocal( absp );
+    // Order doesn't matter, so entries that are gone are swapped with the last one
+    for( size_t i = 0; i < suspension_cache.size(); ) {
+        const point locp = getlocal( suspension_cache[i] );
         const tripoint loctp( locp, z );
         if( !inbounds( locp ) ) {
-            ++iter;
+            ++i;
             continue;
         }
         const submap *cur_submap = get_submap_at( loctp );
         if( cur_submap == nullptr ) {
             debugmsg( "Tried to run suspension check at (%d,%d,%d) but the submap is not loaded", locp.x,
                       locp.y, z );
-            ++iter;
+            ++i;
             continue;
         }
         const ter_t &terrain = ter( locp ).obj();
-        if( terrain.has_flag( TFLAG_SUSPENDED ) ) {
-            if( !is_suspension_valid( loctp ) ) {
+        if( !terrain.has_flag( TFLAG_SUSPENDED ) || !is_suspension_valid( loctp ) ) {
+            if( terrain.has_flag( TFLAG_SUSPENDED ) ) {
                 support_dirty( loctp );
-                iter = suspension_cache.erase( iter );
-            } else {
-                ++iter;
             }
+            suspension_cache[i] = suspension_cache.back();
+            suspension_cache.pop_back();
         } else {
-            iter = suspension_cache.erase( iter );
+            ++i;
         }
     }
     ch.suspension_cache_dirty = false;
@@ -8595,19 +8907,43 @@ void map::build_map_cache( const int zlev, bool skip_lightmap )
     const int minz = zlevels ? -OVERMAP_DEPTH : zlev;
     const int maxz = zlevels ? OVERMAP_HEIGHT : zlev;
     bool seen_cache_dirty = false;
+
+    bool transparency_cache_dirty = false;
+    // Also allocates missing level caches here, and not in the worker threads below
     for( int z = minz; z <= maxz; z++ ) {
-        // trigger FOV recalculation only when there is a change on the player's level or if fov_3d is enabled
-        const bool affects_seen_cache =  z == zlev || fov_3d;
+        const level_cache &ch = get_cache( z );
+        transparency_cache_dirty |= ch.transparency_cache_dirty.any();
+        // The lightmap is cast over these, so it can't be reused after they are rebuilt
+        lightmap_inputs_dirty |= ch.outside_cache_dirty.any() || ch.floor_cache_dirty.any() ||
+                                 ch.transparency_cache_dirty.any();
+    }
+    // The weather lookup is shared by all levels, so update it (and resolve the weather id)
+    // before the levels are built concurrently
+    if( transparency_cache_dirty ) {
+        update_weather_transparency_lookup();
+    }
+
+    // These caches only depend on their own level (and on the submaps below, for the floor cache),
+    // so each level can be built independently of the others.
+    std::array<bool, OVERMAP_LAYERS> floor_cache_rebuilt = {};
+    get_thread_pool().parallel_for( minz, maxz + 1, [&]( const int z ) {
         build_outside_cache( z );
         build_transparency_cache( z );
-        update_suspension_cache( z );
-        seen_cache_dirty |= ( build_floor_cache( z ) && affects_seen_cache );
-        seen_cache_dirty |= get_cache( z ).seen_cache_dirty && affects_seen_cache;
+        floor_cache_rebuilt[z + OVERMAP_DEPTH] = build_floor_cache( z );
         diagonal_blocks fill = {false, false};
         std::uninitialized_fill_n( &( get_cache( z ).vehicle_obscured_cache[0][0] ), MAPSIZE_X * MAPSIZE_Y,
                                    fill );
         std::uninitialized_fill_n( &( get_cache( z ).vehicle_obstructed_cache[0][0] ),
                                    MAPSIZE_X * MAPSIZE_Y, fill );
+    } );
+
+    for( int z = minz; z <= maxz; z++ ) {
+        // trigger FOV recalculation only when there is a change on the player's level or if fov_3d is enabled
+        const bool affects_seen_cache =  z == zlev || fov_3d;
+        // Only reads the map and queues support checks, so it stays on the main thread
+        update_suspension_cache( z );
+        seen_cache_dirty |= floor_cache_rebuilt[z + OVERMAP_DEPTH] && affects_seen_cache;
+        seen_cache_dirty |= get_cache( z ).seen_cache_dirty && affects_seen_cache;
     }
     // needs a separate pass as it changes the caches on neighbour z-levels (e.g. floor_cache);
     // otherwise such changes might be overwritten by main cache-building logic
@@ -8620,6 +8956,8 @@ void map::build_map_cache( const int zlev, bool skip_lightmap )
     if( seen_cache_dirty ) {
         skew_vision_cache.clear();
     }
+    // Vehicles may have moved even if nothing the player sees changed
+    shared_fovs.clear();
     // Initial value is illegal player position.
     const tripoint &p = g->u.pos();
     static tripoint player_prev_pos;
@@ -8666,6 +9004,24 @@ tripoint map::get_abs_sub() const
     return abs_sub;
 }
 
+std::vector<std::pair<const submap *, std::uint64_t>> map::submap_generations(
+            const tripoint &from, const tripoint &to ) const
+{
+    std::vector<std::pair<const submap *, std::uint64_t>> result;
+    const int max_z = zlevels ? std::min( to.z, OVERMAP_HEIGHT ) : abs_sub.z;
+    for( int z = zlevels ? std::max( from.z, -OVERMAP_DEPTH ) : abs_sub.z; z <= max_z; z++ ) {
+        for( int gy = std::max( from.y, 0 ) / SEEY; gy <= std::min( to.y, SEEY * my_MAPSIZE - 1 ) / SEEY;
+             gy++ ) {
+            for( int gx = std::max( from.x, 0 ) / SEEX;
+                 gx <= std::min( to.x, SEEX * my_MAPSIZE - 1 ) / SEEX; gx++ ) {
+                const submap *sm = get_submap_at_grid( tripoint( gx, gy, z ) );
+                result.emplace_back( sm, sm->get_generation() );
+            }
+        }
+    }
+    return result;
+}
+
 submap *map::getsubmap( const size_t grididx ) const
 {
     if( grididx >= grid.size() ) {
@@ -8684,6 +9040,8 @@ void map::setsubmap( const size_t grididx, submap *const smap )
         debugmsg( "Tried to set NULL submap pointer at index %d", grididx );
         return;
     }
+    // Whatever holds the submap in a map can change it without going through submap
+    smap->set_modified();
     grid[grididx] = smap;
 }
 
@@ -8708,18 +9066,6 @@ submap *map::get_submap_at_grid( const tripoint &gridp ) const
     return getsubmap( get_nonant( gridp ) );
 }
 
-size_t map::get_nonant( const tripoint &gridp ) const
-{
-    // There used to be a bounds check here
-    // But this function is called a lot, so push it up if needed
-    if( zlevels ) {
-        const int indexz = gridp.z + OVERMAP_HEIGHT; // Can't be lower than 0
-        return indexz + ( gridp.x + gridp.y * my_MAPSIZE ) * OVERMAP_LAYERS;
-    } else {
-        return gridp.x + gridp.y * my_MAPSIZE;
-    }
-}
-
 tinymap::tinymap( int mapsize, bool zlevels )
     : map( mapsize, zlevels )
 {
@@ -9140,7 +9486,7 @@ std::list<Creature *> map::get_creatures_in_radius( const tripoint &center, size
 level_cache &map::access_cache( int zlev )
 {
     if( zlev >= -OVERMAP_DEPTH && zlev <= OVERMAP_HEIGHT ) {
-        return *caches[zlev + OVERMAP_DEPTH];
+        return get_cache( zlev );
     }
 
     debugmsg( "access_cache called with invalid z-level: %d", zlev );
@@ -9150,7 +9496,7 @@ level_cache &map::access_cache( int zlev )
 const level_cache &map::access_cache( int zlev ) const
 {
     if( zlev >= -OVERMAP_DEPTH && zlev <= OVERMAP_HEIGHT ) {
-        return *caches[zlev + OVERMAP_DEPTH];
+        return get_cache( zlev );
     }
 
     debugmsg( "access_cache called with invalid z-level: %d", zlev );
@@ -9160,9 +9506,12 @@ const level_cache &map::access_cache( int zlev ) const
 level_cache::level_cache()
 {
     const int map_dimensions = MAPSIZE_X * MAPSIZE_Y;
+    // Nothing is built yet, the setters of the dirty flags rely on that for missing caches
     transparency_cache_dirty.set();
-    outside_cache_dirty = true;
-    floor_cache_dirty = false;
+    outside_cache_dirty.set();
+    floor_cache_dirty.set();
+    seen_cache_dirty = true;
+    suspension_cache_dirty = true;
     constexpr four_quadrants four_zeros( 0.0f );
     std::fill_n( &lm[0][0], map_dimensions, four_zeros );
     std::fill_n( &sm[0][0], map_dimensions, 0.0f );
@@ -9189,13 +9538,19 @@ pathfinding_cache::pathfinding_cache()
 
 pathfinding_cache &map::get_pathfinding_cache( int zlev ) const
 {
-    return *pathfinding_caches[zlev + OVERMAP_DEPTH];
+    std::unique_ptr<pathfinding_cache> &cache = pathfinding_caches[zlev + OVERMAP_DEPTH];
+    if( !cache ) {
+        cache = std::make_unique<pathfinding_cache>();
+    }
+    return *cache;
 }
 
 void map::set_pathfinding_cache_dirty( const int zlev )
 {
     if( inbounds_z( zlev ) ) {
-        get_pathfinding_cache( zlev ).dirty = true;
+        pathfinding_cache &cache = get_pathfinding_cache( zlev );
+        cache.dirty = true;
+        cache.version++;
     }
 }
 
@@ -9219,21 +9574,23 @@ bool map::check_and_set_seen_cache( const tripoint &p ) const
 
 void map::invalidate_map_cache( const int zlev )
 {
-    if( inbounds_z( zlev ) ) {
-        level_cache &ch = get_cache( zlev );
-        ch.floor_cache_dirty = true;
-        ch.transparency_cache_dirty.set();
-        ch.seen_cache_dirty = true;
-        ch.outside_cache_dirty = true;
-        ch.suspension_cache_dirty = true;
+    if( level_cache *ch = inbounds_z( zlev ) ? find_cache( zlev ) : nullptr ) {
+        ch->floor_cache_dirty.set();
+        ch->transparency_cache_dirty.set();
+        ch->seen_cache_dirty = true;
+        ch->outside_cache_dirty.set();
+        ch->suspension_cache_dirty = true;
     }
 }
 
 void map::set_memory_seen_cache_dirty( const tripoint &p )
 {
     const int offset = p.x + p.y * MAPSIZE_Y;
-    if( offset >= 0 && offset < MAPSIZE_X * MAPSIZE_Y ) {
-        get_cache( p.z ).map_memory_seen_cache.reset( offset );
+    if( offset < 0 || offset >= MAPSIZE_X * MAPSIZE_Y ) {
+        return;
+    }
+    if( level_cache *ch = find_cache( p.z ) ) {
+        ch->map_memory_seen_cache.reset( offset );
     }
 }
 
@@ -9259,6 +9616,8 @@ void map::update_pathfinding_cache( int zlev ) const
     }
 
     std::uninitialized_fill_n( &cache.special[0][0], MAPSIZE_X * MAPSIZE_Y, PF_NORMAL );
+    std::uninitialized_fill_n( &cache.move_cost[0][0], MAPSIZE_X * MAPSIZE_Y,
+                               pathfinding_cache::unknown_move_cost );
 
     for( int smx = 0; smx < my_MAPSIZE; ++smx ) {
         for( int smy = 0; smy < my_MAPSIZE; ++smy ) {
@@ -9284,6 +9643,9 @@ void map::update_pathfinding_cache( int zlev ) const
                     const vehicle *veh = veh_at_internal( p, part );
 
                     const int cost = move_cost_internal( furniture, terrain, veh, part );
+                    if( cost < pathfinding_cache::unknown_move_cost ) {
+                        cache.move_cost[p.x][p.y] = cost;
+                    }
 
                     if( cost > 2 ) {
                         cur_value |= PF_SLOW;
@@ -2,6 +2,7 @@
 #ifndef CATA_SRC_MAP_H
 #define CATA_SRC_MAP_H
 
+#include <algorithm>
 #include <array>
 #include <bitset>
 #include <climits>
@@ -14,6 +15,7 @@
 #include <set>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -28,7 +30,6 @@
 #include "item_stack.h"
 #include "lightmap.h"
 #include "line.h"
-#include "lru_cache.h"
 #include "mapdata.h"
 #include "memory_fast.h"
 #include "point.h"
@@ -44,6 +45,10 @@ namespace catacurses
 {
 class window;
 } // namespace catacurses
+namespace gas_diffusion
+{
+struct layer;
+} // namespace gas_diffusion
 class active_tile_data;
 class Character;
 class Creature;
@@ -84,8 +89,12 @@ using VehicleList = std::vector<wrapped_vehicle>;
 class map;
 
 enum ter_bitflags : int;
+struct flow_field;
 struct pathfinding_cache;
 struct pathfinding_settings;
+struct route_cache;
+struct route_cache_stats;
+struct route_step;
 template<typename T>
 struct weighted_int_list;
 struct rl_vec2d;
@@ -116,6 +125,20 @@ class map_stack : public item_stack
         units::volume max_volume() const override;
 };
 
+/**
+ * A run of neighbouring tiles of one submap, see @ref map::for_each_submap_run.
+ * Runs go along y, because that is the order in which submaps store their tiles.
+ */
+struct submap_run {
+    submap *sm;
+    /** Position of the first tile of the run in map (local) coordinates. */
+    tripoint start;
+    /** Position of the first tile of the run within @ref sm. */
+    point local;
+    /** Number of tiles, the run covers local to local + ( 0, length - 1 ). */
+    int length;
+};
+
 struct visibility_variables {
     // Is this struct initialized for current z-level
     bool variables_set;
@@ -302,12 +325,13 @@ struct level_cache {
     level_cache( const level_cache &other ) = default;
 
     std::bitset<MAPSIZE *MAPSIZE> transparency_cache_dirty;
-    bool outside_cache_dirty = false;
-    bool floor_cache_dirty = false;
+    // Dirty bits of the outside and floor caches, one per submap like transparency_cache_dirty
+    std::bitset<MAPSIZE *MAPSIZE> outside_cache_dirty;
+    std::bitset<MAPSIZE *MAPSIZE> floor_cache_dirty;
     bool seen_cache_dirty = false;
     bool suspension_cache_initialized = false;
     bool suspension_cache_dirty = false;
-    std::list<point> suspension_cache;
+    std::vector<point> suspension_cache;
 
     four_quadrants lm[MAPSIZE_X][MAPSIZE_Y];
     float sm[MAPSIZE_X][MAPSIZE_Y];
@@ -348,15 +372,69 @@ struct level_cache {
     lit_level visibility_cache[MAPSIZE_X][MAPSIZE_Y];
     std::bitset<MAPSIZE_X *MAPSIZE_Y> map_memory_seen_cache;
     std::bitset<MAPSIZE *MAPSIZE> field_cache;
+    // Submaps with a trap set or built into their terrain, same layout as field_cache
+    std::bitset<MAPSIZE *MAPSIZE> trap_cache;
 
     bool veh_in_active_range;
     bool veh_exists_at[MAPSIZE_X][MAPSIZE_Y];
-    std::map< tripoint, std::pair<vehicle *, int> > veh_cached_parts;
+    // Vehicle and part index on each tile, only valid where veh_exists_at is set
+    std::pair<vehicle *, int> veh_cached_parts[MAPSIZE_X][MAPSIZE_Y];
     std::set<vehicle *> vehicle_list;
     std::set<vehicle *> zone_vehicles;
 
 };
 
+/**
+ * A light source applied by map::generate_lightmap.
+ * The sources of the last generated lightmap are kept, so that the lightmap only
+ * has to be cast again when the sources or the caches they are cast over changed.
+ */
+struct lightmap_source {
+    enum class source_type : int {
+        // map::apply_light_source
+        immediate,
+        // map::add_light_source
+        buffered,
+        // map::apply_light_arc
+        arc,
+    };
+    source_type type;
+    tripoint p;
+    float luminance;
+    units::angle direction = 0_degrees;
+    units::angle width = 0_degrees;
+    // Character holding the light, may get effect_haslight once the light is applied
+    Character *carrier = nullptr;
+    // Result of the above, not part of the comparison
+    bool carrier_lit = false;
+
+    bool operator==( const lightmap_source &rhs ) const {
+        return type == rhs.type && p == rhs.p && luminance == rhs.luminance &&
+               direction == rhs.direction && width == rhs.width && carrier == rhs.carrier;
+    }
+};
+
+/** Everything map::generate_lightmap casts on top of sunlight, in the order it is applied. */
+struct lightmap_sources {
+    int zlev = INT_MIN;
+    float natural_light = 0.0f;
+    float surface_light = 0.0f;
+    float sight_penalty = 0.0f;
+    std::vector<lightmap_source> sources;
+    // sources[first_tile_source, end_tile_source) are emitted by terrain, furniture, fields and
+    // items on the map, the ones before are from characters, the ones after from monsters and vehicles
+    size_t first_tile_source = 0;
+    size_t end_tile_source = 0;
+    std::vector<std::pair<tripoint, float>> overrides;
+
+    bool operator==( const lightmap_sources &rhs ) const {
+        return zlev == rhs.zlev && natural_light == rhs.natural_light &&
+               surface_light == rhs.surface_light && sight_penalty == rhs.sight_penalty &&
+               first_tile_source == rhs.first_tile_source &&
+               end_tile_source == rhs.end_tile_source && sources == rhs.sources && overrides == rhs.overrides;
+    }
+};
+
 /**
  * Manage and cache data about a part of the map.
  *
@@ -416,8 +494,12 @@ class map
         void set_seen_cache_dirty( const int zlevel );
 
         void set_outside_cache_dirty( const int zlev );
+        // invalidates the outside cache of the submaps that the roof of p shelters
+        void set_outside_cache_dirty( const tripoint &p );
 
         void set_floor_cache_dirty( const int zlev );
+        // invalidates the floor cache of the submap p is in
+        void set_floor_cache_dirty( const tripoint &p );
 
         void set_suspension_cache_dirty( const int zlev );
 
@@ -515,6 +597,13 @@ class map
          * Note: the map must have been loaded before this can be called.
          */
         void shift( point s );
+        /**
+         * Loads or generates submaps just outside the map in direction @param dir,
+         * so that the next @ref shift that way finds them in the mapbuffer instead of
+         * stalling on mapgen.  Generates at most a couple overmap terrains per call,
+         * leaving the rest for later calls.
+         */
+        void prefetch_submaps( point dir );
         /**
          * Moves the map vertically to (not by!) newz.
          * Does not actually shift anything, only forces cache updates.
@@ -526,6 +615,28 @@ class map
         void clear_spawns();
         void clear_traps();
 
+        /** Which submap sits at a position of @ref grid and its @ref submap::get_generation. */
+        struct submap_stamp {
+            const submap *sm = nullptr;
+            std::uint64_t generation = 0;
+        };
+        /** Stamps of all submaps of the map, so later calls can tell which of them changed. */
+        std::vector<submap_stamp> stamp_submaps() const;
+        /**
+         * Whether the submap at grid point @p gridp is still the one from @p stamps and
+         * nothing changed it since.  Submaps with vehicles, active items or active furniture
+         * never count as unchanged, those change without going through the submap.
+         */
+        bool submap_unchanged_since( const std::vector<submap_stamp> &stamps,
+                                     const tripoint &gridp ) const;
+
+        struct content_counts {
+            std::int64_t items = 0;
+            std::int64_t fields = 0;
+        };
+        /** Items and fields on all submaps of the map.  Walks every tile, for profiling. */
+        content_counts count_contents() const;
+
         maptile maptile_at( const tripoint &p ) const;
         maptile maptile_at( const tripoint &p );
     private:
@@ -536,6 +647,12 @@ class map
         std::array<std::pair<tripoint, maptile>, 8> get_neighbors( const tripoint &p );
         void spread_gas( field_entry &cur, const tripoint &p, int percent_spread,
                          const time_duration &outdoor_age_speedup, scent_block &sblk );
+        // The part of spreading gas that only affects its own tile
+        void apply_gas_here( field_entry &cur, const tripoint &p,
+                             const time_duration &outdoor_age_speedup, scent_block &sblk );
+        // Spreads all gases that use buffered_diffusion, see gas_diffusion.h
+        void diffuse_buffered_gases();
+        void describe_gas_source( gas_diffusion::layer &l, const tripoint &p );
         void create_hot_air( const tripoint &p, int intensity );
         bool gas_can_spread_to( field_entry &cur, const tripoint &src, const tripoint &dst );
         void gas_spread_to( field_entry &cur, maptile &dst, const tripoint &p );
@@ -610,6 +727,20 @@ class map
         * Returns whether `F` sees `T` with a view range of `range`.
         */
         bool sees( const tripoint &F, const tripoint &T, int range ) const;
+        /**
+         * Casts a field of view from `origin` once, so that many sight checks to or from
+         * `origin` can share it, like monsters do with the player's seen cache.
+         * Shared fields of view are dropped whenever the map cache is rebuilt.
+         */
+        void share_fov( const tripoint &origin );
+        /** Whether @ref share_fov was called for `origin` since the last map cache rebuild. */
+        bool has_shared_fov( const tripoint &origin ) const;
+        /**
+         * Like @ref sees, but uses the field of view shared by `target` or `viewer` when there
+         * is one.  Same z-level only, the answer is the same as from shadowcasting, which may
+         * differ from the Bresenham line used by @ref sees around corners.
+         */
+        bool sees_shared( const tripoint &viewer, const tripoint &target, int range ) const;
     private:
         /**
          * Don't expose the slope adjust outside map functions.
@@ -699,6 +830,20 @@ class map
                                      const pathfinding_settings &settings,
         const std::set<tripoint> &pre_closed = {{ }} ) const;
 
+        /** Hit and miss counts of the cache of recent @ref route results. */
+        const route_cache_stats &get_route_cache_stats() const;
+        /** Forgets all remembered routes, the counters stay. */
+        void clear_route_cache();
+
+        /**
+         * Like @ref route, but for creatures that expect to share their destination with others.
+         * Once several routes to the same goal with the same settings are requested within
+         * a turn, they are all answered from one flow field instead of separate A* searches.
+         * Only same z-level routes are shared, others fall back to @ref route.
+         */
+        std::vector<tripoint> route_shared( const tripoint &f, const tripoint &t,
+                                            const pathfinding_settings &settings ) const;
+
         // Vehicles: Common to 2D and 3D
         VehicleList get_vehicles();
         void add_vehicle_to_cache( vehicle * );
@@ -1366,13 +1511,25 @@ class map
         void remove_trap( const tripoint &p );
         const std::vector<tripoint> &get_furn_field_locations() const;
         const std::vector<tripoint> &trap_locations( const trap_id &type ) const;
+        /**
+         * Points around @p center on its z-level that have a trap, in the order of
+         * @ref points_in_radius.  Ledges are included.  Submaps without any trap are skipped
+         * without looking at their tiles.
+         */
+        std::vector<tripoint> trap_locations_in_radius( const tripoint &center, int radius ) const;
 
         // Adds to a list of byproducts from items destroyed in fire.
         void create_burnproducts( std::vector<detached_ptr<item>> &out, const item &fuel,
                                   const units::mass &burned_mass );
         // See fields.cpp
         void process_fields();
-        void process_fields_in_submap( submap *current_submap, const tripoint &submap_pos );
+        /**
+         * @param turns Turns since the submap was processed last, more than 1 if it is far
+         * enough from the player to only be processed every few turns.  Fields age by that
+         * much, everything else they do happens once.
+         */
+        void process_fields_in_submap( submap *current_submap, const tripoint &submap_pos,
+                                       int turns = 1 );
         /**
          * Apply field effects to the creature when it's on a square with fields.
          */
@@ -1508,8 +1665,10 @@ class map
 
         // Support (of weight, structures etc.)
     private:
-        // Tiles whose ability to support things was removed in the last turn
-        std::set<tripoint> support_cache_dirty;
+        // Tiles whose ability to support things was removed in the last turn, each listed once
+        std::vector<tripoint> support_cache_dirty;
+        // One bit per tile of the map, set for the tiles in support_cache_dirty
+        std::vector<bool> support_dirty_mask;
         // Checks if the tile is supported and adds it to support_cache_dirty if it isn't
         void support_dirty( const tripoint &p );
     public:
@@ -1617,6 +1776,13 @@ class map
 
         /** return @ref abs_sub */
         tripoint get_abs_sub() const;
+        /**
+         * Every submap overlapping the box from @p from to @p to (local coordinates, clipped
+         * to the map) together with its @ref submap::get_generation.  If two results compare
+         * equal, nothing stored in those submaps was changed in between.
+         */
+        std::vector<std::pair<const submap *, std::uint64_t>> submap_generations(
+                    const tripoint &from, const tripoint &to ) const;
         /**
          * Translates local (to this map) coordinates of a square to global absolute coordinates.
          * Coordinates is in the system that is used by the ter/furn/i_at functions.
@@ -1650,6 +1816,36 @@ class map
         void clip_to_bounds( int &x, int &y ) const;
         void clip_to_bounds( int &x, int &y, int &z ) const;
 
+        /**
+         * Calls fun( const submap_run & ) for every run of tiles of the cuboid between
+         * @p min and @p max (inclusive, clipped to the map). The submap of a run is looked up
+         * only once for all of its tiles, a run never spans two submaps.
+         * While submaps are generated the submap of a run can be null.
+         */
+        template<typename Functor>
+        void for_each_submap_run( const tripoint &min, const tripoint &max, Functor fun ) const {
+            const tripoint lo( std::max( min.x, 0 ), std::max( min.y, 0 ),
+                               std::max( min.z, -OVERMAP_DEPTH ) );
+            const tripoint hi( std::min( max.x, SEEX * my_MAPSIZE - 1 ),
+                               std::min( max.y, SEEY * my_MAPSIZE - 1 ), std::min( max.z, OVERMAP_HEIGHT ) );
+            submap_run run;
+            for( int z = lo.z; z <= hi.z; z++ ) {
+                for( int x = lo.x; x <= hi.x; x++ ) {
+                    for( int y = lo.y; y <= hi.y; y += run.length ) {
+                        run.start = tripoint( x, y, z );
+                        run.sm = unsafe_get_submap_at( run.start, run.local );
+                        run.length = std::min( SEEY - run.local.y, hi.y - y + 1 );
+                        fun( static_cast<const submap_run &>( run ) );
+                    }
+                }
+            }
+        }
+        template<typename Functor>
+        void for_each_submap_run( const tripoint &center, int radius, Functor fun ) const {
+            for_each_submap_run( center - tripoint( radius, radius, 0 ),
+                                 center + tripoint( radius, radius, 0 ), fun );
+        }
+
         int getmapsize() const {
             return my_MAPSIZE;
         }
@@ -1698,6 +1894,8 @@ class map
     protected:
         void saven( const tripoint &grid );
         void loadn( const tripoint &grid, bool update_vehicles );
+        /** Quads of the submaps a full @ref load has to read, in the order it reads them. */
+        std::vector<tripoint> quads_to_load() const;
         void loadn( point grid, bool update_vehicles ) {
             if( zlevels ) {
                 for( int gridz = -OVERMAP_DEPTH; gridz <= OVERMAP_HEIGHT; gridz++ ) {
@@ -1780,7 +1978,11 @@ class map
 
         // Builds a transparency cache and returns true if the cache was invalidated.
         // Used to determine if seen cache should be rebuilt.
+        // Expects update_weather_transparency_lookup to have run for the current weather.
         bool build_transparency_cache( int zlev );
+        // Updates the weather lookup shared by all levels' transparency caches.
+        // Must not run concurrently with build_transparency_cache.
+        static void update_weather_transparency_lookup();
         bool build_vision_transparency_cache( const Character &player );
         // fills lm with sunlight. pzlev is current player's zlevel
         void build_sunlight_cache( int pzlev );
@@ -1796,7 +1998,14 @@ class map
     protected:
         void generate_lightmap( int zlev );
         void build_seen_cache( const tripoint &origin, int target_z );
+        /**
+         * Adds what the vehicle cameras (position and view distance offset of each camera)
+         * see to the camera cache of the level.
+         */
+        void apply_camera_view( const std::vector<std::pair<tripoint, int>> &cameras,
+                                level_cache &map_cache );
         void apply_character_light( Character &p );
+        void apply_lightmap_source( lightmap_source &src );
 
         //Adds/removes player specific transparencies
         void apply_vision_transparency_cache( const tripoint &center, int target_z,
@@ -1806,6 +2015,15 @@ class map
 
         int my_MAPSIZE;
         bool zlevels;
+        /** Distance in @ref grid between neighbouring submaps along each axis, see @ref get_nonant. */
+        tripoint grid_stride;
+
+        // Sources of the current lightmap, see generate_lightmap
+        lightmap_sources last_lightmap_sources;
+        // While set, light sources are recorded here instead of being applied
+        lightmap_sources *recorded_light_sources = nullptr;
+        // Set when any cache the lightmap is cast over was rebuilt since the last lightmap
+        bool lightmap_inputs_dirty = true;
 
         // stores vision adjustment for the tiles immediately surrounding the player, the order is given by eight_adjacent_offsets in point.h
         // examples of adjustment: crouching
@@ -1858,13 +2076,27 @@ class map
             return getsubmap( get_nonant( gridp ) );
         }
         submap *get_submap_at_grid( const tripoint &gridp ) const;
+        /**
+         * Same as @ref get_submap_at with offset, but without any checks. Only for callers
+         * that have just checked (p) with @ref inbounds themselves.
+         */
+        submap *unsafe_get_submap_at( const tripoint &p, point &offset_p ) const {
+            offset_p.x = p.x % SEEX;
+            offset_p.y = p.y % SEEY;
+            return grid[get_nonant( { p.x / SEEX, p.y / SEEY, p.z } )];
+        }
     protected:
         /**
          * Get the index of a submap pointer in the grid given by grid coordinates. The grid
          * coordinates must be valid: 0 <= x < my_MAPSIZE, same for y.
          * Version with z-levels checks for z between -OVERMAP_DEPTH and OVERMAP_HEIGHT
          */
-        size_t get_nonant( const tripoint &gridp ) const;
+        size_t get_nonant( const tripoint &gridp ) const {
+            // There used to be a bounds check here
+            // But this function is called a lot, so push it up if needed
+            return ( gridp.z + OVERMAP_HEIGHT ) * grid_stride.z + gridp.x * grid_stride.x +
+                   gridp.y * grid_stride.y;
+        }
         size_t get_nonant( point gridp ) const {
             return get_nonant( { gridp, abs_sub.z } );
         }
@@ -1989,20 +2221,50 @@ class map
          */
         std::vector<tripoint> field_furn_locs;
         /**
-         * Holds caches for visibility, light, transparency and vehicles
+         * Holds caches for visibility, light, transparency and vehicles.
+         * Allocated on first use, most maps (tinymaps for mapgen, maps without z-levels)
+         * only ever touch a few levels.  Use @ref get_cache to access them.
          */
-        std::array< std::unique_ptr<level_cache>, OVERMAP_LAYERS > caches;
+        mutable std::array< std::unique_ptr<level_cache>, OVERMAP_LAYERS > caches;
 
         mutable std::array< std::unique_ptr<pathfinding_cache>, OVERMAP_LAYERS > pathfinding_caches;
+        /**
+         * Flow fields requested through route_shared, stale ones are dropped on the next request.
+         */
+        mutable std::vector<std::unique_ptr<flow_field>> flow_fields;
+        mutable std::unique_ptr<route_cache> route_results;
         /**
          * Set of submaps that contain active items in absolute coordinates.
          */
         std::set<tripoint> submaps_with_active_items;
 
         /**
-         * Cache of coordinate pairs recently checked for visibility.
+         * Visibility of coordinate pairs checked along the default line since the seen cache
+         * last changed, see @ref sees.
+         */
+        mutable std::unordered_map<point, bool> skew_vision_cache;
+
+        struct shared_fov {
+            float seen[MAPSIZE_X][MAPSIZE_Y];
+        };
+        /**
+         * Fields of view from @ref share_fov by their origin.
+         */
+        std::unordered_map<tripoint, std::unique_ptr<shared_fov>> shared_fovs;
+        const shared_fov *find_shared_fov( const tripoint &origin ) const;
+
+        /**
+         * What the cameras saw in the last @ref apply_camera_view, together with everything
+         * the view depends on.  Cameras don't move with the player, so this is reused for as
+         * long as the cameras and what they look through stay the same.
          */
-        mutable lru_cache<point, char> skew_vision_cache;
+        struct camera_view {
+            std::vector<std::pair<tripoint, int>> cameras;
+            float transparency[MAPSIZE_X][MAPSIZE_Y];
+            diagonal_blocks blocked[MAPSIZE_X][MAPSIZE_Y];
+            float seen[MAPSIZE_X][MAPSIZE_Y];
+        };
+        std::unique_ptr<camera_view> cached_camera_view;
 
         /**
          * Vehicle list doesn't change often, but is pretty expensive.
@@ -2012,11 +2274,42 @@ class map
 
         // Note: no bounds check
         level_cache &get_cache( int zlev ) const {
-            return *caches[zlev + OVERMAP_DEPTH];
+            std::unique_ptr<level_cache> &ch = caches[zlev + OVERMAP_DEPTH];
+            if( !ch ) {
+                ch = std::make_unique<level_cache>();
+            }
+            return *ch;
+        }
+        /**
+         * Like @ref get_cache, but nullptr if the level has no cache yet.  A new cache starts
+         * with everything dirty, so marking parts of a missing one dirty is a no-op: maps that
+         * only run mapgen (tinymaps of overmap specials) never allocate the caches for it.
+         * Note: no bounds check
+         */
+        level_cache *find_cache( int zlev ) const {
+            return caches[zlev + OVERMAP_DEPTH].get();
         }
 
         pathfinding_cache &get_pathfinding_cache( int zlev ) const;
 
+        /** Returns the shared flow field for given goal and settings if it is worth using. */
+        const flow_field *get_flow_field( const tripoint &goal,
+                                          const pathfinding_settings &settings ) const;
+        void build_flow_field( flow_field &field ) const;
+        /** The A* search of @ref route, without the result cache. */
+        std::vector<tripoint> find_route( const tripoint &f, const tripoint &t,
+                                          const pathfinding_settings &settings,
+                                          const std::set<tripoint> &pre_closed ) const;
+        /**
+         * Cost of a single step of @ref route between neighboring tiles on the same z-level.
+         * @param cur_veh The vehicle at @p cur, if any.
+         */
+        route_step route_step_cost( const tripoint &cur, const vehicle *cur_veh, const tripoint &p,
+                                    const pathfinding_settings &settings ) const;
+        /** Same for flow fields, which don't go down ledges.  -1 if the step is impossible. */
+        int flow_step_cost( const tripoint &cur, const tripoint &p,
+                            const pathfinding_settings &settings ) const;
+
         visibility_variables visibility_variables_cache;
 
         // caches the highest zlevel above which all zlevels are uniform
@@ -2025,7 +2318,7 @@ class map
 
     public:
         const level_cache &get_cache_ref( int zlev ) const {
-            return *caches[zlev + OVERMAP_DEPTH];
+            return get_cache( zlev );
         }
 
         const pathfinding_cache &get_pathfinding_cache_ref( int zlev ) const;
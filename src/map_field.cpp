@@ -29,6 +29,7 @@
 #include "fungal_effects.h"
 #include "game.h"
 #include "game_constants.h"
+#include "gas_diffusion.h"
 #include "int_id.h"
 #include "item.h"
 #include "item_contents.h"
@@ -44,6 +45,7 @@
 #include "monster.h"
 #include "mtype.h"
 #include "npc.h"
+#include "options.h"
 #include "overmapbuffer.h"
 #include "player.h"
 #include "pldata.h"
@@ -144,22 +146,44 @@ void map::process_fields()
 {
     ZoneScoped;
 
+    // Submaps this far from the one of the player are processed every few turns only
+    const int lod_distance = get_option<int>( "FIELD_LOD_DISTANCE" );
+    const time_duration lod_interval = time_duration::from_turns(
+                                           get_option<int>( "FIELD_LOD_INTERVAL" ) );
+    const point player_sm = ms_to_sm_copy( g->u.pos().xy() );
+
     const int minz = zlevels ? -OVERMAP_DEPTH : abs_sub.z;
     const int maxz = zlevels ? OVERMAP_HEIGHT : abs_sub.z;
     for( int z = minz; z <= maxz; z++ ) {
         auto &field_cache = get_cache( z ).field_cache;
         for( int x = 0; x < my_MAPSIZE; x++ ) {
             for( int y = 0; y < my_MAPSIZE; y++ ) {
-                if( field_cache[ x + y * MAPSIZE ] ) {
-                    submap *const current_submap = get_submap_at_grid( { x, y, z } );
-                    process_fields_in_submap( current_submap, tripoint( x, y, z ) );
+                // Also counts turns on submaps without fields, so a new field doesn't catch up
+                // on turns it didn't exist in
+                submap *const current_submap = get_submap_at_grid( { x, y, z } );
+                const time_duration since = calendar::turn - current_submap->fields_processed;
+                // Submaps that weren't processed recently weren't skipped, they just got loaded
+                const bool fresh = since < 0_turns || since > lod_interval;
+                const bool reduced = lod_distance > 0 &&
+                                     square_dist( player_sm, point( x, y ) ) >= lod_distance;
+                if( reduced && !fresh && since < lod_interval ) {
+                    continue;
+                }
+                current_submap->fields_processed = calendar::turn;
+                if( !field_cache[ x + y * MAPSIZE ] ) {
+                    continue;
                 }
+                // Catches up the turns that were skipped, also after getting closer again
+                const int turns = fresh ? 1 : std::max( to_turns<int>( since ), 1 );
+                process_fields_in_submap( current_submap, tripoint( x, y, z ), turns );
             }
         }
 
         // no need to invalidate "transparency" and "seen" caches here
         // they are invalidated point by point inside the `process_fields_in_submap`
     }
+
+    diffuse_buffered_gases();
 }
 
 bool ter_furn_has_flag( const ter_t &ter, const furn_t &furn, const ter_bitflags flag )
@@ -212,16 +236,20 @@ std::array<std::pair<tripoint, maptile>, 8> map::get_neighbors( const tripoint &
     };
 }
 
+static bool gas_can_enter( const maptile &tile )
+{
+    const ter_t &ter = tile.get_ter_t();
+    const furn_t &frn = tile.get_furn_t();
+    return ter_furn_movecost( ter, frn ) > 0 || ter_furn_has_flag( ter, frn, TFLAG_PERMEABLE );
+}
+
 bool map::gas_can_spread_to( field_entry &cur, const tripoint &src, const tripoint &dst )
 {
     maptile dst_tile = maptile_at( dst );
     const field_entry *tmpfld = dst_tile.get_field().find_field( cur.get_field_type() );
     // Candidates are existing weaker fields or navigable/flagged tiles with no field.
     if( tmpfld == nullptr || tmpfld->get_field_intensity() < cur.get_field_intensity() ) {
-        const ter_t &ter = dst_tile.get_ter_t();
-        const furn_t &frn = dst_tile.get_furn_t();
-        return !obstructed_by_vehicle_rotation( src, dst ) &&
-               ( ter_furn_movecost( ter, frn ) > 0 || ter_furn_has_flag( ter, frn, TFLAG_PERMEABLE ) );
+        return gas_can_enter( dst_tile ) && !obstructed_by_vehicle_rotation( src, dst );
     }
     return false;
 }
@@ -252,24 +280,161 @@ void map::gas_spread_to( field_entry &cur, maptile &dst, const tripoint &p )
     }
 }
 
-void map::spread_gas( field_entry &cur, const tripoint &p, int percent_spread,
-                      const time_duration &outdoor_age_speedup, scent_block &sblk )
+void map::diffuse_buffered_gases()
 {
-    map &here = get_map();
-    // TODO: fix point types
+    std::vector<field_type_id> buffered_types;
+    for( const field_type &ft : field_types::get_all() ) {
+        if( ft.buffered_diffusion && ft.phase == GAS && ft.percent_spread > 0 ) {
+            buffered_types.push_back( ft.id.id() );
+        }
+    }
+    if( buffered_types.empty() ) {
+        return;
+    }
+
+    const int minz = zlevels ? -OVERMAP_DEPTH : abs_sub.z;
+    const int maxz = zlevels ? OVERMAP_HEIGHT : abs_sub.z;
+    const int size = SEEX * my_MAPSIZE;
+    const weather_manager &weather = get_weather();
+
+    for( const field_type_id &type : buffered_types ) {
+        // Find the z-levels holding this gas, and the ones it may move to
+        std::vector<bool> has_gas( maxz - minz + 1, false );
+        for( int z = minz; z <= maxz; z++ ) {
+            const auto &field_cache = get_cache( z ).field_cache;
+            for( int x = 0; x < my_MAPSIZE && !has_gas[z - minz]; x++ ) {
+                for( int y = 0; y < my_MAPSIZE && !has_gas[z - minz]; y++ ) {
+                    if( field_cache[x + y * MAPSIZE] ) {
+                        has_gas[z - minz] = true;
+                    }
+                }
+            }
+        }
+        std::vector<gas_diffusion::layer> layers( has_gas.size() );
+        bool any_gas = false;
+        for( int z = minz; z <= maxz; z++ ) {
+            const int i = z - minz;
+            const bool needed = has_gas[i] || ( i > 0 && has_gas[i - 1] ) ||
+                                ( i + 1 < static_cast<int>( has_gas.size() ) && has_gas[i + 1] );
+            if( !needed ) {
+                continue;
+            }
+            layers[i] = gas_diffusion::layer( size );
+            if( !has_gas[i] ) {
+                continue;
+            }
+            gas_diffusion::layer &l = layers[i];
+            for( int smx = 0; smx < my_MAPSIZE; smx++ ) {
+                for( int smy = 0; smy < my_MAPSIZE; smy++ ) {
+                    if( !get_cache( z ).field_cache[smx + smy * MAPSIZE] ) {
+                        continue;
+                    }
+                    const submap *sm = get_submap_at_grid( { smx, smy, z } );
+                    for( int lx = 0; lx < SEEX; lx++ ) {
+                        for( int ly = 0; ly < SEEY; ly++ ) {
+                            if( !sm->may_have_field( { lx, ly } ) ) {
+                                continue;
+                            }
+                            const field_entry *fe = sm->get_field( { lx, ly } ).find_field( type );
+                            if( fe == nullptr || !fe->is_field_alive() ) {
+                                continue;
+                            }
+                            const tripoint p( smx * SEEX + lx, smy * SEEY + ly, z );
+                            const int idx = p.x + p.y * size;
+                            l.intensity[idx] = static_cast<std::uint8_t>( fe->get_field_intensity() );
+                            l.age[idx] = to_turns<int>( fe->get_field_age() );
+                            any_gas = true;
+                            if( l.intensity[idx] > 1 ) {
+                                describe_gas_source( l, p );
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        if( !any_gas ) {
+            continue;
+        }
+
+        gas_diffusion::settings opts;
+        opts.percent_spread = type->percent_spread;
+        opts.max_intensity = type->get_max_intensity();
+        opts.winddirection = weather.winddirection;
+        opts.zlevels = zlevels;
+        opts.seed = static_cast<std::uint64_t>( to_turn<int>( calendar::turn ) ) * 131 + type.to_i();
+        gas_diffusion::diffuse( layers, opts );
+
+        const bool dirties_transparency = type->dirty_transparency_cache || !type->is_transparent();
+        for( int z = minz; z <= maxz; z++ ) {
+            const gas_diffusion::layer &l = layers[z - minz];
+            if( l.empty() ) {
+                continue;
+            }
+            for( int idx = 0; idx < size * size; idx++ ) {
+                if( l.next_intensity[idx] == l.intensity[idx] && l.next_age[idx] == l.age[idx] ) {
+                    continue;
+                }
+                const tripoint p( idx % size, idx / size, z );
+                const time_duration age = time_duration::from_turns( l.next_age[idx] );
+                if( l.intensity[idx] == 0 ) {
+                    add_field( p, type, l.next_intensity[idx], age );
+                    continue;
+                }
+                field_entry *fe = get_field( p, type );
+                if( fe == nullptr ) {
+                    continue;
+                }
+                fe->set_field_intensity( l.next_intensity[idx] );
+                fe->set_field_age( age );
+                if( dirties_transparency ) {
+                    set_transparency_cache_dirty( p );
+                    set_seen_cache_dirty( p );
+                }
+            }
+        }
+    }
+}
+
+void map::describe_gas_source( gas_diffusion::layer &l, const tripoint &p )
+{
+    // Everything spread_gas looks up on the map, so the kernel doesn't have to
+    const int idx = p.x + p.y * l.size;
     const oter_id &cur_om_ter =
-        overmap_buffer.ter( tripoint_abs_omt( ms_to_omt_copy( here.getabs( p ) ) ) );
+        overmap_buffer.ter( tripoint_abs_omt( ms_to_omt_copy( getabs( p ) ) ) );
     const bool sheltered = g->is_sheltered( p );
     const weather_manager &weather = get_weather();
-    const int winddirection = weather.winddirection;
-    const int windpower = get_local_windpower( weather.windspeed, cur_om_ter, p, winddirection,
-                          sheltered );
-
-    const int current_intensity = cur.get_field_intensity();
-    const field_type_id ft_id = cur.get_field_type();
+    l.sheltered[idx] = sheltered;
+    l.windpower[idx] = get_local_windpower( weather.windspeed, cur_om_ter, p,
+                                            weather.winddirection, sheltered );
+
+    std::uint16_t open = 0;
+    for( size_t i = 0; i < eight_horizontal_neighbors.size(); i++ ) {
+        const tripoint dst = p + eight_horizontal_neighbors[i];
+        if( inbounds( dst ) && gas_can_enter( maptile_at_internal( dst ) ) &&
+            !obstructed_by_vehicle_rotation( p, dst ) ) {
+            open |= 1 << i;
+        }
+    }
+    if( zlevels ) {
+        const tripoint down( p.xy(), p.z - 1 );
+        if( p.z > -OVERMAP_DEPTH && gas_can_enter( maptile_at_internal( down ) ) &&
+            valid_move( p, down, true, true ) ) {
+            open |= gas_diffusion::open_below;
+        }
+        const tripoint up( p.xy(), p.z + 1 );
+        if( p.z < OVERMAP_HEIGHT && gas_can_enter( maptile_at_internal( up ) ) &&
+            valid_move( p, up, true, true ) ) {
+            open |= gas_diffusion::open_above;
+        }
+    }
+    l.permeability[idx] = open;
+}
 
-    const int scent_neutralize = ft_id->get_intensity_level( current_intensity -
-                                 1 ).scent_neutralization;
+void map::apply_gas_here( field_entry &cur, const tripoint &p,
+                          const time_duration &outdoor_age_speedup, scent_block &sblk )
+{
+    const int scent_neutralize = cur.get_field_type()->get_intensity_level(
+                                     cur.get_field_intensity() - 1 ).scent_neutralization;
 
     if( scent_neutralize > 0 ) {
         // modify scents by neutralization value (minus)
@@ -283,6 +448,24 @@ void map::spread_gas( field_entry &cur, const tripoint &p, int percent_spread,
         const time_duration current_age = cur.get_field_age();
         cur.set_field_age( current_age + outdoor_age_speedup );
     }
+}
+
+void map::spread_gas( field_entry &cur, const tripoint &p, int percent_spread,
+                      const time_duration &outdoor_age_speedup, scent_block &sblk )
+{
+    map &here = get_map();
+    // TODO: fix point types
+    const oter_id &cur_om_ter =
+        overmap_buffer.ter( tripoint_abs_omt( ms_to_omt_copy( here.getabs( p ) ) ) );
+    const bool sheltered = g->is_sheltered( p );
+    const weather_manager &weather = get_weather();
+    const int winddirection = weather.winddirection;
+    const int windpower = get_local_windpower( weather.windspeed, cur_om_ter, p, winddirection,
+                          sheltered );
+
+    const int current_intensity = cur.get_field_intensity();
+
+    apply_gas_here( cur, p, outdoor_age_speedup, sblk );
 
     // Bail out if we don't meet the spread chance or required intensity.
     if( current_intensity <= 1 || rng( 1, 100 - windpower ) > percent_spread ) {
@@ -398,7 +581,7 @@ This is the general update function for field effects. This should only be calle
 If you need to insert a new field behavior per unit time add a case statement in the switch below.
 */
 void map::process_fields_in_submap( submap *const current_submap,
-                                    const tripoint &submap )
+                                    const tripoint &submap, const int turns )
 {
     scent_block sblk( submap, g->scent );
 
@@ -419,6 +602,11 @@ void map::process_fields_in_submap( submap *const current_submap,
     // Loop through all tiles in this submap indicated by current_submap
     for( locx = 0; locx < SEEX; locx++ ) {
         for( locy = 0; locy < SEEY; locy++ ) {
+            // Most tiles never had a field, skip them without touching their field object
+            if( !current_submap->may_have_field( { locx, locy } ) ) {
+                continue;
+            }
+
             // Get a reference to the field variable from the submap;
             // contains all the pointers to the real field effects.
             field &curfield = current_submap->get_field( { locx, locy } );
@@ -426,6 +614,7 @@ void map::process_fields_in_submap( submap *const current_submap,
             // when displayed_field_type == fd_null it means that `curfield` has no fields inside
             // avoids instantiating (relatively) expensive map iterator
             if( !curfield.displayed_field_type() ) {
+                current_submap->clear_field_tile( { locx, locy } );
                 continue;
             }
 
@@ -803,19 +992,28 @@ void map::process_fields_in_submap( submap *const current_submap,
                                 continue;
                             }
 
+                            const ter_t &dster = dst.get_ter_t();
+                            const furn_t &dsfrn = dst.get_furn_t();
+                            // Only flammable ground catches fire, whatever the rolls below say.
+                            // In a burning area most neighbors are not, so check that first.
+                            if( !( check_flammable( dster ) || check_flammable( dsfrn ) ) ||
+                                in_pit != ( dster.id.id() == t_pit ) ) {
+                                continue;
+                            }
+
                             field_entry *nearwebfld = dst.find_field( fd_web );
                             int spread_chance = 25 * ( cur.get_field_intensity() - 1 );
                             if( nearwebfld != nullptr ) {
                                 spread_chance = 50 + spread_chance / 2;
                             }
+                            // The roll below is at least 1, so intensity 1 fires only spread along webs
+                            if( spread_chance <= 1 ) {
+                                continue;
+                            }
 
-                            const ter_t &dster = dst.get_ter_t();
-                            const furn_t &dsfrn = dst.get_furn_t();
                             // Allow weaker fires to spread occasionally
                             const int power = cur.get_field_intensity() + one_in( 5 );
-                            if( can_spread && rng( 1, 100 ) < spread_chance &&
-                                ( check_flammable( dster ) || check_flammable( dsfrn ) ) &&
-                                ( in_pit == ( dster.id.id() == t_pit ) ) &&
+                            if( rng( 1, 100 ) < spread_chance &&
                                 (
                                     ( power >= 3 && cur.get_field_age() < 0_turns && one_in( 20 ) ) ||
                                     ( power >= 2 && ( ter_furn_has_flag( dster, dsfrn, TFLAG_FLAMMABLE ) && one_in( 2 ) ) ) ||
@@ -847,7 +1045,12 @@ void map::process_fields_in_submap( submap *const current_submap,
                     const int gas_percent_spread = cur_fd_type.percent_spread;
                     if( gas_percent_spread > 0 ) {
                         const time_duration outdoor_age_speedup = cur_fd_type.outdoor_age_speedup;
-                        spread_gas( cur, p, gas_percent_spread, outdoor_age_speedup, sblk );
+                        if( cur_fd_type.buffered_diffusion ) {
+                            // Spread later by diffuse_buffered_gases
+                            apply_gas_here( cur, p, outdoor_age_speedup, sblk );
+                        } else {
+                            spread_gas( cur, p, gas_percent_spread, outdoor_age_speedup, sblk );
+                        }
                     }
                 }
 
@@ -1174,7 +1377,7 @@ void map::process_fields_in_submap( submap *const current_submap,
                     }
                 }
 
-                cur.set_field_age( cur.get_field_age() + 1_turns );
+                cur.set_field_age( cur.get_field_age() + 1_turns * turns );
                 auto &fdata = cur.get_field_type().obj();
                 if( fdata.half_life > 0_turns && cur.get_field_age() > 0_turns &&
                     dice( 2, to_turns<int>( cur.get_field_age() ) ) > to_turns<int>( fdata.half_life ) ) {
@@ -1189,6 +1392,10 @@ void map::process_fields_in_submap( submap *const current_submap,
                 }
             }
 
+            if( curfield.field_count() == 0 ) {
+                current_submap->clear_field_tile( { locx, locy } );
+            }
+
             if( dirty_transparency_cache ) {
                 set_transparency_cache_dirty( thep );
                 set_seen_cache_dirty( thep );
@@ -1894,30 +2101,10 @@ void map::monster_in_field( monster &z )
 std::tuple<maptile, maptile, maptile> map::get_wind_blockers( const int &winddirection,
         const tripoint &pos )
 {
-    static const std::array<std::pair<int, std::tuple< point, point, point >>, 9> outputs = {{
-            { 330, std::make_tuple( point_east, point_north_east, point_south_east ) },
-            { 301, std::make_tuple( point_south_east, point_east, point_south ) },
-            { 240, std::make_tuple( point_south, point_south_west, point_south_east ) },
-            { 211, std::make_tuple( point_south_west, point_west, point_south ) },
-            { 150, std::make_tuple( point_west, point_north_west, point_south_west ) },
-            { 121, std::make_tuple( point_north_west, point_north, point_west ) },
-            { 60, std::make_tuple( point_north, point_north_west, point_north_east ) },
-            { 31, std::make_tuple( point_north_east, point_east, point_north ) },
-            { 0, std::make_tuple( point_east, point_north_east, point_south_east ) }
-        }
-    };
-
-    tripoint removepoint;
-    tripoint removepoint2;
-    tripoint removepoint3;
-    for( const std::pair<int, std::tuple< point, point, point >> &val : outputs ) {
-        if( winddirection >= val.first ) {
-            removepoint = pos + std::get<0>( val.second );
-            removepoint2 = pos + std::get<1>( val.second );
-            removepoint3 = pos + std::get<2>( val.second );
-            break;
-        }
-    }
+    const std::array<point, 3> offsets = gas_diffusion::wind_blockers( winddirection );
+    const tripoint removepoint = pos + offsets[0];
+    const tripoint removepoint2 = pos + offsets[1];
+    const tripoint removepoint3 = pos + offsets[2];
 
     const maptile remove_tile = maptile_at( removepoint );
     const maptile remove_tile2 = maptile_at( removepoint2 );
@@ -1941,6 +2128,15 @@ void map::emit_field( const tripoint &pos, const emit_id &src, float mul )
 void map::propagate_field( const tripoint &center, const field_type_id &type, int amount,
                            int max_intensity )
 {
+    // Most emissions are a single small puff that fits on the center tile, that can skip the
+    // whole flood fill below, which would do the same in its first step
+    const int center_intensity = get_field_intensity( center, type );
+    if( amount > 0 && center_intensity < max_intensity &&
+        amount <= max_intensity - center_intensity ) {
+        mod_field_intensity( center, type, amount );
+        return;
+    }
+
     using gas_blast = std::pair<float, tripoint>;
     std::priority_queue<gas_blast, std::vector<gas_blast>, pair_greater_cmp_first> open;
     std::set<tripoint> closed;
@@ -1955,7 +2151,7 @@ void map::propagate_field( const tripoint &center, const field_type_id &type, in
         }
 
         // All points with equal gas intensity should propagate at the same time
-        std::list<gas_blast> gas_front;
+        std::vector<gas_blast> gas_front;
         gas_front.push_back( open.top() );
         const int cur_intensity = get_field_intensity( open.top().second, type );
         open.pop();
@@ -1,11 +1,15 @@
 #include "map_memory.h"
 
+#include <deque>
+#include <unordered_map>
+
 #include "coordinate_conversions.h"
 #include "cuboid_rectangle.h"
 #include "debug.h"
 #include "filesystem.h"
 #include "fstream_utils.h"
 #include "game.h"
+#include "hash_utils.h"
 #include "line.h"
 #include "translations.h"
 #include "map.h"
@@ -15,6 +19,9 @@ const int mm_submap::default_symbol = 0;
 
 #define MM_SIZE (MAPSIZE * 2)
 
+// About 1 KiB each, regions without unsaved changes are dropped past this
+static constexpr size_t max_held_submaps = 16384;
+
 #define dbg(x) DebugLog((x),DC::MapMem)
 
 /**
@@ -32,6 +39,56 @@ struct reg_coord_pair {
 
 mm_submap::mm_submap() = default;
 
+namespace
+{
+
+struct memorized_tile_hash {
+    size_t operator()( const memorized_terrain_tile &t ) const {
+        size_t seed = std::hash<std::string>()( t.tile );
+        cata::hash_combine( seed, t.subtile );
+        cata::hash_combine( seed, t.rotation );
+        return seed;
+    }
+};
+
+struct memorized_tile_table {
+    // A deque, so references handed out by mm_submap::tile stay valid
+    std::deque<memorized_terrain_tile> tiles;
+    std::unordered_map<memorized_terrain_tile, uint32_t, memorized_tile_hash> indices;
+
+    memorized_tile_table() {
+        // Index 0 is the default (empty) tile
+        tiles.push_back( memorized_terrain_tile{ "", 0, 0 } );
+        indices.emplace( tiles.back(), 0 );
+    }
+};
+
+memorized_tile_table &get_tile_table()
+{
+    static memorized_tile_table table;
+    return table;
+}
+
+} // namespace
+
+mm_submap::tile_index mm_submap::intern( const memorized_terrain_tile &value )
+{
+    memorized_tile_table &table = get_tile_table();
+    const auto iter = table.indices.find( value );
+    if( iter != table.indices.end() ) {
+        return iter->second;
+    }
+    const tile_index index = table.tiles.size();
+    table.tiles.push_back( value );
+    table.indices.emplace( value, index );
+    return index;
+}
+
+const memorized_terrain_tile &mm_submap::interned_tile( tile_index index )
+{
+    return get_tile_table().tiles[index];
+}
+
 mm_region::mm_region() : submaps {{ nullptr }} {}
 
 bool mm_region::is_empty() const
@@ -108,6 +165,15 @@ void map_memory::clear_memorized_tile( const tripoint &pos )
     sm.set_tile( p.loc, mm_submap::default_tile );
 }
 
+size_t map_memory::memory_usage() const
+{
+    size_t total = 0;
+    for( const auto &entry : submaps ) {
+        total += entry.second->memory_usage();
+    }
+    return total;
+}
+
 bool map_memory::prepare_region( const tripoint &p1, const tripoint &p2 )
 {
     assert( p1.z == p2.z );
@@ -138,6 +204,8 @@ bool map_memory::prepare_region( const tripoint &p1, const tripoint &p2 )
     cache_size = sm_size;
 
     cached.clear();
+    constexpr point MM_HSIZE_P = point( MM_SIZE / 2, MM_SIZE / 2 );
+    drop_clean_regions( sm_p1.xy() - MM_HSIZE_P, sm_p2.xy() + MM_HSIZE_P );
     cached.reserve( cache_size.x * cache_size.y * ( maxz - minz + 1 ) );
 
     for( int z = minz; z <= maxz; z++ ) {
@@ -252,6 +320,8 @@ shared_ptr_fast<mm_submap> map_memory::load_submap( const tripoint &sm_pos )
             }
 
             temp_remove_open_air( mmr.submaps[x][y] );
+            // Same as on disk, other than the open air removal
+            sm->dirty = false;
 
             submaps.insert( std::make_pair( pos, sm ) );
         }
@@ -343,6 +413,7 @@ bool map_memory::save( const tripoint &pos )
                 for( size_t x = 0; x < MM_REG_SIZE; x++ ) {
                     tripoint p = regp_sm + tripoint( x, y, 0 );
                     shared_ptr_fast<mm_submap> &sm = reg.submaps[x][y];
+                    sm->dirty = false;
                     submaps.insert( std::make_pair( p, sm ) );
                 }
             }
@@ -357,6 +428,39 @@ bool map_memory::save( const tripoint &pos )
     return result;
 }
 
+void map_memory::drop_clean_regions( point keep_min, point keep_max )
+{
+    if( submaps.size() <= max_held_submaps ) {
+        return;
+    }
+    // Submaps are always loaded and allocated in whole regions, so they are dropped that way too
+    std::unordered_map<tripoint, bool> region_dirty;
+    for( const auto &it : submaps ) {
+        bool &dirty = region_dirty[reg_coord_pair( it.first ).reg];
+        dirty = dirty || it.second->dirty;
+    }
+    const inclusive_rectangle<point> keep( keep_min, keep_max );
+    size_t dropped = 0;
+    for( const std::pair<const tripoint, bool> &reg : region_dirty ) {
+        if( reg.second ) {
+            continue;
+        }
+        const tripoint regp_sm = mmr_to_sm_copy( reg.first );
+        const inclusive_rectangle<point> rect_reg( regp_sm.xy(),
+                regp_sm.xy() + point( MM_REG_SIZE - 1, MM_REG_SIZE - 1 ) );
+        if( rect_reg.overlaps( keep ) ) {
+            continue;
+        }
+        for( size_t y = 0; y < MM_REG_SIZE; y++ ) {
+            for( size_t x = 0; x < MM_REG_SIZE; x++ ) {
+                submaps.erase( regp_sm + tripoint( x, y, 0 ) );
+            }
+        }
+        dropped++;
+    }
+    dbg( DL::Info ) << "Dropped " << dropped << " clean mm_regions, " << submaps.size() << " submaps left";
+}
+
 void map_memory::clear_cache()
 {
     cached.clear();
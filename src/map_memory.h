@@ -2,8 +2,11 @@
 #ifndef CATA_SRC_MAP_MEMORY_H
 #define CATA_SRC_MAP_MEMORY_H
 
+#include <cstdint>
 #include <map>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "game_constants.h"
 #include "memory_fast.h"
@@ -44,7 +47,7 @@ struct mm_submap {
             if( tiles.empty() ) {
                 return default_tile;
             } else {
-                return tiles[p.y * SEEX + p.x];
+                return interned_tile( tiles[p.y * SEEX + p.x] );
             }
         }
 
@@ -52,9 +55,10 @@ struct mm_submap {
             if( tiles.empty() ) {
                 // call 'reserve' first to force allocation of exact size
                 tiles.reserve( SEEX * SEEY );
-                tiles.resize( SEEX * SEEY, default_tile );
+                tiles.resize( SEEX * SEEY, default_tile_index );
             }
-            tiles[p.y * SEEX + p.x] = value;
+            tiles[p.y * SEEX + p.x] = intern( value );
+            dirty = true;
         }
 
         int symbol( point p ) const {
@@ -72,15 +76,33 @@ struct mm_submap {
                 symbols.resize( SEEX * SEEY, default_symbol );
             }
             symbols[p.y * SEEX + p.x] = value;
+            dirty = true;
         }
 
         void serialize( JsonOut &jsout ) const;
         void deserialize( JsonIn &jsin );
 
+        /** Bytes held by this submap, including its tile and symbol arrays. */
+        size_t memory_usage() const {
+            return sizeof( *this ) + tiles.capacity() * sizeof( tile_index ) +
+                   symbols.capacity() * sizeof( int );
+        }
+
     private:
-        std::vector<memorized_terrain_tile> tiles; // holds either 0 or SEEX*SEEY elements
+        /**
+         * Memorized tiles are kept in one table shared by all submaps, there are only so many
+         * combinations of tile id, subtile and rotation.  Submaps store indices into it.
+         */
+        using tile_index = std::uint32_t;
+        static constexpr tile_index default_tile_index = 0;
+        static tile_index intern( const memorized_terrain_tile &value );
+        static const memorized_terrain_tile &interned_tile( tile_index index );
+
+        std::vector<tile_index> tiles; // holds either 0 or SEEX*SEEY elements
         std::vector<int> symbols; // holds either 0 or SEEX*SEEY elements
         bool valid = true;
+        // Changed since it was last loaded or saved
+        bool dirty = false;
 };
 
 /**
@@ -178,8 +200,15 @@ class map_memory
          */
         void clear_memorized_tile( const tripoint &pos );
 
+        /** Number of memorized submaps held in memory. */
+        size_t num_submaps() const {
+            return submaps.size();
+        }
+        /** Bytes held by the memorized submaps, see @ref mm_submap::memory_usage. */
+        size_t memory_usage() const;
+
     private:
-        std::map<tripoint, shared_ptr_fast<mm_submap>> submaps;
+        std::unordered_map<tripoint, shared_ptr_fast<mm_submap>> submaps;
 
         std::vector<shared_ptr_fast<mm_submap>> cached;
         tripoint cache_pos;
@@ -201,6 +230,13 @@ class map_memory
          */
         mm_submap &get_submap( const tripoint &sm_pos );
 
+        /**
+         * Drops regions without unsaved changes that are entirely outside of the given area
+         * (in sm coords, both corners inclusive), once more than a certain number of submaps
+         * are held.  They can be loaded from disk again when needed.
+         */
+        void drop_clean_regions( point keep_min, point keep_max );
+
         void clear_cache();
 };
 
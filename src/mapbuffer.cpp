@@ -3,7 +3,6 @@
 #include <algorithm>
 #include <exception>
 #include <functional>
-#include <set>
 #include <sstream>
 #include <utility>
 #include <vector>
@@ -22,6 +21,7 @@
 #include "popup.h"
 #include "string_formatter.h"
 #include "submap.h"
+#include "thread_pool.h"
 #include "translations.h"
 #include "ui_manager.h"
 #include "world.h"
@@ -33,16 +33,79 @@ mapbuffer::~mapbuffer() = default;
 
 void mapbuffer::clear()
 {
-    submaps.clear();
+    quads.clear();
+}
+
+size_t mapbuffer::quad_index( const tripoint &p )
+{
+    const tripoint offset = p - omt_to_sm_copy( sm_to_omt_copy( p ) );
+    // Same order as the submaps are stored in the quad files
+    return offset.x * 2 + offset.y;
+}
+
+std::unique_ptr<submap> *mapbuffer::find_slot( const tripoint &p )
+{
+    const auto iter = quads.find( sm_to_omt_copy( p ) );
+    if( iter == quads.end() ) {
+        return nullptr;
+    }
+    return &iter->second[quad_index( p )];
+}
+
+const std::unique_ptr<submap> *mapbuffer::find_slot( const tripoint &p ) const
+{
+    const auto iter = quads.find( sm_to_omt_copy( p ) );
+    if( iter == quads.end() ) {
+        return nullptr;
+    }
+    return &iter->second[quad_index( p )];
+}
+
+bool mapbuffer::is_submap_loaded( const tripoint &p ) const
+{
+    const std::unique_ptr<submap> *slot = find_slot( p );
+    return slot != nullptr && *slot != nullptr;
+}
+
+size_t mapbuffer::num_submaps() const
+{
+    size_t count = 0;
+    for( const auto &entry : quads ) {
+        for( const std::unique_ptr<submap> &sm : entry.second ) {
+            count += sm != nullptr;
+        }
+    }
+    return count;
+}
+
+mapbuffer::memory_stats mapbuffer::get_memory_stats() const
+{
+    memory_stats stats;
+    for( const auto &entry : quads ) {
+        for( const std::unique_ptr<submap> &sm : entry.second ) {
+            if( sm == nullptr ) {
+                continue;
+            }
+            stats.submaps++;
+            stats.vehicles += sm->vehicles.size();
+            for( int x = 0; x < SEEX; x++ ) {
+                for( int y = 0; y < SEEY; y++ ) {
+                    stats.items += sm->get_items( point( x, y ) ).size();
+                }
+            }
+        }
+    }
+    return stats;
 }
 
 bool mapbuffer::add_submap( const tripoint &p, std::unique_ptr<submap> &sm )
 {
-    if( submaps.contains( p ) ) {
+    std::unique_ptr<submap> &slot = quads[sm_to_omt_copy( p )][quad_index( p )];
+    if( slot != nullptr ) {
         return false;
     }
 
-    submaps[p] = std::move( sm );
+    slot = std::move( sm );
 
     return true;
 }
@@ -61,18 +124,24 @@ bool mapbuffer::add_submap( const tripoint &p, submap *sm )
 
 void mapbuffer::remove_submap( tripoint addr )
 {
-    auto m_target = submaps.find( addr );
-    if( m_target == submaps.end() ) {
+    const auto iter = quads.find( sm_to_omt_copy( addr ) );
+    if( iter == quads.end() || iter->second[quad_index( addr )] == nullptr ) {
         debugmsg( "Tried to remove non-existing submap %s", addr.to_string() );
         return;
     }
-    submaps.erase( m_target );
+    submap_quad &quad = iter->second;
+    quad[quad_index( addr )].reset();
+    if( std::all_of( quad.begin(), quad.end(), []( const std::unique_ptr<submap> &sm ) {
+    return sm == nullptr;
+} ) ) {
+        quads.erase( iter );
+    }
 }
 
 submap *mapbuffer::lookup_submap( const tripoint &p )
 {
-    const auto iter = submaps.find( p );
-    if( iter == submaps.end() ) {
+    const std::unique_ptr<submap> *slot = find_slot( p );
+    if( slot == nullptr || *slot == nullptr ) {
         try {
             return unserialize_submaps( p );
         } catch( const std::exception &err ) {
@@ -81,13 +150,36 @@ submap *mapbuffer::lookup_submap( const tripoint &p )
         return nullptr;
     }
 
-    return iter->second.get();
+    return slot->get();
+}
+
+std::array<submap *, 4> mapbuffer::lookup_quad( const tripoint &om_addr )
+{
+    std::array<submap *, 4> result = {};
+    auto iter = quads.find( om_addr );
+    if( iter == quads.end() ) {
+        try {
+            using namespace std::placeholders;
+            g->get_active_world()->read_map_quad( om_addr, std::bind( &mapbuffer::deserialize,
+                                                  this, _1 ) );
+        } catch( const std::exception &err ) {
+            debugmsg( "Failed to load submap quad %s: %s", om_addr.to_string(), err.what() );
+        }
+        iter = quads.find( om_addr );
+        if( iter == quads.end() ) {
+            return result;
+        }
+    }
+    for( size_t i = 0; i < result.size(); i++ ) {
+        result[i] = iter->second[i].get();
+    }
+    return result;
 }
 
 void mapbuffer::save( bool delete_after_save )
 {
     int num_saved_submaps = 0;
-    int num_total_submaps = submaps.size();
+    int num_total_submaps = quads.size() * 4;
 
     map &here = get_map();
     const tripoint map_origin = sm_to_omt_copy( here.get_abs_sub() );
@@ -95,13 +187,42 @@ void mapbuffer::save( bool delete_after_save )
 
     static_popup popup;
 
-    // A set of already-saved submaps, in global overmap coordinates.
-    std::set<tripoint> saved_submaps;
     std::list<tripoint> submaps_to_delete;
     static constexpr std::chrono::milliseconds update_interval( 500 );
     auto last_update = std::chrono::steady_clock::now();
 
-    for( auto &elem : submaps ) {
+    struct pending_quad {
+        const tripoint *om_addr;
+        submap_quad *quad;
+        bool delete_after_save;
+    };
+    std::vector<pending_quad> pending;
+
+    // We're saving a 2x2 quad of submaps at a time.
+    // Submaps are generated in quads, so we know if we have one member of a quad,
+    // we have the rest of it, if that assumption is broken we have REAL problems.
+    for( auto &elem : quads ) {
+        const tripoint &om_addr = elem.first;
+
+        // delete_on_save deletes everything, otherwise delete submaps
+        // outside the current map.
+        const bool zlev_del = !map_has_zlevels && om_addr.z != g->get_levz();
+        const bool delete_quad = delete_after_save || zlev_del ||
+                                 om_addr.x < map_origin.x || om_addr.y < map_origin.y ||
+                                 om_addr.x > map_origin.x + HALF_MAPSIZE ||
+                                 om_addr.y > map_origin.y + HALF_MAPSIZE;
+        if( quad_needs_save( om_addr, elem.second, submaps_to_delete, delete_quad ) ) {
+            pending.push_back( { &om_addr, &elem.second, delete_quad } );
+        } else {
+            num_saved_submaps += 4;
+        }
+    }
+
+    // Quads are independent of each other, so they are serialized and compressed in parallel;
+    // the database serializes the writes themselves.  Done in batches to update the popup.
+    thread_pool &pool = get_thread_pool();
+    const size_t batch_size = 16 * ( pool.num_workers() + 1 );
+    for( size_t batch_start = 0; batch_start < pending.size(); batch_start += batch_size ) {
         auto now = std::chrono::steady_clock::now();
         if( last_update + update_interval < now ) {
             popup.message( _( "Please wait as the map saves [%d/%d]" ),
@@ -111,30 +232,22 @@ void mapbuffer::save( bool delete_after_save )
             inp_mngr.pump_events();
             last_update = now;
         }
-        // Whatever the coordinates of the current submap are,
-        // we're saving a 2x2 quad of submaps at a time.
-        // Submaps are generated in quads, so we know if we have one member of a quad,
-        // we have the rest of it, if that assumption is broken we have REAL problems.
-        const tripoint om_addr = sm_to_omt_copy( elem.first );
-        if( saved_submaps.contains( om_addr ) ) {
-            // Already handled this one.
-            continue;
+        const size_t batch_end = std::min( pending.size(), batch_start + batch_size );
+        pool.parallel_for( static_cast<int>( batch_start ), static_cast<int>( batch_end ),
+        [&]( const int i ) {
+            write_quad( *pending[i].om_addr, *pending[i].quad );
+        } );
+        for( size_t i = batch_start; i < batch_end; i++ ) {
+            if( pending[i].delete_after_save ) {
+                const tripoint sm_addr = omt_to_sm_copy( *pending[i].om_addr );
+                for( size_t j = 0; j < pending[i].quad->size(); j++ ) {
+                    if( ( *pending[i].quad )[j] != nullptr ) {
+                        submaps_to_delete.push_back( sm_addr + point( j / 2, j % 2 ) );
+                    }
+                }
+            }
         }
-        saved_submaps.insert( om_addr );
-
-        // A segment is a chunk of 32x32 submap quads.
-        // We're breaking them into subdirectories so there aren't too many files per directory.
-        // Might want to make a set for this one too so it's only checked once per save().
-
-        // delete_on_save deletes everything, otherwise delete submaps
-        // outside the current map.
-        const bool zlev_del = !map_has_zlevels && om_addr.z != g->get_levz();
-        save_quad( om_addr, submaps_to_delete,
-                   delete_after_save || zlev_del ||
-                   om_addr.x < map_origin.x || om_addr.y < map_origin.y ||
-                   om_addr.x > map_origin.x + HALF_MAPSIZE ||
-                   om_addr.y > map_origin.y + HALF_MAPSIZE );
-        num_saved_submaps += 4;
+        num_saved_submaps += 4 * ( batch_end - batch_start );
     }
     for( auto &elem : submaps_to_delete ) {
         remove_submap( elem );
@@ -143,58 +256,48 @@ void mapbuffer::save( bool delete_after_save )
     get_distribution_grid_tracker().on_saved();
 }
 
-void mapbuffer::save_quad( const tripoint &om_addr, std::list<tripoint> &submaps_to_delete,
-                           bool delete_after_save )
+bool mapbuffer::quad_needs_save( const tripoint &om_addr, const submap_quad &quad,
+                                 std::list<tripoint> &submaps_to_delete, bool delete_after_save ) const
 {
-    std::vector<point> offsets;
-    std::vector<tripoint> submap_addrs;
-    offsets.push_back( point_zero );
-    offsets.push_back( point_south );
-    offsets.push_back( point_east );
-    offsets.push_back( point_south_east );
-
     bool all_uniform = true;
-    for( auto &offsets_offset : offsets ) {
-        tripoint submap_addr = omt_to_sm_copy( om_addr );
-        submap_addr.x += offsets_offset.x;
-        submap_addr.y += offsets_offset.y;
-        submap_addrs.push_back( submap_addr );
-        submap *sm = submaps[submap_addr].get();
+    bool any_modified = false;
+    for( const std::unique_ptr<submap> &sm : quad ) {
         if( sm != nullptr && !sm->is_uniform ) {
             all_uniform = false;
         }
+        if( sm != nullptr && sm->is_modified_since_save() ) {
+            any_modified = true;
+        }
     }
 
-    if( all_uniform ) {
-        // Nothing to save - this quad will be regenerated faster than it would be re-read
+    if( all_uniform || !any_modified ) {
+        // Nothing to save - this quad will be regenerated faster than it would be re-read,
+        // or it is already saved as it is
         if( delete_after_save ) {
-            for( auto &submap_addr : submap_addrs ) {
-                if( submaps.contains( submap_addr ) && submaps[submap_addr] != nullptr ) {
-                    submaps_to_delete.push_back( submap_addr );
+            for( size_t i = 0; i < quad.size(); i++ ) {
+                if( quad[i] != nullptr ) {
+                    submaps_to_delete.push_back( omt_to_sm_copy( om_addr ) + point( i / 2, i % 2 ) );
                 }
             }
         }
 
-        return;
+        return false;
     }
 
-    if( disable_mapgen ) {
-        return;
-    }
+    return !disable_mapgen;
+}
 
+void mapbuffer::write_quad( const tripoint &om_addr, submap_quad &quad )
+{
     g->get_active_world()->write_map_quad( om_addr, [&]( std::ostream & fout ) {
         JsonOut jsout( fout );
         jsout.start_array();
-        for( auto &submap_addr : submap_addrs ) {
-            if( !submaps.contains( submap_addr ) ) {
-                continue;
-            }
-
-            submap *sm = submaps[submap_addr].get();
-
+        for( size_t i = 0; i < quad.size(); i++ ) {
+            submap *sm = quad[i].get();
             if( sm == nullptr ) {
                 continue;
             }
+            const tripoint submap_addr = omt_to_sm_copy( om_addr ) + point( i / 2, i % 2 );
 
             jsout.start_object();
 
@@ -208,12 +311,9 @@ void mapbuffer::save_quad( const tripoint &om_addr, std::list<tripoint> &submaps
             jsout.end_array();
 
             sm->store( jsout );
+            sm->mark_saved();
 
             jsout.end_object();
-
-            if( delete_after_save ) {
-                submaps_to_delete.push_back( submap_addr );
-            }
         }
 
         jsout.end_array();
@@ -233,12 +333,13 @@ submap *mapbuffer::unserialize_submaps( const tripoint &p )
         // If it doesn't exist, trigger generating it.
         return nullptr;
     }
-    if( !submaps.contains( p ) ) {
+    const std::unique_ptr<submap> *slot = find_slot( p );
+    if( slot == nullptr || *slot == nullptr ) {
         debugmsg( "file did not contain the expected submap %d,%d,%d",
                   p.x, p.y, p.z );
         return nullptr;
     }
-    return submaps[ p ].get();
+    return slot->get();
 }
 
 void mapbuffer::deserialize( JsonIn &jsin )
@@ -270,6 +371,11 @@ void mapbuffer::deserialize( JsonIn &jsin )
             }
         }
 
+        if( sm && version == savegame_version ) {
+            // Identical to what's on disk, until something changes it.
+            // Older versions are rewritten to get them migrated.
+            sm->mark_saved();
+        }
         if( !add_submap( submap_coordinates, sm ) ) {
             debugmsg( "submap %d,%d,%d was already loaded", submap_coordinates.x, submap_coordinates.y,
                       submap_coordinates.z );
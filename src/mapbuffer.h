@@ -2,10 +2,11 @@
 #ifndef CATA_SRC_MAPBUFFER_H
 #define CATA_SRC_MAPBUFFER_H
 
+#include <array>
 #include <list>
-#include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 
 #include "coordinates.h"
 #include "point.h"
@@ -58,20 +59,31 @@ class mapbuffer
             return lookup_submap( p.raw() );
         }
 
-    private:
-        using submap_map_t = std::map<tripoint, std::unique_ptr<submap>>;
+        /** The four submaps of one overmap terrain tile, indexed by @ref quad_index. */
+        using submap_quad = std::array<std::unique_ptr<submap>, 4>;
 
-    public:
-        submap_map_t::iterator begin() {
-            return submaps.begin();
-        }
-        submap_map_t::iterator end() {
-            return submaps.end();
-        }
+        /** Get all four submaps of an overmap terrain tile, loading them from disk if needed.
+         *
+         * @param om_addr The absolute world position in overmap terrain coordinates.
+         * @return The submaps in @ref quad_index order, entries are NULL if they are not in
+         * the mapbuffer and could not be loaded.
+         */
+        std::array<submap *, 4> lookup_quad( const tripoint &om_addr );
 
-        bool is_submap_loaded( const tripoint &p ) const {
-            return submaps.contains( p );
-        }
+        /** Position of the submap at absolute submap coordinates @p p within its quad. */
+        static size_t quad_index( const tripoint &p );
+
+        bool is_submap_loaded( const tripoint &p ) const;
+
+        struct memory_stats {
+            size_t submaps = 0;
+            // Items lying on the submaps, not counting their contents
+            size_t items = 0;
+            size_t vehicles = 0;
+        };
+        /** Counts what the buffered submaps hold.  Walks every tile, meant for reports. */
+        memory_stats get_memory_stats() const;
+        size_t num_submaps() const;
 
     private:
         // There's a very good reason this is private,
@@ -79,9 +91,20 @@ class mapbuffer
         void remove_submap( tripoint addr );
         submap *unserialize_submaps( const tripoint &p );
         void deserialize( JsonIn &jsin );
-        void save_quad( const tripoint &om_addr, std::list<tripoint> &submaps_to_delete,
-                        bool delete_after_save );
-        submap_map_t submaps;
+        /**
+         * Queues the submaps of a quad that doesn't have to be written for deletion if
+         * requested.  Returns whether the quad has to be written with @ref write_quad.
+         */
+        bool quad_needs_save( const tripoint &om_addr, const submap_quad &quad,
+                              std::list<tripoint> &submaps_to_delete, bool delete_after_save ) const;
+        /** Serializes and writes a quad, may run concurrently for different quads. */
+        static void write_quad( const tripoint &om_addr, submap_quad &quad );
+        /** Quad slot of @p p, NULL if its quad has no entry at all. */
+        std::unique_ptr<submap> *find_slot( const tripoint &p );
+        const std::unique_ptr<submap> *find_slot( const tripoint &p ) const;
+        // Submaps are generated, saved and loaded in quads, so they are stored that way as well.
+        // Keyed by the overmap terrain coordinates of the quad.
+        std::unordered_map<tripoint, submap_quad> quads;
 };
 
 extern mapbuffer MAPBUFFER;
@@ -2280,7 +2280,7 @@ class jmapgen_furniture : public jmapgen_piece
         void apply( const mapgendata &dat, const jmapgen_int &x, const jmapgen_int &y
                   ) const override {
             furn_id chosen_id = id.get( dat );
-            if( chosen_id.id().is_null() ) {
+            if( chosen_id == f_null ) {
                 return;
             }
             dat.m.furn_set( point( x.get(), y.get() ), chosen_id );
@@ -2315,16 +2315,18 @@ class jmapgen_terrain : public jmapgen_piece
         void apply( const mapgendata &dat, const jmapgen_int &x, const jmapgen_int &y
                   ) const override {
             ter_id chosen_id = id.get( dat );
-            if( chosen_id.id().is_null() ) {
+            if( chosen_id == t_null ) {
                 return;
             }
-            dat.m.ter_set( point( x.get(), y.get() ), chosen_id );
+            // Rolled once, so a random position doesn't put the wall cleanup somewhere else
+            const point p( x.get(), y.get() );
+            dat.m.ter_set( p, chosen_id );
             // Delete furniture if a wall was just placed over it. TODO: need to do anything for fluid, monsters?
-            if( dat.m.has_flag_ter( "WALL", point( x.get(), y.get() ) ) ) {
-                dat.m.furn_set( point( x.get(), y.get() ), f_null );
+            if( dat.m.has_flag_ter( TFLAG_WALL, p ) ) {
+                dat.m.furn_set( p, f_null );
                 // and items, unless the wall has PLACE_ITEM flag indicating it stores things.
-                if( !dat.m.has_flag_ter( "PLACE_ITEM", point( x.get(), y.get() ) ) ) {
-                    dat.m.i_clear( tripoint( x.get(), y.get(), dat.m.get_abs_sub().z ) );
+                if( !dat.m.has_flag_ter( "PLACE_ITEM", p ) ) {
+                    dat.m.i_clear( tripoint( p, dat.m.get_abs_sub().z ) );
                 }
             }
         }
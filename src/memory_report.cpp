@@ -0,0 +1,74 @@
+#include "memory_report.h"
+
+#include "avatar.h"
+#include "catalua.h"
+#include "game.h"
+#include "item.h"
+#include "json.h"
+#include "map_memory.h"
+#include "mapbuffer.h"
+#include "monster.h"
+#include "npc.h"
+#include "overmap.h"
+#include "overmapbuffer.h"
+#include "profile.h"
+#include "string_formatter.h"
+#include "submap.h"
+#include "vehicle.h"
+
+std::vector<memory_report::entry> memory_report::collect()
+{
+    std::vector<entry> entries;
+    const mapbuffer::memory_stats sm_stats = MAPBUFFER.get_memory_stats();
+    entries.push_back( { "submaps", sm_stats.submaps, sm_stats.submaps * sizeof( submap ) } );
+    entries.push_back( { "items on the ground", sm_stats.items, sm_stats.items * sizeof( item ) } );
+    entries.push_back( { "vehicles", sm_stats.vehicles, sm_stats.vehicles * sizeof( vehicle ) } );
+    const size_t overmaps = overmap_buffer.num_loaded();
+    entries.push_back( { "overmaps", overmaps, overmaps * sizeof( overmap ) } );
+    if( g != nullptr ) {
+        const map_memory &memory = g->u.get_map_memory();
+        entries.push_back( { "map memory submaps", memory.num_submaps(), memory.memory_usage() } );
+        const size_t monsters = g->num_creatures();
+        entries.push_back( { "creatures in the bubble", monsters, monsters * sizeof( monster ) } );
+    }
+    entries.push_back( { "lua heap", 1, cata::get_lua_memory_usage() } );
+    return entries;
+}
+
+void memory_report::serialize( JsonOut &jsout, const std::vector<entry> &entries )
+{
+    jsout.start_array();
+    for( const entry &e : entries ) {
+        jsout.start_object();
+        jsout.member( "name", e.name );
+        jsout.member( "count", e.count );
+        jsout.member( "bytes", e.bytes );
+        jsout.end_object();
+    }
+    jsout.end_array();
+}
+
+std::string memory_report::format( const std::vector<entry> &entries )
+{
+    std::string result = string_format( "%-24s %10s %10s\n", "", "count", "MiB" );
+    size_t total = 0;
+    for( const entry &e : entries ) {
+        result += string_format( "%-24s %10d %10.1f\n", e.name, e.count,
+                                 e.bytes / ( 1024.0 * 1024.0 ) );
+        total += e.bytes;
+    }
+    result += string_format( "%-24s %10s %10.1f\n", "total", "", total / ( 1024.0 * 1024.0 ) );
+    return result;
+}
+
+void memory_report::plot()
+{
+#if defined(USE_TRACY)
+    ZoneScoped;
+    TracyPlot( "Submaps", static_cast<int64_t>( MAPBUFFER.num_submaps() ) );
+    TracyPlot( "Overmaps", static_cast<int64_t>( overmap_buffer.num_loaded() ) );
+    TracyPlot( "Map memory submaps", static_cast<int64_t>( g->u.get_map_memory().num_submaps() ) );
+    TracyPlot( "Creatures", static_cast<int64_t>( g->num_creatures() ) );
+    TracyPlot( "Lua heap", static_cast<int64_t>( cata::get_lua_memory_usage() ) );
+#endif
+}
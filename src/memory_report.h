@@ -0,0 +1,40 @@
+#pragma once
+#ifndef CATA_SRC_MEMORY_REPORT_H
+#define CATA_SRC_MEMORY_REPORT_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+class JsonOut;
+
+/**
+ * Rough accounting of what the big game containers hold.
+ *
+ * Byte counts come from object sizes and the arrays the objects own, heap data deeper
+ * down (item names, vehicle parts, ...) is not followed.  They are meant to show which
+ * subsystem grows, not to add up to the process size.  The Lua heap is exact.
+ */
+namespace memory_report
+{
+
+struct entry {
+    std::string name;
+    size_t count = 0;
+    // 0 if unknown
+    size_t bytes = 0;
+};
+
+/** Counts everything, walks all buffered submaps.  Meant for on demand reports. */
+std::vector<entry> collect();
+
+void serialize( JsonOut &jsout, const std::vector<entry> &entries );
+/** Human readable table of @p entries. */
+std::string format( const std::vector<entry> &entries );
+
+/** Plots the cheap counters in Tracy.  Does nothing in builds without Tracy. */
+void plot();
+
+} // namespace memory_report
+
+#endif // CATA_SRC_MEMORY_REPORT_H
@@ -189,12 +189,12 @@ class messages_impl
                 return;
             }
 
-            unsigned int message_limit = get_option<int>( "MESSAGE_LIMIT" );
-            while( messages.size() > message_limit ) {
+            static const option_handle<int> message_limit( "MESSAGE_LIMIT" );
+            while( messages.size() > static_cast<size_t>( message_limit.get() ) ) {
                 messages.pop_front();
             }
 
-            messages.emplace_back( m );
+            messages.emplace_back( std::move( m ) );
         }
 
         /** Check if the current message needs to be prevented (hidden) or not from being displayed in the side bar.
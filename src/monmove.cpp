@@ -81,7 +81,7 @@ enum {
     MONSTER_FOLLOW_DIST = 8
 };
 
-bool monster::wander()
+bool monster::wander() const
 {
     return ( goal == pos() );
 }
@@ -347,6 +347,16 @@ void monster::plan()
     bool swarms = has_flag( MF_SWARMS );
     auto mood = attitude();
 
+    // Monsters can't see further than their best vision range, so only the ones within
+    // it can ever be rated as targets.  Collecting them through the spatial index keeps
+    // large mixed hordes from having to rate every other monster.
+    static const mfaction_str_id playerfaction( "player" );
+    const auto faction_of = []( const monster & mon ) {
+        return mon.friendly == 0 ? mon.faction : playerfaction.id();
+    };
+    const std::vector<monster *> nearby = g->critter_tracker->find_in_radius( pos(),
+                                          std::max( max_sight_range, 1 ) );
+
     // If we can see the player, move toward them or flee, simpleminded animals are too dumb to follow the player.
     if( friendly == 0 && sees( g->u ) && !waiting ) {
         dist = rate_target( g->u, dist, smart_planning );
@@ -391,11 +401,11 @@ void monster::plan()
             }
         }
     } else if( friendly != 0 && !docile && !waiting ) {
-        for( monster &tmp : g->all_monsters() ) {
-            if( tmp.friendly == 0 ) {
-                float rating = rate_target( tmp, dist, smart_planning );
+        for( monster *tmp : nearby ) {
+            if( tmp->friendly == 0 ) {
+                float rating = rate_target( *tmp, dist, smart_planning );
                 if( rating < dist ) {
-                    target = &tmp;
+                    target = tmp;
                     dist = rating;
                 }
             }
@@ -457,35 +467,29 @@ void monster::plan()
 
     fleeing = fleeing || ( mood == MATT_FLEE );
     if( friendly == 0 ) {
-        for( const auto &fac : factions ) {
-            auto faction_att = faction.obj().attitude( fac.first );
+        for( monster *candidate : nearby ) {
+            auto faction_att = faction.obj().attitude( faction_of( *candidate ) );
             if( faction_att == MFA_NEUTRAL || faction_att == MFA_FRIENDLY ) {
                 continue;
             }
 
-            for( const weak_ptr_fast<monster> &weak : fac.second ) {
-                const shared_ptr_fast<monster> shared = weak.lock();
-                if( !shared ) {
-                    continue;
-                }
-                monster &mon = *shared;
-                float rating = rate_target( mon, dist, smart_planning );
-                if( rating == dist ) {
-                    ++valid_targets;
-                    if( one_in( valid_targets ) ) {
-                        target = &mon;
-                    }
-                }
-                if( rating < dist ) {
+            monster &mon = *candidate;
+            float rating = rate_target( mon, dist, smart_planning );
+            if( rating == dist ) {
+                ++valid_targets;
+                if( one_in( valid_targets ) ) {
                     target = &mon;
-                    dist = rating;
-                    valid_targets = 1;
-                }
-                if( rating <= 5 ) {
-                    anger += angers_hostile_near;
-                    morale -= fears_hostile_near;
                 }
             }
+            if( rating < dist ) {
+                target = &mon;
+                dist = rating;
+                valid_targets = 1;
+            }
+            if( rating <= 5 ) {
+                anger += angers_hostile_near;
+                morale -= fears_hostile_near;
+            }
         }
     }
 
@@ -502,12 +506,11 @@ void monster::plan()
     }
     swarms = swarms && target == nullptr; // Only swarm if we have no target
     if( group_morale || swarms ) {
-        for( const weak_ptr_fast<monster> &weak : myfaction_iter->second ) {
-            const shared_ptr_fast<monster> shared = weak.lock();
-            if( !shared ) {
+        for( monster *ally : nearby ) {
+            if( faction_of( *ally ) != mfaction_id( actual_faction ) ) {
                 continue;
             }
-            monster &mon = *shared;
+            monster &mon = *ally;
             float rating = rate_target( mon, dist, smart_planning );
             if( group_morale && rating <= 10 ) {
                 morale += 10 - rating;
@@ -712,7 +715,7 @@ void monster::move()
     behavior::monster_oracle_t oracle( this );
     behavior::tree goals;
     goals.add( type->get_goals() );
-    std::string action = goals.tick( &oracle );
+    const std::string &action = goals.tick( &oracle );
     //The monster can consume objects it stands on. Check if there are any.
     //If there are. Consume them.
     // TODO: Stick this in a map and dispatch to it via the action string.
@@ -893,7 +896,10 @@ void monster::move()
             if( pf_settings.max_dist >= rl_dist( pos(), goal ) &&
                 ( path.empty() || rl_dist( pos(), path.front() ) >= 2 || path.back() != goal ) ) {
                 // We need a new path
-                path = g->m.route( pos(), goal, pf_settings, get_path_avoid() );
+                // Hordes tend to chase the same target, so let them share the search
+                const std::set<tripoint> path_avoid = get_path_avoid();
+                path = path_avoid.empty() ? g->m.route_shared( pos(), goal, pf_settings ) :
+                       g->m.route( pos(), goal, pf_settings, path_avoid );
             }
 
             // Try to respect old paths, even if we can't pathfind at the moment
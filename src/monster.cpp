@@ -65,6 +65,8 @@
 #include "weather.h"
 #include "profile.h"
 
+static const option_handle<float> monster_upgrade_factor( "MONSTER_UPGRADE_FACTOR" );
+
 static const ammo_effect_str_id ammo_effect_WHIP( "WHIP" );
 
 static const efftype_id effect_attention( "attention" );
@@ -365,7 +367,7 @@ void monster::poly( const mtype_id &id )
 
 bool monster::can_upgrade() const
 {
-    return upgrades && get_option<float>( "MONSTER_UPGRADE_FACTOR" ) > 0.0;
+    return upgrades && monster_upgrade_factor.get() > 0.0;
 }
 
 // For master special attack.
@@ -375,7 +377,7 @@ void monster::hasten_upgrade()
         return;
     }
 
-    const int scaled_half_life = type->half_life * get_option<float>( "MONSTER_UPGRADE_FACTOR" );
+    const int scaled_half_life = type->half_life * monster_upgrade_factor.get();
     upgrade_time -= rng( 1, scaled_half_life );
     if( upgrade_time < 0 ) {
         upgrade_time = 0;
@@ -400,7 +402,7 @@ int monster::next_upgrade_time()
     if( type->age_grow > 0 ) {
         return type->age_grow;
     }
-    const int scaled_half_life = type->half_life * get_option<float>( "MONSTER_UPGRADE_FACTOR" );
+    const int scaled_half_life = type->half_life * monster_upgrade_factor.get();
     int day = 1; // 1 day of guaranteed evolve time
     for( int i = 0; i < UPGRADE_MAX_ITERS; i++ ) {
         if( one_in( 2 ) ) {
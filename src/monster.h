@@ -192,7 +192,7 @@ class monster : public Creature, public location_visitable<monster>
         void shift( point sm_shift ); // Shifts the monster to the appropriate submap
         void set_goal( const tripoint &p );
         // Updates current pos AND our plans
-        bool wander(); // Returns true if we have no plans
+        bool wander() const; // Returns true if we have no plans
 
         /**
          * Checks whether we can move to/through p. This does not account for bashing.
@@ -488,6 +488,8 @@ class monster : public Creature, public location_visitable<monster>
         // TEMP VALUES
         tripoint wander_pos; // Wander destination - Just try to move in that direction
         int wandf;           // Urge to wander - Increased by sound, decrements each move
+        // Earliest turn of the next plan for idle monsters far away from the player
+        time_point next_plan = calendar::before_time_starts;
 
 
         Character *mounted_player = nullptr; // player that is mounting this creature
@@ -24,7 +24,9 @@ status_t monster_oracle_t::not_hallucination() const
 
 status_t monster_oracle_t::items_available() const
 {
-    if( !get_map().has_flag( TFLAG_SEALED, subject->pos() ) && get_map().has_items( subject->pos() ) ) {
+    const map &here = get_map();
+    // Most tiles have no items, that's the cheaper check
+    if( here.has_items( subject->pos() ) && !here.has_flag( TFLAG_SEALED, subject->pos() ) ) {
         return running;
     }
     return failure;
@@ -282,7 +282,7 @@ void input_manager::pump_events()
     previously_pressed_key = 0;
 }
 
-input_event input_manager::get_input_event()
+input_event input_manager::get_platform_input_event()
 {
     int key = ERR;
     input_event rval;
@@ -1928,12 +1928,58 @@ healing_options npc::has_healing_options()
     return has_healing_options( try_to_fix );
 }
 
+bool npc_item_index::has_ammo_for( const item &it ) const
+{
+    const std::set<ammotype> &wanted = it.ammo_types();
+    // Things without ammo types may still be reloaded with other items
+    return wanted.empty() || std::any_of( wanted.begin(), wanted.end(),
+    [this]( const ammotype & at ) {
+        return ammo.count( at ) > 0;
+    } );
+}
+
+const npc_item_index &npc::carried_items()
+{
+    if( item_index.built == calendar::turn &&
+        get_npc_ai_info_cache( npc_ai_info::carried_items ) >= 0.0 ) {
+        return item_index;
+    }
+    npc_item_index &index = item_index;
+    index.ammo.clear();
+    index.healing.clear_all();
+    visit_items( [&index]( item * node ) {
+        if( node->is_ammo() ) {
+            index.ammo.insert( node->ammo_type() );
+        }
+        const auto use = node->type->get_use( "heal" );
+        if( use != nullptr ) {
+            const heal_actor &actor = dynamic_cast<const heal_actor &>( *use->get_actor_ptr() );
+            index.healing.bandage |= actor.bandages_power > 0.0f;
+            index.healing.disinfect |= actor.disinfectant_power > 0.0f;
+            index.healing.bleed |= actor.bleed > 0;
+            index.healing.bite |= actor.bite > 0;
+            index.healing.infect |= actor.infect > 0;
+        }
+        return VisitResponse::NEXT;
+    } );
+    index.built = calendar::turn;
+    set_npc_ai_info_cache( npc_ai_info::carried_items, 1.0 );
+    return index;
+}
+
 healing_options npc::has_healing_options( healing_options try_to_fix )
 {
     healing_options can_fix;
     can_fix.clear_all();
     healing_options *fix_p = &can_fix;
 
+    const healing_options &carried = carried_items().healing;
+    if( !( try_to_fix.bandage && carried.bandage ) && !( try_to_fix.disinfect && carried.disinfect ) &&
+        !( try_to_fix.bleed && carried.bleed ) && !( try_to_fix.bite && carried.bite ) &&
+        !( try_to_fix.infect && carried.infect ) ) {
+        return can_fix;
+    }
+
     visit_items( [&fix_p, try_to_fix]( item * node ) {
         const auto use = node->type->get_use( "heal" );
         if( use == nullptr ) {
@@ -482,6 +482,21 @@ struct healing_options {
     bool all_false();
 };
 
+/**
+ * Summary of what an NPC carries, for quick "definitely don't have it" answers.
+ * Built by one visit of all items, at most once per turn and again after items are added.
+ * Items may be used up in the meantime, so a positive answer still needs a real search.
+ */
+struct npc_item_index {
+    // Types of all ammo, including ammo in magazines and containers
+    std::set<ammotype> ammo;
+    // What the carried healing items can fix
+    healing_options healing;
+    time_point built = calendar::before_time_starts;
+
+    bool has_ammo_for( const item &it ) const;
+};
+
 // Data relevant only for this action
 struct npc_short_term_cache {
     float danger = 0;
@@ -909,6 +924,9 @@ class npc : public player
         bool has_artifact_with( const art_effect_passive ) const override {
             return false;
         }
+        enum_bitset<art_effect_passive> passive_artifact_effects() const override {
+            return {};
+        }
         /** Is the item safe or does the NPC trust you enough? */
         bool will_accept_from_player( const item &it ) const;
 
@@ -1215,6 +1233,8 @@ class npc : public player
         std::map<std::string, time_point> complaints;
 
         npc_short_term_cache ai_cache;
+        npc_item_index item_index;
+        const npc_item_index &carried_items();
 
         std::map<npc_need, npc_need_goal_cache> goal_cache;
     public:
@@ -437,6 +437,10 @@ void npc::assess_danger()
         }
     }
 
+    // Everything below checks sight from here, and monsters check theirs to us.  One shared
+    // field of view answers both, and stays valid for every NPC until the map cache changes.
+    here.share_fov( pos() );
+
     // find our Character friends and enemies
     std::vector<weak_ptr_fast<Creature>> hostile_guys;
     for( const npc &guy : g->all_npcs() ) {
@@ -1502,8 +1506,9 @@ item &npc::find_reloadable()
     // TODO: Cache items checked for reloading to avoid re-checking same items every turn
     // TODO: Make it understand smaller and bigger magazines
     item *reloadable = nullptr;
-    visit_items( [this, &reloadable]( item * node ) {
-        if( !wants_to_reload( *this, *node ) ) {
+    const npc_item_index &carried = carried_items();
+    visit_items( [this, &reloadable, &carried]( item * node ) {
+        if( !carried.has_ammo_for( *node ) || !wants_to_reload( *this, *node ) ) {
             return VisitResponse::NEXT;
         }
         const auto it_loc = character_funcs::select_ammo( *this, *node ).ammo;
@@ -1539,7 +1544,7 @@ bool npc::can_reload_current()
 
 item *npc::find_usable_ammo( item &weap )
 {
-    if( !can_reload( weap ) ) {
+    if( !can_reload( weap ) || !carried_items().has_ammo_for( weap ) ) {
         return nullptr;
     }
 
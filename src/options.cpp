@@ -10,6 +10,7 @@
 #include "cached_item_options.h"
 #include "cata_utility.h"
 #include "catacharset.h"
+#include "catalua.h"
 #include "color.h"
 #include "cursesdef.h"
 #include "cursesport.h"
@@ -31,9 +32,11 @@
 #include "sdlsound.h"
 #include "sdltiles.h"
 #include "sounds.h"
+#include "stall_watchdog.h"
 #include "string_formatter.h"
 #include "string_input_popup.h"
 #include "string_utils.h"
+#include "thread_pool.h"
 #include "translations.h"
 #include "ui_manager.h"
 #include "worldfactory.h"
@@ -878,6 +881,7 @@ int options_manager::cOpt::getMaxLength() const
 //set to next item
 void options_manager::cOpt::setNext()
 {
+    values_changed();
     if( sType == "string_select" ) {
         int iNext = getItemPos( sSet ) + 1;
         if( iNext >= static_cast<int>( vItems.size() ) ) {
@@ -921,6 +925,7 @@ void options_manager::cOpt::setNext()
 //set to previous item
 void options_manager::cOpt::setPrev()
 {
+    values_changed();
     if( sType == "string_select" ) {
         int iPrev = getItemPos( sSet ) - 1;
         if( iPrev < 0 ) {
@@ -959,6 +964,7 @@ void options_manager::cOpt::setPrev()
 //set value
 void options_manager::cOpt::setValue( float fSetIn )
 {
+    values_changed();
     if( sType != "float" ) {
         debugmsg( "tried to set a float value to a %s option", sType );
         return;
@@ -972,6 +978,7 @@ void options_manager::cOpt::setValue( float fSetIn )
 //set value
 void options_manager::cOpt::setValue( int iSetIn )
 {
+    values_changed();
     if( sType != "int" ) {
         debugmsg( "tried to set an int value to a %s option", sType );
         return;
@@ -985,6 +992,7 @@ void options_manager::cOpt::setValue( int iSetIn )
 //set value
 void options_manager::cOpt::setValue( const std::string &sSetIn )
 {
+    values_changed();
     if( sType == "string_select" ) {
         if( getItemPos( sSetIn ) != -1 ) {
             sSet = sSetIn;
@@ -1422,6 +1430,16 @@ void options_manager::add_options_general()
 
     get_option( "AUTOSAVE_MINUTES" ).setPrerequisite( "AUTOSAVE" );
 
+    add( "ASYNC_SAVE", general, translate_marker( "Save in the background" ),
+         translate_marker( "If true, autosaves and quicksaves of worlds using the compressed save format are written to disk in the background while the game continues." ),
+         true
+       );
+
+    add( "SAVE_COMPRESSION", general, translate_marker( "Save compression" ),
+         translate_marker( "How map and player data of worlds using the compressed save format is compressed.  Uncompressed saves are larger, but load faster.  Already saved data is read back whatever it was saved with." ),
+    { { "zlib", translate_marker( "zlib" ) }, { "none", translate_marker( "None" ) } }, "zlib"
+       );
+
     add_empty_line();
 
     add( "AUTO_NOTES", general, translate_marker( "Auto notes" ),
@@ -1504,6 +1522,13 @@ void options_manager::add_options_general()
        );
 
     get_option( "AMBIENT_SOUND_VOLUME" ).setPrerequisite( "SOUND_ENABLED" );
+
+    add( "SOUND_EFFECT_CACHE_SIZE", general, translate_marker( "Sound effect cache size" ),
+         translate_marker( "Megabytes of decoded sound effects kept in memory.  Sounds are loaded when first played, the least recently played ones are unloaded once this is exceeded.  Sounds preloaded by the soundpack are always kept.  0 means no limit." ),
+         0, 4096, 256, COPT_NO_SOUND_HIDE
+       );
+
+    get_option( "SOUND_EFFECT_CACHE_SIZE" ).setPrerequisite( "SOUND_ENABLED" );
 }
 
 void options_manager::add_options_interface()
@@ -2159,6 +2184,11 @@ void options_manager::add_options_debug()
          true
        );
 
+    add( "CHECK_DATA_ON_LOAD", debug, translate_marker( "Check data on load" ),
+         translate_marker( "If true, the consistency of all game data is verified every time a world is loaded.  Disable to load faster if the installed data and mods are known to be good.  The --check-mods command line mode always verifies it." ),
+         true
+       );
+
     add( "FORCE_TILESET_RELOAD", debug, translate_marker( "Force tileset reload" ),
          translate_marker( "If false, the game will keep tileset in memory after first load to speed up subsequent loadings of game data.  Enable this if you're working on a tileset for the game or a mod." ),
          false
@@ -2261,6 +2291,51 @@ void options_manager::add_options_debug()
 
     get_option( "FOV_3D_Z_RANGE" ).setPrerequisite( "FOV_3D" );
 
+    add( "WORKER_THREADS", debug, translate_marker( "Worker threads" ),
+         translate_marker( "Number of additional threads used to rebuild map caches of different z-levels in parallel.  0 keeps all work on the main thread.  Results are identical either way, only speed differs." ),
+         0, 32, 0
+       );
+
+    add( "STALL_WATCHDOG_MS", debug, translate_marker( "Stall report threshold" ),
+         translate_marker( "When the game takes longer than this many milliseconds to react to an input, a background thread writes what the game was doing to stall_report.txt in the config directory.  0 disables it." ),
+         0, 10000, 0
+       );
+
+    add( "LUA_GC_STEP_KB", debug, translate_marker( "Lua garbage collection step" ),
+         translate_marker( "Kilobytes of Lua garbage collection work done at the end of every turn, instead of whenever a script happens to allocate memory.  0 leaves collection to Lua." ),
+         0, 65536, 0
+       );
+
+    add( "LUA_GC_FULL_MB", debug, translate_marker( "Lua full collection threshold" ),
+         translate_marker( "When the Lua heap grows beyond this many megabytes between turns, all Lua garbage is collected at once.  Only used with a Lua garbage collection step above 0." ),
+         1, 4096, 128
+       );
+
+    add( "MONSTER_AI_LOD_DISTANCE", debug, translate_marker( "Reduced monster AI distance" ),
+         translate_marker( "Monsters further away from the player than this that aren't fighting anything only make new plans every few turns, in between they keep following their old plans.  0 makes every monster plan every turn." ),
+         0, MAPSIZE_X, 0
+       );
+
+    add( "MONSTER_AI_LOD_INTERVAL", debug, translate_marker( "Reduced monster AI interval" ),
+         translate_marker( "How many turns apart monsters with reduced AI make new plans." ),
+         2, 10, 4
+       );
+
+    add( "MONSTER_AI_BUDGET", debug, translate_marker( "Monster AI time budget" ),
+         translate_marker( "Milliseconds per turn that monsters with reduced AI may spend planning.  Once it's used up, their remaining plans move to the next turns.  Monsters close to the player or fighting always plan.  0 means no limit." ),
+         0, 100, 0
+       );
+
+    add( "FIELD_LOD_DISTANCE", debug, translate_marker( "Reduced field simulation distance" ),
+         translate_marker( "Fields on submaps at least this many submaps away from the one of the player are only processed every few turns.  They age by the skipped turns, but spread and burn less often.  0 processes every field every turn." ),
+         0, HALF_MAPSIZE, 0
+       );
+
+    add( "FIELD_LOD_INTERVAL", debug, translate_marker( "Reduced field simulation interval" ),
+         translate_marker( "How many turns apart fields with reduced simulation are processed." ),
+         2, 10, 4
+       );
+
     add( "ENABLE_EVENTS", debug, translate_marker( "Event bus system" ),
          translate_marker( "If false, achievements and some Magiclysm functionality won't work, but performance will be better." ),
          true
@@ -3322,6 +3397,7 @@ std::string options_manager::show( bool ingame, const bool world_options_only,
             if( ingame && world_options_changed ) {
                 ACTIVE_WORLD_OPTIONS = WOPTIONS_OLD;
             }
+            values_changed();
         }
     }
 
@@ -3417,6 +3493,7 @@ std::string options_manager::migrateOptionValue( const std::string &name,
 
 void options_manager::cache_to_globals()
 {
+    values_changed();
     enum_bitset<DL> levels;
     levels.set( DL::Error );
     for( const debug_log_level &e : debug_log_levels ) {
@@ -3448,6 +3525,10 @@ void options_manager::cache_to_globals()
     fov_3d_z_range = ::get_option<int>( "FOV_3D_Z_RANGE" );
     static_z_effect = ::get_option<bool>( "STATICZEFFECT" );
     PICKUP_RANGE = ::get_option<int>( "PICKUP_RANGE" );
+    get_thread_pool().resize( ::get_option<int>( "WORKER_THREADS" ) );
+    stall_watchdog::set_threshold( ::get_option<int>( "STALL_WATCHDOG_MS" ) );
+    cata::set_lua_gc_budget( ::get_option<int>( "LUA_GC_STEP_KB" ),
+                             ::get_option<int>( "LUA_GC_FULL_MB" ) );
 
     merge_comestible_mode = ( [] {
         const auto opt = ::get_option<std::string>( "MERGE_COMESTIBLES" );
@@ -3540,6 +3621,7 @@ options_manager::options_container options_manager::get_world_defaults() const
 
 void options_manager::set_world_options( options_container *options )
 {
+    values_changed();
     if( options == nullptr ) {
         world_options.reset();
     } else {
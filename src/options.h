@@ -47,6 +47,14 @@ class options_manager
         friend options_manager &get_options();
         options_manager();
 
+        /** Bumped whenever any option value may have changed, see @ref option_handle. */
+        inline static unsigned int values_version = 1;
+        template<typename T>
+        friend class option_handle;
+        static void values_changed() {
+            values_version++;
+        }
+
         void addOptionToPage( const std::string &name, const std::string &page );
         void cache_to_globals(); // cache some options to globals due to heavy usage
 
@@ -371,4 +379,34 @@ inline T get_option( const std::string &name )
     return get_options().get_option( name ).value_as<T>();
 }
 
+/**
+ * Typed access to an option for code that reads it often. The value is looked up by name
+ * only on first use and after some option changed, every other read is a version check.
+ *
+ *     static const option_handle<bool> item_health_bar( "ITEM_HEALTH_BAR" );
+ *     if( item_health_bar ) { ... }
+ */
+template<typename T>
+class option_handle
+{
+    public:
+        explicit option_handle( const std::string &name ) : name( name ) {}
+
+        const T &get() const {
+            if( version != options_manager::values_version ) {
+                value = ::get_option<T>( name );
+                version = options_manager::values_version;
+            }
+            return value;
+        }
+        operator const T &() const {
+            return get();
+        }
+
+    private:
+        std::string name;
+        mutable T value = T();
+        mutable unsigned int version = 0;
+};
+
 #endif // CATA_SRC_OPTIONS_H
@@ -65,13 +65,10 @@ int OVERMAP_LEGEND_WIDTH;
 scrollingcombattext SCT;
 
 // utf8 version
-std::vector<std::string> foldstring( const std::string &str, int width, const char split )
+static std::vector<std::string> fold_uncached( const std::string &str, int width,
+        const char split )
 {
     std::vector<std::string> lines;
-    if( width < 1 ) {
-        lines.push_back( str );
-        return lines;
-    }
     std::stringstream sstr( str );
     std::string strline;
     std::vector<std::string> tags;
@@ -128,6 +125,40 @@ std::vector<std::string> foldstring( const std::string &str, int width, const ch
     return lines;
 }
 
+namespace
+{
+struct folded_text {
+    std::string text;
+    int width = 0;
+    char split = ' ';
+    std::vector<std::string> lines;
+};
+} // namespace
+
+std::vector<std::string> foldstring( const std::string &str, int width, const char split )
+{
+    if( width < 1 ) {
+        return { str };
+    }
+    // Menus and info panels fold the same few texts again on every redraw.
+    // Remember the most recent results, comparing the text is much cheaper than folding it.
+    static constexpr size_t fold_cache_size = 16;
+    static thread_local std::array<folded_text, fold_cache_size> cache;
+    static thread_local size_t next_slot = 0;
+    for( const folded_text &entry : cache ) {
+        if( entry.width == width && entry.split == split && entry.text == str ) {
+            return entry.lines;
+        }
+    }
+    folded_text &entry = cache[next_slot];
+    next_slot = ( next_slot + 1 ) % fold_cache_size;
+    entry.text = str;
+    entry.width = width;
+    entry.split = split;
+    entry.lines = fold_uncached( str, width, split );
+    return entry.lines;
+}
+
 std::vector<std::string> split_by_color( const std::string &s )
 {
     std::vector<std::string> ret;
@@ -149,12 +180,13 @@ std::string remove_color_tags( const std::string &s )
     size_t next_pos = 0;
 
     if( !tag_positions.empty() ) {
+        ret.reserve( s.size() );
         for( size_t tag_position : tag_positions ) {
-            ret += s.substr( next_pos, tag_position - next_pos );
-            next_pos = s.find( ">", tag_position, 1 ) + 1;
+            ret.append( s, next_pos, tag_position - next_pos );
+            next_pos = s.find( '>', tag_position ) + 1;
         }
 
-        ret += s.substr( next_pos, std::string::npos );
+        ret.append( s, next_pos, std::string::npos );
     } else {
         return s;
     }
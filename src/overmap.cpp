@@ -7,6 +7,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <climits>
 #include <cmath>
 #include <cstring>
 #include <exception>
@@ -15,6 +16,7 @@
 #include <optional>
 #include <ostream>
 #include <set>
+#include <sstream>
 #include <unordered_set>
 #include <vector>
 
@@ -2587,7 +2589,7 @@ int overmap_special::longest_side() const
 {
     // Figure out the longest side of the special for purposes of determining our sector size
     // when attempting placements.
-    std::vector<overmap_special_locations> req_locations = required_locations();
+    const std::vector<overmap_special_locations> &req_locations = required_locations();
     auto min_max_x = std::minmax_element( req_locations.begin(), req_locations.end(),
     []( const overmap_special_locations & lhs, const overmap_special_locations & rhs ) {
         return lhs.p.x < rhs.p.x;
@@ -2636,10 +2638,11 @@ std::vector<overmap_special_terrain> overmap_special::preview_terrains() const
     return result;
 }
 
-std::vector<overmap_special_locations> overmap_special::required_locations() const
+const std::vector<overmap_special_locations> &overmap_special::required_locations() const
 {
-    // TODO: It's called a lot during mapgen, and should probably be cached
-    // instead of making thousands of copies
+    if( required_locations_ ) {
+        return *required_locations_;
+    }
     std::vector<overmap_special_locations> result = data_->required_locations();
 
     for( const auto &nested : get_nested_specials() ) {
@@ -2649,7 +2652,8 @@ std::vector<overmap_special_locations> overmap_special::required_locations() con
             result.push_back( rel_loc );
         }
     }
-    return result;
+    required_locations_ = std::move( result );
+    return *required_locations_;
 }
 
 
@@ -2776,6 +2780,8 @@ void overmap_special::finalize()
 {
     const_cast<overmap_special_data &>( *data_ ).finalize(
         "overmap special " + id.str(), default_locations_ );
+    // Finalizing fills in the default locations
+    required_locations_.reset();
 
     for( auto &elem : connections ) {
         elem.finalize();
@@ -3821,9 +3827,15 @@ void overmap::move_hordes()
 */
 void overmap::signal_hordes( const tripoint_rel_sm &p_rel, const int sig_power )
 {
+    if( sig_power < 0 ) {
+        return;
+    }
     tripoint_om_sm p( p_rel.raw() );
-    for( auto &elem : zg ) {
-        mongroup &mg = elem.second;
+    // Groups are ordered by x first, none outside of this strip can be in range
+    const auto first = zg.lower_bound( tripoint_om_sm( p.x() - sig_power, INT_MIN, INT_MIN ) );
+    const auto last = zg.upper_bound( tripoint_om_sm( p.x() + sig_power, INT_MAX, INT_MAX ) );
+    for( auto it = first; it != last; ++it ) {
+        mongroup &mg = it->second;
         if( !mg.horde ) {
             continue;
         }
@@ -4084,7 +4096,8 @@ void overmap::place_forests()
     const oter_id forest( "forest" );
     const oter_id forest_thick( "forest_thick" );
 
-    const om_noise::om_noise_layer_forest f( global_base_point(), g->get_seed() );
+    const om_noise::om_noise_layer_forest forest_noise( global_base_point(), g->get_seed() );
+    const om_noise::om_noise_grid f( forest_noise );
 
     for( int x = 0; x < OMAPX; x++ ) {
         for( int y = 0; y < OMAPY; y++ ) {
@@ -4111,7 +4124,9 @@ void overmap::place_forests()
 
 void overmap::place_lakes()
 {
-    const om_noise::om_noise_layer_lake f( global_base_point(), g->get_seed() );
+    const om_noise::om_noise_layer_lake lake_noise( global_base_point(), g->get_seed() );
+    // The flood fill leaves the overmap, the grid falls back to the layer there
+    const om_noise::om_noise_grid f( lake_noise );
 
     const auto is_lake = [&]( const point_om_omt & p ) {
         return f.noise_at( p ) > settings->overmap_lake.noise_threshold_lake;
@@ -4432,7 +4447,8 @@ void overmap::place_swamps()
     const oter_id forest_water( "forest_water" );
 
     // Get a layer of noise to use in conjunction with our river buffered floodplain.
-    const om_noise::om_noise_layer_floodplain f( global_base_point(), g->get_seed() );
+    const om_noise::om_noise_layer_floodplain floodplain_noise( global_base_point(), g->get_seed() );
+    const om_noise::om_noise_grid f( floodplain_noise );
 
     for( int x = 0; x < OMAPX; x++ ) {
         for( int y = 0; y < OMAPY; y++ ) {
@@ -4742,10 +4758,17 @@ void overmap::place_building( const tripoint_om_omt &p, om_direction::type dir,
 
     const int town_dist = ( trig_dist( building_pos.xy(), town.pos ) * 100 ) / std::max( town.size, 1 );
 
+    // Houses come up again and again, a building that didn't fit won't fit on the next try
+    std::vector<overmap_special_id> rejected;
     for( size_t retries = 10; retries > 0; --retries ) {
         const overmap_special_id building_tid = pick_random_building_to_place( town_dist );
+        if( std::find( rejected.begin(), rejected.end(), building_tid ) != rejected.end() ) {
+            continue;
+        }
 
-        if( can_place_special( *building_tid, building_pos, building_dir, false ) ) {
+        if( !can_place_special( *building_tid, building_pos, building_dir, false ) ) {
+            rejected.push_back( building_tid );
+        } else {
             place_special( *building_tid, building_pos, building_dir, town, false, false );
             break;
         }
@@ -5507,7 +5530,7 @@ bool overmap::can_place_special( const overmap_special &special, const tripoint_
         return false;
     }
 
-    const std::vector<overmap_special_locations> fixed_terrains = special.required_locations();
+    const std::vector<overmap_special_locations> &fixed_terrains = special.required_locations();
 
     return std::all_of( fixed_terrains.begin(), fixed_terrains.end(),
     [&]( const overmap_special_locations & elem ) {
@@ -5743,30 +5766,61 @@ int overmap::place_special_attempt( const overmap_special &special, const int ma
         max_per_city = std::ceil( static_cast<float>( max ) / valid_cities );
     }
 
+    // The origin doesn't move with rotation, so points where it can't go are rejected
+    // before trying every rotation.  Most points share a handful of terrains.
+    std::vector<const overmap_special_locations *> origin_locations;
+    for( const overmap_special_locations &loc : special.required_locations() ) {
+        if( loc.p == tripoint_zero ) {
+            origin_locations.push_back( &loc );
+        }
+    }
+    std::unordered_map<oter_id, bool> origin_fits;
+    const auto origin_fits_at = [&]( const tripoint_om_omt & p ) {
+        const oter_id &tid = ter( p );
+        auto iter = origin_fits.find( tid );
+        if( iter == origin_fits.end() ) {
+            const bool fits = std::all_of( origin_locations.begin(), origin_locations.end(),
+            [&tid]( const overmap_special_locations * loc ) {
+                return loc->can_be_placed_on( tid );
+            } );
+            iter = origin_fits.emplace( tid, fits ).first;
+        }
+        return iter->second;
+    };
+
     int placed = 0;
     for( auto p = points.begin(); p != points.end(); ) {
-        const city &nearest_city = get_nearest_city( *p );
-
         // City check is the fastest => it goes first.
+        const city *nearest_city = nullptr;
         if( need_city ) {
-            if( !valid_city.contains( &nearest_city ) ||
-                valid_city[&nearest_city] >= max_per_city ||
-                !special.can_belong_to_city( *p, nearest_city ) ) {
+            nearest_city = &get_nearest_city( *p );
+            if( !valid_city.contains( nearest_city ) ||
+                valid_city[nearest_city] >= max_per_city ||
+                !special.can_belong_to_city( *p, *nearest_city ) ) {
                 p++;
                 continue;
             }
         }
 
+        // Underground origins may also go on the default terrain, leave those to the full check
+        if( p->z() == 0 && !origin_fits_at( *p ) ) {
+            p++;
+            continue;
+        }
+
         // See if we can actually place the special there.
         const auto rotation = random_special_rotation( special, *p, must_be_unexplored );
         if( rotation == om_direction::type::invalid ) {
             p++;
             continue;
         }
-        std::vector<tripoint_om_omt> result = place_special( special, *p, rotation, nearest_city, false,
-                                              must_be_unexplored );
+        if( nearest_city == nullptr ) {
+            nearest_city = &get_nearest_city( *p );
+        }
+        std::vector<tripoint_om_omt> result = place_special( special, *p, rotation, *nearest_city,
+                                              false, must_be_unexplored );
         if( need_city ) {
-            valid_city[&nearest_city]++;
+            valid_city[nearest_city]++;
         }
 
         // Remove all used points from our candidates list
@@ -6125,14 +6179,38 @@ void overmap::open( overmap_special_batch &enabled_specials )
 }
 
 // Note: this may throw io errors from std::ofstream
+// Serializes in memory first and only calls write if the data differs from what was
+// written last time. Most loaded overmaps don't change between saves.
+static void write_if_changed( size_t &saved_hash, file_write_fn serializer,
+                              const std::function<bool( file_write_fn )> &write )
+{
+    std::ostringstream buffer;
+    serializer( buffer );
+    const std::string data = buffer.str();
+    const size_t hash = std::hash<std::string>()( data );
+    if( hash == saved_hash ) {
+        return;
+    }
+    const auto write_data = [&data]( std::ostream & stream ) {
+        stream << data;
+    };
+    if( write( write_data ) ) {
+        saved_hash = hash;
+    }
+}
+
 void overmap::save() const
 {
-    g->get_active_world()->write_overmap_player_visibility( loc, [&]( std::ostream & stream ) {
+    world *w = g->get_active_world();
+    write_if_changed( saved_view_hash, [this]( std::ostream & stream ) {
         serialize_view( stream );
+    }, [this, w]( file_write_fn writer ) {
+        return w->write_overmap_player_visibility( loc, writer );
     } );
-
-    g->get_active_world()->write_overmap( loc, [&]( std::ostream & stream ) {
+    write_if_changed( saved_terrain_hash, [this]( std::ostream & stream ) {
         serialize( stream );
+    }, [this, w]( file_write_fn writer ) {
+        return w->write_overmap( loc, writer );
     } );
 }
 
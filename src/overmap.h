@@ -357,6 +357,9 @@ class overmap
 
         bool nullbool = false;
         point_abs_om loc;
+        /** Hashes of what @ref save last wrote, to skip writing an unchanged overmap again. */
+        mutable size_t saved_terrain_hash = 0;
+        mutable size_t saved_view_hash = 0;
 
         std::array<map_layer, OVERMAP_LAYERS> layer;
         std::unordered_map<tripoint_abs_omt, scent_trace> scents;
@@ -1,6 +1,5 @@
 #include "overmap_location.h"
 
-#include <algorithm>
 #include <map>
 #include <set>
 #include <utility>
@@ -33,10 +32,8 @@ const overmap_location &string_id<overmap_location>::obj() const
 
 bool overmap_location::test( const oter_id &oter ) const
 {
-    return std::any_of( terrains.cbegin(), terrains.cend(),
-    [ &oter ]( const oter_type_str_id & type ) {
-        return oter->type_is( type );
-    } );
+    const size_t index = static_cast<size_t>( oter->get_type_id().id().to_i() );
+    return index < terrain_mask.size() && terrain_mask[index];
 }
 
 oter_type_id overmap_location::get_random_terrain() const
@@ -86,6 +83,18 @@ void overmap_location::finalize()
             }
         }
     }
+
+    terrain_mask.clear();
+    for( const oter_type_str_id &elem : terrains ) {
+        if( !elem.is_valid() ) {
+            continue;
+        }
+        const size_t index = static_cast<size_t>( elem.id().to_i() );
+        if( index >= terrain_mask.size() ) {
+            terrain_mask.resize( index + 1, false );
+        }
+        terrain_mask[index] = true;
+    }
 }
 
 void overmap_locations::load( const JsonObject &jo, const std::string &src )
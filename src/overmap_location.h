@@ -28,6 +28,9 @@ struct overmap_location {
     private:
         std::vector<oter_type_str_id> terrains;
         std::vector<std::string> flags;
+        // Indexed by oter_type_id, set for the types in terrains.  Locations given by flags
+        // list hundreds of terrains, special placement tests them for every tile.
+        std::vector<bool> terrain_mask;
 };
 
 namespace overmap_locations
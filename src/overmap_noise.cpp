@@ -3,6 +3,7 @@
 
 #include "overmap_noise.h"
 #include "simplexnoise.h"
+#include "thread_pool.h"
 
 namespace om_noise
 {
@@ -35,4 +36,24 @@ float om_noise_layer_lake::noise_at( const point_om_omt &local_omt_pos ) const
     return r;
 }
 
+om_noise_grid::om_noise_grid( const om_noise_layer &layer ) : layer( layer )
+{
+    values.resize( OMAPX * OMAPY );
+    get_thread_pool().parallel_for( 0, OMAPY, [&]( int y ) {
+        for( int x = 0; x < OMAPX; x++ ) {
+            values[y * OMAPX + x] = layer.noise_at( point_om_omt( x, y ) );
+        }
+    } );
+}
+
+float om_noise_grid::noise_at( const point_om_omt &local_omt_pos ) const
+{
+    const int x = local_omt_pos.x();
+    const int y = local_omt_pos.y();
+    if( x < 0 || y < 0 || x >= OMAPX || y >= OMAPY ) {
+        return layer.noise_at( local_omt_pos );
+    }
+    return values[y * OMAPX + x];
+}
+
 } // namespace om_noise
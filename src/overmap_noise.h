@@ -2,6 +2,8 @@
 #ifndef CATA_SRC_OVERMAP_NOISE_H
 #define CATA_SRC_OVERMAP_NOISE_H
 
+#include <vector>
+
 #include "coordinates.h"
 #include "game_constants.h"
 #include "point.h"
@@ -78,6 +80,24 @@ class om_noise_layer_lake : public om_noise_layer
         float noise_at( const point_om_omt &local_omt_pos ) const override;
 };
 
+/**
+ * Values of a noise layer for every terrain of one overmap, evaluated up front.
+ * Rows are split across the shared thread pool, the values are the same as those of
+ * @ref om_noise_layer::noise_at no matter how many threads there are.
+ */
+class om_noise_grid
+{
+    public:
+        explicit om_noise_grid( const om_noise_layer &layer );
+
+        /** Precomputed for points on the overmap, other points are passed to the layer. */
+        float noise_at( const point_om_omt &local_omt_pos ) const;
+
+    private:
+        const om_noise_layer &layer;
+        std::vector<float> values;
+};
+
 } // namespace om_noise
 
 #endif // CATA_SRC_OVERMAP_NOISE_H
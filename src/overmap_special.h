@@ -7,6 +7,7 @@
 #include <cstdint>
 #include <bitset>
 #include <list>
+#include <optional>
 #include <set>
 #include <vector>
 #include <array>
@@ -147,7 +148,8 @@ class overmap_special
         int longest_side() const;
         std::vector<oter_str_id> all_terrains() const;
         std::vector<overmap_special_terrain> preview_terrains() const;
-        std::vector<overmap_special_locations> required_locations() const;
+        /** Locations of this special and its nested specials, relative to the origin. */
+        const std::vector<overmap_special_locations> &required_locations() const;
 
         special_placement_result place(
             overmap &om, const tripoint_om_omt &origin, om_direction::type dir ) const;
@@ -181,6 +183,9 @@ class overmap_special
         cata::flat_set<overmap_location_id> default_locations_;
         mapgen_parameters mapgen_params_;
         std::unordered_map<tripoint_rel_omt, overmap_special_id> nested_;
+
+        // Checked for every placement attempt, so it's built once on first use
+        mutable std::optional<std::vector<overmap_special_locations>> required_locations_;
 };
 
 namespace overmap_specials
@@ -160,6 +160,10 @@ class overmapbuffer
         overmap &get( const point_abs_om & );
         void save();
         void clear();
+        /** Number of overmaps held in memory. */
+        size_t num_loaded() const {
+            return overmaps.size();
+        }
         void create_custom_overmap( const point_abs_om &, overmap_special_batch &specials );
 
         /**
@@ -1833,7 +1833,7 @@ static void draw_ai_goal( const avatar &u, const catacurses::window &w )
     behavior::tree needs;
     needs.add( &string_id<behavior::node_t>( "npc_needs" ).obj() );
     behavior::character_oracle_t player_oracle( &u );
-    std::string current_need = needs.tick( &player_oracle );
+    const std::string &current_need = needs.tick( &player_oracle );
     // NOLINTNEXTLINE(cata-use-named-point-constants)
     mvwprintz( w, point( 1, 0 ), c_light_gray, _( "Goal: %s" ), current_need );
     wnoutrefresh( w );
@@ -2013,15 +2013,12 @@ static void draw_mana_wide( const player &u, const catacurses::window &w )
 
 static bool spell_panel()
 {
-    std::vector<spell_id> spells = get_avatar().magic->spells();
-    bool has_manacasting = false;
-    for( spell_id sp : spells ) {
-        spell temp_spell = get_avatar().magic->get_spell( sp );
-        if( temp_spell.energy_source() == mana_energy ) {
-            has_manacasting = true;
+    for( const spell *sp : get_avatar().magic->get_spells() ) {
+        if( sp->energy_source() == mana_energy ) {
+            return true;
         }
     }
-    return has_manacasting;
+    return false;
 }
 
 bool default_render()
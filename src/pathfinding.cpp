@@ -1,5 +1,7 @@
 #include "pathfinding.h"
 
+#include <climits>
+#include <cstdint>
 #include <cstdlib>
 #include <algorithm>
 #include <optional>
@@ -38,43 +40,89 @@ constexpr int flat_index( const tripoint &p )
 }
 
 // Flattened 2D array representing a single z-level worth of pathfinding data
+// Layers are reused between searches: an entry only holds data of the current search
+// if its search id matches, so a new search doesn't have to clear the whole layer.
 struct path_data_layer {
+    std::uint32_t current_search = 0;
+    std::array< std::uint32_t, MAPSIZE_X *MAPSIZE_Y > search;
     // State is accessed way more often than all other values here
     std::array< astar_state, MAPSIZE_X *MAPSIZE_Y > state;
     std::array< int, MAPSIZE_X *MAPSIZE_Y > score;
     std::array< int, MAPSIZE_X *MAPSIZE_Y > gscore;
     std::array< tripoint, MAPSIZE_X *MAPSIZE_Y > parent;
 
-    void init( point min, point max ) {
-        tripoint p;
-        for( p.x = min.x; p.x <= max.x; p.x++ ) {
-            for( p.y = min.y; p.y <= max.y; p.y++ ) {
-                const int ind = flat_index( p );
-                state[ind] = ASL_NONE; // Mark as unvisited
-            }
+    path_data_layer() {
+        search.fill( 0 );
+    }
+
+    // Resets the entry if it was last written by an earlier search
+    void prepare( const int index ) {
+        if( search[index] != current_search ) {
+            search[index] = current_search;
+            state[index] = ASL_NONE; // Mark as unvisited
+            score[index] = 0;
+            gscore[index] = 0;
         }
     }
+
+    astar_state &state_at( const int index ) {
+        prepare( index );
+        return state[index];
+    }
+    int &score_at( const int index ) {
+        prepare( index );
+        return score[index];
+    }
+    int &gscore_at( const int index ) {
+        prepare( index );
+        return gscore[index];
+    }
+    tripoint &parent_at( const int index ) {
+        prepare( index );
+        return parent[index];
+    }
+};
+
+struct path_data {
+    std::uint32_t last_search = 0;
+    std::array< std::unique_ptr< path_data_layer >, OVERMAP_LAYERS > layers;
 };
 
+// Layers are big, so they are allocated once per thread instead of once per search
+static path_data &get_path_data()
+{
+    static thread_local path_data data;
+    return data;
+}
+
 struct pathfinder {
     point min;
     point max;
+    std::uint32_t search_id;
     pathfinder( point _min, point _max ) :
         min( _min ), max( _max ) {
+        path_data &data = get_path_data();
+        search_id = ++data.last_search;
+        if( search_id == 0 ) {
+            // Wrapped around, entries of ancient searches could look current now
+            for( std::unique_ptr< path_data_layer > &layer : data.layers ) {
+                if( layer != nullptr ) {
+                    layer->search.fill( 0 );
+                }
+            }
+            search_id = ++data.last_search;
+        }
     }
 
     std::priority_queue< std::pair<int, tripoint>, std::vector< std::pair<int, tripoint> >, pair_greater_cmp_first >
     open;
-    std::array< std::unique_ptr< path_data_layer >, OVERMAP_LAYERS > path_data;
 
     path_data_layer &get_layer( const int z ) {
-        std::unique_ptr< path_data_layer > &ptr = path_data[z + OVERMAP_DEPTH];
-        if( ptr != nullptr ) {
-            return *ptr;
+        std::unique_ptr< path_data_layer > &ptr = get_path_data().layers[z + OVERMAP_DEPTH];
+        if( ptr == nullptr ) {
+            ptr = std::make_unique<path_data_layer>();
         }
-
-        ptr = std::make_unique<path_data_layer>();
-        ptr->init( min, max );
+        ptr->current_search = search_id;
         return *ptr;
     }
 
@@ -91,8 +139,9 @@ struct pathfinder {
     void add_point( const int gscore, const int score, const tripoint &from, const tripoint &to ) {
         auto &layer = get_layer( to.z );
         const int index = flat_index( to );
-        if( ( layer.state[index] == ASL_OPEN && gscore >= layer.gscore[index] ) ||
-            layer.state[index] == ASL_CLOSED ) {
+        const astar_state state = layer.state_at( index );
+        if( ( state == ASL_OPEN && gscore >= layer.gscore[index] ) ||
+            state == ASL_CLOSED ) {
             return;
         }
 
@@ -106,13 +155,13 @@ struct pathfinder {
     void close_point( const tripoint &p ) {
         auto &layer = get_layer( p.z );
         const int index = flat_index( p );
-        layer.state[index] = ASL_CLOSED;
+        layer.state_at( index ) = ASL_CLOSED;
     }
 
     void unclose_point( const tripoint &p ) {
         auto &layer = get_layer( p.z );
         const int index = flat_index( p );
-        layer.state[index] = ASL_NONE;
+        layer.state_at( index ) = ASL_NONE;
     }
 };
 
@@ -192,6 +241,19 @@ bool is_disjoint( const Set1 &set1, const Set2 &set2 )
     return true;
 }
 
+static const pf_special non_normal = PF_SLOW | PF_WALL | PF_VEHICLE | PF_TRAP | PF_SHARP;
+
+// Whether the line from f is boring flat ground all the way
+static bool is_flat_line( const pathfinding_cache &pf_cache, const tripoint &f,
+                          const std::vector<tripoint> &line_path )
+{
+    // Check all points for any special case (including just hard terrain)
+    return !( pf_cache.special[f.x][f.y] & non_normal ) &&
+    std::all_of( line_path.begin(), line_path.end(), [&pf_cache]( const tripoint & p ) {
+        return !( pf_cache.special[p.x][p.y] & non_normal );
+    } );
+}
+
 std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
                                   const pathfinding_settings &settings,
                                   const std::set<tripoint> &pre_closed ) const
@@ -210,17 +272,55 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
         clip_to_bounds( clipped );
         return route( f, clipped, settings, pre_closed );
     }
+
+    const route_cache_key key{ f, t, settings, cata::range_hash()( pre_closed ) };
+    std::vector<int> cache_versions;
+    for( int z = std::min( f.z, t.z ); z <= std::max( f.z, t.z ); z++ ) {
+        cache_versions.push_back( get_pathfinding_cache( z ).version );
+    }
+
+    route_cache &cache = *route_results;
+    const shared_ptr_fast<const route_cache_entry> cached = cache.entries.get( key, nullptr );
+    if( cached != nullptr && cached->pre_closed == pre_closed ) {
+        if( cached->abs_sub == abs_sub && cached->cache_versions == cache_versions ) {
+            cache.stats.hits++;
+            // Refresh its position in the LRU order
+            cache.entries.insert( route_cache::max_entries, key, cached );
+            return cached->route;
+        }
+        cache.stats.invalidations++;
+    }
+    cache.stats.misses++;
+
+    const shared_ptr_fast<route_cache_entry> entry = make_shared_fast<route_cache_entry>();
+    entry->route = find_route( f, t, settings, pre_closed );
+    entry->pre_closed = pre_closed;
+    entry->abs_sub = abs_sub;
+    entry->cache_versions = std::move( cache_versions );
+    cache.entries.insert( route_cache::max_entries, key, entry );
+    return entry->route;
+}
+
+const route_cache_stats &map::get_route_cache_stats() const
+{
+    return route_results->stats;
+}
+
+void map::clear_route_cache()
+{
+    route_results->entries.clear();
+}
+
+std::vector<tripoint> map::find_route( const tripoint &f, const tripoint &t,
+                                       const pathfinding_settings &settings,
+                                       const std::set<tripoint> &pre_closed ) const
+{
+    std::vector<tripoint> ret;
     // First, check for a simple straight line on flat ground
     // Except when the line contains a pre-closed tile - we need to do regular pathing then
-    static const auto non_normal = PF_SLOW | PF_WALL | PF_VEHICLE | PF_TRAP | PF_SHARP;
     if( f.z == t.z ) {
         const auto line_path = line_to( f, t );
-        const auto &pf_cache = get_pathfinding_cache_ref( f.z );
-        // Check all points for any special case (including just hard terrain)
-        if( !( pf_cache.special[f.x][f.y] & non_normal ) &&
-        std::all_of( line_path.begin(), line_path.end(), [&pf_cache]( const tripoint & p ) {
-        return !( pf_cache.special[p.x][p.y] & non_normal );
-        } ) ) {
+        if( is_flat_line( get_pathfinding_cache_ref( f.z ), f, line_path ) ) {
             const std::set<tripoint> sorted_line( line_path.begin(), line_path.end() );
 
             if( is_disjoint( sorted_line, pre_closed ) ) {
@@ -235,12 +335,6 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
     }
 
     int max_length = settings.max_length;
-    int bash = settings.bash_strength;
-    int climb_cost = settings.climb_cost;
-    bool doors = settings.allow_open_doors;
-    bool trapavoid = settings.avoid_traps;
-    bool roughavoid = settings.avoid_rough_terrain;
-    bool sharpavoid = settings.avoid_sharp;
 
     const int pad = 16;  // Should be much bigger - low value makes pathfinders dumb!
     int minx = std::min( f.x, t.x ) - pad;
@@ -275,12 +369,12 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
 
         const int parent_index = flat_index( cur );
         auto &layer = pf.get_layer( cur.z );
-        auto &cur_state = layer.state[parent_index];
+        auto &cur_state = layer.state_at( parent_index );
         if( cur_state == ASL_CLOSED ) {
             continue;
         }
 
-        if( layer.gscore[parent_index] > max_length ) {
+        if( layer.gscore_at( parent_index ) > max_length ) {
             // Shortest path would be too long, return empty vector
             return std::vector<tripoint>();
         }
@@ -312,152 +406,31 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
                 continue;
             }
 
-            if( layer.state[index] == ASL_CLOSED ) {
+            if( layer.state_at( index ) == ASL_CLOSED ) {
                 continue;
             }
 
-            int part = -1;
-            const vehicle *veh = veh_at_internal( p, part );
-            if( cur_veh &&
-                !cur_veh->allowed_move( cur_veh->tripoint_to_mount( cur ), cur_veh->tripoint_to_mount( p ) ) ) {
-                //Trying to squeeze through a vehicle hole, skip this movement but don't close the tile as other paths may lead to it
-                continue;
+            const route_step step = route_step_cost( cur, cur_veh, p, settings );
+            if( step.close ) {
+                // Close it so that next time we won't try to calculate costs
+                layer.state_at( index ) = ASL_CLOSED;
             }
-
-            if( veh && veh != cur_veh &&
-                !veh->allowed_move( veh->tripoint_to_mount( cur ), veh->tripoint_to_mount( p ) ) ) {
-                //Same as above but moving into rather than out of a vehicle
-                continue;
+            if( step.ledge ) {
+                const tripoint below( p.xy(), p.z - 1 );
+                auto &below_layer = pf.get_layer( p.z - 1 );
+                // From cur, not p, because we won't be walking on air
+                pf.add_point( below_layer.gscore_at( parent_index ) + 10,
+                              below_layer.score_at( parent_index ) + 10 + 2 * rl_dist( below, t ),
+                              cur, below );
             }
-
-            // Penalize for diagonals or the path will look "unnatural"
-            int newg = layer.gscore[parent_index] + ( ( cur.x != p.x && cur.y != p.y ) ? 1 : 0 );
-
-            const auto p_special = pf_cache.special[p.x][p.y];
-            // TODO: De-uglify, de-huge-n
-            if( !( p_special & non_normal ) ) {
-                // Boring flat dirt - the most common case above the ground
-                newg += 2;
-            } else {
-                if( roughavoid ) {
-                    layer.state[index] = ASL_CLOSED; // Close all rough terrain tiles
-                    continue;
-                }
-
-                const maptile &tile = maptile_at_internal( p );
-                const auto &terrain = tile.get_ter_t();
-                const auto &furniture = tile.get_furn_t();
-
-                const int cost = move_cost_internal( furniture, terrain, veh, part );
-                // Don't calculate bash rating unless we intend to actually use it
-                const int rating = ( bash == 0 || cost != 0 ) ? -1 :
-                                   bash_rating_internal( bash, furniture, terrain, false, veh, part );
-
-                if( cost == 0 && rating <= 0 && ( !doors || !terrain.open || !furniture.open ) && veh == nullptr &&
-                    climb_cost <= 0 ) {
-                    layer.state[index] = ASL_CLOSED; // Close it so that next time we won't try to calculate costs
-                    continue;
-                }
-
-                newg += cost;
-                if( cost == 0 ) {
-                    if( climb_cost > 0 && p_special & PF_CLIMBABLE ) {
-                        // Climbing fences
-                        newg += climb_cost;
-                    } else if( doors && ( terrain.open || furniture.open ) &&
-                               ( !terrain.has_flag( "OPENCLOSE_INSIDE" ) || !furniture.has_flag( "OPENCLOSE_INSIDE" ) ||
-                                 !is_outside( cur ) ) ) {
-                        // Only try to open INSIDE doors from the inside
-                        // To open and then move onto the tile
-                        newg += 4;
-                    } else if( veh != nullptr ) {
-                        const auto vpobst = vpart_position( const_cast<vehicle &>( *veh ), part ).obstacle_at_part();
-                        part = vpobst ? vpobst->part_index() : -1;
-                        int dummy = -1;
-                        if( doors && veh->part_flag( part, VPFLAG_OPENABLE ) &&
-                            ( !veh->part_flag( part, "OPENCLOSE_INSIDE" ) ||
-                              veh_at_internal( cur, dummy ) == veh ) ) {
-                            // Handle car doors, but don't try to path through curtains
-                            newg += 10; // One turn to open, 4 to move there
-                        } else if( part >= 0 && bash > 0 ) {
-                            // Car obstacle that isn't a door
-                            // TODO: Account for armor
-                            int hp = veh->cpart( part ).hp();
-                            if( hp / 20 > bash ) {
-                                // Threshold damage thing means we just can't bash this down
-                                layer.state[index] = ASL_CLOSED;
-                                continue;
-                            } else if( hp / 10 > bash ) {
-                                // Threshold damage thing means we will fail to deal damage pretty often
-                                hp *= 2;
-                            }
-
-                            newg += 2 * hp / bash + 8 + 4;
-                        } else if( part >= 0 ) {
-                            if( !doors || !veh->part_flag( part, VPFLAG_OPENABLE ) ) {
-                                // Won't be openable, don't try from other sides
-                                layer.state[index] = ASL_CLOSED;
-                            }
-
-                            continue;
-                        }
-                    } else if( rating > 1 ) {
-                        // Expected number of turns to bash it down, 1 turn to move there
-                        // and 5 turns of penalty not to trash everything just because we can
-                        newg += ( 20 / rating ) + 2 + 10;
-                    } else if( rating == 1 ) {
-                        // Desperate measures, avoid whenever possible
-                        newg += 500;
-                    } else {
-                        // Unbashable and unopenable from here
-                        if( !doors || !terrain.open || !furniture.open ) {
-                            // Or anywhere else for that matter
-                            layer.state[index] = ASL_CLOSED;
-                        }
-
-                        continue;
-                    }
-                }
-
-                if( trapavoid && p_special & PF_TRAP ) {
-                    const auto &ter_trp = terrain.trap.obj();
-                    const auto &trp = ter_trp.is_benign() ? tile.get_trap_t() : ter_trp;
-                    if( !trp.is_benign() ) {
-                        // For now make them detect all traps
-                        if( has_zlevels() && terrain.has_flag( TFLAG_NO_FLOOR ) ) {
-                            // Special case - ledge in z-levels
-                            // Warning: really expensive, needs a cache
-                            if( valid_move( p, tripoint( p.xy(), p.z - 1 ), false, true ) ) {
-                                tripoint below( p.xy(), p.z - 1 );
-                                if( !has_flag( TFLAG_NO_FLOOR, below ) ) {
-                                    // Otherwise this would have been a huge fall
-                                    auto &layer = pf.get_layer( p.z - 1 );
-                                    // From cur, not p, because we won't be walking on air
-                                    pf.add_point( layer.gscore[parent_index] + 10,
-                                                  layer.score[parent_index] + 10 + 2 * rl_dist( below, t ),
-                                                  cur, below );
-                                }
-
-                                // Close p, because we won't be walking on it
-                                layer.state[index] = ASL_CLOSED;
-                                continue;
-                            }
-                        } else if( trapavoid ) {
-                            // Otherwise it's walkable
-                            newg += 500;
-                        }
-                    }
-                }
-
-                if( sharpavoid && p_special & PF_SHARP ) {
-                    layer.state[index] = ASL_CLOSED; // Avoid sharp things
-                }
-
+            if( step.cost < 0 ) {
+                continue;
             }
+            const int newg = layer.gscore_at( parent_index ) + step.cost;
 
             // If not visited, add as open
             // If visited, add it only if we can do so with better score
-            if( layer.state[index] == ASL_NONE || newg < layer.gscore[index] ) {
+            if( layer.state_at( index ) == ASL_NONE || newg < layer.gscore_at( index ) ) {
                 pf.add_point( newg, newg + 2 * rl_dist( p, t ), cur, p );
             }
         }
@@ -473,8 +446,8 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
             tripoint dest( cur.xy(), cur.z - 1 );
             if( vertical_move_destination<TFLAG_GOES_UP>( *this, dest ) ) {
                 auto &layer = pf.get_layer( dest.z );
-                pf.add_point( layer.gscore[parent_index] + 2,
-                              layer.score[parent_index] + 2 * rl_dist( dest, t ),
+                pf.add_point( layer.gscore_at( parent_index ) + 2,
+                              layer.score_at( parent_index ) + 2 * rl_dist( dest, t ),
                               cur, dest );
             }
         }
@@ -482,8 +455,8 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
             tripoint dest( cur.xy(), cur.z + 1 );
             if( vertical_move_destination<TFLAG_GOES_DOWN>( *this, dest ) ) {
                 auto &layer = pf.get_layer( dest.z );
-                pf.add_point( layer.gscore[parent_index] + 2,
-                              layer.score[parent_index] + 2 * rl_dist( dest, t ),
+                pf.add_point( layer.gscore_at( parent_index ) + 2,
+                              layer.score_at( parent_index ) + 2 * rl_dist( dest, t ),
                               cur, dest );
             }
         }
@@ -492,8 +465,8 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
             auto &layer = pf.get_layer( cur.z + 1 );
             for( size_t it = 0; it < 8; it++ ) {
                 const tripoint above( cur.x + x_offset[it], cur.y + y_offset[it], cur.z + 1 );
-                pf.add_point( layer.gscore[parent_index] + 4,
-                              layer.score[parent_index] + 4 + 2 * rl_dist( above, t ),
+                pf.add_point( layer.gscore_at( parent_index ) + 4,
+                              layer.score_at( parent_index ) + 4 + 2 * rl_dist( above, t ),
                               cur, above );
             }
         }
@@ -502,8 +475,8 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
             auto &layer = pf.get_layer( cur.z + 1 );
             for( size_t it = 0; it < 8; it++ ) {
                 const tripoint above( cur.x + x_offset[it], cur.y + y_offset[it], cur.z + 1 );
-                pf.add_point( layer.gscore[parent_index] + 4,
-                              layer.score[parent_index] + 4 + 2 * rl_dist( above, t ),
+                pf.add_point( layer.gscore_at( parent_index ) + 4,
+                              layer.score_at( parent_index ) + 4 + 2 * rl_dist( above, t ),
                               cur, above );
             }
         }
@@ -512,8 +485,8 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
             auto &layer = pf.get_layer( cur.z - 1 );
             for( size_t it = 0; it < 8; it++ ) {
                 const tripoint below( cur.x + x_offset[it], cur.y + y_offset[it], cur.z - 1 );
-                pf.add_point( layer.gscore[parent_index] + 4,
-                              layer.score[parent_index] + 4 + 2 * rl_dist( below, t ),
+                pf.add_point( layer.gscore_at( parent_index ) + 4,
+                              layer.score_at( parent_index ) + 4 + 2 * rl_dist( below, t ),
                               cur, below );
             }
         }
@@ -526,8 +499,8 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
         // Just to limit max distance, in case something weird happens
         for( int fdist = max_length; fdist != 0; fdist-- ) {
             const int cur_index = flat_index( cur );
-            const auto &layer = pf.get_layer( cur.z );
-            const tripoint &par = layer.parent[cur_index];
+            auto &layer = pf.get_layer( cur.z );
+            const tripoint &par = layer.parent_at( cur_index );
             if( cur == f ) {
                 break;
             }
@@ -549,3 +522,274 @@ std::vector<tripoint> map::route( const tripoint &f, const tripoint &t,
 
     return ret;
 }
+
+// Fields are only worth building when more than one route would use them
+static constexpr int flow_field_min_requests = 2;
+// Bounds the memory used by crowds with many different goals
+static constexpr size_t max_flow_fields = 8;
+
+std::vector<tripoint> map::route_shared( const tripoint &f, const tripoint &t,
+        const pathfinding_settings &settings ) const
+{
+    if( f == t || f.z != t.z || !inbounds( f ) || !inbounds( t ) ) {
+        return route( f, t, settings );
+    }
+
+    // Same shortcuts as in route, they are cheaper than looking up a field
+    const auto line_path = line_to( f, t );
+    if( is_flat_line( get_pathfinding_cache_ref( f.z ), f, line_path ) ) {
+        return line_path;
+    }
+    if( rl_dist( f, t ) > settings.max_dist ) {
+        return std::vector<tripoint>();
+    }
+
+    const flow_field *field = get_flow_field( t, settings );
+    if( field == nullptr ) {
+        return route( f, t, settings );
+    }
+
+    std::vector<tripoint> ret;
+    int cur_index = flat_index( f );
+    if( field->cost[cur_index] > settings.max_length ) {
+        // Same as in route: shortest path would be too long
+        return ret;
+    }
+    const int goal_index = flat_index( t );
+    while( cur_index != goal_index ) {
+        cur_index = field->next[cur_index];
+        ret.emplace_back( cur_index / MAPSIZE_Y, cur_index % MAPSIZE_Y, t.z );
+    }
+    return ret;
+}
+
+const flow_field *map::get_flow_field( const tripoint &goal,
+                                       const pathfinding_settings &settings ) const
+{
+    const int version = get_pathfinding_cache( goal.z ).version;
+    flow_fields.erase( std::remove_if( flow_fields.begin(), flow_fields.end(),
+    [&]( const std::unique_ptr<flow_field> &field ) {
+        return field->turn != calendar::turn || field->abs_sub != abs_sub ||
+               field->cache_version != get_pathfinding_cache( field->goal.z ).version;
+    } ), flow_fields.end() );
+
+    auto iter = std::find_if( flow_fields.begin(), flow_fields.end(),
+    [&]( const std::unique_ptr<flow_field> &field ) {
+        return field->goal == goal && field->settings == settings;
+    } );
+    if( iter == flow_fields.end() ) {
+        if( flow_fields.size() >= max_flow_fields ) {
+            return nullptr;
+        }
+        flow_fields.push_back( std::make_unique<flow_field>() );
+        iter = std::prev( flow_fields.end() );
+        flow_field &field = **iter;
+        field.goal = goal;
+        field.settings = settings;
+        field.turn = calendar::turn;
+        field.abs_sub = abs_sub;
+        field.cache_version = version;
+    }
+
+    flow_field &field = **iter;
+    if( !field.built && ++field.requests >= flow_field_min_requests ) {
+        build_flow_field( field );
+    }
+    return field.built ? &field : nullptr;
+}
+
+void map::build_flow_field( flow_field &field ) const
+{
+    const pathfinding_settings &settings = field.settings;
+    const int z = field.goal.z;
+    field.cost.fill( INT_MAX );
+    const int goal_index = flat_index( field.goal );
+    field.cost[goal_index] = 0;
+    field.next[goal_index] = goal_index;
+
+    // Dijkstra outwards from the goal, so costs are computed for steps towards it
+    std::priority_queue< std::pair<int, int>, std::vector< std::pair<int, int> >, pair_greater_cmp_first >
+    open;
+    open.emplace( 0, goal_index );
+    constexpr std::array<int, 8> x_offset{{ -1,  1,  0,  0,  1, -1, -1, 1 }};
+    constexpr std::array<int, 8> y_offset{{  0,  0, -1,  1, -1,  1, -1, 1 }};
+    while( !open.empty() ) {
+        const auto top = open.top();
+        open.pop();
+        const int index = top.second;
+        if( top.first != field.cost[index] ) {
+            // Already reached at a lower cost
+            continue;
+        }
+        const tripoint p( index / MAPSIZE_Y, index % MAPSIZE_Y, z );
+        for( size_t i = 0; i < 8; i++ ) {
+            const tripoint cur( p.x + x_offset[i], p.y + y_offset[i], z );
+            if( cur.x < 0 || cur.x >= MAPSIZE_X || cur.y < 0 || cur.y >= MAPSIZE_Y ) {
+                continue;
+            }
+            const int cur_index = flat_index( cur );
+            if( field.cost[cur_index] <= top.first ) {
+                continue;
+            }
+            const int step = flow_step_cost( cur, p, settings );
+            if( step < 0 ) {
+                continue;
+            }
+            const int newg = top.first + step;
+            if( newg < field.cost[cur_index] && newg <= settings.max_length ) {
+                field.cost[cur_index] = newg;
+                field.next[cur_index] = index;
+                open.emplace( newg, cur_index );
+            }
+        }
+    }
+    field.built = true;
+}
+
+route_step map::route_step_cost( const tripoint &cur, const vehicle *cur_veh, const tripoint &p,
+                                 const pathfinding_settings &settings ) const
+{
+    const int bash = settings.bash_strength;
+    const int climb_cost = settings.climb_cost;
+    const bool doors = settings.allow_open_doors;
+
+    route_step ret;
+    int part = -1;
+    const vehicle *veh = veh_at_internal( p, part );
+    if( cur_veh &&
+        !cur_veh->allowed_move( cur_veh->tripoint_to_mount( cur ), cur_veh->tripoint_to_mount( p ) ) ) {
+        //Trying to squeeze through a vehicle hole, skip this movement but don't close the tile as other paths may lead to it
+        return ret;
+    }
+
+    if( veh && veh != cur_veh &&
+        !veh->allowed_move( veh->tripoint_to_mount( cur ), veh->tripoint_to_mount( p ) ) ) {
+        //Same as above but moving into rather than out of a vehicle
+        return ret;
+    }
+
+    // Penalize for diagonals or the path will look "unnatural"
+    int newg = ( cur.x != p.x && cur.y != p.y ) ? 1 : 0;
+
+    const pathfinding_cache &pf_cache = get_pathfinding_cache_ref( p.z );
+    const auto p_special = pf_cache.special[p.x][p.y];
+    // TODO: De-uglify, de-huge-n
+    if( !( p_special & non_normal ) ) {
+        // Boring flat dirt - the most common case above the ground
+        ret.cost = newg + 2;
+        return ret;
+    }
+
+    if( settings.avoid_rough_terrain ) {
+        // Close all rough terrain tiles
+        ret.close = true;
+        return ret;
+    }
+
+    const maptile &tile = maptile_at_internal( p );
+    const auto &terrain = tile.get_ter_t();
+    const auto &furniture = tile.get_furn_t();
+
+    const std::uint8_t cached_cost = pf_cache.move_cost[p.x][p.y];
+    const int cost = veh == nullptr && cached_cost != pathfinding_cache::unknown_move_cost ?
+                     cached_cost : move_cost_internal( furniture, terrain, veh, part );
+    // Don't calculate bash rating unless we intend to actually use it
+    const int rating = ( bash == 0 || cost != 0 ) ? -1 :
+                       bash_rating_internal( bash, furniture, terrain, false, veh, part );
+
+    if( cost == 0 && rating <= 0 && ( !doors || !terrain.open || !furniture.open ) && veh == nullptr &&
+        climb_cost <= 0 ) {
+        ret.close = true;
+        return ret;
+    }
+
+    newg += cost;
+    if( cost == 0 ) {
+        if( climb_cost > 0 && p_special & PF_CLIMBABLE ) {
+            // Climbing fences
+            newg += climb_cost;
+        } else if( doors && ( terrain.open || furniture.open ) &&
+                   ( !terrain.has_flag( "OPENCLOSE_INSIDE" ) || !furniture.has_flag( "OPENCLOSE_INSIDE" ) ||
+                     !is_outside( cur ) ) ) {
+            // Only try to open INSIDE doors from the inside
+            // To open and then move onto the tile
+            newg += 4;
+        } else if( veh != nullptr ) {
+            const auto vpobst = vpart_position( const_cast<vehicle &>( *veh ), part ).obstacle_at_part();
+            part = vpobst ? vpobst->part_index() : -1;
+            if( doors && veh->part_flag( part, VPFLAG_OPENABLE ) &&
+                ( !veh->part_flag( part, "OPENCLOSE_INSIDE" ) || cur_veh == veh ) ) {
+                // Handle car doors, but don't try to path through curtains
+                newg += 10; // One turn to open, 4 to move there
+            } else if( part >= 0 && bash > 0 ) {
+                // Car obstacle that isn't a door
+                // TODO: Account for armor
+                int hp = veh->cpart( part ).hp();
+                if( hp / 20 > bash ) {
+                    // Threshold damage thing means we just can't bash this down
+                    ret.close = true;
+                    return ret;
+                } else if( hp / 10 > bash ) {
+                    // Threshold damage thing means we will fail to deal damage pretty often
+                    hp *= 2;
+                }
+
+                newg += 2 * hp / bash + 8 + 4;
+            } else if( part >= 0 ) {
+                // Won't be openable, don't try from other sides
+                ret.close = !doors || !veh->part_flag( part, VPFLAG_OPENABLE );
+                return ret;
+            }
+        } else if( rating > 1 ) {
+            // Expected number of turns to bash it down, 1 turn to move there
+            // and 5 turns of penalty not to trash everything just because we can
+            newg += ( 20 / rating ) + 2 + 10;
+        } else if( rating == 1 ) {
+            // Desperate measures, avoid whenever possible
+            newg += 500;
+        } else {
+            // Unbashable and unopenable from here, or anywhere else for that matter
+            ret.close = !doors || !terrain.open || !furniture.open;
+            return ret;
+        }
+    }
+
+    if( settings.avoid_traps && p_special & PF_TRAP ) {
+        const auto &ter_trp = terrain.trap.obj();
+        const auto &trp = ter_trp.is_benign() ? tile.get_trap_t() : ter_trp;
+        if( !trp.is_benign() ) {
+            // For now make them detect all traps
+            if( has_zlevels() && terrain.has_flag( TFLAG_NO_FLOOR ) ) {
+                // Special case - ledge in z-levels
+                // Warning: really expensive, needs a cache
+                if( valid_move( p, tripoint( p.xy(), p.z - 1 ), false, true ) ) {
+                    // Otherwise this would have been a huge fall
+                    ret.ledge = !has_flag( TFLAG_NO_FLOOR, tripoint( p.xy(), p.z - 1 ) );
+                    // Close p, because we won't be walking on it
+                    ret.close = true;
+                    return ret;
+                }
+            } else {
+                // Otherwise it's walkable
+                newg += 500;
+            }
+        }
+    }
+
+    if( settings.avoid_sharp && p_special & PF_SHARP ) {
+        // Avoid sharp things
+        ret.close = true;
+        return ret;
+    }
+
+    ret.cost = newg;
+    return ret;
+}
+
+int map::flow_step_cost( const tripoint &cur, const tripoint &p,
+                         const pathfinding_settings &settings ) const
+{
+    int cur_part;
+    // Ledges lead to other z-levels, which fields don't cover, they are impossible steps here
+    return route_step_cost( cur, veh_at_internal( cur, cur_part ), p, settings ).cost;
+}
@@ -2,7 +2,19 @@
 #ifndef CATA_SRC_PATHFINDING_H
 #define CATA_SRC_PATHFINDING_H
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <set>
+#include <vector>
+
+#include "calendar.h"
 #include "game_constants.h"
+#include "hash_utils.h"
+#include "lru_cache.h"
+#include "memory_fast.h"
+#include "point.h"
 
 enum pf_special : int {
     PF_NORMAL = 0x00,    // Plain boring tile (grass, dirt, floor etc.)
@@ -43,8 +55,18 @@ struct pathfinding_cache {
     ~pathfinding_cache() = default;
 
     bool dirty;
+    // Incremented every time the cache is marked dirty, so data derived from it can be
+    // invalidated without a callback
+    int version = 0;
 
     pf_special special[MAPSIZE_X][MAPSIZE_Y];
+    /**
+     * map::move_cost of every tile, or @ref unknown_move_cost where it doesn't fit.  Not valid
+     * on tiles with a vehicle, vehicle parts can open, close and break without making the
+     * cache dirty.
+     */
+    std::uint8_t move_cost[MAPSIZE_X][MAPSIZE_Y];
+    static constexpr std::uint8_t unknown_move_cost = UINT8_MAX;
 };
 
 struct pathfinding_settings {
@@ -71,6 +93,98 @@ struct pathfinding_settings {
           allow_open_doors( aod ), avoid_traps( at ), allow_climb_stairs( acs ), avoid_rough_terrain( art ),
           avoid_sharp( as ) {}
     pathfinding_settings &operator = ( const pathfinding_settings & ) = default;
+    bool operator==( const pathfinding_settings & ) const = default;
+};
+
+/** Result of @ref map::route_step_cost. */
+struct route_step {
+    // -1 if the step can't be made
+    int cost = -1;
+    // Can't be entered from any side either, the search doesn't have to try again
+    bool close = false;
+    // Walkable ledge, the search continues on the level below instead
+    bool ledge = false;
+};
+
+/**
+ * Cost of the cheapest path from every tile of one z-level to a shared goal on it (a Dijkstra map).
+ * Lets a crowd of creatures chasing the same target with the same settings
+ * share one search instead of running A* each. See @ref map::route_shared.
+ */
+struct flow_field {
+    tripoint goal;
+    pathfinding_settings settings;
+
+    // Validity: the field is only used for the turn, map position and pathfinding cache
+    // version it was requested for
+    time_point turn;
+    tripoint abs_sub;
+    int cache_version = 0;
+
+    // Number of routes requested this turn, the field is built once enough of them share it
+    int requests = 0;
+    bool built = false;
+
+    // Path cost to the goal, INT_MAX if it can't be reached within settings.max_length
+    std::array<int, MAPSIZE_X *MAPSIZE_Y> cost;
+    // Flat index of the next tile on the cheapest path to the goal
+    std::array<int, MAPSIZE_X *MAPSIZE_Y> next;
+};
+
+struct route_cache_key {
+    tripoint from;
+    tripoint to;
+    pathfinding_settings settings;
+    // Hash of the pre-closed set, the set itself is stored in the entry
+    std::size_t avoid_hash = 0;
+
+    bool operator==( const route_cache_key & ) const = default;
+};
+
+namespace std
+{
+template <>
+struct hash<route_cache_key> {
+    std::size_t operator()( const route_cache_key &k ) const noexcept {
+        std::size_t seed = 0;
+        cata::hash_combine( seed, k.from );
+        cata::hash_combine( seed, k.to );
+        cata::hash_combine( seed, k.settings.bash_strength );
+        cata::hash_combine( seed, k.settings.max_dist );
+        cata::hash_combine( seed, k.settings.max_length );
+        cata::hash_combine( seed, k.avoid_hash );
+        return seed;
+    }
+};
+} // namespace std
+
+struct route_cache_entry {
+    std::vector<tripoint> route;
+    std::set<tripoint> pre_closed;
+    // The route is only valid while the map isn't shifted and pathfinding caches
+    // of the z-levels it could pass through aren't marked dirty
+    tripoint abs_sub;
+    std::vector<int> cache_versions;
+};
+
+/** Counters of @ref route_cache, for profiling. */
+struct route_cache_stats {
+    int hits = 0;
+    int misses = 0;
+    // Entries found, but no longer valid
+    int invalidations = 0;
+};
+
+/**
+ * Results of recent @ref map::route calls.  Creatures (mostly NPCs) re-plan routes
+ * to the same target every turn, most of which can be answered from here.
+ * Not thread safe, like the rest of the map.
+ */
+struct route_cache {
+    static constexpr int max_entries = 64;
+
+    lru_cache<route_cache_key, shared_ptr_fast<const route_cache_entry>> entries;
+    route_cache_stats stats;
 };
 
 #endif // CATA_SRC_PATHFINDING_H
@@ -8,6 +8,7 @@
 #include <memory>
 #include <numeric>
 #include <optional>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -229,9 +230,61 @@ bool pickup::query_thief()
 }
 
 // Returns false if pickup caused a prompt and the player selected to cancel pickup
+// What the avatar carries, kept up to date while a batch of items is picked up, so the
+// inventory isn't summed up again (and searched for ammo containers) for every single item.
+// The totals are upper bounds: stacking can only make the real ones smaller.  A check that
+// fails on them is repeated with the real numbers, so the outcome is the same as without.
+struct carried_estimate {
+    std::optional<units::mass> weight;
+    std::optional<units::volume> volume;
+    // Ammo that no carried ammo container can take any more of
+    std::set<itype_id> ammo_without_container;
+
+    bool can_pick_weight( const Character &u, units::mass add ) {
+        const units::mass limit = u.max_pick_weight( false );
+        if( weight && *weight + add <= limit ) {
+            return true;
+        }
+        weight = u.weight_carried();
+        return *weight + add <= limit;
+    }
+
+    bool can_pick_volume( const Character &u, units::volume add ) {
+        const units::volume limit = u.volume_capacity();
+        if( volume && *volume + add <= limit ) {
+            return true;
+        }
+        volume = u.volume_carried();
+        return *volume + add <= limit;
+    }
+
+    void added( units::mass add_weight, units::volume add_volume ) {
+        if( weight ) {
+            *weight += add_weight;
+        }
+        if( volume ) {
+            *volume += add_volume;
+        }
+    }
+
+    // After anything but putting items into the inventory
+    void invalidate() {
+        weight.reset();
+        volume.reset();
+        ammo_without_container.clear();
+    }
+};
+
+static bool holds_ammo_container( const item &it )
+{
+    return it.has_item_with( []( const item & e ) {
+        return e.is_ammo_container();
+    } );
+}
+
 static bool pick_one_up( pickup::pick_drop_selection &selection, bool &got_water,
-                         bool &offered_swap,
-                         pickup_map &map_pickup, bool autopickup )
+                         bool &offered_swap, pickup_map &map_pickup,
+                         carried_estimate &carried, bool autopickup )
 {
     player &u = get_avatar();
     int moves_taken = 100;
@@ -275,7 +328,18 @@ static bool pick_one_up( pickup::pick_drop_selection &selection, bool &got_water
     auto with_det = [&]( detached_ptr<item> &&newloc ) {
 
         // Ammo can sometimes be picked up into containers
-        newloc = u.i_add_to_container( std::move( newloc ), false );
+        if( newloc->is_ammo() && !carried.ammo_without_container.contains( newloc->typeId() ) ) {
+            const units::mass weight_before = newloc->weight();
+            const units::volume volume_before = newloc->volume();
+            const int charges_before = newloc->charges;
+            newloc = u.i_add_to_container( std::move( newloc ), false );
+            if( newloc && newloc->charges == charges_before ) {
+                carried.ammo_without_container.insert( newloc->typeId() );
+            } else {
+                // Full volume, the containers might not be rigid
+                carried.added( weight_before, volume_before );
+            }
+        }
 
         if( !newloc || ( newloc->count_by_charges() && newloc->charges == 0 ) ) {
             // We've picked up everything into containers, skip the options part
@@ -283,7 +347,7 @@ static bool pick_one_up( pickup::pick_drop_selection &selection, bool &got_water
             option = NUM_ANSWERS;
         } else if( newloc->made_of( LIQUID ) ) {
             got_water = true;
-        } else if( !u.can_pick_weight( newloc->weight() + children_weight, false ) ) {
+        } else if( !carried.can_pick_weight( u, newloc->weight() + children_weight ) ) {
             if( !autopickup ) {
                 const std::string &explain = string_format( _( "The %s is too heavy!" ),
                                              newloc->display_name() );
@@ -301,7 +365,7 @@ static bool pick_one_up( pickup::pick_drop_selection &selection, bool &got_water
             } else {
                 option = CANCEL;
             }
-        } else if( !u.can_pick_volume( newloc->volume() + children_volume ) ) {
+        } else if( !carried.can_pick_volume( u, newloc->volume() + children_volume ) ) {
             if( !autopickup ) {
                 const std::string &explain = string_format( _( "Not enough capacity to stash %s" ),
                                              newloc->display_name() );
@@ -323,10 +387,12 @@ static bool pick_one_up( pickup::pick_drop_selection &selection, bool &got_water
                 picked_up = false;
                 break;
             case WEAR:
+                carried.invalidate();
                 newloc = u.wear_item( std::move( newloc ) );
                 picked_up = !newloc;
                 break;
             case WIELD: {
+                carried.invalidate();
                 const ret_val<bool> wield_check = u.can_wield( *newloc );
                 if( wield_check.success() ) {
 
@@ -362,6 +428,12 @@ static bool pick_one_up( pickup::pick_drop_selection &selection, bool &got_water
                 auto &entry = map_pickup[newloc->tname()];
                 entry.second += newloc->count();
                 entry.first = &*newloc;
+                if( option != STASH || did_prompt || holds_ammo_container( *newloc ) ) {
+                    carried.invalidate();
+                } else {
+                    carried.added( newloc->weight() + children_weight,
+                                   newloc->volume() + children_volume );
+                }
                 u.i_add( std::move( newloc ) );
                 picked_up = true;
                 break;
@@ -409,6 +481,7 @@ bool do_pickup( std::vector<pick_drop_selection> &targets, bool autopickup )
     // Map of items picked up so we can output them all at the end and
     // merge dropping items with the same name.
     pickup_map map_pickup;
+    carried_estimate carried;
 
     bool problem = false;
     while( !problem && u.get_moves() >= 0 && !targets.empty() ) {
@@ -422,7 +495,8 @@ bool do_pickup( std::vector<pick_drop_selection> &targets, bool autopickup )
         }
 
         // TODO: This invocation is very ugly, should get a proper structure or something
-        problem = !pick_one_up( current_target, got_water, offered_swap, map_pickup, autopickup );
+        problem = !pick_one_up( current_target, got_water, offered_swap, map_pickup, carried,
+                                autopickup );
     }
 
     if( !map_pickup.empty() ) {
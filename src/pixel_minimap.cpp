@@ -32,6 +32,7 @@
 #include "monster.h"
 #include "pixel_minimap_projectors.h"
 #include "sdl_utils.h"
+#include "thread_pool.h"
 #include "vehicle.h"
 #include "vehicle_part.h"
 #include "vpart_position.h"
@@ -302,13 +303,12 @@ void pixel_minimap::flush_cache_updates()
     }
 }
 
-void pixel_minimap::update_cache_at( const tripoint &sm_pos )
+void pixel_minimap::update_cache_at( const tripoint &sm_pos, submap_cache &cache_item ) const
 {
     const map &here = get_map();
     const level_cache &access_cache = here.access_cache( sm_pos.z );
     const bool nv_goggle = get_avatar().get_vision_modes()[NV_GOGGLES];
 
-    submap_cache &cache_item = get_cache_at( here.get_abs_sub() + sm_pos );
     const tripoint ms_pos = sm_to_ms_copy( sm_pos );
 
     cache_item.touched = true;
@@ -365,11 +365,20 @@ void pixel_minimap::process_cache( const tripoint &center )
 {
     prepare_cache_for_updates( center );
 
+    // Finding the caches can add to the map, after that every submap only touches its own
+    const tripoint abs_sub = get_map().get_abs_sub();
+    std::vector<std::pair<tripoint, submap_cache *>> submaps;
+    submaps.reserve( MAPSIZE * MAPSIZE );
     for( int y = 0; y < MAPSIZE; ++y ) {
         for( int x = 0; x < MAPSIZE; ++x ) {
-            update_cache_at( { x, y, center.z } );
+            const tripoint sm_pos( x, y, center.z );
+            submaps.emplace_back( sm_pos, &get_cache_at( abs_sub + sm_pos ) );
         }
     }
+    // Only the colors are computed on the workers, textures are updated here
+    get_thread_pool().parallel_for( 0, static_cast<int>( submaps.size() ), [&]( int i ) {
+        update_cache_at( submaps[i].first, *submaps[i].second );
+    } );
 
     flush_cache_updates();
     clear_unused_cache();
@@ -56,7 +56,8 @@ class pixel_minimap
         void process_cache( const tripoint &center );
 
         void flush_cache_updates();
-        void update_cache_at( const tripoint &pos );
+        /** Computes the colors of one submap, safe to run concurrently for different submaps. */
+        void update_cache_at( const tripoint &sm_pos, submap_cache &cache_item ) const;
         void prepare_cache_for_updates( const tripoint &center );
         void clear_unused_cache();
 
@@ -113,4 +113,14 @@
 
 #endif
 
+/** Names the calling thread in the profiler.  @p name is copied. */
+inline void set_profiler_thread_name( const char *name )
+{
+#if defined(USE_TRACY)
+    tracy::SetThreadName( name );
+#else
+    static_cast<void>( name );
+#endif
+}
+
 #endif // CATA_SRC_PROFILE_H
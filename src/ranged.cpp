@@ -5,6 +5,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <iterator>
+#include <map>
 #include <memory>
 #include <optional>
 #include <set>
@@ -153,6 +154,20 @@ static void cycle_action( item &weap, const tripoint &pos );
 dispersion_sources calculate_dispersion( const map &m, const Character &who, const item &gun,
         int at_recoil, bool burst );
 
+/**
+ * Numbers of the aiming panel that don't depend on the cursor position, only on the recoil
+ * values involved.  Moving the cursor between targets reuses them, anything else the player
+ * does in the targeting ui (aiming, switching firing modes or ammo) clears them.
+ */
+struct aim_panel_cache {
+    // By recoil of the aim type
+    std::map<int, dispersion_sources> dispersion;
+    // By recoil of the aim type and recoil the aiming starts from
+    std::map<std::pair<int, int>, int> moves;
+    // Delay and resulting recoil, by threshold of the aim mode and starting recoil
+    std::map<std::pair<int, double>, std::pair<int, double>> aim_delay;
+};
+
 class target_ui
 {
     public:
@@ -264,6 +279,7 @@ class target_ui
         // but increases the further away the new aim point will be
         // relative to the current one.
         double predicted_recoil = 0;
+        aim_panel_cache aim_cache;
 
         // For AOE spells, list of tiles affected by the spell
         // relevant for TargetMode::Spell
@@ -1636,7 +1652,7 @@ static double calculate_aim_cap( const Character &p, const tripoint &target )
 static int print_aim( const Character &p, const catacurses::window &w, int line_number,
                       input_context &ctxt, item &weapon,
                       const double target_size, const tripoint &pos, double predicted_recoil,
-                      item *load_loc )
+                      item *load_loc, aim_panel_cache &cache )
 {
     // This is absolute accuracy for the player.
     // TODO: push the calculations duplicated from Creature::deal_projectile_attack() and
@@ -1668,12 +1684,22 @@ static int print_aim( const Character &p, const catacurses::window &w, int line_
     int shots = std::max( 1, weapon.gun_current_mode().qty );
     const auto dispersion_fun = [&]( const ranged::aim_type & at ) {
         int at_recoil = at.has_threshold ? at.threshold : static_cast<int>( predicted_recoil );
-        return calculate_dispersion( get_map(), p, weapon, at_recoil, shots > 1 );
+        auto iter = cache.dispersion.find( at_recoil );
+        if( iter == cache.dispersion.end() ) {
+            iter = cache.dispersion.emplace( at_recoil, calculate_dispersion( get_map(), p, weapon,
+                                             at_recoil, shots > 1 ) ).first;
+        }
+        return iter->second;
     };
     const auto cost_fun = [&]( const ranged::aim_type & at ) {
         int at_recoil = at.has_threshold ? at.threshold : static_cast<int>( predicted_recoil );
-        return ranged::gun_engagement_moves( p, weapon, at_recoil, p.recoil ) +
-               ranged::time_to_attack( p, weapon, load_loc );
+        const std::pair<int, int> key( at_recoil, static_cast<int>( p.recoil ) );
+        auto iter = cache.moves.find( key );
+        if( iter == cache.moves.end() ) {
+            iter = cache.moves.emplace( key, ranged::gun_engagement_moves( p, weapon, at_recoil,
+                                        p.recoil ) + ranged::time_to_attack( p, weapon, load_loc ) ).first;
+        }
+        return iter->second;
     };
     const double range = rl_dist( p.pos(), pos );
     line_number = print_steadiness( w, line_number, steadiness );
@@ -2180,7 +2206,8 @@ std::vector<Creature *> targetable_creatures( const Character &c, const int rang
         const turret_data &turret )
 {
     const vehicle *veh_from_turret = turret ? turret.get_veh() : nullptr;
-    return g->get_creatures_if( [&c, range, veh_from_turret]( const Creature & critter ) -> bool {
+    return g->get_creatures_in_radius( c.pos(), range, [&c, range,
+    veh_from_turret]( const Creature & critter ) -> bool {
         if( std::round( rl_dist_exact( c.pos(), critter.pos() ) ) > range )
         {
             return false;
@@ -2403,7 +2430,9 @@ target_handler::trajectory target_ui::run()
         // Handle received input
         if( handle_cursor_movement( action, skip_redraw ) ) {
             continue;
-        } else if( action == "TOGGLE_SNAP_TO_TARGET" ) {
+        }
+        aim_cache = aim_panel_cache();
+        if( action == "TOGGLE_SNAP_TO_TARGET" ) {
             toggle_snap_to_target();
         } else if( action == "TOGGLE_TURRET_LINES" ) {
             draw_turret_lines = !draw_turret_lines;
@@ -3734,14 +3763,21 @@ void target_ui::panel_fire_mode_aim( int &text_y )
     double predicted_recoil = you->recoil;
     int predicted_delay = 0;
     if( aim_mode->has_threshold && aim_mode->threshold < you->recoil ) {
-        do {
-            const double aim_amount = ranged::aim_per_move( *you, *relevant, predicted_recoil );
-            if( aim_amount > 0 ) {
-                predicted_delay++;
-                predicted_recoil = std::max( predicted_recoil - aim_amount, 0.0 );
-            }
-        } while( predicted_recoil > aim_mode->threshold &&
-                 predicted_recoil - sight_dispersion > 0 );
+        const std::pair<int, double> key( aim_mode->threshold, you->recoil );
+        const auto cached = aim_cache.aim_delay.find( key );
+        if( cached != aim_cache.aim_delay.end() ) {
+            std::tie( predicted_delay, predicted_recoil ) = cached->second;
+        } else {
+            do {
+                const double aim_amount = ranged::aim_per_move( *you, *relevant, predicted_recoil );
+                if( aim_amount > 0 ) {
+                    predicted_delay++;
+                    predicted_recoil = std::max( predicted_recoil - aim_amount, 0.0 );
+                }
+            } while( predicted_recoil > aim_mode->threshold &&
+                     predicted_recoil - sight_dispersion > 0 );
+            aim_cache.aim_delay.emplace( key, std::make_pair( predicted_delay, predicted_recoil ) );
+        }
     } else {
         predicted_recoil = you->recoil;
     }
@@ -3751,7 +3787,7 @@ void target_ui::panel_fire_mode_aim( int &text_y )
 
     item *load_loc = activity->reload_loc ? &*activity->reload_loc : nullptr;
     text_y = print_aim( *you, w_target, text_y, ctxt, *relevant->gun_current_mode(),
-                        target_size, dst, predicted_recoil, load_loc );
+                        target_size, dst, predicted_recoil, load_loc, aim_cache );
 
     if( aim_mode->has_threshold ) {
         mvwprintw( w_target, point( 1, text_y++ ), _( "%s Delay: %i" ), aim_mode->name,
@@ -560,15 +560,20 @@ bool recipe::will_be_blacklisted() const
 std::function<bool( const item & )> recipe::get_component_filter(
     const recipe_filter_flags flags ) const
 {
-    detached_ptr<item> res = create_result();
-    item &result = *res;
-
-    // Disallow crafting of non-perishables with rotten components
-    // Make an exception for items with the ALLOW_ROTTEN flag such as seeds
-    const bool recipe_forbids_rotten =
-        result.is_food() && !result.goes_bad() && !has_flag( "ALLOW_ROTTEN" );
+    // Creating the result item is the expensive part, and its answers don't change
+    if( !result_rot ) {
+        detached_ptr<item> res = create_result();
+        const item &result = *res;
+        // Disallow crafting of non-perishables with rotten components
+        // Make an exception for items with the ALLOW_ROTTEN flag such as seeds
+        result_rot = result_rot_info{
+            result.is_food() && !result.goes_bad() && !has_flag( "ALLOW_ROTTEN" ),
+            result.goes_bad_after_opening()
+        };
+    }
+    const bool recipe_forbids_rotten = result_rot->forbids_rotten;
     const bool flags_forbid_rotten =
-        static_cast<bool>( flags & recipe_filter_flags::no_rotten ) && result.goes_bad_after_opening();
+        static_cast<bool>( flags & recipe_filter_flags::no_rotten ) && result_rot->goes_bad_after_opening;
     std::function<bool( const item & )> rotten_filter = return_true<item>;
     if( recipe_forbids_rotten || flags_forbid_rotten ) {
         rotten_filter = []( const item & component ) {
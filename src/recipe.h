@@ -205,6 +205,13 @@ class recipe
         /** Deduped version constructed from the above requirements_ */
         deduped_requirement_data deduped_requirements_;
 
+        /** What get_component_filter needs to know about the result, found on first use */
+        struct result_rot_info {
+            bool forbids_rotten;
+            bool goes_bad_after_opening;
+        };
+        mutable std::optional<result_rot_info> result_rot;
+
         std::set<std::string> flags;
 
         /** If set (zero or positive) set charges of output result for items counted by charges */
@@ -1,13 +1,18 @@
 #include "recipe_dictionary.h"
 
 #include <algorithm>
+#include <cstdint>
+#include <cwctype>
 #include <iterator>
+#include <locale>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <utility>
 
 #include "cata_algo.h"
 #include "cata_utility.h"
+#include "catacharset.h"
 #include "debug.h"
 #include "init.h"
 #include "input.h"
@@ -23,6 +28,7 @@
 #include "skill.h"
 #include "string_id.h"
 #include "string_utils.h"
+#include "translations.h"
 #include "uistate.h"
 #include "units.h"
 #include "value_ptr.h"
@@ -93,29 +99,6 @@ recipe_filter recipe_filter_by_component( const itype_id &c )
     };
 }
 
-// searches for left-anchored partial match in the relevant recipe requirements set
-template <class group>
-bool search_reqs( group gp, const std::string &txt )
-{
-    return std::any_of( gp.begin(), gp.end(), [&]( const typename group::value_type & opts ) {
-        return std::any_of( opts.begin(),
-        opts.end(), [&]( const typename group::value_type::value_type & e ) {
-            return lcmatch( e.to_string(), txt );
-        } );
-    } );
-}
-// template specialization to make component searches easier
-template<>
-bool search_reqs( std::vector<std::vector<item_comp> >  gp,
-                  const std::string &txt )
-{
-    return std::any_of( gp.begin(), gp.end(), [&]( const std::vector<item_comp> &opts ) {
-        return std::any_of( opts.begin(), opts.end(), [&]( const item_comp & ic ) {
-            return lcmatch( item::nname( ic.type ), txt );
-        } );
-    } );
-}
-
 std::vector<const recipe *> recipe_subset::favorite() const
 {
     std::vector<const recipe *> res;
@@ -158,52 +141,254 @@ std::vector<const recipe *> recipe_subset::recent() const
 
     return res;
 }
-std::vector<const recipe *> recipe_subset::search( const std::string &txt,
-        const search_type key ) const
+namespace
 {
-    std::vector<const recipe *> res;
 
-    std::copy_if( recipes.begin(), recipes.end(), std::back_inserter( res ), [&]( const recipe * r ) {
-        if( !*r || r->obsolete ) {
-            return false;
-        }
-        switch( key ) {
-            case search_type::name:
-                return lcmatch( r->result_name(), txt );
+using search_type = recipe_subset::search_type;
 
-            case search_type::skill:
-                return lcmatch( r->required_skills_string( nullptr, true, false ), txt );
+std::wstring search_text( const std::string &str )
+{
+    std::wstring text = utf8_to_wstr( str );
+    const auto &f = std::use_facet<std::ctype<wchar_t>>( std::locale{} );
+    f.tolower( text.data(), text.data() + text.size() );
+    return text;
+}
 
-            case search_type::primary_skill:
-                return lcmatch( r->skill_used->name(), txt );
+template <class group>
+void add_req_texts( const group &gp, std::vector<std::wstring> &out )
+{
+    for( const auto &opts : gp ) {
+        for( const auto &e : opts ) {
+            out.push_back( search_text( e.to_string() ) );
+        }
+    }
+}
 
-            case search_type::component:
-                return search_reqs( r->simple_requirements().get_components(), txt );
+void add_req_texts( const std::vector<std::vector<item_comp>> &gp, std::vector<std::wstring> &out )
+{
+    for( const std::vector<item_comp> &opts : gp ) {
+        for( const item_comp &ic : opts ) {
+            out.push_back( search_text( item::nname( ic.type ) ) );
+        }
+    }
+}
 
-            case search_type::tool:
-                return search_reqs( r->simple_requirements().get_tools(), txt );
+/** The texts lcmatch used to be called on, one entry per matchable string. */
+std::vector<std::wstring> recipe_texts( const recipe &r, search_type key )
+{
+    std::vector<std::wstring> res;
+    switch( key ) {
+        case search_type::name:
+            res.push_back( search_text( r.result_name() ) );
+            break;
+        case search_type::skill:
+            res.push_back( search_text( r.required_skills_string( nullptr, true, false ) ) );
+            break;
+        case search_type::primary_skill:
+            res.push_back( search_text( r.skill_used->name() ) );
+            break;
+        case search_type::component:
+            add_req_texts( r.simple_requirements().get_components(), res );
+            break;
+        case search_type::tool:
+            add_req_texts( r.simple_requirements().get_tools(), res );
+            break;
+        case search_type::quality:
+            add_req_texts( r.simple_requirements().get_qualities(), res );
+            break;
+        case search_type::quality_result:
+            for( const std::pair<const quality_id, int> &e : r.result()->qualities ) {
+                res.push_back( search_text( e.first->name.translated() ) );
+            }
+            break;
+        default:
+            break;
+    }
+    return res;
+}
 
-            case search_type::quality:
-                return search_reqs( r->simple_requirements().get_qualities(), txt );
+std::uint64_t trigram( const std::wstring &text, size_t pos )
+{
+    std::uint64_t key = 0;
+    for( size_t i = pos; i < pos + 3; i++ ) {
+        key = ( key << 21 ) | ( static_cast<std::uint64_t>( text[i] ) & 0x1fffff );
+    }
+    return key;
+}
+
+/**
+ * 0 if @p needle starts one of the @p texts, 1 if it starts a word in one of them, 2 if
+ * it is somewhere else, -1 if there is no match.
+ */
+int match_rank( const std::vector<std::wstring> &texts, const std::wstring &needle )
+{
+    int best = -1;
+    for( const std::wstring &text : texts ) {
+        for( size_t pos = text.find( needle ); pos != std::wstring::npos;
+             pos = text.find( needle, pos + 1 ) ) {
+            const int rank = pos == 0 ? 0 : std::iswalnum( text[pos - 1] ) ? 2 : 1;
+            if( best < 0 || rank < best ) {
+                best = rank;
+            }
+            if( best == 0 || rank == 2 ) {
+                break;
+            }
+        }
+        if( best == 0 ) {
+            break;
+        }
+    }
+    return best;
+}
+
+/**
+ * Lower cased search texts of all recipes for one search type, together with an index
+ * from every three character sequence to the recipes containing it.  Queries of three or
+ * more characters only look at the recipes containing all sequences of the query.
+ */
+struct recipe_text_index {
+    std::vector<const recipe *> recipes;
+    std::vector<std::vector<std::wstring>> texts;
+    std::unordered_map<const recipe *, size_t> position;
+    std::unordered_map<std::uint64_t, std::vector<size_t>> trigrams;
+
+    void build( search_type key ) {
+        for( const auto &e : recipe_dict ) {
+            const recipe &r = e.second;
+            if( !r || r.obsolete ) {
+                continue;
+            }
+            const size_t idx = recipes.size();
+            recipes.push_back( &r );
+            position.emplace( &r, idx );
+            texts.push_back( recipe_texts( r, key ) );
+            for( const std::wstring &text : texts.back() ) {
+                for( size_t i = 0; i + 3 <= text.size(); i++ ) {
+                    std::vector<size_t> &users = trigrams[trigram( text, i )];
+                    if( users.empty() || users.back() != idx ) {
+                        users.push_back( idx );
+                    }
+                }
+            }
+        }
+    }
 
-            case search_type::quality_result: {
-                const auto &quals = r->result()->qualities;
-                return std::any_of( quals.begin(), quals.end(), [&]( const std::pair<quality_id, int> &e ) {
-                    return lcmatch( e.first->name, txt );
-                } );
+    /** Recipes that may contain @p needle, nothing if the query is too short to tell. */
+    std::optional<std::vector<size_t>> candidates( const std::wstring &needle ) const {
+        if( needle.size() < 3 ) {
+            return std::nullopt;
+        }
+        std::vector<size_t> res;
+        for( size_t i = 0; i + 3 <= needle.size(); i++ ) {
+            const auto iter = trigrams.find( trigram( needle, i ) );
+            if( iter == trigrams.end() ) {
+                return std::vector<size_t>();
+            }
+            if( i == 0 ) {
+                res = iter->second;
+                continue;
             }
+            std::vector<size_t> both;
+            std::set_intersection( res.begin(), res.end(), iter->second.begin(), iter->second.end(),
+                                   std::back_inserter( both ) );
+            res = std::move( both );
+            if( res.empty() ) {
+                break;
+            }
+        }
+        return res;
+    }
+};
 
-            case search_type::description_result: {
-                //TODO!: push this up, it's a potentially infinite one I think
-                detached_ptr<item> result = r->create_result();
-                return lcmatch( remove_color_tags( result->info_string( iteminfo_query::no_conditions ) ), txt );
+class recipe_search_index
+{
+    public:
+        const recipe_text_index &get( search_type key ) {
+            if( language_version != detail::get_current_language_version() ) {
+                indexes.clear();
+                language_version = detail::get_current_language_version();
+            }
+            auto iter = indexes.find( key );
+            if( iter == indexes.end() ) {
+                iter = indexes.emplace( key, recipe_text_index() ).first;
+                iter->second.build( key );
             }
+            return iter->second;
+        }
+        void reset() {
+            indexes.clear();
+        }
+
+    private:
+        int language_version = INVALID_LANGUAGE_VERSION;
+        std::map<search_type, recipe_text_index> indexes;
+};
+
+recipe_search_index &get_recipe_search_index()
+{
+    static recipe_search_index index;
+    return index;
+}
+
+} // namespace
 
-            default:
+std::vector<const recipe *> recipe_subset::search( const std::string &txt,
+        const search_type key ) const
+{
+    std::vector<const recipe *> res;
+
+    if( key == search_type::description_result ) {
+        std::copy_if( recipes.begin(), recipes.end(), std::back_inserter( res ),
+        [&]( const recipe * r ) {
+            if( !*r || r->obsolete ) {
                 return false;
+            }
+            //TODO!: push this up, it's a potentially infinite one I think
+            detached_ptr<item> result = r->create_result();
+            return lcmatch( remove_color_tags( result->info_string( iteminfo_query::no_conditions ) ),
+                            txt );
+        } );
+        return res;
+    }
+
+    const recipe_text_index &index = get_recipe_search_index().get( key );
+    const std::wstring needle = search_text( txt );
+    std::vector<std::pair<int, const recipe *>> ranked;
+    const auto consider = [&]( const recipe * r, const std::vector<std::wstring> &texts ) {
+        const int rank = match_rank( texts, needle );
+        if( rank >= 0 ) {
+            ranked.emplace_back( rank, r );
         }
-    } );
+    };
 
+    const std::optional<std::vector<size_t>> candidates = index.candidates( needle );
+    if( candidates && candidates->size() < recipes.size() ) {
+        for( size_t idx : *candidates ) {
+            if( recipes.contains( index.recipes[idx] ) ) {
+                consider( index.recipes[idx], index.texts[idx] );
+            }
+        }
+    } else {
+        for( const recipe *r : recipes ) {
+            if( !*r || r->obsolete ) {
+                continue;
+            }
+            const auto iter = index.position.find( r );
+            if( iter != index.position.end() ) {
+                consider( r, index.texts[iter->second] );
+            } else {
+                // Not part of the dictionary
+                consider( r, recipe_texts( *r, key ) );
+            }
+        }
+    }
+
+    // Best matches first, otherwise in the order of the subset (which is by address)
+    std::sort( ranked.begin(), ranked.end() );
+    res.reserve( ranked.size() );
+    for( const std::pair<int, const recipe *> &e : ranked ) {
+        res.push_back( e.second );
+    }
     return res;
 }
 
@@ -439,6 +624,7 @@ void recipe_dictionary::finalize()
 
     finalize_internal( recipe_dict.recipes );
     finalize_internal( recipe_dict.uncraft );
+    get_recipe_search_index().reset();
 
     for( auto &e : recipe_dict.recipes ) {
         auto &r = e.second;
@@ -496,6 +682,7 @@ void recipe_dictionary::reset()
     recipe_dict.recipes.clear();
     recipe_dict.uncraft.clear();
     recipe_dict.items_on_loops.clear();
+    get_recipe_search_index().reset();
 }
 
 void recipe_dictionary::delete_if( const std::function<bool( const recipe & )> &pred )
@@ -148,6 +148,79 @@ void rng_set_engine_seed( unsigned int seed )
     }
 }
 
+// splitmix64, used to expand a seed into the full state
+static std::uint64_t mix_seed( std::uint64_t &x )
+{
+    std::uint64_t z = ( x += 0x9e3779b97f4a7c15ULL );
+    z = ( z ^ ( z >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+    z = ( z ^ ( z >> 27 ) ) * 0x94d049bb133111ebULL;
+    return z ^ ( z >> 31 );
+}
+
+static std::uint64_t rotl( const std::uint64_t x, const int k )
+{
+    return ( x << k ) | ( x >> ( 64 - k ) );
+}
+
+rng_stream::rng_stream( std::uint64_t seed )
+{
+    for( std::uint64_t &s : state ) {
+        s = mix_seed( seed );
+    }
+}
+
+rng_stream::rng_stream( const std::uint64_t world_seed, const rng_domain domain,
+                        const std::uint64_t key ) :
+    rng_stream( rng_stream( world_seed ).fork( static_cast<std::uint64_t>( domain ) ).fork( key ) )
+{
+}
+
+rng_stream::result_type rng_stream::operator()()
+{
+    const std::uint64_t result = rotl( state[1] * 5, 7 ) * 9;
+    const std::uint64_t t = state[1] << 17;
+    state[2] ^= state[0];
+    state[3] ^= state[1];
+    state[1] ^= state[2];
+    state[0] ^= state[3];
+    state[2] ^= t;
+    state[3] = rotl( state[3], 45 );
+    return result;
+}
+
+rng_stream rng_stream::fork( const std::uint64_t key ) const
+{
+    std::uint64_t x = state[0] ^ rotl( state[1], 17 ) ^ rotl( state[2], 31 ) ^ rotl( state[3], 47 );
+    std::uint64_t k = key;
+    return rng_stream( mix_seed( x ) ^ mix_seed( k ) );
+}
+
+int rng( rng_stream &stream, int lo, int hi )
+{
+    if( lo > hi ) {
+        std::swap( lo, hi );
+    }
+    return std::uniform_int_distribution<int>( lo, hi )( stream );
+}
+
+double rng_float( rng_stream &stream, double lo, double hi )
+{
+    if( lo > hi ) {
+        std::swap( lo, hi );
+    }
+    return std::uniform_real_distribution<double>( lo, hi )( stream );
+}
+
+bool one_in( rng_stream &stream, int chance )
+{
+    return chance <= 1 || rng( stream, 0, chance - 1 ) == 0;
+}
+
+bool x_in_y( rng_stream &stream, double x, double y )
+{
+    return rng_float( stream, 0.0, 1.0 ) <= x / y;
+}
+
 namespace weighted_list_detail
 {
 unsigned int gen_rand_i()
@@ -3,6 +3,7 @@
 #define CATA_SRC_RNG_H
 
 #include <array>
+#include <cstdint>
 #include <functional>
 #include <iosfwd>
 #include <optional>
@@ -28,6 +29,54 @@ using cata_default_random_engine = std::minstd_rand0;
 cata_default_random_engine &rng_get_engine();
 unsigned int rng_bits();
 
+/** Subsystems that get their own @ref rng_stream, so they don't disturb each other's rolls. */
+enum class rng_domain : int {
+    mapgen,
+    monster_ai,
+    weather,
+    combat,
+};
+
+/**
+ * Seedable random number engine (xoshiro256**) that is independent of the global engine.
+ *
+ * Work that should come out the same no matter in which order (or on which thread) it is
+ * done creates its own stream from the world seed and something that identifies the work,
+ * e.g. the turn or the location, and forks a child stream for each part of it.
+ * Satisfies UniformRandomBitGenerator, so it works with the distributions from <random>.
+ */
+class rng_stream
+{
+    public:
+        using result_type = std::uint64_t;
+
+        explicit rng_stream( std::uint64_t seed );
+        /** Stream for the given subsystem, derived from the world seed and a key. */
+        rng_stream( std::uint64_t world_seed, rng_domain domain, std::uint64_t key );
+
+        static constexpr result_type min() {
+            return 0;
+        }
+        static constexpr result_type max() {
+            return UINT64_MAX;
+        }
+        result_type operator()();
+
+        /**
+         * Child stream for a sub-task. Depends only on the state of this stream and the key,
+         * and does not advance this stream, so children can be created in any order.
+         */
+        rng_stream fork( std::uint64_t key ) const;
+
+    private:
+        std::array<std::uint64_t, 4> state;
+};
+
+int rng( rng_stream &stream, int lo, int hi );
+double rng_float( rng_stream &stream, double lo, double hi );
+bool one_in( rng_stream &stream, int chance );
+bool x_in_y( rng_stream &stream, double x, double y );
+
 int rng( int lo, int hi );
 double rng_float( double lo, double hi );
 
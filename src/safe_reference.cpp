@@ -159,6 +159,7 @@ void safe_reference<T>::cleanup()
 {
     std::set<record *> records;
     for( auto &rec : records_by_pointer ) {
+        record_of( rec.first ) = nullptr;
         records.insert( rec.second );
     }
     for( auto &rec : records_by_id ) {
@@ -187,18 +188,19 @@ void safe_reference<T>::register_load( T *obj, id_type id )
         record *rec = new record( obj, id );
         records_by_id.insert( {id, rec} );
         records_by_pointer.insert( {obj, rec} );
+        record_of( obj ) = rec;
     }
 }
 
 template<typename T>
 typename safe_reference<T>::id_type safe_reference<T>::lookup_id( const T *obj )
 {
-    rbp_it search = records_by_pointer.find( obj );
-    if( search != records_by_pointer.end() ) {
-        if( search->second->id == ID_NONE ) {
-            search->second->id = generate_new_id();
+    record *rec = record_of( obj );
+    if( rec != nullptr ) {
+        if( rec->id == ID_NONE ) {
+            rec->id = generate_new_id();
         }
-        return search->second->id;
+        return rec->id;
     }
     return ID_NONE;
 }
@@ -206,21 +208,21 @@ typename safe_reference<T>::id_type safe_reference<T>::lookup_id( const T *obj )
 template<typename T>
 void safe_reference<T>::mark_destroyed( T *obj )
 {
-    rbp_it search = records_by_pointer.find( obj );
-    if( search == records_by_pointer.end() ) {
+    record *rec = record_of( obj );
+    if( rec == nullptr ) {
         return;
     }
-    search->second->id |= DESTROYED_MASK;
+    rec->id |= DESTROYED_MASK;
 }
 
 template<typename T>
 void safe_reference<T>::mark_deallocated( T *obj )
 {
-    rbp_it search = records_by_pointer.find( obj );
-    if( search == records_by_pointer.end() ) {
+    if( record_of( obj ) == nullptr ) {
         return;
     }
-    records_by_pointer.erase( search );
+    records_by_pointer.erase( obj );
+    record_of( obj ) = nullptr;
 }
 
 template<typename T>
@@ -22,7 +22,10 @@
  * is set the pointer instead points to another record.
  *
  * Two in-memory global (really per GO type) unordered_maps are used to manage this. One that
- * contains object pointers -> record pointers and one that contains ids -> record pointers. There
+ * contains object pointers -> record pointers and one that contains ids -> record pointers. The
+ * record of a live object is also stored in the object itself (game_object::safe_ref_record), so
+ * going from an object to its record never needs the first map; it's kept in sync for merges
+ * and cleanup. Deleting an object nothing refers to doesn't touch either map. There
  * are also two global json structures created when saving. These store the json counts of IDs and a
  * table of ID redirects. Both of these are cleaned when the json count for an ID hits 0. Objects
  * are not given a record until a safe reference to them is first created. These records can exist
@@ -61,6 +64,7 @@ class JsonOut;
 
 template<typename T> class cata_arena;
 template<typename T> class cache_reference;
+template<typename T> class game_object;
 
 void reset_save_ids( uint32_t prefix, bool quitting );
 
@@ -79,6 +83,7 @@ class safe_reference
         friend T;
         friend game;
         friend cata_arena<T>;
+        friend game_object<T>;
 
     protected:
         using rbp_type = std::unordered_map<const T *, record *>;
@@ -114,13 +119,25 @@ class safe_reference
         inline static rbi_type records_by_id;
         inline static uint32_t next_id = 1;
 
+        static record *&record_of( const T *obj ) {
+            return obj->safe_ref_record;
+        }
+
+        /** Drops the pointer entry of @p r, unless its target has since been deallocated. */
+        static void forget_pointer( record *r ) {
+            rbp_it search = records_by_pointer.find( r->target.p );
+            if( search != records_by_pointer.end() && search->second == r ) {
+                record_of( search->first ) = nullptr;
+                records_by_pointer.erase( search );
+            }
+        }
+
         void fill( T *obj ) {
-            rbp_it search = records_by_pointer.find( obj );
-            if( search != records_by_pointer.end() ) {
-                rec = search->second;
-            } else {
+            rec = record_of( obj );
+            if( rec == nullptr ) {
                 rec = new record( obj );
                 records_by_pointer.insert( {obj, rec} );
+                record_of( obj ) = rec;
             }
         }
         void fill( id_type id ) {
@@ -169,13 +186,13 @@ class safe_reference
             if( rec->mem_count == 1 ) {
                 if( base_id( rec->id ) == ID_NONE ) {
                     //If the record doesn't have an ID it's ok to just forget it
-                    records_by_pointer.erase( rec->target.p );
+                    forget_pointer( rec );
                     delete rec;
                 } else if( rec->json_count == 0 && id_is_destroyed( rec->id ) ) {
                     //If there are no more references and the object is destroyed, forget it
                     records_by_id.erase( rec->id );
                     if( rec->target.p != nullptr ) {
-                        records_by_pointer.erase( rec->target.p );
+                        forget_pointer( rec );
                     }
                     delete rec;
                 } else {
@@ -340,31 +357,30 @@ class safe_reference
          */
         static void merge( T *primary, T *secondary ) {
 
-            rbp_it sec_search = records_by_pointer.find( secondary );
+            record *sec_rec = record_of( secondary );
 
             // The secondary doesn't have a record (i.e. there are no references
             // to it to redirect) so there's nothing to do
-            if( sec_search == records_by_pointer.end() ) {
+            if( sec_rec == nullptr ) {
                 return;
             }
 
-            rbp_it pri_search = records_by_pointer.find( primary );
+            record *pri_rec = record_of( primary );
 
             //The primary doesn't have a record but the secondary does
-            if( pri_search == records_by_pointer.end() ) {
+            if( pri_rec == nullptr ) {
                 //change the secondary's record to point to the primary now
-                record *rec = sec_search->second;
-                rec->target.p = primary;
+                sec_rec->target.p = primary;
                 records_by_pointer.erase( secondary );
-                records_by_pointer.insert( {primary, rec} );
+                records_by_pointer.insert( {primary, sec_rec} );
+                record_of( secondary ) = nullptr;
+                record_of( primary ) = sec_rec;
                 return;
             }
 
             // They both have a record
             // Neither of these records should be a redirect as this would imply
             // that a secondary wasn't destroyed after being merged
-            record *pri_rec = pri_search->second;
-            record *sec_rec = sec_search->second;
 
             //If the secondary doesn't have an ID
             if( sec_rec->id == ID_NONE ) {
@@ -1271,7 +1271,9 @@ void faction_manager::deserialize( JsonIn &jsin )
 void Creature_tracker::deserialize( JsonIn &jsin )
 {
     monsters_list.clear();
-    monsters_by_location.clear();
+    monster_slots.clear();
+    removed_slots = 0;
+    clear_locations();
     jsin.start_array();
     while( !jsin.end_array() ) {
         // TODO: would be nice if monster had a constructor using JsonIn or similar, so this could be one statement.
@@ -1284,7 +1286,7 @@ void Creature_tracker::deserialize( JsonIn &jsin )
 void Creature_tracker::serialize( JsonOut &jsout ) const
 {
     jsout.start_array();
-    for( const auto &monster_ptr : monsters_list ) {
+    for( const auto &monster_ptr : get_monsters_list() ) {
         jsout.write( *monster_ptr );
     }
     jsout.end_array();
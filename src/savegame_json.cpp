@@ -3600,7 +3600,13 @@ void event_multiset::deserialize( JsonIn &jsin )
     jo.allow_omitted_members();
     std::vector<std::pair<cata::event::data_type, int>> copy;
     jo.read( "event_counts", copy );
-    counts_ = { copy.begin(), copy.end() };
+    counts_.clear();
+    count_ = 0;
+    summaries_.clear();
+    for( const std::pair<cata::event::data_type, int> &entry : copy ) {
+        counts_[entry.first] += entry.second;
+        add_to_summaries( entry.first, entry.second );
+    }
 }
 
 void stats_tracker::serialize( JsonOut &jsout ) const
@@ -3622,52 +3628,117 @@ void stats_tracker::deserialize( JsonIn &jsin )
     jo.read( "initial_scores", initial_scores );
 }
 
-void submap::store( JsonOut &jsout ) const
+// Tile layers are saved as the palette of ids used in the submap, followed by
+// run-length encoded (palette index, count) pairs in row order.  Each id string is
+// then written and looked up only once per submap instead of once per tile.
+template<typename T>
+static void store_tile_layer( JsonOut &jsout, const std::string &name,
+                              const int_id<T> ( &layer )[SEEX][SEEY] )
 {
-    jsout.member( "turn_last_touched", last_touched );
-    jsout.member( "temperature", temperature );
-
-    // Terrain is saved using a simple RLE scheme.  Legacy saves don't have
-    // this feature but the algorithm is backward compatible.
-    jsout.member( "terrain" );
-    jsout.start_array();
-    std::string last_id;
-    int num_same = 1;
+    std::vector<int_id<T>> palette;
+    std::vector<std::pair<int, int>> runs;
     for( int j = 0; j < SEEY; j++ ) {
-        // NOLINTNEXTLINE(modernize-loop-convert)
         for( int i = 0; i < SEEX; i++ ) {
-            const std::string this_id = ter[i][j].obj().id.str();
-            if( !last_id.empty() ) {
-                if( this_id == last_id ) {
-                    num_same++;
-                } else {
-                    if( num_same == 1 ) {
-                        // if there's only one element don't write as an array
-                        jsout.write( last_id );
-                    } else {
-                        jsout.start_array();
-                        jsout.write( last_id );
-                        jsout.write( num_same );
-                        jsout.end_array();
-                        num_same = 1;
-                    }
-                    last_id = this_id;
-                }
+            const auto iter = std::find( palette.begin(), palette.end(), layer[i][j] );
+            const int index = std::distance( palette.begin(), iter );
+            if( iter == palette.end() ) {
+                palette.push_back( layer[i][j] );
+            }
+            if( !runs.empty() && runs.back().first == index ) {
+                runs.back().second++;
             } else {
-                last_id = this_id;
+                runs.emplace_back( index, 1 );
             }
         }
     }
-    // Because of the RLE scheme we have to do one last pass
-    if( num_same == 1 ) {
-        jsout.write( last_id );
-    } else {
-        jsout.start_array();
-        jsout.write( last_id );
-        jsout.write( num_same );
-        jsout.end_array();
+
+    jsout.member( name );
+    jsout.start_array();
+    jsout.start_array();
+    for( const int_id<T> &id : palette ) {
+        jsout.write( id.id().str() );
     }
     jsout.end_array();
+    for( const std::pair<int, int> &run : runs ) {
+        jsout.write( run.first );
+        jsout.write( run.second );
+    }
+    jsout.end_array();
+}
+
+template<typename T>
+static void load_tile_layer( JsonIn &jsin, int_id<T> ( &layer )[SEEX][SEEY] )
+{
+    std::vector<int_id<T>> palette;
+    jsin.start_array();
+    jsin.start_array();
+    while( !jsin.end_array() ) {
+        palette.push_back( string_id<T>( jsin.get_string() ).id() );
+    }
+    int cell = 0;
+    while( !jsin.end_array() ) {
+        const int index = jsin.get_int();
+        const int count = jsin.get_int();
+        if( index < 0 || index >= static_cast<int>( palette.size() ) || count < 0 ||
+            cell + count > SEEX * SEEY ) {
+            jsin.error( "Mapbuffer tile layer is corrupt." );
+        }
+        for( int n = 0; n < count; n++, cell++ ) {
+            layer[cell % SEEX][cell / SEEX] = palette[index];
+        }
+    }
+    if( cell != SEEX * SEEY ) {
+        debugmsg( "Mapbuffer tile layer is corrupt, tile data missing." );
+    }
+}
+
+// Runs of identical items, like the contents of a storage room full of nails, are written
+// once, preceded by the length of the run.  Items are compared by their serialized form,
+// so the copies read back are exactly what would have been read without the grouping.
+static void store_item_runs( JsonOut &jsout, const location_vector<item> &items )
+{
+    jsout.start_array();
+    std::string run;
+    int run_length = 0;
+    const auto write_run = [&]() {
+        if( run_length > 1 ) {
+            jsout.write( run_length );
+        }
+        jsout.write_separator();
+        *jsout.get_stream() << run;
+        jsout.set_need_separator();
+    };
+    // One stream for all items of the tile, setting up a new one per item costs more than
+    // writing most items
+    std::ostringstream buffer;
+    for( const item * const &it : items ) {
+        buffer.str( std::string() );
+        JsonOut item_out( buffer );
+        item_out.write( *it );
+        if( run_length > 0 && buffer.view() == run ) {
+            run_length++;
+            continue;
+        }
+        if( run_length > 0 ) {
+            write_run();
+        }
+        run = std::move( buffer ).str();
+        run_length = 1;
+    }
+    if( run_length > 0 ) {
+        write_run();
+    }
+    jsout.end_array();
+}
+
+void submap::store( JsonOut &jsout ) const
+{
+    jsout.member( "turn_last_touched", last_touched );
+    jsout.member( "temperature", temperature );
+
+    store_tile_layer( jsout, "terrain_layer", ter );
+    store_tile_layer( jsout, "furniture_layer", frn );
+    store_tile_layer( jsout, "trap_layer", trp );
 
     // Write out the radiation array in a simple RLE scheme.
     // written in intensity, count pairs
@@ -3695,23 +3766,6 @@ void submap::store( JsonOut &jsout ) const
     jsout.write( count );
     jsout.end_array();
 
-    jsout.member( "furniture" );
-    jsout.start_array();
-    for( int j = 0; j < SEEY; j++ ) {
-        for( int i = 0; i < SEEX; i++ ) {
-            const point p( i, j );
-            // Save furniture
-            if( get_furn( p ) ) {
-                jsout.start_array();
-                jsout.write( p.x );
-                jsout.write( p.y );
-                jsout.write( get_furn( p ).obj().id );
-                jsout.end_array();
-            }
-        }
-    }
-    jsout.end_array();
-
     jsout.member( "items" );
     jsout.start_array();
     for( int j = 0; j < SEEY; j++ ) {
@@ -3721,25 +3775,7 @@ void submap::store( JsonOut &jsout ) const
             }
             jsout.write( i );
             jsout.write( j );
-            jsout.write( itm[i][j] );
-        }
-    }
-    jsout.end_array();
-
-    jsout.member( "traps" );
-    jsout.start_array();
-    for( int j = 0; j < SEEY; j++ ) {
-        for( int i = 0; i < SEEX; i++ ) {
-            const point p( i, j );
-            // Save traps
-            if( get_trap( p ) ) {
-                jsout.start_array();
-                jsout.write( p.x );
-                jsout.write( p.y );
-                // TODO: jsout should support writing an id like jsout.write( trap_id )
-                jsout.write( get_trap( p ).id().str() );
-                jsout.end_array();
-            }
+            store_item_runs( jsout, itm[i][j] );
         }
     }
     jsout.end_array();
@@ -3851,7 +3887,14 @@ void submap::load( JsonIn &jsin, const std::string &member_name, int version,
         last_touched = calendar::turn_zero + time_duration::from_turns( jsin.get_int() );
     } else if( member_name == "temperature" ) {
         temperature = jsin.get_int();
+    } else if( member_name == "terrain_layer" ) {
+        load_tile_layer( jsin, ter );
+    } else if( member_name == "furniture_layer" ) {
+        load_tile_layer( jsin, frn );
+    } else if( member_name == "trap_layer" ) {
+        load_tile_layer( jsin, trp );
     } else if( member_name == "terrain" ) {
+        // Legacy format
         // TODO: try block around this to error out if we come up short?
         jsin.start_array();
         // terrain is encoded using simple RLE
@@ -3911,20 +3954,31 @@ void submap::load( JsonIn &jsin, const std::string &member_name, int version,
             const point p( i, j );
             jsin.start_array();
             while( !jsin.end_array() ) {
-                detached_ptr<item> tmp;
-                jsin.read( tmp );
-
-                if( tmp->is_emissive() ) {
-                    update_lum_add( p, *tmp );
+                // See store_item_runs
+                int run_length = 1;
+                if( jsin.test_int() ) {
+                    run_length = jsin.get_int();
                 }
+                const int item_pos = jsin.tell();
+                for( int n = 0; n < run_length; n++ ) {
+                    if( n > 0 ) {
+                        jsin.seek( item_pos );
+                    }
+                    detached_ptr<item> tmp;
+                    jsin.read( tmp );
 
-                if( savegame_loading_version >= 27 && version < 27 ) {
-                    tmp->legacy_fast_forward_time();
-                }
-                item &obj = *tmp;
-                itm[p.x][p.y].push_back( std::move( tmp ) );
-                if( obj.needs_processing() ) {
-                    active_items.add( obj );
+                    if( tmp->is_emissive() ) {
+                        update_lum_add( p, *tmp );
+                    }
+
+                    if( savegame_loading_version >= 27 && version < 27 ) {
+                        tmp->legacy_fast_forward_time();
+                    }
+                    item &obj = *tmp;
+                    itm[p.x][p.y].push_back( std::move( tmp ) );
+                    if( obj.needs_processing() ) {
+                        active_items.add( obj );
+                    }
                 }
             }
         }
@@ -3976,6 +4030,7 @@ void submap::load( JsonIn &jsin, const std::string &member_name, int version,
                     field_count++;
                 }
                 fld[i][j].add_field( ft, intensity, time_duration::from_turns( age ) );
+                mark_field_tile( point( i, j ) );
             }
         }
     } else if( member_name == "graffiti" ) {
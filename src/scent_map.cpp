@@ -18,6 +18,12 @@
 
 static constexpr int SCENT_RADIUS = 40;
 
+// Area updated by scent_map::update, plus a column of neighbours on each side
+static constexpr int scratch_width = SCENT_RADIUS * 2 + 3;
+static constexpr int scratch_height = SCENT_RADIUS * 2 + 1;
+template<typename T>
+using scratch_array = std::array<std::array<T, scratch_height>, scratch_width>;
+
 static nc_color sev( const size_t level )
 {
     static const std::array<nc_color, 22> colors = { {
@@ -162,9 +168,13 @@ void scent_map::update( const tripoint &center, map &m )
     //block=0 reduce=1 normal=5
     scent_array<char> scent_transfer;
 
-    std::array < std::array < int, 3 + SCENT_RADIUS * 2 >, 1 + SCENT_RADIUS * 2 > new_scent;
-    std::array < std::array < int, 3 + SCENT_RADIUS * 2 >, 1 + SCENT_RADIUS * 2 > sum_3_scent_y;
-    std::array < std::array < char, 3 + SCENT_RADIUS * 2 >, 1 + SCENT_RADIUS * 2 > squares_used_y;
+    // The diffusion is separable: first sum each tile with its y neighbours, then sum
+    // those sums along x.  The scratch arrays are column major like grscent, so all the
+    // inner loops run over contiguous memory without branches and can be vectorized.
+    scratch_array<int> sum_3_scent_y;
+    scratch_array<int> squares_used_y;
+    scratch_array<int> total;
+    scratch_array<int> squares_used;
 
     diagonal_blocks( &blocked_cache )[MAPSIZE_X][MAPSIZE_Y] = m.access_cache(
                 center.z ).vehicle_obstructed_cache;
@@ -179,66 +189,63 @@ void scent_map::update( const tripoint &center, map &m )
     m.scent_blockers( scent_transfer, point( scentmap_minx - 1, scentmap_miny - 1 ),
                       point( scentmap_maxx + 1, scentmap_maxy + 1 ) );
 
-    for( int x = 0; x < SCENT_RADIUS * 2 + 3; ++x ) {
-        sum_3_scent_y[0][x] = 0;
-        squares_used_y[0][x] = 0;
-        sum_3_scent_y[SCENT_RADIUS * 2][x] = 0;
-        squares_used_y[SCENT_RADIUS * 2][x] = 0;
+    for( int x = 0; x < scratch_width; ++x ) {
+        // remember the sum of the scent val for the 3 neighboring squares that can defuse into
+        const int abs_x = x + scentmap_minx - 1;
+        const int *scent_col = grscent[abs_x].data() + scentmap_miny;
+        const char *transfer_col = scent_transfer[abs_x].data() + scentmap_miny;
+        for( int y = 0; y < scratch_height; ++y ) {
+            sum_3_scent_y[x][y] = transfer_col[y - 1] * scent_col[y - 1] +
+                                  transfer_col[y] * scent_col[y] +
+                                  transfer_col[y + 1] * scent_col[y + 1];
+            squares_used_y[x][y] = transfer_col[y - 1] + transfer_col[y] + transfer_col[y + 1];
+        }
     }
 
-    for( int x = 0; x < SCENT_RADIUS * 2 + 3; ++x ) {
-        for( int y = 0; y < SCENT_RADIUS * 2 + 1; ++y ) {
-
-            point abs( x + scentmap_minx - 1, y + scentmap_miny );
-
-            // remember the sum of the scent val for the 3 neighboring squares that can defuse into
-            sum_3_scent_y[y][x] = 0;
-            squares_used_y[y][x] = 0;
-            for( int i = abs.y - 1; i <= abs.y + 1; ++i ) {
-                sum_3_scent_y[y][x] += scent_transfer[abs.x][i] * grscent[abs.x][i];
-                squares_used_y[y][x] += scent_transfer[abs.x][i];
-            }
+    for( int x = 1; x < scratch_width - 1; ++x ) {
+        for( int y = 0; y < scratch_height; ++y ) {
+            squares_used[x][y] = squares_used_y[x - 1][y] + squares_used_y[x][y] +
+                                 squares_used_y[x + 1][y];
+            total[x][y] = sum_3_scent_y[x - 1][y] + sum_3_scent_y[x][y] + sum_3_scent_y[x + 1][y];
         }
     }
 
-    for( int x = 1; x < SCENT_RADIUS * 2 + 2; ++x ) {
-        for( int y = 0; y < SCENT_RADIUS * 2 + 1; ++y ) {
-            const point abs( x + scentmap_minx - 1, y + scentmap_miny );
-
-            int squares_used = squares_used_y[y][x - 1] + squares_used_y[y][x] + squares_used_y[y][x + 1];
-            int total = sum_3_scent_y[y][x - 1] + sum_3_scent_y[y][x] + sum_3_scent_y[y][x + 1];
-
-            //handle vehicle holes
+    //handle vehicle holes, these are rare enough for the branches to be cheap
+    for( int x = 1; x < scratch_width - 1; ++x ) {
+        const int abs_x = x + scentmap_minx - 1;
+        for( int y = 0; y < scratch_height; ++y ) {
+            const point abs( abs_x, y + scentmap_miny );
             if( blocked_cache[abs.x][abs.y].nw && scent_transfer[abs.x + 1][abs.y + 1] == 5 ) {
-                squares_used -= 4;
-                total -= 4 * grscent[abs.x + 1][abs.y + 1];
+                squares_used[x][y] -= 4;
+                total[x][y] -= 4 * grscent[abs.x + 1][abs.y + 1];
             }
             if( blocked_cache[abs.x][abs.y].ne && scent_transfer[abs.x - 1][abs.y + 1] == 5 ) {
-                squares_used -= 4;
-                total -= 4 * grscent[abs.x - 1][abs.y + 1];
+                squares_used[x][y] -= 4;
+                total[x][y] -= 4 * grscent[abs.x - 1][abs.y + 1];
             }
             if( blocked_cache[abs.x - 1][abs.y - 1].nw && scent_transfer[abs.x - 1][abs.y - 1] == 5 ) {
-                squares_used -= 4;
-                total -= 4 * grscent[abs.x - 1][abs.y - 1];
+                squares_used[x][y] -= 4;
+                total[x][y] -= 4 * grscent[abs.x - 1][abs.y - 1];
             }
             if( blocked_cache[abs.x + 1][abs.y - 1].ne && scent_transfer[abs.x + 1][abs.y - 1] == 5 ) {
-                squares_used -= 4;
-                total -= 4 * grscent[abs.x + 1][abs.y - 1];
+                squares_used[x][y] -= 4;
+                total[x][y] -= 4 * grscent[abs.x + 1][abs.y - 1];
             }
+        }
+    }
 
+    // Everything read from grscent is in the sums now, so it can be overwritten in place
+    for( int x = 1; x < scratch_width - 1; ++x ) {
+        const int abs_x = x + scentmap_minx - 1;
+        int *scent_col = grscent[abs_x].data() + scentmap_miny;
+        const char *transfer_col = scent_transfer[abs_x].data() + scentmap_miny;
+        for( int y = 0; y < scratch_height; ++y ) {
+            const int transfer = transfer_col[y];
             //Lingering scent
-            int temp_scent =  grscent[abs.x][abs.y] * ( 250 - squares_used  *
-                              scent_transfer[abs.x][abs.y] ) ;
-            temp_scent -=  grscent[abs.x][abs.y] * scent_transfer[abs.x][abs.y] *
-                           ( 45 - squares_used ) / 5;
+            int temp_scent = scent_col[y] * ( 250 - squares_used[x][y] * transfer );
+            temp_scent -= scent_col[y] * transfer * ( 45 - squares_used[x][y] ) / 5;
 
-            new_scent[y][x] = ( temp_scent + total * scent_transfer[abs.x][abs.y] ) / 250;
-
-        }
-    }
-    for( int x = 1; x < SCENT_RADIUS * 2 + 2; ++x ) {
-        for( int y = 0; y < SCENT_RADIUS * 2 + 1; ++y ) {
-            grscent[x + scentmap_minx - 1 ][y + scentmap_miny] = new_scent[y][x];
+            scent_col[y] = ( temp_scent + total[x][y] * transfer ) / 250;
         }
     }
 }
@@ -5,6 +5,7 @@
 #include <cstdlib>
 #include <algorithm>
 #include <chrono>
+#include <cstdint>
 #include <map>
 #include <string>
 #include <unordered_map>
@@ -44,6 +45,10 @@ struct sound_effect_resource {
         }
     };
     std::unique_ptr<Mix_Chunk, deleter> chunk;
+    // Preloaded chunks are never unloaded to stay within the cache size
+    bool preloaded = false;
+    // Value of sfx_use_counter when the chunk was last requested
+    std::uint64_t last_used = 0;
 };
 struct sound_effect {
     int volume;
@@ -90,6 +95,9 @@ static ambient_parameters current_ambient;
 
 static std::unordered_map<std::string, int> unique_paths;
 static sfx_resources_t sfx_resources;
+// Bytes of sample data held by the loaded chunks
+static size_t loaded_sfx_bytes = 0;
+static std::uint64_t sfx_use_counter = 0;
 static std::vector<id_and_variant> sfx_preload;
 
 bool sounds::sound_enabled = false;
@@ -349,16 +357,68 @@ static Mix_Chunk *load_chunk( const std::string &path )
 // Check to see if the resource has already been loaded
 // - Loaded: Return stored pointer
 // - Not Loaded: Load chunk from stored resource path
+static bool is_chunk_playing( const Mix_Chunk *chunk )
+{
+    const int channels = Mix_AllocateChannels( -1 );
+    for( int ch = 0; ch < channels; ch++ ) {
+        if( Mix_Playing( ch ) && Mix_GetChunk( ch ) == chunk ) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Unloads the least recently used chunks until the loaded ones fit into SOUND_EFFECT_CACHE_SIZE.
+// Preloaded chunks, chunks that are still playing and @p keep_id stay loaded.
+static void trim_sfx_cache( int keep_id )
+{
+    static const option_handle<int> cache_size_mb( "SOUND_EFFECT_CACHE_SIZE" );
+    const size_t budget = static_cast<size_t>( std::max( cache_size_mb.get(), 0 ) ) * 1024 * 1024;
+    while( budget > 0 && loaded_sfx_bytes > budget ) {
+        sound_effect_resource *oldest = nullptr;
+        for( size_t i = 0; i < sfx_resources.resource.size(); i++ ) {
+            sound_effect_resource &candidate = sfx_resources.resource[i];
+            if( !candidate.chunk || candidate.preloaded || static_cast<int>( i ) == keep_id ) {
+                continue;
+            }
+            if( oldest != nullptr && oldest->last_used <= candidate.last_used ) {
+                continue;
+            }
+            if( is_chunk_playing( candidate.chunk.get() ) ) {
+                continue;
+            }
+            oldest = &candidate;
+        }
+        if( oldest == nullptr ) {
+            return;
+        }
+        loaded_sfx_bytes -= oldest->chunk->alen;
+        oldest->chunk.reset();
+    }
+}
+
+// Check to see if the resource has already been loaded
+// - Loaded: Return stored pointer
+// - Not Loaded: Load chunk from stored resource path, unloading old chunks if needed
 static inline Mix_Chunk *get_sfx_resource( int resource_id )
 {
     sound_effect_resource &resource = sfx_resources.resource[ resource_id ];
+    resource.last_used = ++sfx_use_counter;
     if( !resource.chunk ) {
         std::string path = ( current_soundpack_path + "/" + resource.path );
         resource.chunk.reset( load_chunk( path ) );
+        loaded_sfx_bytes += resource.chunk->alen;
+        trim_sfx_cache( resource_id );
     }
     return resource.chunk.get();
 }
 
+static void preload_sfx_resource( int resource_id )
+{
+    sfx_resources.resource[ resource_id ].preloaded = true;
+    get_sfx_resource( resource_id );
+}
+
 static inline int add_sfx_path( const std::string &path )
 {
     auto find_result = unique_paths.find( path );
@@ -691,7 +751,7 @@ void load_soundset()
             for( const auto &[key, sfxs] : sfx_resources.sound_effects ) {
                 if( key.first == id ) {
                     for( const auto &sfx : sfxs ) {
-                        get_sfx_resource( sfx.resource_id );
+                        preload_sfx_resource( sfx.resource_id );
                     }
                 }
             }
@@ -699,7 +759,7 @@ void load_soundset()
             const auto find_result = sfx_resources.sound_effects.find( preload );
             if( find_result != sfx_resources.sound_effects.end() ) {
                 for( const auto &sfx : find_result->second ) {
-                    get_sfx_resource( sfx.resource_id );
+                    preload_sfx_resource( sfx.resource_id );
                 }
             }
         }
@@ -62,6 +62,7 @@
 #include "overmapbuffer.h"
 #include "path_info.h"
 #include "point.h"
+#include "profile.h"
 #include "rng.h"
 #include "sdl_wrappers.h"
 #include "sdl_geometry.h"
@@ -126,7 +127,7 @@ static int WindowWidth;        //Width of the actual window, not the curses wind
 static int WindowHeight;       //Height of the actual window, not the curses window
 // input from various input sources. Each input source sets the type and
 // the actual input value (key pressed, mouse button clicked, ...)
-// This value is finally returned by input_manager::get_input_event.
+// This value is finally returned by input_manager::get_platform_input_event.
 static input_event last_input;
 
 static constexpr int ERR = -1;
@@ -534,6 +535,49 @@ SDL_Rect get_android_render_rect( float DisplayBufferWidth, float DisplayBufferH
 
 #endif
 
+#if defined(USE_TRACY)
+// Every this many presented frames a thumbnail of the window goes to the profiler
+static constexpr int frame_image_interval = 10;
+static constexpr int frame_image_max_width = 320;
+
+// Has to run while the window is the render target, before presenting
+static void send_frame_image()
+{
+    static int frames = 0;
+    if( !TracyIsConnected || ++frames < frame_image_interval ) {
+        return;
+    }
+    frames = 0;
+    ZoneScoped;
+    int width = 0;
+    int height = 0;
+    if( SDL_GetRendererOutputSize( renderer.get(), &width, &height ) != 0 ) {
+        return;
+    }
+    // Tracy wants RGBA with both dimensions divisible by 4
+    const int step = std::max( 1, ( width + frame_image_max_width - 1 ) / frame_image_max_width );
+    const int thumb_width = width / step / 4 * 4;
+    const int thumb_height = height / step / 4 * 4;
+    if( thumb_width == 0 || thumb_height == 0 ) {
+        return;
+    }
+    std::vector<uint32_t> pixels( static_cast<size_t>( width ) * height );
+    if( SDL_RenderReadPixels( renderer.get(), nullptr, SDL_PIXELFORMAT_RGBA32, pixels.data(),
+                              width * 4 ) != 0 ) {
+        return;
+    }
+    std::vector<uint32_t> thumb( static_cast<size_t>( thumb_width ) * thumb_height );
+    for( int y = 0; y < thumb_height; y++ ) {
+        for( int x = 0; x < thumb_width; x++ ) {
+            thumb[y * thumb_width + x] = pixels[static_cast<size_t>( y * step ) * width + x * step];
+        }
+    }
+    // Tracy copies the image
+    FrameImage( thumb.data(), static_cast<uint16_t>( thumb_width ),
+                static_cast<uint16_t>( thumb_height ), 0, false );
+}
+#endif
+
 void refresh_display()
 {
     needupdate = false;
@@ -558,6 +602,9 @@ void refresh_display()
     draw_terminal_size_preview();
     draw_quick_shortcuts();
     draw_virtual_joystick();
+#endif
+#if defined(USE_TRACY)
+    send_frame_image();
 #endif
     SDL_RenderPresent( renderer.get() );
     SetRenderTarget( renderer, display_buffer );
@@ -765,20 +812,23 @@ static std::optional<std::pair<tripoint_abs_omt, std::string>> get_mission_arrow
     return std::make_pair( tripoint_abs_omt( arr_pos ), mission_arrow_variant );
 }
 
-std::string cata_tiles::get_omt_id_rotation_and_subtile(
-    const tripoint_abs_omt &omp, int &rota, int &subtile )
+static oter_id displayed_oter_at( const tripoint_abs_omt &p )
 {
-    auto oter_at = []( const tripoint_abs_omt & p ) {
-        const oter_id &cur_ter = overmap_buffer.ter( p );
+    static const oter_type_str_id forest_trail( "forest_trail" );
+    static const oter_str_id forest( "forest" );
+    const oter_id &cur_ter = overmap_buffer.ter( p );
 
-        if( !uistate.overmap_show_forest_trails &&
-            is_ot_match( "forest_trail", cur_ter, ot_match_type::type ) ) {
-            return oter_id( "forest" );
-        }
+    if( !uistate.overmap_show_forest_trails && cur_ter->get_type_id() == forest_trail ) {
+        return forest.id();
+    }
 
-        return cur_ter;
-    };
+    return cur_ter;
+}
 
+std::string cata_tiles::get_omt_id_rotation_and_subtile(
+    const tripoint_abs_omt &omp, int &rota, int &subtile,
+    const std::function<oter_id( const tripoint_abs_omt & )> &oter_at )
+{
     oter_id ot_id = oter_at( omp );
     const oter_t &ot = *ot_id;
     oter_type_id ot_type_id = ot.get_type_id();
@@ -888,6 +938,26 @@ void cata_tiles::draw_om( point dest, const tripoint_abs_omt &center_abs_omt, bo
                                    && center_abs_omt.z() >= 0 );
     o = corner_NW.raw().xy();
 
+    // Connected terrain looks at the neighbours of every tile, so each terrain of the view
+    // (and a border around it) is only looked up once.  Unseen tiles are never looked up,
+    // that could generate overmaps.
+    const point ter_memo_size( max_col - min_col + 2, max_row - min_row + 2 );
+    std::vector<oter_id> ter_memo( ter_memo_size.x * ter_memo_size.y );
+    std::vector<bool> ter_memo_set( ter_memo.size(), false );
+    const auto memo_oter_at = [&]( const tripoint_abs_omt & p ) {
+        const point rel = ( p.xy() - corner_NW.xy() ).raw() + point_south_east;
+        if( p.z() != corner_NW.z() || rel.x < 0 || rel.y < 0 ||
+            rel.x >= ter_memo_size.x || rel.y >= ter_memo_size.y ) {
+            return displayed_oter_at( p );
+        }
+        const size_t idx = rel.y * ter_memo_size.x + rel.x;
+        if( !ter_memo_set[idx] ) {
+            ter_memo[idx] = displayed_oter_at( p );
+            ter_memo_set[idx] = true;
+        }
+        return ter_memo[idx];
+    };
+
     const auto global_omt_to_draw_position = []( const tripoint_abs_omt & omp ) {
         // z position is hardcoded to 0 because the things this will be used to draw should not be skipped
         return tripoint( omp.raw().xy(), 0 );
@@ -913,7 +983,7 @@ void cata_tiles::draw_om( point dest, const tripoint_abs_omt &center_abs_omt, bo
             }
             if( id.empty() ) {
                 if( see ) {
-                    id = get_omt_id_rotation_and_subtile( omp, rotation, subtile );
+                    id = get_omt_id_rotation_and_subtile( omp, rotation, subtile, memo_oter_at );
                 } else {
                     id = "unknown_terrain";
                 }
@@ -1285,8 +1355,23 @@ static bool draw_window( Font_Ptr &font, const catacurses::window &w, point offs
     // TODO: Get this from UTF system to make sure it is exactly the kind of space we need
     static const std::string space_string = " ";
 
+    const bool draw_ascii_lines = get_option<bool>( "USE_DRAW_ASCII_LINES_ROUTINE" );
+
+    // Consecutive changed spaces of the same background are filled with a single rect
+    point space_run_start;
+    int space_run_cells = 0;
+    catacurses::base_color space_run_color = catacurses::black;
+    const auto flush_space_run = [&]() {
+        if( space_run_cells > 0 ) {
+            geometry->rect( renderer, space_run_start, font->width * space_run_cells, font->height,
+                            color_as_sdl( space_run_color ) );
+            space_run_cells = 0;
+        }
+    };
+
     bool update = false;
     for( int j = 0; j < win->height; j++ ) {
+        flush_space_run();
         if( !win->line[j].touched ) {
             continue;
         }
@@ -1320,6 +1405,7 @@ static bool draw_window( Font_Ptr &font, const catacurses::window &w, point offs
             cursecell &oldcell = framebuffer[fby].chars[fbx];
 
             if( oldWinCompatible && cell == oldcell && fontScale == fontScaleBuffer ) {
+                flush_space_run();
                 continue;
             }
             oldcell = cell;
@@ -1330,10 +1416,18 @@ static bool draw_window( Font_Ptr &font, const catacurses::window &w, point offs
 
             // Spaces are used a lot, so this does help noticeably
             if( cell.ch == space_string ) {
-                geometry->rect( renderer, point( drawx, drawy ), font->width, font->height,
-                                color_as_sdl( cell.BG ) );
+                if( space_run_cells > 0 && space_run_color == cell.BG &&
+                    space_run_start.x + space_run_cells * font->width == drawx ) {
+                    space_run_cells++;
+                } else {
+                    flush_space_run();
+                    space_run_start = point( drawx, drawy );
+                    space_run_color = cell.BG;
+                    space_run_cells = 1;
+                }
                 continue;
             }
+            flush_space_run();
             const int codepoint = UTF8_getch( cell.ch );
             const catacurses::base_color FG = cell.FG;
             const catacurses::base_color BG = cell.BG;
@@ -1342,7 +1436,7 @@ static bool draw_window( Font_Ptr &font, const catacurses::window &w, point offs
                 // utf8_width() may return a negative width
                 continue;
             }
-            bool use_draw_ascii_lines_routine = get_option<bool>( "USE_DRAW_ASCII_LINES_ROUTINE" );
+            bool use_draw_ascii_lines_routine = draw_ascii_lines;
             unsigned char uc = static_cast<unsigned char>( cell.ch[0] );
             switch( codepoint ) {
                 case LINE_XOXO_UNICODE:
@@ -1394,6 +1488,7 @@ static bool draw_window( Font_Ptr &font, const catacurses::window &w, point offs
             }
         }
     }
+    flush_space_run();
     win->draw = false; //We drew the window, mark it as so
     //Keeping track of last drawn window and tilemode zoom level
     ::winBuffer = w.weak_ptr();
@@ -1662,6 +1757,27 @@ static int HandleDPad()
     return 0;
 }
 
+/**
+ * Sleeps until an event is queued or @p max_ms milliseconds passed.  The event stays in
+ * the queue for CheckMessages.
+ */
+static void wait_for_event( Uint32 max_ms )
+{
+#if defined(__ANDROID__)
+    // Touch repeats and long presses are timed by CheckMessages, it has to run often
+    ( void )max_ms; // unused
+    SDL_Delay( 1 );
+#else
+    if( delaydpad != std::numeric_limits<Uint32>::max() ) {
+        // A held d-pad repeats without sending new events
+        const Uint32 now = SDL_GetTicks();
+        max_ms = std::min( max_ms, delaydpad > now ? delaydpad - now + 1 : 1 );
+    }
+    const int timeout = static_cast<int>( std::min<Uint32>( max_ms, std::numeric_limits<int>::max() ) );
+    SDL_WaitEventTimeout( nullptr, std::max( timeout, 1 ) );
+#endif
+}
+
 static SDL_Keycode sdl_keycode_opposite_arrow( SDL_Keycode key )
 {
     switch( key ) {
@@ -3642,7 +3758,7 @@ void input_manager::pump_events()
 
 // This is how we're actually going to handle input events, SDL getch
 // is simply a wrapper around this.
-input_event input_manager::get_input_event()
+input_event input_manager::get_platform_input_event()
 {
     previously_pressed_key = 0;
 
@@ -3662,7 +3778,7 @@ input_event input_manager::get_input_event()
             if( last_input.type != input_event_t::error ) {
                 break;
             }
-            SDL_Delay( 1 );
+            wait_for_event( std::numeric_limits<Uint32>::max() );
         } while( last_input.type == input_event_t::error );
     } else if( inputdelay > 0 ) {
         uint32_t starttime = SDL_GetTicks();
@@ -3674,10 +3790,12 @@ input_event input_manager::get_input_event()
             if( last_input.type != input_event_t::error ) {
                 break;
             }
-            SDL_Delay( 1 );
-            timedout = endtime >= starttime + inputdelay;
+            const uint32_t deadline = starttime + inputdelay;
+            timedout = endtime >= deadline;
             if( timedout ) {
                 last_input.type = input_event_t::timeout;
+            } else {
+                wait_for_event( deadline - endtime );
             }
         } while( !timedout );
     } else {
@@ -248,6 +248,18 @@ simple_path<tripoint_abs_omt> find_overmap_path( const tripoint_abs_omt &source,
     simple_path<tripoint_abs_omt> ret;
     bool meet = false;
 
+    // Scoring looks up the overmap terrain, which is much more expensive than the search
+    // itself. Both search directions share the results, and rejected nodes are not scored
+    // again every time a neighbour of theirs is expanded.
+    std::unordered_map<tripoint_abs_omt, omt_score> scores;
+    const auto score_of = [&]( const tripoint_abs_omt & p ) -> const omt_score & {
+        auto it = scores.find( p );
+        if( it == scores.end() ) {
+            it = scores.emplace( p, scorer( p ) ).first;
+        }
+        return it->second;
+    };
+
     auto do_astar = [&]( const tripoint_abs_omt & start,
                          std::unordered_map<tripoint_abs_omt, navigation_node> &known_nodes,
                          std::priority_queue<scored_address, std::vector<scored_address>, std::greater<>> &open_set,
@@ -290,9 +302,8 @@ simple_path<tripoint_abs_omt> find_overmap_path( const tripoint_abs_omt &source,
                 if( octile_dist( source.xy(), next_addr.xy() ) > radius ) {
                     continue;
                 }
-                const omt_score next_score = scorer( next_addr );
+                const omt_score &next_score = score_of( next_addr );
                 if( next_score.node_cost < 0 ) {
-                    // TODO: add to closed set to avoid re-visiting
                     continue;
                 }
                 // TODO: pass in the 10 (default terrain cost)
@@ -311,8 +322,8 @@ simple_path<tripoint_abs_omt> find_overmap_path( const tripoint_abs_omt &source,
             }
         }
     };
-    const omt_score start_score = scorer( source );
-    const omt_score end_score = scorer( dest );
+    const omt_score start_score = score_of( source );
+    const omt_score end_score = score_of( dest );
     if( start_score.node_cost < 0 || end_score.node_cost < 0 ) {
         return ret;
     }
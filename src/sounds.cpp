@@ -18,6 +18,7 @@
 #include "calendar.h"
 #include "coordinate_conversions.h"
 #include "creature.h"
+#include "creature_tracker.h"
 #include "debug.h"
 #include "effect.h"
 #include "enums.h"
@@ -362,13 +363,18 @@ void sounds::process_sounds()
             const tripoint_abs_sm target( abs_sm, source.z );
             overmap_buffer.signal_hordes( target, sig_power );
         }
+        if( vol <= 0 ) {
+            continue;
+        }
         // Alert all monsters (that can hear) to the sound.
-        for( monster &critter : g->all_monsters() ) {
+        // The sound distance is never shorter than the square distance, so monsters
+        // outside of that radius would be excluded below anyway.
+        for( monster *critter : g->critter_tracker->find_in_radius( source, vol * 2 - 1 ) ) {
             // TODO: Generalize this to Creature::hear_sound
-            const int dist = sound_distance( source, critter.pos() );
+            const int dist = sound_distance( source, critter->pos() );
             if( vol * 2 > dist ) {
                 // Exclude monsters that certainly won't hear the sound
-                critter.hear_sound( source, vol, dist );
+                critter->hear_sound( source, vol, dist );
             }
         }
     }
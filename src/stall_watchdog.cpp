@@ -0,0 +1,275 @@
+#include "stall_watchdog.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <ctime>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+
+#include "fstream_utils.h"
+#include "path_info.h"
+#include "profile.h"
+#include "turn_profiler.h"
+
+#if defined(_WIN32) && !defined(_MSC_VER)
+#   include "mingw.thread.h"
+#endif
+
+// Same condition as the glibc backtrace in debug.cpp
+#if defined(BACKTRACE) && !defined(_WIN32) && !defined(__CYGWIN__) && !defined(__ANDROID__) && !defined(LIBBACKTRACE)
+#   define STALL_WATCHDOG_STACKS
+#   include <cerrno>
+#   include <csignal>
+#   include <cstdlib>
+#   include <execinfo.h>
+#   include <pthread.h>
+#endif
+
+namespace stall_watchdog
+{
+
+namespace
+{
+
+using steady = std::chrono::steady_clock;
+
+constexpr std::chrono::milliseconds poll_interval( 50 );
+constexpr std::chrono::milliseconds sample_interval( 100 );
+constexpr int max_samples = 10;
+
+// Written by the main thread, read by the watchdog
+std::atomic<bool> is_busy{ false };
+std::atomic<std::int64_t> busy_since{ 0 };
+std::atomic<std::uint64_t> busy_generation{ 0 };
+std::atomic<std::uint64_t> finished_generation{ 0 };
+std::atomic<std::int64_t> finished_duration{ 0 };
+
+std::int64_t now_ns()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               steady::now().time_since_epoch() ).count();
+}
+
+std::int64_t to_ms( std::int64_t ns )
+{
+    return ns / 1000000;
+}
+
+#if defined(STALL_WATCHDOG_STACKS)
+constexpr int max_frames = 64;
+void *sample_frames[max_frames];
+std::atomic<int> sample_size{ -1 };
+pthread_t main_thread;
+
+void on_sample_signal( int )
+{
+    const int saved_errno = errno;
+    sample_size.store( backtrace( sample_frames, max_frames ), std::memory_order_release );
+    errno = saved_errno;
+}
+
+void install_sampler()
+{
+    main_thread = pthread_self();
+    // backtrace loads libgcc the first time it runs, that must not happen in the handler
+    void *dummy[1];
+    backtrace( dummy, 1 );
+    struct sigaction action = {};
+    action.sa_handler = on_sample_signal;
+    action.sa_flags = SA_RESTART;
+    sigemptyset( &action.sa_mask );
+    sigaction( SIGURG, &action, nullptr );
+}
+
+void write_stack( std::ostream &os )
+{
+    sample_size.store( -1, std::memory_order_relaxed );
+    if( pthread_kill( main_thread, SIGURG ) != 0 ) {
+        return;
+    }
+    int size = -1;
+    for( int i = 0; i < 50 && size < 0; ++i ) {
+        std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+        size = sample_size.load( std::memory_order_acquire );
+    }
+    if( size <= 0 ) {
+        os << "    (no stack, the main thread did not answer)\n";
+        return;
+    }
+    char **symbols = backtrace_symbols( sample_frames, size );
+    if( symbols == nullptr ) {
+        return;
+    }
+    // Skip the signal handler and the signal trampoline
+    for( int i = 2; i < size; ++i ) {
+        os << "    " << symbols[i] << '\n';
+    }
+    free( symbols );
+}
+#else
+void install_sampler()
+{
+}
+
+void write_stack( std::ostream & )
+{
+}
+#endif
+
+class watchdog
+{
+    public:
+        ~watchdog() {
+            stop();
+        }
+
+        void start( int ms ) {
+            // Options are applied again on every change of any option
+            if( worker.joinable() && threshold == std::chrono::milliseconds( ms ) ) {
+                return;
+            }
+            stop();
+            threshold = std::chrono::milliseconds( ms );
+            stopping = false;
+            worker = std::thread( [this] {
+                run();
+            } );
+        }
+
+        void stop() {
+            if( !worker.joinable() ) {
+                return;
+            }
+            {
+                std::lock_guard<std::mutex> lock( mutex );
+                stopping = true;
+            }
+            wake.notify_all();
+            worker.join();
+        }
+
+    private:
+        void run() {
+            set_profiler_thread_name( "stall watchdog" );
+            const std::string path = PATH_INFO::config_dir() + "stall_report.txt";
+            // Generation of the stall being reported, 0 for none
+            std::uint64_t reported = 0;
+            int samples = 0;
+            steady::time_point next_sample;
+            std::unique_lock<std::mutex> lock( mutex );
+            while( !wake.wait_for( lock, poll_interval, [this] {
+            return stopping;
+        } ) ) {
+                const bool busy = is_busy.load( std::memory_order_acquire );
+                const std::uint64_t generation = busy_generation.load( std::memory_order_acquire );
+                const std::int64_t elapsed = now_ns() - busy_since.load( std::memory_order_acquire );
+
+                if( reported != 0 && ( !busy || generation != reported ) ) {
+                    write_end( path, reported );
+                    reported = 0;
+                }
+                if( !busy || std::chrono::nanoseconds( elapsed ) < threshold ) {
+                    continue;
+                }
+                if( reported == 0 ) {
+                    reported = generation;
+                    samples = 0;
+                    next_sample = steady::now();
+                    write_start( path );
+                }
+                if( samples < max_samples && steady::now() >= next_sample ) {
+                    write_sample( path, elapsed );
+                    samples++;
+                    next_sample = steady::now() + sample_interval;
+                }
+            }
+        }
+
+        static void write_start( const std::string &path ) {
+            cata_ofstream file;
+            file.mode( cata_ios_mode::app ).open( path );
+            if( !file.is_open() ) {
+                return;
+            }
+            const std::time_t now = std::time( nullptr );
+            char stamp[32] = {};
+            std::strftime( stamp, sizeof( stamp ), "%Y-%m-%d %H:%M:%S", std::localtime( &now ) );
+            *file << "=== Main thread stalled, " << stamp << " ===\n";
+        }
+
+        static void write_sample( const std::string &path, std::int64_t elapsed ) {
+            cata_ofstream file;
+            file.mode( cata_ios_mode::app ).open( path );
+            if( !file.is_open() ) {
+                return;
+            }
+            const turn_profiler::phase p = turn_profiler::current_phase();
+            *file << "after " << to_ms( elapsed ) << " ms, phase "
+                  << ( p == turn_profiler::phase::num_phases ? "none" : turn_profiler::phase_name( p ) )
+                  << '\n';
+            write_stack( *file );
+        }
+
+        static void write_end( const std::string &path, std::uint64_t generation ) {
+            cata_ofstream file;
+            file.mode( cata_ios_mode::app ).open( path );
+            if( !file.is_open() ) {
+                return;
+            }
+            if( finished_generation.load( std::memory_order_acquire ) == generation ) {
+                *file << "=== Stall ended after "
+                      << to_ms( finished_duration.load( std::memory_order_relaxed ) ) << " ms ===\n\n";
+            } else {
+                *file << "=== Stall ended ===\n\n";
+            }
+        }
+
+        std::chrono::nanoseconds threshold{ 0 };
+        std::thread worker;
+        std::mutex mutex;
+        std::condition_variable wake;
+        bool stopping = false;
+};
+
+watchdog &get_watchdog()
+{
+    static watchdog instance;
+    return instance;
+}
+
+} // namespace
+
+void set_threshold( int ms )
+{
+    if( ms <= 0 ) {
+        get_watchdog().stop();
+        return;
+    }
+    install_sampler();
+    get_watchdog().start( ms );
+}
+
+void busy()
+{
+    busy_since.store( now_ns(), std::memory_order_relaxed );
+    busy_generation.fetch_add( 1, std::memory_order_relaxed );
+    is_busy.store( true, std::memory_order_release );
+}
+
+void idle()
+{
+    if( !is_busy.load( std::memory_order_relaxed ) ) {
+        return;
+    }
+    finished_duration.store( now_ns() - busy_since.load( std::memory_order_relaxed ),
+                             std::memory_order_relaxed );
+    finished_generation.store( busy_generation.load( std::memory_order_relaxed ),
+                               std::memory_order_release );
+    is_busy.store( false, std::memory_order_release );
+}
+
+} // namespace stall_watchdog
@@ -0,0 +1,31 @@
+#pragma once
+#ifndef CATA_SRC_STALL_WATCHDOG_H
+#define CATA_SRC_STALL_WATCHDOG_H
+
+/**
+ * Background thread that notices when the main thread takes too long between two
+ * input events (a turn or a frame that hangs) and writes what it was doing to
+ * config_dir/stall_report.txt.
+ *
+ * For every stall the report has the time it started, the phase from turn_profiler.h the
+ * main thread was in at every sample and, where the platform allows it, a stack trace of
+ * the main thread at every sample.  A second entry with the total duration is written
+ * once the main thread gets back to reading input.
+ */
+namespace stall_watchdog
+{
+
+/**
+ * Starts the watchdog, reporting stalls longer than @p ms milliseconds.  0 stops it.
+ * Has to be called from the main thread, that's the thread that is watched.
+ */
+void set_threshold( int ms );
+
+/** The main thread got an input event and starts working on it. */
+void busy();
+/** The main thread is done and waits for the next input event. */
+void idle();
+
+} // namespace stall_watchdog
+
+#endif // CATA_SRC_STALL_WATCHDOG_H
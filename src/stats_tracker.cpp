@@ -29,11 +29,7 @@ void event_multiset::set_type( event_type type )
 
 int event_multiset::count() const
 {
-    int total = 0;
-    for( const auto &pair : counts_ ) {
-        total += pair.second;
-    }
-    return total;
+    return count_;
 }
 
 int event_multiset::count( const cata::event::data_type &criteria ) const
@@ -49,7 +45,8 @@ int event_multiset::count( const cata::event::data_type &criteria ) const
 
 int event_multiset::total( const std::string &field ) const
 {
-    return total( field, {} );
+    auto it = summaries_.find( field );
+    return it == summaries_.end() ? 0 : it->second.total;
 }
 
 int event_multiset::total( const std::string &field, const cata::event::data_type &criteria ) const
@@ -69,44 +66,42 @@ int event_multiset::total( const std::string &field, const cata::event::data_typ
 
 int event_multiset::minimum( const std::string &field ) const
 {
-    int minimum = 0;
-    for( const auto &pair : counts_ ) {
-        auto it = pair.first.find( field );
-        if( it == pair.first.end() ) {
-            continue;
-        }
-        const int potential = it->second.get<cata_variant_type::int_>();
-        if( potential < minimum ) {
-            minimum = potential;
-        }
-    }
-    return minimum;
+    auto it = summaries_.find( field );
+    return it == summaries_.end() ? 0 : it->second.minimum;
 }
 
 int event_multiset::maximum( const std::string &field ) const
 {
-    int maximum = 0;
-    for( const auto &pair : counts_ ) {
-        auto it = pair.first.find( field );
-        if( it == pair.first.end() ) {
-            continue;
-        }
-        const int potential = it->second.get<cata_variant_type::int_>();
-        if( potential > maximum ) {
-            maximum = potential;
-        }
-    }
-    return maximum;
+    auto it = summaries_.find( field );
+    return it == summaries_.end() ? 0 : it->second.maximum;
 }
 
 void event_multiset::add( const cata::event &e )
 {
     counts_[e.data()]++;
+    add_to_summaries( e.data(), 1 );
 }
 
 void event_multiset::add( const counts_type::value_type &e )
 {
     counts_[e.first] += e.second;
+    add_to_summaries( e.first, e.second );
+}
+
+void event_multiset::add_to_summaries( const cata::event::data_type &data, const int count )
+{
+    count_ += count;
+    for( const std::pair<const std::string, cata_variant> &field : data ) {
+        if( field.second.type() != cata_variant_type::int_ ) {
+            continue;
+        }
+        const int value = field.second.get<cata_variant_type::int_>();
+        field_summary &summary = summaries_[field.first];
+        summary.total += count * value;
+        // Like the old scans, the extremes include 0
+        summary.minimum = std::min( summary.minimum, value );
+        summary.maximum = std::max( summary.maximum, value );
+    }
 }
 
 base_watcher::~base_watcher()
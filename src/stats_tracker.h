@@ -74,8 +74,19 @@ class event_multiset
         void serialize( JsonOut & ) const;
         void deserialize( JsonIn & );
     private:
+        // Kept up to date by add, so the queries without criteria don't have to look at
+        // every entry of counts_
+        struct field_summary {
+            int total = 0;
+            int minimum = 0;
+            int maximum = 0;
+        };
+        void add_to_summaries( const cata::event::data_type &data, int count );
+
         event_type type_;
         counts_type counts_;
+        int count_ = 0;
+        std::unordered_map<std::string, field_summary> summaries_;
 };
 
 class base_watcher
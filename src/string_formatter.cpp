@@ -138,36 +138,61 @@ void cata::string_formatter::discard_oct_hex_sign_flag()
     } ), current_format.end() );
 }
 
+// Formats into a stack buffer first, so no temporary string is allocated per specifier.
+template<typename T>
+static void append_printf( std::string &output, const std::string &format, const T &value )
+{
+    fmt::memory_buffer buffer;
+    fmt::vprintf( buffer, fmt::string_view( format ), fmt::printf_args( fmt::make_printf_args(
+                      value ) ) );
+    output.append( buffer.data(), buffer.size() );
+}
+
 namespace cata
 {
 void string_formatter::do_formating( int value )
 {
-    output.append( fmt::sprintf( current_format, value ) );
+    append_printf( output, current_format, value );
 }
 
 void string_formatter::do_formating( signed long long int value )
 {
-    output.append( fmt::sprintf( current_format, value ) );
+    // Plain "%d" is by far the most common specifier
+    if( current_format == "%lld" ) {
+        const fmt::format_int str( value );
+        output.append( str.data(), str.size() );
+        return;
+    }
+    append_printf( output, current_format, value );
 }
 
 void string_formatter::do_formating( unsigned long long int value )
 {
-    output.append( fmt::sprintf( current_format, value ) );
+    if( current_format == "%llu" ) {
+        const fmt::format_int str( value );
+        output.append( str.data(), str.size() );
+        return;
+    }
+    append_printf( output, current_format, value );
 }
 
 void string_formatter::do_formating( double value )
 {
-    output.append( fmt::sprintf( current_format, value ) );
+    append_printf( output, current_format, value );
 }
 
 void string_formatter::do_formating( void *value )
 {
-    output.append( fmt::sprintf( current_format, value ) );
+    append_printf( output, current_format, value );
 }
 
 void string_formatter::do_formating( std::string_view value )
 {
-    output.append( fmt::sprintf( current_format, value ) );
+    if( current_format == "%s" ) {
+        output.append( value );
+        return;
+    }
+    append_printf( output, current_format, value );
 }
 } // namespace cata
 
@@ -211,9 +211,14 @@ class string_formatter
         /// Used during parsing to denote the *next* character in @ref format to be
         /// parsed.
         size_t current_index_in_format = 0;
+        /// Output buffer used when the caller does not supply one.
+        std::string own_output;
         /// The formatted output string, filled during parsing of @ref format,
-        /// so it's only valid after the parsing has completed.
-        std::string output;
+        /// so it's only valid after the parsing has completed. Either @ref own_output
+        /// or a string supplied by the caller, which is appended to.
+        std::string &output;
+        /// Size of @ref output before parsing started, everything before it is not ours.
+        size_t output_start = 0;
         /// The *currently parsed format specifiers. This is extracted from @ref format
         /// during parsing and given to @ref sprintf (along with the actual argument).
         /// It is filled and reset during parsing for each format specifier in @ref format.
@@ -360,7 +365,12 @@ class string_formatter
 
     public:
         /// @param format The format string as required by `sprintf`.
-        string_formatter( std::string_view format ) : format( format ) { }
+        string_formatter( std::string_view format ) : format( format ), output( own_output ) { }
+        /// Same as above, but the output is appended to @p out instead of an internal buffer.
+        string_formatter( std::string_view format, std::string &out ) : format( format ),
+            output( out ), output_start( out.size() ) { }
+        string_formatter( const string_formatter & ) = delete;
+        string_formatter &operator=( const string_formatter & ) = delete;
         /// Does the actual `sprintf`. It uses @ref format and puts the formatted
         /// string into @ref output.
         /// Note: use @ref get_output to get the formatted string after a successful
@@ -370,8 +380,8 @@ class string_formatter
         /// Note: @ref string_format is a wrapper that handles those exceptions.
         template<typename ...Args>
         void parse( Args &&... args ) {
-            output.reserve( format.size() );
-            output.resize( 0 );
+            output.resize( output_start );
+            output.reserve( output_start + format.size() );
             current_index_in_format = 0;
             current_argument_index = 0;
             while( const char c = consume_next_input() ) {
@@ -399,7 +409,12 @@ class string_formatter
             }
         }
         std::string get_output() const {
-            return output;
+            return output.substr( output_start );
+        }
+        /// Like @ref get_output, but moves the internal buffer out instead of copying it.
+        /// Only valid when no output string was given to the constructor.
+        std::string take_output() {
+            return std::move( own_output );
         }
 };
 
@@ -434,7 +449,7 @@ inline std::string string_format( std::string_view format, Args &&...args )
     try {
         cata::string_formatter formatter( format );
         formatter.parse( std::forward<Args>( args )... );
-        return formatter.get_output();
+        return formatter.take_output();
     } catch( ... ) {
         return cata::handle_string_format_error();
     }
@@ -447,6 +462,32 @@ requires cata::is_translation<T>::value {
 }
 /**@}*/
 
+/**
+ * Same as @ref string_format, but appends the result to @p out instead of returning a new
+ * string. Code that builds a long text piece by piece can reuse one buffer this way.
+ * On error, the error message is appended instead of the partial output.
+ */
+/**@{*/
+template<typename ...Args>
+inline void string_format_to( std::string &out, std::string_view format, Args &&...args )
+{
+    const size_t start = out.size();
+    try {
+        cata::string_formatter formatter( format, out );
+        formatter.parse( std::forward<Args>( args )... );
+    } catch( ... ) {
+        out.resize( start );
+        out += cata::handle_string_format_error();
+    }
+}
+template<typename T, typename ...Args>
+inline void
+string_format_to( std::string &out, T &&format, Args &&...args )
+requires cata::is_translation<T>::value {
+    string_format_to( out, format.translated(), std::forward<Args>( args )... );
+}
+/**@}*/
+
 /** Print string to stdout. */
 void cata_print_stdout( const std::string &s );
 /** Print string to stderr. */
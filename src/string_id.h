@@ -7,7 +7,9 @@
 #include <type_traits>
 #include <utility>
 
-static constexpr int64_t INVALID_VERSION = -1;
+// Versions are 32 bit to keep string_id small, they wrap around instead of overflowing
+using factory_version = uint32_t;
+static constexpr factory_version INVALID_VERSION = UINT32_MAX;
 static constexpr int INVALID_CID = -1;
 
 template<typename T>
@@ -350,13 +352,13 @@ class string_id
 
     private:
         // generic_factory version that corresponds to the _cid
-        mutable int64_t _version = INVALID_VERSION;
+        mutable factory_version _version = INVALID_VERSION;
         // cached int_id counterpart of this string_id
         mutable int _cid = INVALID_CID;
         // structure that captures the actual "identity" of this string_id
         Identity _id;
 
-        void set_cid_version( int cid, int64_t version ) const {
+        void set_cid_version( int cid, factory_version version ) const {
             _cid = cid;
             _version = version;
         }
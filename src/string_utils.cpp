@@ -11,31 +11,48 @@
 
 bool lcmatch( const std::string &str, const std::string &qry )
 {
-    auto temp_locale = std::locale{};
-    if( temp_locale.name() != "en_US.UTF-8" && temp_locale.name() != "C" ) {
-        auto &f = std::use_facet<std::ctype<wchar_t>>( temp_locale );
-        std::wstring wneedle = utf8_to_wstr( qry );
-        std::wstring whaystack = utf8_to_wstr( str );
+    return lcmatcher( qry )( str );
+}
 
-        f.tolower( whaystack.data(), whaystack.data() + whaystack.size() );
-        f.tolower( wneedle.data(), wneedle.data() + wneedle.size() );
+bool lcmatch( const translation &str, const std::string &qry )
+{
+    return lcmatch( str.translated(), qry );
+}
 
-        return whaystack.find( wneedle ) != std::wstring::npos;
+lcmatcher::lcmatcher( const std::string &qry )
+{
+    const std::locale temp_locale{};
+    wide = temp_locale.name() != "en_US.UTF-8" && temp_locale.name() != "C";
+    if( wide ) {
+        auto &f = std::use_facet<std::ctype<wchar_t>>( temp_locale );
+        wneedle = utf8_to_wstr( qry );
+        f.tolower( wneedle.data(), wneedle.data() + wneedle.size() );
+        return;
     }
-    std::string needle;
     needle.reserve( qry.size() );
     std::transform( qry.begin(), qry.end(), std::back_inserter( needle ), tolower );
+}
 
-    std::string haystack;
-    haystack.reserve( str.size() );
-    std::transform( str.begin(), str.end(), std::back_inserter( haystack ), tolower );
-
-    return haystack.find( needle ) != std::string::npos;
+bool lcmatcher::operator()( const std::string &str ) const
+{
+    if( wide ) {
+        auto &f = std::use_facet<std::ctype<wchar_t>>( std::locale{} );
+        std::wstring whaystack = utf8_to_wstr( str );
+        f.tolower( whaystack.data(), whaystack.data() + whaystack.size() );
+        return whaystack.find( wneedle ) != std::wstring::npos;
+    }
+    if( needle.empty() ) {
+        return true;
+    }
+    return std::search( str.begin(), str.end(), needle.begin(), needle.end(),
+    []( const char hay, const char ndl ) {
+        return static_cast<char>( tolower( hay ) ) == ndl;
+    } ) != str.end();
 }
 
-bool lcmatch( const translation &str, const std::string &qry )
+bool lcmatcher::operator()( const translation &str ) const
 {
-    return lcmatch( str.translated(), qry );
+    return ( *this )( str.translated() );
 }
 
 bool lcequal( const std::string &str1, const std::string &str2 )
@@ -21,6 +21,25 @@ class translation;
 bool lcmatch( const std::string &str, const std::string &qry );
 bool lcmatch( const translation &str, const std::string &qry );
 
+/**
+ * Same search as @ref lcmatch, for matching one query against many subjects.
+ * The query is lowercased only once, when the matcher is created.
+ */
+class lcmatcher
+{
+    public:
+        explicit lcmatcher( const std::string &qry );
+
+        bool operator()( const std::string &str ) const;
+        bool operator()( const translation &str ) const;
+
+    private:
+        // Whether the current locale needs the wide character lowercasing
+        bool wide;
+        std::string needle;
+        std::wstring wneedle;
+};
+
 /** Perform case insensitive comparison of 2 strings. */
 bool lcequal( const std::string &str1, const std::string &str2 );
 
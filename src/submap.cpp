@@ -8,6 +8,7 @@
 
 #include "int_id.h"
 #include "mapdata.h"
+#include "profile.h"
 #include "tileray.h"
 #include "trap.h"
 #include "vehicle.h"
@@ -25,6 +26,9 @@ void maptile_soa<sx, sy>::swap_soa_tile( point p1, point p2 )
     std::swap( fld[p1.x][p1.y], fld[p2.x][p2.y] );
     std::swap( trp[p1.x][p1.y], trp[p2.x][p2.y] );
     std::swap( rad[p1.x][p1.y], rad[p2.x][p2.y] );
+    const bool fld_tile1 = fld_tiles[p1.x * sy + p1.y];
+    fld_tiles[p1.x * sy + p1.y] = fld_tiles[p2.x * sy + p2.y];
+    fld_tiles[p2.x * sy + p2.y] = fld_tile1;
 }
 
 void submap::swap( submap &first, submap &second )
@@ -33,12 +37,14 @@ void submap::swap( submap &first, submap &second )
     std::swap( first.frn, second.frn );
     std::swap( first.lum, second.lum );
     std::swap( first.fld, second.fld );
+    std::swap( first.fld_tiles, second.fld_tiles );
     std::swap( first.trp, second.trp );
     std::swap( first.rad, second.rad );
     std::swap( first.is_uniform, second.is_uniform );
     std::swap( first.active_items, second.active_items );
     std::swap( first.field_count, second.field_count );
     std::swap( first.last_touched, second.last_touched );
+    std::swap( first.fields_processed, second.fields_processed );
     std::swap( first.spawns, second.spawns );
     std::swap( first.vehicles, second.vehicles );
     std::swap( first.partial_constructions, second.partial_constructions );
@@ -48,6 +54,8 @@ void submap::swap( submap &first, submap &second )
     std::swap( first.legacy_computer, second.legacy_computer );
     std::swap( first.temperature, second.temperature );
     std::swap( first.cosmetics, second.cosmetics );
+    first.set_modified();
+    second.set_modified();
 
     for( int x = 0; x < SEEX; x++ ) {
         for( int y = 0; y < SEEY; y++ ) {
@@ -223,6 +231,9 @@ maptile_soa<sx, sy>::maptile_soa( tripoint offset ) : itm{{
 {
 }
 
+// Name of the memory pool in the profiler, compared by address
+[[maybe_unused]] static const char *const submap_memory = "submaps";
+
 submap::submap( tripoint offset ) : maptile_soa<SEEX, SEEY>( offset )
 {
     std::uninitialized_fill_n( &ter[0][0], elements, t_null );
@@ -232,12 +243,17 @@ submap::submap( tripoint offset ) : maptile_soa<SEEX, SEEY>( offset )
     std::uninitialized_fill_n( &rad[0][0], elements, 0 );
 
     is_uniform = false;
+    TracyAllocN( this, sizeof( submap ), submap_memory );
 }
 
-submap::~submap() = default;
+submap::~submap()
+{
+    TracyFreeN( this, submap_memory );
+}
 
 void submap::update_lum_rem( point p, const item &i )
 {
+    set_modified();
     is_uniform = false;
     if( !i.is_emissive() ) {
         return;
@@ -262,6 +278,7 @@ void submap::update_lum_rem( point p, const item &i )
 
 void submap::insert_cosmetic( point p, const std::string &type, const std::string &str )
 {
+    set_modified();
     cosmetic_t ins;
 
     ins.pos = p;
@@ -314,6 +331,7 @@ const std::string &submap::get_graffiti( point p ) const
 
 void submap::set_graffiti( point p, const std::string &new_graffiti )
 {
+    set_modified();
     is_uniform = false;
     // Find signage at p if available
     const auto fresult = find_cosmetic( cosmetics, p, COSMETICS_GRAFFITI );
@@ -326,6 +344,7 @@ void submap::set_graffiti( point p, const std::string &new_graffiti )
 
 void submap::delete_graffiti( point p )
 {
+    set_modified();
     is_uniform = false;
     const auto fresult = find_cosmetic( cosmetics, p, COSMETICS_GRAFFITI );
     if( fresult.result ) {
@@ -354,6 +373,7 @@ std::string submap::get_signage( point p ) const
 }
 void submap::set_signage( point p, const std::string &s )
 {
+    set_modified();
     is_uniform = false;
     // Find signage at p if available
     const auto fresult = find_cosmetic( cosmetics, p, COSMETICS_SIGNAGE );
@@ -365,6 +385,7 @@ void submap::set_signage( point p, const std::string &s )
 }
 void submap::delete_signage( point p )
 {
+    set_modified();
     is_uniform = false;
     const auto fresult = find_cosmetic( cosmetics, p, COSMETICS_SIGNAGE );
     if( fresult.result ) {
@@ -408,6 +429,7 @@ const computer *submap::get_computer( point p ) const
 
 computer *submap::get_computer( point p )
 {
+    set_modified();
     // need to update to std::map first so modifications to the returned object
     // only affects the exact point p
     update_legacy_computer();
@@ -420,6 +442,7 @@ computer *submap::get_computer( point p )
 
 void submap::set_computer( point p, const computer &c )
 {
+    set_modified();
     update_legacy_computer();
     const auto it = computers.find( p );
     if( it != computers.end() ) {
@@ -431,6 +454,7 @@ void submap::set_computer( point p, const computer &c )
 
 void submap::delete_computer( point p )
 {
+    set_modified();
     update_legacy_computer();
     computers.erase( p );
 }
@@ -447,6 +471,7 @@ bool submap::contains_vehicle( vehicle *veh )
 
 void submap::rotate( int turns )
 {
+    set_modified();
     turns = turns % 4;
 
     if( turns == 0 ) {
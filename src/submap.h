@@ -2,6 +2,7 @@
 #ifndef CATA_SRC_SUBMAP_H
 #define CATA_SRC_SUBMAP_H
 
+#include <bitset>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -80,6 +81,9 @@ struct maptile_soa {
         field              fld[sx][sy];  // Field on each square
         trap_id            trp[sx][sy];  // Trap on each square
         int                rad[sx][sy];  // Irradiation of each square
+        // Tiles whose field may hold entries, indexed by x * sy + y.  Field processing
+        // skips the other tiles and clears the bits of tiles it finds empty.
+        std::bitset<sx * sy> fld_tiles;
 
         void swap_soa_tile( point p1, point p2 );
 };
@@ -96,10 +100,12 @@ class submap : maptile_soa<SEEX, SEEY>
 
         void set_trap( point p, trap_id trap ) {
             is_uniform = false;
+            set_modified();
             trp[p.x][p.y] = trap;
         }
 
         void set_all_traps( const trap_id &trap ) {
+            set_modified();
             std::uninitialized_fill_n( &trp[0][0], elements, trap );
         }
 
@@ -109,10 +115,12 @@ class submap : maptile_soa<SEEX, SEEY>
 
         void set_furn( point p, furn_id furn ) {
             is_uniform = false;
+            set_modified();
             frn[p.x][p.y] = furn;
         }
 
         void set_all_furn( const furn_id &furn ) {
+            set_modified();
             std::uninitialized_fill_n( &frn[0][0], elements, furn );
         }
 
@@ -122,10 +130,12 @@ class submap : maptile_soa<SEEX, SEEY>
 
         void set_ter( point p, ter_id terr ) {
             is_uniform = false;
+            set_modified();
             ter[p.x][p.y] = terr;
         }
 
         void set_all_ter( const ter_id &terr ) {
+            set_modified();
             std::uninitialized_fill_n( &ter[0][0], elements, terr );
         }
 
@@ -135,6 +145,7 @@ class submap : maptile_soa<SEEX, SEEY>
 
         void set_radiation( point p, const int radiation ) {
             is_uniform = false;
+            set_modified();
             rad[p.x][p.y] = radiation;
         }
 
@@ -158,6 +169,7 @@ class submap : maptile_soa<SEEX, SEEY>
 
         // TODO: Replace this as it essentially makes itm public
         location_vector<item> &get_items( const point &p ) {
+            set_modified();
             return itm[p.x][p.y];
         }
 
@@ -167,6 +179,7 @@ class submap : maptile_soa<SEEX, SEEY>
 
         // TODO: Replace this as it essentially makes fld public
         field &get_field( point p ) {
+            set_modified();
             return fld[p.x][p.y];
         }
 
@@ -174,6 +187,17 @@ class submap : maptile_soa<SEEX, SEEY>
             return fld[p.x][p.y];
         }
 
+        /** Has to be called whenever an entry is added to the field at @p p. */
+        void mark_field_tile( point p ) {
+            fld_tiles.set( p.x * SEEY + p.y );
+        }
+        void clear_field_tile( point p ) {
+            fld_tiles.reset( p.x * SEEY + p.y );
+        }
+        bool may_have_field( point p ) const {
+            return fld_tiles[p.x * SEEY + p.y];
+        }
+
         struct cosmetic_t {
             point pos;
             std::string type;
@@ -187,6 +211,7 @@ class submap : maptile_soa<SEEX, SEEY>
         }
 
         void set_temperature( int new_temperature ) {
+            set_modified();
             temperature = new_temperature;
         }
 
@@ -216,6 +241,30 @@ class submap : maptile_soa<SEEX, SEEY>
 
         void rotate( int turns );
 
+        /**
+         * Marks the submap as changed since it was last loaded or saved.  Called by all
+         * mutators here; code changing public members directly has to call it itself.
+         */
+        void set_modified() {
+            generation++;
+        }
+        /** Increases with every change, see @ref set_modified. */
+        std::uint64_t get_generation() const {
+            return generation;
+        }
+        void mark_saved() {
+            saved_generation = generation;
+        }
+        /**
+         * Whether the submap has to be written on the next save.  Vehicles, active items and
+         * active furniture change without going through the submap, so submaps with any
+         * of them always count as modified.
+         */
+        bool is_modified_since_save() const {
+            return generation != saved_generation || !vehicles.empty() || !active_items.empty() ||
+                   !active_furniture.empty();
+        }
+
         void store( JsonOut &jsout ) const;
         void load( JsonIn &jsin, const std::string &member_name, int version, const tripoint offset );
 
@@ -229,6 +278,8 @@ class submap : maptile_soa<SEEX, SEEY>
 
         int field_count = 0;
         time_point last_touched = calendar::turn_zero;
+        // Last turn map::process_fields processed the fields, not saved
+        time_point fields_processed = calendar::turn_zero;
         std::vector<spawn_point> spawns;
         /**
          * Vehicles on this submap (their (0,0) point is on this submap).
@@ -245,6 +296,9 @@ class submap : maptile_soa<SEEX, SEEY>
         std::map<point, computer> computers;
         std::unique_ptr<computer> legacy_computer;
         int temperature = 0;
+        // Fresh submaps haven't been saved yet
+        std::uint64_t generation = 1;
+        std::uint64_t saved_generation = 0;
 
         void update_legacy_computer();
 
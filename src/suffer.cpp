@@ -295,7 +295,8 @@ void Character::suffer_from_addictions()
     }
 }
 
-void Character::suffer_while_awake( const int current_stim )
+void Character::suffer_while_awake( const int current_stim,
+                                    const enum_bitset<art_effect_passive> &artifacts )
 {
     if( !has_trait( trait_DEBUG_STORAGE ) &&
         ( weight_carried() > 4 * weight_capacity() ) ) {
@@ -308,12 +309,12 @@ void Character::suffer_while_awake( const int current_stim )
     if( has_trait( trait_CHEMIMBALANCE ) ) {
         suffer_from_chemimbalance();
     }
-    if( ( has_trait( trait_SCHIZOPHRENIC ) || has_artifact_with( AEP_SCHIZO ) ) &&
+    if( ( has_trait( trait_SCHIZOPHRENIC ) || artifacts.test( AEP_SCHIZO ) ) &&
         !has_effect( effect_took_thorazine ) && !has_effect( effect_feral_killed_recently ) ) {
         suffer_from_schizophrenia();
     }
 
-    if( ( has_trait( trait_NARCOLEPTIC ) || has_artifact_with( AEP_SCHIZO ) ) ) {
+    if( ( has_trait( trait_NARCOLEPTIC ) || artifacts.test( AEP_SCHIZO ) ) ) {
         if( one_turn_in( 8_hours ) ) {
             add_msg_player_or_npc( m_bad,
                                    _( "You're suddenly overcome with the urge to sleep and you pass out." ),
@@ -1293,6 +1294,9 @@ void Character::suffer_from_radiation()
 
 void Character::suffer_from_bad_bionics()
 {
+    if( my_bionics->empty() ) {
+        return;
+    }
     // Negative bionics effects
     if( has_bionic( bio_dis_shock ) && get_power_level() > bio_dis_shock->power_trigger &&
         one_turn_in( 2_hours ) &&
@@ -1384,24 +1388,24 @@ void Character::suffer_from_bad_bionics()
     }
 }
 
-void Character::suffer_from_artifacts()
+void Character::suffer_from_artifacts( const enum_bitset<art_effect_passive> &artifacts )
 {
     // Artifact effects
-    if( has_artifact_with( AEP_ATTENTION ) ) {
+    if( artifacts.test( AEP_ATTENTION ) ) {
         add_effect( effect_attention, 3_turns );
     }
 
-    if( has_artifact_with( AEP_BAD_WEATHER ) && calendar::once_every( 1_minutes ) &&
+    if( artifacts.test( AEP_BAD_WEATHER ) && calendar::once_every( 1_minutes ) &&
         get_weather().weather_id->precip < precip_class::heavy ) {
         weather_manager &wm = get_weather();
         wm.weather_override = wm.get_cur_weather_gen().get_bad_weather();
         wm.set_nextweather( calendar::turn );
     }
 
-    if( has_artifact_with( AEP_MUTAGENIC ) && one_turn_in( 48_hours ) ) {
+    if( artifacts.test( AEP_MUTAGENIC ) && one_turn_in( 48_hours ) ) {
         mutate();
     }
-    if( has_artifact_with( AEP_FORCE_TELEPORT ) && one_turn_in( 1_hours ) ) {
+    if( artifacts.test( AEP_FORCE_TELEPORT ) && one_turn_in( 1_hours ) ) {
         teleport::teleport( *this );
     }
 }
@@ -1551,7 +1555,7 @@ void Character::suffer()
 
     for( std::pair<const trait_id, char_trait_data> &mut : my_mutations ) {
         const mutation_branch &mdata = mut.first.obj();
-        if( calendar::once_every( 1_minutes ) ) {
+        if( mdata.weakness_to_water != 0 && calendar::once_every( 1_minutes ) ) {
             suffer_water_damage( mdata );
         }
         char_trait_data &tdata = mut.second;
@@ -1564,10 +1568,15 @@ void Character::suffer()
         suffer_while_underwater();
     }
 
-    suffer_from_addictions();
+    if( !addictions.empty() ) {
+        suffer_from_addictions();
+    }
+
+    // Artifacts are looked up for several effects below, collect them in one go
+    const enum_bitset<art_effect_passive> artifacts = passive_artifact_effects();
 
     if( !in_sleep_state() ) {
-        suffer_while_awake( current_stim );
+        suffer_while_awake( current_stim, artifacts );
     } // Done with while-awake-only effects
 
     if( has_trait( trait_ASTHMA ) ) {
@@ -1579,7 +1588,9 @@ void Character::suffer()
 
     suffer_in_sunlight();
     suffer_from_other_mutations();
-    suffer_from_artifacts();
+    if( artifacts.test_any() ) {
+        suffer_from_artifacts( artifacts );
+    }
     suffer_from_radiation();
     suffer_from_bad_bionics();
     suffer_from_stimulants( current_stim );
@@ -0,0 +1,144 @@
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <string>
+
+// Set while the current thread executes jobs of a batch, so nested batches can fall back
+// to serial execution instead of waiting on themselves.
+static thread_local bool inside_job = false;
+
+thread_pool::thread_pool( int num_workers )
+{
+    resize( num_workers );
+}
+
+thread_pool::~thread_pool()
+{
+    stop_workers();
+}
+
+void thread_pool::resize( int num_workers )
+{
+    num_workers = std::max( num_workers, 0 );
+    std::lock_guard<LockableBase( std::mutex )> batch_lock( batch_mutex );
+    if( static_cast<int>( workers.size() ) == num_workers ) {
+        return;
+    }
+    stop_workers();
+    workers.reserve( num_workers );
+    for( int i = 0; i < num_workers; ++i ) {
+        // Workers may start running after the next batch was already submitted,
+        // so hand them the generation they have to wait past.
+        workers.emplace_back( &thread_pool::worker_loop, this, i, generation );
+    }
+}
+
+int thread_pool::num_workers() const
+{
+    return static_cast<int>( workers.size() );
+}
+
+void thread_pool::stop_workers()
+{
+    {
+        std::lock_guard<LockableBase( std::mutex )> lock( mutex );
+        stopping = true;
+    }
+    work_available.notify_all();
+    for( std::thread &worker : workers ) {
+        worker.join();
+    }
+    workers.clear();
+    stopping = false;
+}
+
+void thread_pool::worker_loop( int index, std::uint64_t seen_generation )
+{
+    set_profiler_thread_name( ( "worker " + std::to_string( index ) ).c_str() );
+    std::unique_lock<LockableBase( std::mutex )> lock( mutex );
+    while( true ) {
+        work_available.wait( lock, [&] {
+            return stopping || generation != seen_generation;
+        } );
+        if( stopping ) {
+            return;
+        }
+        seen_generation = generation;
+        lock.unlock();
+        run_jobs();
+        lock.lock();
+        if( --busy_workers == 0 ) {
+            work_done.notify_one();
+        }
+    }
+}
+
+void thread_pool::run_jobs()
+{
+    inside_job = true;
+    for( int i = next_index++; i < end_index; i = next_index++ ) {
+        try {
+            ( *job )( i );
+        } catch( ... ) {
+            std::lock_guard<LockableBase( std::mutex )> lock( mutex );
+            if( !first_error ) {
+                first_error = std::current_exception();
+            }
+        }
+    }
+    inside_job = false;
+}
+
+void thread_pool::parallel_for( int begin, int end, const std::function<void( int )> &func )
+{
+    if( end <= begin ) {
+        return;
+    }
+    if( inside_job || end - begin == 1 || workers.empty() ) {
+        const bool was_inside_job = inside_job;
+        inside_job = true;
+        try {
+            for( int i = begin; i < end; ++i ) {
+                func( i );
+            }
+        } catch( ... ) {
+            inside_job = was_inside_job;
+            throw;
+        }
+        inside_job = was_inside_job;
+        return;
+    }
+
+    std::lock_guard<LockableBase( std::mutex )> batch_lock( batch_mutex );
+    {
+        std::lock_guard<LockableBase( std::mutex )> lock( mutex );
+        job = &func;
+        next_index = begin;
+        end_index = end;
+        busy_workers = static_cast<int>( workers.size() );
+        first_error = nullptr;
+        ++generation;
+    }
+    work_available.notify_all();
+
+    run_jobs();
+
+    std::exception_ptr error;
+    {
+        std::unique_lock<LockableBase( std::mutex )> lock( mutex );
+        work_done.wait( lock, [&] {
+            return busy_workers == 0;
+        } );
+        job = nullptr;
+        std::swap( error, first_error );
+    }
+    if( error ) {
+        std::rethrow_exception( error );
+    }
+}
+
+thread_pool &get_thread_pool()
+{
+    static thread_pool pool;
+    return pool;
+}
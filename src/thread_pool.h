@@ -0,0 +1,83 @@
+#pragma once
+#ifndef CATA_SRC_THREAD_POOL_H
+#define CATA_SRC_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "profile.h"
+
+#if defined(_WIN32) && !defined(_MSC_VER)
+#   include "mingw.thread.h"
+#endif
+
+/**
+ * Small fixed-size pool of worker threads used to split independent chunks of
+ * work (e.g. per z-level cache rebuilds) across cores.
+ *
+ * Work is submitted in batches with @ref parallel_for, which blocks until every
+ * index of the batch has been processed.  The calling thread takes part in the
+ * batch, so a pool without workers degenerates into a plain serial loop.
+ *
+ * Jobs must not touch shared mutable state (including debugmsg and the message log)
+ * unless they synchronize it themselves.
+ */
+class thread_pool
+{
+    public:
+        explicit thread_pool( int num_workers = 0 );
+        thread_pool( const thread_pool & ) = delete;
+        thread_pool &operator=( const thread_pool & ) = delete;
+        ~thread_pool();
+
+        /** Stops all current workers and starts @param num_workers new ones. */
+        void resize( int num_workers );
+        int num_workers() const;
+
+        /**
+         * Calls @param func for every index in [begin, end), possibly concurrently.
+         * Returns once all calls have finished.  If any call throws, the first
+         * exception is rethrown on the calling thread.
+         * Nested calls from inside a job are executed serially.
+         */
+        void parallel_for( int begin, int end, const std::function<void( int )> &func );
+
+    private:
+        void worker_loop( int index, std::uint64_t seen_generation );
+        void run_jobs();
+        void stop_workers();
+
+        std::vector<std::thread> workers;
+
+        // Serializes batches submitted from different threads.
+        TracyLockable( std::mutex, batch_mutex );
+
+        TracyLockable( std::mutex, mutex );
+        // The _any variant is needed for Tracy's lock wrapper
+#if defined(USE_TRACY)
+        std::condition_variable_any work_available;
+        std::condition_variable_any work_done;
+#else
+        std::condition_variable work_available;
+        std::condition_variable work_done;
+#endif
+        bool stopping = false;
+        std::uint64_t generation = 0;
+        int busy_workers = 0;
+
+        const std::function<void( int )> *job = nullptr;
+        std::atomic<int> next_index{ 0 };
+        int end_index = 0;
+        std::exception_ptr first_error;
+};
+
+/** Pool shared by the game's parallelized subsystems, sized from the WORKER_THREADS option. */
+thread_pool &get_thread_pool();
+
+#endif // CATA_SRC_THREAD_POOL_H
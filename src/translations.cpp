@@ -135,9 +135,7 @@ void translation::make_plural()
         // just mark plural form as enabled
         raw_pl = cata::make_value<std::string>();
     }
-    // reset the cache
-    cached_language_version = INVALID_LANGUAGE_VERSION;
-    cached_translation = nullptr;
+    reset_cache();
 }
 
 void translation::add_context( const std::string &ctxt )
@@ -150,16 +148,12 @@ void translation::add_context( const std::string &ctxt )
     } else {
         this->ctxt = cata::make_value<std::string>( ctxt );
     }
-    // reset the cache
-    cached_language_version = INVALID_LANGUAGE_VERSION;
-    cached_translation = nullptr;
+    reset_cache();
 }
 
 void translation::deserialize( JsonIn &jsin )
 {
-    // reset the cache
-    cached_language_version = INVALID_LANGUAGE_VERSION;
-    cached_translation = nullptr;
+    reset_cache();
 
 #ifndef CATA_IN_TOOL
     bool check_style = false;
@@ -306,7 +300,14 @@ void translation::deserialize( JsonIn &jsin )
 #endif
 }
 
-std::string translation::translated( const int num ) const
+void translation::reset_cache() const
+{
+    cached_language_version = INVALID_LANGUAGE_VERSION;
+    cached_translation = nullptr;
+    cached_translation_pl = nullptr;
+}
+
+const std::string &translation::cached( const int num ) const
 {
     if( !needs_translation || raw.empty() ) {
         return raw;
@@ -315,28 +316,38 @@ std::string translation::translated( const int num ) const
     // in the places where they are changed, cache is explicitly invalidated
     // Note2: if `raw_pl` is defined, `num` becomes part of the "cache key"
     // otherwise `num` is ignored (for both translation and cache)
-    if( cached_language_version != current_language_version ||
-        ( raw_pl && cached_num != num ) || !cached_translation ) {
+    if( cached_language_version != current_language_version ) {
+        reset_cache();
         cached_language_version = current_language_version;
-        cached_num = num;
-
-        if( !ctxt ) {
-            if( !raw_pl ) {
-                cached_translation = cata::make_value<std::string>( detail::_translate_internal( raw ) );
-            } else {
-                cached_translation = cata::make_value<std::string>(
-                                         vgettext( raw.c_str(), raw_pl->c_str(), num ) );
-            }
-        } else {
-            if( !raw_pl ) {
-                cached_translation = cata::make_value<std::string>( pgettext( ctxt->c_str(), raw.c_str() ) );
-            } else {
-                cached_translation = cata::make_value<std::string>(
-                                         vpgettext( ctxt->c_str(), raw.c_str(), raw_pl->c_str(), num ) );
-            }
+    }
+    if( !raw_pl ) {
+        if( !cached_translation ) {
+            cached_translation = cata::make_value<std::string>( ctxt ?
+                                 pgettext( ctxt->c_str(), raw.c_str() ) : detail::_translate_internal( raw.c_str() ) );
+        }
+        return *cached_translation;
+    }
+    const auto lookup = [this]( const int n ) {
+        return cata::make_value<std::string>( ctxt ?
+                                              vpgettext( ctxt->c_str(), raw.c_str(), raw_pl->c_str(), n ) :
+                                              vgettext( raw.c_str(), raw_pl->c_str(), n ) );
+    };
+    if( num == 1 ) {
+        if( !cached_translation ) {
+            cached_translation = lookup( 1 );
         }
+        return *cached_translation;
+    }
+    if( !cached_translation_pl || cached_num != num ) {
+        cached_num = num;
+        cached_translation_pl = lookup( num );
     }
-    return *cached_translation;
+    return *cached_translation_pl;
+}
+
+std::string translation::translated( const int num ) const
+{
+    return cached( num );
 }
 
 bool translation::empty() const
@@ -346,12 +357,12 @@ bool translation::empty() const
 
 bool translation::translated_lt( const translation &that ) const
 {
-    return localized_compare( translated(), that.translated() );
+    return localized_compare( cached( 1 ), that.cached( 1 ) );
 }
 
 bool translation::translated_eq( const translation &that ) const
 {
-    return translated() == that.translated();
+    return cached( 1 ) == that.cached( 1 );
 }
 
 bool translation::translated_ne( const translation &that ) const
@@ -270,10 +270,17 @@ class translation
         std::string raw;
         cata::value_ptr<std::string> raw_pl = nullptr;
         bool needs_translation = false;
-        // translation cache. For "plural" translation only latest `num` is optimistically cached
+        /** Translation for @p num, from the cache if it is still valid. */
+        const std::string &cached( int num ) const;
+        void reset_cache() const;
+
+        // translation cache. The singular form is cached separately, so switching between
+        // e.g. "1 rock" and "2 rocks" doesn't evict it. For the other plural forms only the
+        // latest `num` is optimistically cached.
         mutable int cached_language_version = INVALID_LANGUAGE_VERSION;
-        mutable int cached_num = 0; // `num`, which `cached_translation` corresponds to
+        mutable int cached_num = 0; // `num`, which `cached_translation_pl` corresponds to
         mutable cata::value_ptr<std::string> cached_translation;
+        mutable cata::value_ptr<std::string> cached_translation_pl;
 };
 
 /**
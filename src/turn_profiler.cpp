@@ -0,0 +1,128 @@
+#include "turn_profiler.h"
+
+#include <deque>
+#include <memory>
+#include <ostream>
+
+#include "debug.h"
+#include "fstream_utils.h"
+
+namespace turn_profiler
+{
+
+bool detail::enabled = false;
+std::atomic<int> detail::active_phase{ static_cast<int>( phase::num_phases ) };
+
+namespace
+{
+struct profiler_state {
+    turn_stats current;
+    std::deque<turn_stats> history;
+    std::unique_ptr<cata_ofstream> csv;
+};
+
+profiler_state &get_state()
+{
+    static profiler_state state;
+    return state;
+}
+} // namespace
+
+const char *phase_name( phase p )
+{
+    switch( p ) {
+        case phase::vehmove:
+            return "vehmove";
+        case phase::process_fields:
+            return "process_fields";
+        case phase::process_items:
+            return "process_items";
+        case phase::build_map_cache:
+            return "build_map_cache";
+        case phase::monmove:
+            return "monmove";
+        case phase::monster_plan:
+            return "monster_plan";
+        case phase::npc_moves:
+            return "npc_moves";
+        case phase::lua_hooks:
+            return "lua_hooks";
+        case phase::lua_gc:
+            return "lua_gc";
+        case phase::draw:
+            return "draw";
+        case phase::num_phases:
+            break;
+    }
+    return "unknown";
+}
+
+void detail::record( phase p, std::chrono::nanoseconds time )
+{
+    phase_stats &stats = get_state().current[static_cast<size_t>( p )];
+    stats.time += time;
+    stats.calls++;
+}
+
+void set_enabled( bool enable, const std::string &csv_path )
+{
+    profiler_state &state = get_state();
+    state = profiler_state();
+    detail::enabled = enable;
+    if( !enable || csv_path.empty() ) {
+        return;
+    }
+
+    state.csv = std::make_unique<cata_ofstream>();
+    state.csv->open( csv_path );
+    if( !state.csv->is_open() ) {
+        debugmsg( "Could not open %s for writing the turn profile", csv_path );
+        state.csv.reset();
+        return;
+    }
+    std::ostream &os = **state.csv;
+    os << "turn";
+    for( size_t i = 0; i < num_phases; ++i ) {
+        const char *name = phase_name( static_cast<phase>( i ) );
+        os << ',' << name << "_us," << name << "_calls";
+    }
+    os << '\n';
+}
+
+void end_turn( int turn )
+{
+    if( !is_enabled() ) {
+        return;
+    }
+    profiler_state &state = get_state();
+    if( state.csv ) {
+        std::ostream &os = **state.csv;
+        os << turn;
+        for( const phase_stats &stats : state.current ) {
+            os << ',' << std::chrono::duration_cast<std::chrono::microseconds>( stats.time ).count()
+               << ',' << stats.calls;
+        }
+        os << '\n';
+    }
+    state.history.push_back( state.current );
+    if( static_cast<int>( state.history.size() ) > history_size ) {
+        state.history.pop_front();
+    }
+    state.current = turn_stats();
+}
+
+turn_stats recent_totals( int &turns )
+{
+    const profiler_state &state = get_state();
+    turn_stats totals;
+    for( const turn_stats &stats : state.history ) {
+        for( size_t i = 0; i < num_phases; ++i ) {
+            totals[i].time += stats[i].time;
+            totals[i].calls += stats[i].calls;
+        }
+    }
+    turns = static_cast<int>( state.history.size() );
+    return totals;
+}
+
+} // namespace turn_profiler
@@ -0,0 +1,121 @@
+#pragma once
+#ifndef CATA_SRC_TURN_PROFILER_H
+#define CATA_SRC_TURN_PROFILER_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+/**
+ * Built-in profiler measuring the wall time spent in the main phases of each turn.
+ *
+ * Unlike the Tracy zones in profile.h it is available in every build.  When it's
+ * disabled, a @ref scoped_phase costs a flag check and keeping track of the innermost
+ * running phase for @ref current_phase.
+ */
+namespace turn_profiler
+{
+
+enum class phase : int {
+    vehmove,
+    process_fields,
+    process_items,
+    build_map_cache,
+    monmove,
+    // Part of monmove
+    monster_plan,
+    npc_moves,
+    lua_hooks,
+    lua_gc,
+    draw,
+    num_phases
+};
+
+constexpr size_t num_phases = static_cast<size_t>( phase::num_phases );
+
+const char *phase_name( phase p );
+
+struct phase_stats {
+    std::chrono::nanoseconds time{ 0 };
+    int calls = 0;
+};
+
+using turn_stats = std::array<phase_stats, num_phases>;
+
+namespace detail
+{
+extern bool enabled;
+extern std::atomic<int> active_phase;
+void record( phase p, std::chrono::nanoseconds time );
+} // namespace detail
+
+inline bool is_enabled()
+{
+    return detail::enabled;
+}
+
+/**
+ * Innermost phase the main thread is in, phase::num_phases outside of all of them.
+ * Safe to call from other threads, see stall_watchdog.h.
+ */
+inline phase current_phase()
+{
+    return static_cast<phase>( detail::active_phase.load( std::memory_order_relaxed ) );
+}
+
+/**
+ * Starts or stops profiling, dropping all collected data.
+ * If @p csv_path is not empty, every finished turn is also appended to that file.
+ */
+void set_enabled( bool enable, const std::string &csv_path = std::string() );
+
+/** Closes the current turn.  Phases measured from now on count towards the next one. */
+void end_turn( int turn );
+
+/** Number of finished turns kept for @ref recent_totals. */
+constexpr int history_size = 100;
+
+/** Sums of the last (up to @ref history_size) finished turns, their number is stored in @p turns. */
+turn_stats recent_totals( int &turns );
+
+/** Measures the time until it's destroyed or stopped. */
+class scoped_phase
+{
+    public:
+        explicit scoped_phase( phase p ) : p( p ),
+            previous( detail::active_phase.exchange( static_cast<int>( p ), std::memory_order_relaxed ) ) {
+            if( is_enabled() ) {
+                running = true;
+                start = std::chrono::steady_clock::now();
+            }
+        }
+        scoped_phase( const scoped_phase & ) = delete;
+        scoped_phase &operator=( const scoped_phase & ) = delete;
+        ~scoped_phase() {
+            stop();
+        }
+
+        void stop() {
+            if( !stopped ) {
+                stopped = true;
+                detail::active_phase.store( previous, std::memory_order_relaxed );
+            }
+            if( running ) {
+                running = false;
+                detail::record( p, std::chrono::steady_clock::now() - start );
+            }
+        }
+
+    private:
+        phase p;
+        int previous;
+        bool stopped = false;
+        bool running = false;
+        std::chrono::steady_clock::time_point start;
+};
+
+} // namespace turn_profiler
+
+#endif // CATA_SRC_TURN_PROFILER_H
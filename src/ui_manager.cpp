@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <chrono>
 #include <iterator>
 #include <memory>
 #include <optional>
@@ -10,6 +11,7 @@
 #include "cached_options.h"
 #include "cursesdef.h"
 #include "game_ui.h"
+#include "output.h"
 #include "point.h"
 #include "sdltiles.h"
 #include "profile.h"
@@ -472,6 +474,21 @@ void redraw_invalidated()
     ui_adaptor::redraw_invalidated();
 }
 
+bool present_if_due( const std::chrono::milliseconds interval )
+{
+    static std::optional<std::chrono::steady_clock::time_point> last_present;
+    const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    if( last_present && now - *last_present < interval ) {
+        return false;
+    }
+    last_present = now;
+    if( !test_mode ) {
+        ui_adaptor::redraw();
+        refresh_display();
+    }
+    return true;
+}
+
 void screen_resized()
 {
     ui_adaptor::screen_resized();
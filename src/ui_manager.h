@@ -2,6 +2,7 @@
 #ifndef CATA_SRC_UI_MANAGER_H
 #define CATA_SRC_UI_MANAGER_H
 
+#include <chrono>
 #include <functional>
 
 #include "cuboid_rectangle.h"
@@ -272,6 +273,15 @@ void redraw();
  * Redraw all invalidated windows without invalidating the top window.
  **/
 void redraw_invalidated();
+/** Shortest time between two presents by `present_if_due`, about 60 frames per second. */
+constexpr std::chrono::milliseconds frame_interval( 16 );
+/**
+ * Redraw and refresh the display, unless the last present by this function has been
+ * less than `interval` ago. For loops that want to show progress without spending
+ * most of their time re-rendering frames that are never seen.
+ * Returns whether the display was presented.
+ **/
+bool present_if_due( std::chrono::milliseconds interval = frame_interval );
 /**
  * Handle resize of the game window.
  * Not supposed to be directly called by the user.
@@ -2109,6 +2109,8 @@ void vehicle::part_removal_cleanup()
             here.clear_vehicle_point_from_cache( this, pt );
             it = parts.erase( it );
             changed = true;
+            // Indices shifted, refresh() may be suspended
+            feature_index_size = 0;
         } else {
             ++it;
         }
@@ -2124,8 +2126,10 @@ void vehicle::part_removal_cleanup()
             here.add_vehicle_to_cache( this );
         }
     }
-    shift_if_needed();
-    refresh(); // Rebuild cached indices
+    // Both refresh when they change anything
+    if( !shift_if_needed() && !changed ) {
+        refresh(); // Rebuild cached indices
+    }
     coeff_air_dirty = coeff_air_changed;
     coeff_air_changed = false;
 }
@@ -2724,9 +2728,11 @@ int vehicle::avail_part_with_feature( point pt, const std::string &flag,
 
 bool vehicle::has_part( const std::string &flag, bool enabled ) const
 {
-    return std::any_of( parts.begin(), parts.end(), [&flag, &enabled]( const vehicle_part & e ) {
-        return !e.removed && ( !enabled || e.enabled ) && !e.is_broken() && e.info().has_flag( flag );
-    } );
+    const part_status_flag required = enabled ?
+                                      part_status_flag::working | part_status_flag::enabled :
+                                      part_status_flag::working;
+    return !empty( vehicle_part_with_feature_range<std::string>( const_cast<vehicle &>( *this ),
+                   flag, required ) );
 }
 
 bool vehicle::has_part( const tripoint &pos, const std::string &flag, bool enabled ) const
@@ -2876,6 +2882,19 @@ int vehicle::next_part_to_open( int p, bool outside ) const
     return -1;
 }
 
+const std::vector<int> &vehicle::indexed_parts_with( const vpart_bitflags flag ) const
+{
+    static const std::vector<int> none;
+    return feature_index_size == 0 ? none : parts_by_bitflag[flag];
+}
+
+const std::vector<int> &vehicle::indexed_parts_with( const std::string &flag ) const
+{
+    static const std::vector<int> none;
+    const auto found = parts_by_flag.find( flag );
+    return found == parts_by_flag.end() ? none : found->second;
+}
+
 vehicle_part_with_feature_range<std::string> vehicle::get_avail_parts( std::string feature ) const
 {
     return vehicle_part_with_feature_range<std::string>( const_cast<vehicle &>( *this ),
@@ -3333,6 +3352,9 @@ void vehicle::precalc_mounts( int idir, units::angle dir, point pivot )
     }
     pivot_anchor[idir] = pivot;
     pivot_rotation[idir] = dir;
+    if( idir == 0 ) {
+        mass_center_precalc_dirty = true;
+    }
 }
 
 bool vehicle::check_rotated_intervening( point from, point to,
@@ -3491,8 +3513,10 @@ units::volume vehicle::total_folded_volume() const
 
 point vehicle::rotated_center_of_mass() const
 {
-    // TODO: Bring back caching of this point
-    calc_mass_center( true );
+    // Dirty when the mass changes or the parts move to new precalc points
+    if( mass_center_precalc_dirty ) {
+        calc_mass_center( true );
+    }
 
     return mass_center_precalc;
 }
@@ -3912,11 +3936,12 @@ int vehicle::max_reverse_velocity( const bool fueled ) const
 // the same physics as max_ground_velocity, but with a smaller engine power
 int vehicle::safe_ground_velocity( const bool fueled ) const
 {
-    for( size_t e = 0; e < parts.size(); e++ ) {
-        const vehicle_part &vp = parts[ e ];
+    // Only engines can be pulled by animals
+    for( const vpart_reference &engine : get_any_parts( VPFLAG_ENGINE ) ) {
+        const vehicle_part &vp = engine.part();
         int animal_vel = 0;
         if( vp.info().fuel_type == fuel_type_animal && engines.size() != 1 ) {
-            monster *mon = get_pet( e );
+            monster *mon = get_pet( engine.part_index() );
             if( mon != nullptr && mon->has_effect( effect_harnessed ) ) {
                 int animal_vel_cur = mon->get_speed() * 12;
                 if( animal_vel > 0 ) {
@@ -5397,8 +5422,38 @@ void vehicle::do_engine_damage( size_t e, int strain )
     }
 }
 
+bool vehicle::is_hibernating() const
+{
+    if( engine_on || velocity != 0 || vertical_velocity != 0 || is_flying || is_alarm_on ) {
+        return false;
+    }
+    // Without running engines or enabled consumers power_parts has nothing to balance,
+    // the accessories may still be enabled if they don't draw power
+    if( !empty( get_enabled_parts( VPFLAG_ENABLED_DRAINS_EPOWER ) ) ||
+        std::any_of( reactors.begin(), reactors.end(), [this]( int p ) {
+        return is_part_on( p );
+    } ) ) {
+        return false;
+    }
+    if( std::any_of( emitters.begin(), emitters.end(), [this]( int p ) {
+    return parts[p].enabled && !parts[p].is_unavailable();
+    } ) ) {
+        return false;
+    }
+    return !has_part( "PLANTER", true ) && !has_part( "STEREO", true ) &&
+           !has_part( "CHIMES", true ) && !has_part( "CRASH_TERRAIN_AROUND", true );
+}
+
 void vehicle::idle( bool on_map )
 {
+    if( is_hibernating() ) {
+        // Batteries only change through solar panels and the like, which are accounted
+        // for all the time since the last update at once
+        if( on_map ) {
+            update_time( calendar::turn );
+        }
+        return;
+    }
     power_parts();
     if( engine_on && total_power_w() > 0 ) {
         int idle_rate = alternator_load;
@@ -5483,10 +5538,10 @@ void vehicle::slow_leak()
 {
     // for each badly damaged tanks (lower than 50% health), leak a small amount
     for( auto &p : parts ) {
-        auto health = p.health_percent();
         if( !p.is_leaking() || p.ammo_remaining() <= 0 ) {
             continue;
         }
+        auto health = p.health_percent();
 
         auto fuel = p.ammo_current();
         int qty = std::max( ( 0.5 - health ) * ( 0.5 - health ) * p.ammo_remaining() / 10, 1.0 );
@@ -5860,26 +5915,13 @@ void vehicle::refresh()
         return;
     }
 
-    alternators.clear();
-    engines.clear();
-    reactors.clear();
-    solar_panels.clear();
-    wind_turbines.clear();
-    sails.clear();
-    water_wheels.clear();
-    funnels.clear();
-    emitters.clear();
+    clear_available_part_lists();
     relative_parts.clear();
-    loose_parts.clear();
-    wheelcache.clear();
-    rail_wheelcache.clear();
-    rotors.clear();
-    steering.clear();
-    speciality.clear();
     floating.clear();
-    alternator_load = 0;
-    extra_drag = 0;
-    rail_profile.clear();
+    parts_by_bitflag.assign( NUM_VPFLAGS, std::vector<int>() );
+    parts_by_flag.clear();
+    // Queries during the loop below must not use the half built index
+    feature_index_size = 0;
 
     // Used to sort part list so it displays properly when examining
     struct sort_veh_part_vector {
@@ -5905,6 +5947,15 @@ void vehicle::refresh()
         }
         refresh_done = true;
 
+        for( int flag = 0; flag < NUM_VPFLAGS; flag++ ) {
+            if( vpi.has_flag( static_cast<vpart_bitflags>( flag ) ) ) {
+                parts_by_bitflag[flag].push_back( p );
+            }
+        }
+        for( const std::string &flag : vpi.get_flags() ) {
+            parts_by_flag[flag].push_back( p );
+        }
+
         // Build map of point -> all parts in that point
         const point pt = vp.mount();
         mount_min.x = std::min( mount_min.x, pt.x );
@@ -5922,81 +5973,13 @@ void vehicle::refresh()
             floating.push_back( p );
         }
 
-        if( vp.part().is_unavailable() ) {
-            continue;
-        }
-        if( vpi.has_flag( VPFLAG_ALTERNATOR ) ) {
-            alternators.push_back( p );
-        }
-        if( vpi.has_flag( VPFLAG_ENGINE ) ) {
-            engines.push_back( p );
-        }
-        if( vpi.has_flag( VPFLAG_REACTOR ) ) {
-            reactors.push_back( p );
-        }
-        if( vpi.has_flag( VPFLAG_SOLAR_PANEL ) ) {
-            solar_panels.push_back( p );
-        }
-        if( vpi.has_flag( VPFLAG_ROTOR ) ) {
-            rotors.push_back( p );
-        }
-        if( vpi.has_flag( "WIND_TURBINE" ) ) {
-            wind_turbines.push_back( p );
-        }
-        if( vpi.has_flag( "WIND_POWERED" ) ) {
-            sails.push_back( p );
-        }
-        if( vpi.has_flag( "WATER_WHEEL" ) ) {
-            water_wheels.push_back( p );
-        }
-        if( vpi.has_flag( "FUNNEL" ) ) {
-            funnels.push_back( p );
-        }
-        if( vpi.has_flag( "UNMOUNT_ON_MOVE" ) ) {
-            loose_parts.push_back( p );
-        }
-        if( vpi.has_flag( "EMITTER" ) ) {
-            emitters.push_back( p );
-        }
-        if( vpi.has_flag( VPFLAG_WHEEL ) ) {
-            wheelcache.push_back( p );
-        }
-        if( vpi.has_flag( VPFLAG_RAIL ) ) {
-            rail_wheelcache.push_back( p );
-
-            const int rail_pos = vp.mount().y;
-            const auto it = std::find( rail_profile.cbegin(), rail_profile.cend(), rail_pos );
-            if( it == rail_profile.cend() ) {
-                rail_profile.push_back( rail_pos );
-            }
-        }
-        if( ( vpi.has_flag( "STEERABLE" ) && part_with_feature( pt, "STEERABLE", true ) != -1 ) ||
-            vpi.has_flag( "TRACKED" ) ) {
-            // TRACKED contributes to steering effectiveness but
-            //  (a) doesn't count as a steering axle for install difficulty
-            //  (b) still contributes to drag for the center of steering calculation
-            steering.push_back( p );
-        }
-        if( vpi.has_flag( "SECURITY" ) ) {
-            speciality.push_back( p );
-        }
-        if( vp.part().enabled && vpi.has_flag( "EXTRA_DRAG" ) ) {
-            extra_drag += vpi.power;
-        }
-        if( vpi.has_flag( "EXTRA_DRAG" ) && ( vpi.has_flag( "WIND_TURBINE" ) ||
-                                              vpi.has_flag( "WATER_WHEEL" ) ) ) {
-            extra_drag += vpi.power;
-        }
-        if( camera_on && vpi.has_flag( "CAMERA" ) ) {
-            vp.part().enabled = true;
-        } else if( !camera_on && vpi.has_flag( "CAMERA" ) ) {
-            vp.part().enabled = false;
-        }
-        if( vpi.has_flag( "TURRET" ) && !has_part( global_part_pos3( vp.part() ), "TURRET_CONTROLS" ) ) {
-            vp.part().enabled = false;
+        if( !vp.part().is_unavailable() ) {
+            index_available_part( vp );
         }
     }
 
+    feature_index_size = parts.size();
+
     front_left.x = mount_max.x;
     front_left.y = mount_min.y;
     front_right = mount_max;
@@ -6013,6 +5996,122 @@ void vehicle::refresh()
     invalidate_mass();
 }
 
+void vehicle::clear_available_part_lists()
+{
+    alternators.clear();
+    engines.clear();
+    reactors.clear();
+    solar_panels.clear();
+    wind_turbines.clear();
+    sails.clear();
+    water_wheels.clear();
+    funnels.clear();
+    emitters.clear();
+    loose_parts.clear();
+    wheelcache.clear();
+    rail_wheelcache.clear();
+    rotors.clear();
+    steering.clear();
+    speciality.clear();
+    alternator_load = 0;
+    extra_drag = 0;
+    rail_profile.clear();
+}
+
+void vehicle::index_available_part( const vpart_reference &vp )
+{
+    const size_t p = vp.part_index();
+    const vpart_info &vpi = vp.info();
+    if( vpi.has_flag( VPFLAG_ALTERNATOR ) ) {
+        alternators.push_back( p );
+    }
+    if( vpi.has_flag( VPFLAG_ENGINE ) ) {
+        engines.push_back( p );
+    }
+    if( vpi.has_flag( VPFLAG_REACTOR ) ) {
+        reactors.push_back( p );
+    }
+    if( vpi.has_flag( VPFLAG_SOLAR_PANEL ) ) {
+        solar_panels.push_back( p );
+    }
+    if( vpi.has_flag( VPFLAG_ROTOR ) ) {
+        rotors.push_back( p );
+    }
+    if( vpi.has_flag( "WIND_TURBINE" ) ) {
+        wind_turbines.push_back( p );
+    }
+    if( vpi.has_flag( "WIND_POWERED" ) ) {
+        sails.push_back( p );
+    }
+    if( vpi.has_flag( "WATER_WHEEL" ) ) {
+        water_wheels.push_back( p );
+    }
+    if( vpi.has_flag( "FUNNEL" ) ) {
+        funnels.push_back( p );
+    }
+    if( vpi.has_flag( "UNMOUNT_ON_MOVE" ) ) {
+        loose_parts.push_back( p );
+    }
+    if( vpi.has_flag( "EMITTER" ) ) {
+        emitters.push_back( p );
+    }
+    if( vpi.has_flag( VPFLAG_WHEEL ) ) {
+        wheelcache.push_back( p );
+    }
+    if( vpi.has_flag( VPFLAG_RAIL ) ) {
+        rail_wheelcache.push_back( p );
+
+        const int rail_pos = vp.mount().y;
+        const auto it = std::find( rail_profile.cbegin(), rail_profile.cend(), rail_pos );
+        if( it == rail_profile.cend() ) {
+            rail_profile.push_back( rail_pos );
+        }
+    }
+    if( ( vpi.has_flag( "STEERABLE" ) && part_with_feature( vp.mount(), "STEERABLE", true ) != -1 ) ||
+        vpi.has_flag( "TRACKED" ) ) {
+        // TRACKED contributes to steering effectiveness but
+        //  (a) doesn't count as a steering axle for install difficulty
+        //  (b) still contributes to drag for the center of steering calculation
+        steering.push_back( p );
+    }
+    if( vpi.has_flag( "SECURITY" ) ) {
+        speciality.push_back( p );
+    }
+    if( vp.part().enabled && vpi.has_flag( "EXTRA_DRAG" ) ) {
+        extra_drag += vpi.power;
+    }
+    if( vpi.has_flag( "EXTRA_DRAG" ) && ( vpi.has_flag( "WIND_TURBINE" ) ||
+                                          vpi.has_flag( "WATER_WHEEL" ) ) ) {
+        extra_drag += vpi.power;
+    }
+    if( camera_on && vpi.has_flag( "CAMERA" ) ) {
+        vp.part().enabled = true;
+    } else if( !camera_on && vpi.has_flag( "CAMERA" ) ) {
+        vp.part().enabled = false;
+    }
+    if( vpi.has_flag( "TURRET" ) && !has_part( global_part_pos3( vp.part() ), "TURRET_CONTROLS" ) ) {
+        vp.part().enabled = false;
+    }
+}
+
+void vehicle::refresh_available_parts()
+{
+    if( no_refresh ) {
+        return;
+    }
+
+    clear_available_part_lists();
+    for( const vpart_reference &vp : get_all_parts() ) {
+        if( !vp.part().removed && !vp.part().is_unavailable() ) {
+            index_available_part( vp );
+        }
+    }
+
+    check_environmental_effects = true;
+    insides_dirty = true;
+    invalidate_mass();
+}
+
 void vehicle::refresh_position()
 {
     if( !parts.empty() ) {
@@ -6737,7 +6836,6 @@ bool vehicle::shift_if_needed()
             && !vp.has_feature( "PROTRUSION" )
             && !vp.part().removed ) {
             shift_parts( vp.mount() );
-            refresh();
             return true;
         }
     }
@@ -6745,7 +6843,6 @@ bool vehicle::shift_if_needed()
     for( const vpart_reference &vp : get_all_parts() ) {
         if( !vp.part().removed ) {
             shift_parts( vp.mount() );
-            refresh();
             return true;
         }
     }
@@ -6892,8 +6989,9 @@ int vehicle::damage_direct( int p, int dmg, damage_type type )
         invalidate_mass();
         coeff_air_changed = true;
 
-        // refresh cache in case the broken part has changed the status
-        refresh();
+        // refresh cache in case the broken part has changed the status, the part is still
+        // there, so only the lists of working parts change
+        refresh_available_parts();
     }
 
     if( parts[p].is_fuel_store() ) {
@@ -6967,6 +7065,7 @@ bool vehicle::restore( const std::string &data )
     try {
         JsonIn json( veh_data );
         parts.clear();
+        feature_index_size = 0;
         json.read( parts );
     } catch( const JsonError &e ) {
         debugmsg( "Error restoring vehicle: %s", e.c_str() );
@@ -7337,6 +7436,7 @@ std::set<int> vehicle::advance_precalc_mounts( point new_pos, const tripoint &sr
 
     pivot_anchor[0] = pivot_anchor[1];
     pivot_rotation[0] = pivot_rotation[1];
+    mass_center_precalc_dirty = true;
     pos = new_pos;
 
     // Invalidate vehicle's point cache
@@ -7374,6 +7474,22 @@ bool vehicle::refresh_zones()
     return false;
 }
 
+template<>
+void vehicle_part_with_feature_range<std::string>::find_candidates()
+{
+    const ::vehicle &veh = this->vehicle();
+    indexed_ = std::min<size_t>( veh.feature_index_size, veh.part_count() );
+    candidates_ = &veh.indexed_parts_with( feature_ );
+}
+
+template<>
+void vehicle_part_with_feature_range<vpart_bitflags>::find_candidates()
+{
+    const ::vehicle &veh = this->vehicle();
+    indexed_ = std::min<size_t>( veh.feature_index_size, veh.part_count() );
+    candidates_ = &veh.indexed_parts_with( feature_ );
+}
+
 template<>
 bool vehicle_part_with_feature_range<std::string>::matches( const size_t part ) const
 {
@@ -43,6 +43,7 @@ struct vehicle_part;
 class vehicle_cursor;
 class vehicle_part_range;
 class vpart_info;
+class vpart_reference;
 struct itype;
 struct uilist_entry;
 template <typename T> class visitable;
@@ -421,6 +422,9 @@ class vehicle
 
         //Refresh all caches and re-locate all parts
         void refresh();
+        // Refresh only the lists of parts that depend on parts being available, for when
+        // parts break or get repaired without any part being added, removed or moved
+        void refresh_available_parts();
 
         // Do stuff like clean up blood and produce smoke from broken parts. Returns false if nothing needs doing.
         bool do_environmental_effects();
@@ -445,6 +449,12 @@ class vehicle
         // refresh pivot_cache, clear pivot_dirty
         void refresh_pivot() const;
 
+    private:
+        void clear_available_part_lists();
+        void index_available_part( const vpart_reference &vp );
+
+    public:
+
         void refresh_mass() const;
         void calc_mass_center( bool precalc ) const;
 
@@ -1165,6 +1175,8 @@ class vehicle
                                         const std::set<vehicle *> &vehicle_list );
         // idle fuel consumption
         void idle( bool on_map = true );
+        // true if idle() has nothing to do but the weather accounting of update_time
+        bool is_hibernating() const;
         // continuous processing for running vehicle alarms
         void alarm();
         // leak from broken tanks
@@ -1584,6 +1596,15 @@ class vehicle
         std::vector<int> speciality;
         std::vector<int> floating;         // List of parts that provide buoyancy to boats
 
+        // Not removed parts with each flag, built by refresh() for the first
+        // feature_index_size parts.  Parts added since then aren't indexed yet.
+        std::vector<std::vector<int>> parts_by_bitflag;
+        std::unordered_map<std::string, std::vector<int>> parts_by_flag;
+        size_t feature_index_size = 0;
+        // Sorted indices of the indexed parts that have the flag
+        const std::vector<int> &indexed_parts_with( vpart_bitflags flag ) const;
+        const std::vector<int> &indexed_parts_with( const std::string &flag ) const;
+
         /**
          * Rail profile of the vehicle.
          *
@@ -12,6 +12,7 @@
 #include <optional>
 #include <queue>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -230,6 +231,69 @@ struct navigation_node {
     bool is_goal;
 };
 
+/**
+ * Navigation nodes found by one search, by address.  Nodes on the nav map are kept in a
+ * flat grid that is reused by the next search instead of being allocated again, the few
+ * goal nodes past the edge of the nav map in a hash map.
+ */
+class navigation_node_store
+{
+    public:
+        void clear() {
+            if( ++generation == 0 ) {
+                // Stamps wrapped around, old ones could look current
+                std::fill( stamps.begin(), stamps.end(), 0 );
+                generation = 1;
+            }
+            outside.clear();
+            count = 0;
+        }
+        size_t size() const {
+            return count;
+        }
+        navigation_node *find( const node_address &addr ) {
+            const int i = index( addr );
+            if( i < 0 ) {
+                const auto iter = outside.find( addr );
+                return iter == outside.end() ? nullptr : &iter->second;
+            }
+            return stamps[i] == generation ? &nodes[i] : nullptr;
+        }
+        void insert( const node_address &addr, const navigation_node &node ) {
+            const int i = index( addr );
+            if( i < 0 ) {
+                outside[addr] = node;
+            } else {
+                if( nodes.empty() ) {
+                    nodes.resize( grid_size );
+                    stamps.resize( grid_size, 0 );
+                }
+                nodes[i] = node;
+                stamps[i] = generation;
+            }
+            count++;
+        }
+
+    private:
+        static constexpr int grid_size = NUM_ORIENTATIONS * NAV_MAP_SIZE_X * NAV_MAP_SIZE_Y;
+
+        static int index( const node_address &addr ) {
+            if( addr.x < 0 || addr.x >= NAV_MAP_SIZE_X || addr.y < 0 || addr.y >= NAV_MAP_SIZE_Y ) {
+                return -1;
+            }
+            return ( static_cast<int>( addr.facing_dir ) * NAV_MAP_SIZE_X + addr.x ) * NAV_MAP_SIZE_Y +
+                   addr.y;
+        }
+
+        // Allocated once, so references to nodes stay valid while more are inserted
+        std::vector<navigation_node> nodes;
+        // Nodes are only valid if their stamp is the current generation
+        std::vector<std::uint32_t> stamps;
+        std::uint32_t generation = 1;
+        std::unordered_map<node_address, navigation_node, node_address_hasher> outside;
+        size_t count = 0;
+};
+
 /*
  * Data type describing a point transformation via translation and rotation.
  */
@@ -288,6 +352,8 @@ struct auto_navigation_data {
     bool valid_positions[NUM_ORIENTATIONS][NAV_MAP_SIZE_X][NAV_MAP_SIZE_Y];
     // node addresses that are valid end positions
     std::unordered_set<node_address, node_address_hasher> goal_zone;
+    // same as goal_zone, for the lookups during the search
+    bool in_goal_zone[NUM_ORIENTATIONS][NAV_MAP_SIZE_X][NAV_MAP_SIZE_Y];
     // the middle of the goal zone, in nav map coords
     std::array<point, NAV_MAP_NUM_OMT> goal_points;
 
@@ -313,6 +379,9 @@ struct auto_navigation_data {
     bool valid_position( const node_address &addr ) const {
         return valid_position( addr.facing_dir, point( addr.x, addr.y ) );
     }
+    bool is_goal( const node_address &addr ) const {
+        return in_goal_zone[static_cast<int>( addr.facing_dir )][addr.x][addr.y];
+    }
 };
 
 enum class collision_check_result : int {
@@ -341,6 +410,8 @@ class vehicle::autodrive_controller
         const vehicle &driven_veh;
         const Character &driver;
         auto_navigation_data data;
+        // Only used by compute_path, kept to reuse its storage
+        mutable navigation_node_store known_nodes;
 
         void compute_coordinates();
         bool check_drivable( tripoint pt ) const;
@@ -744,15 +815,21 @@ void vehicle::autodrive_controller::compute_obstacles()
 void vehicle::autodrive_controller::compute_valid_positions()
 {
     const coord_transformation veh_rot = {point_zero, -data.nav_to_map.rotation, point_zero};
+    std::vector<point> zone_offsets;
     for( orientation facing : all_orientations() ) {
         const vehicle_profile &profile = data.profile( data.nav_to_map.transform( facing ) );
+        // The rotated hull is the same for every position
+        zone_offsets.clear();
+        for( point veh_pt : profile.occupied_zone ) {
+            zone_offsets.push_back( veh_rot.transform( veh_pt ) - veh_rot.transform( point_zero ) );
+        }
         for( int mx = 0; mx < NAV_MAP_SIZE_X; mx++ ) {
             for( int my = 0; my < NAV_MAP_SIZE_Y; my++ ) {
                 const point nav_pt( mx, my );
+                const point view_origin = data.nav_to_view.transform( nav_pt );
                 bool valid = true;
-                for( point veh_pt : profile.occupied_zone ) {
-                    const point view_pt = data.nav_to_view.transform( nav_pt ) + veh_rot.transform(
-                                              veh_pt ) - veh_rot.transform( point_zero );
+                for( point offset : zone_offsets ) {
+                    const point view_pt = view_origin + offset;
                     if( !data.view_bounds.contains( view_pt ) || data.is_obstacle[view_pt.x][view_pt.y] ) {
                         valid = false;
                         break;
@@ -767,6 +844,8 @@ void vehicle::autodrive_controller::compute_valid_positions()
 void vehicle::autodrive_controller::compute_goal_zone()
 {
     data.goal_zone.clear();
+    std::fill_n( &data.in_goal_zone[0][0][0], NUM_ORIENTATIONS * NAV_MAP_SIZE_X * NAV_MAP_SIZE_Y,
+                 false );
     coord_transformation goal_transform;
     if( data.next_next_omt != data.next_omt ) {
         // set the goal at the edge of next_omt and next_next_omt (in next_omt
@@ -790,6 +869,7 @@ void vehicle::autodrive_controller::compute_goal_zone()
             const node_address addr = goal_transform.transform( pt, dir );
             if( data.valid_position( addr ) ) {
                 data.goal_zone.insert( addr );
+                data.in_goal_zone[static_cast<int>( addr.facing_dir )][addr.x][addr.y] = true;
             }
         }
     }
@@ -922,7 +1002,7 @@ const
                 }
             } else if( !data.valid_position( next_addr ) ) {
                 ok = false;
-            } else if( !goal_found && data.goal_zone.find( next_addr ) != data.goal_zone.end() ) {
+            } else if( !goal_found && data.is_goal( next_addr ) ) {
                 goal_found = true;
             }
         }
@@ -956,23 +1036,23 @@ std::optional<std::vector<navigation_step>> vehicle::autodrive_controller::compu
     constexpr size_t max_search_count = 10000;
     std::vector<navigation_step> ret;
     // TODO: check simple reachability first and bail out or set upper bound on node score
-    std::unordered_map<node_address, navigation_node, node_address_hasher> known_nodes;
+    known_nodes.clear();
     std::priority_queue<scored_address, std::vector<scored_address>, std::greater<>>
             open_set;
     const tripoint_abs_ms veh_pos = driven_veh.global_square_location();
     const node_address start = data.nav_to_map.inverse().transform(
                                    veh_pos.raw().xy(), to_orientation( driven_veh.face.dir() ) );
-    known_nodes.emplace( start, make_start_node( start, driven_veh ) );
+    known_nodes.insert( start, make_start_node( start, driven_veh ) );
     open_set.push( scored_address{ start, 0 } );
     std::vector<std::pair<node_address, navigation_node>> next_nodes;
     while( !open_set.empty() ) {
         const node_address cur_addr = open_set.top().addr;
         open_set.pop();
-        const navigation_node &cur_node = known_nodes[cur_addr];
+        const navigation_node &cur_node = *known_nodes.find( cur_addr );
         if( cur_node.is_goal ) {
             node_address addr = cur_addr;
             while( !( addr == start ) ) {
-                const navigation_node &node = known_nodes.at( addr );
+                const navigation_node &node = *known_nodes.find( addr );
                 const node_address &prev = node.prev;
                 const tripoint_abs_ms prev_loc( data.nav_to_map.transform( prev.get_point(),
                                                 data.current_omt.z() ) );
@@ -990,18 +1070,17 @@ std::optional<std::vector<navigation_step>> vehicle::autodrive_controller::compu
         for( const auto &next : next_nodes ) {
             const node_address &next_addr = next.first;
             const navigation_node &next_node = next.second;
-            auto iter = known_nodes.find( next_addr );
-            if( iter != known_nodes.end() ) {
-                const navigation_node &other_node = iter->second;
-                if( next_node.cost < other_node.cost ) {
+            navigation_node *other_node = known_nodes.find( next_addr );
+            if( other_node != nullptr ) {
+                if( next_node.cost < other_node->cost ) {
                     const bool same_dir = cur_addr.facing_dir == next_addr.facing_dir;
                     const bool dir_multiple_45 = static_cast<int>( next_addr.facing_dir ) % 3 == 0;
                     if( ( !same_dir && next_node.tileray_steps == 1 ) || dir_multiple_45 ) {
-                        iter->second = next_node;
+                        *other_node = next_node;
                     }
                 }
             } else if( known_nodes.size() < max_search_count ) {
-                known_nodes[next_addr] = next_node;
+                known_nodes.insert( next_addr, next_node );
                 open_set.push( compute_node_score( next_addr, next_node ) );
             }
         }
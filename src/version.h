@@ -0,0 +1,2 @@
+// NOLINT(cata-header-guard)
+#define VERSION "1da0a21"
@@ -5,6 +5,7 @@
 #include <limits>
 #include <map>
 #include <memory>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 
@@ -48,12 +49,231 @@ static const bionic_id bio_ups( "bio_ups" );
 
 static const flag_id flag_BIONIC_ARMOR_INTERFACE( "BIONIC_ARMOR_INTERFACE" );
 
+// Specialize visitable<T>::visit_items_inline() for each class that will implement the visitable interface
+
+template <typename F>
+static VisitResponse visit_node( F &func, item *node, item *parent = nullptr )
+{
+    switch( func( node, parent ) ) {
+        case VisitResponse::ABORT:
+            return VisitResponse::ABORT;
+
+        case VisitResponse::NEXT:
+            if( node->is_gun() || node->is_magazine() ) {
+                // Content of guns and magazines are accessible only via their specific accessors
+                return VisitResponse::NEXT;
+            }
+
+            for( item *e : node->contents.all_items_top() ) {
+                if( visit_node( func, e, node ) == VisitResponse::ABORT ) {
+                    return VisitResponse::ABORT;
+                }
+            }
+        /* intentional fallthrough */
+
+        case VisitResponse::SKIP:
+            return VisitResponse::NEXT;
+    }
+
+    /* never reached but suppresses GCC warning */
+    return VisitResponse::ABORT;
+}
+
+VisitResponse item_contents::visit_contents( const std::function<VisitResponse( item *, item * )>
+        &func, item *parent )
+{
+    for( item *&e : items ) {
+        switch( visit_node( func, e, parent ) ) {
+            case VisitResponse::ABORT:
+                return VisitResponse::ABORT;
+            default:
+                break;
+        }
+    }
+    return VisitResponse::NEXT;
+}
+
+/** @relates visitable */
+template <>
+template <typename F>
+VisitResponse visitable<item>::visit_items_inline( F &func )
+{
+    auto it = static_cast<item *>( this );
+    return visit_node( func, it );
+}
+
+/** @relates visitable */
+template <>
+template <typename F>
+VisitResponse visitable<inventory>::visit_items_inline( F &func )
+{
+    auto inv = static_cast<const inventory *>( this );
+    for( auto &stack : inv->items ) {
+        for( auto &it : stack ) {
+            if( visit_node( func, it ) == VisitResponse::ABORT ) {
+                return VisitResponse::ABORT;
+            }
+        }
+    }
+    return VisitResponse::NEXT;
+}
+
+template <>
+template <typename F>
+VisitResponse visitable<location_inventory>::visit_items_inline( F &func )
+{
+    auto inv = static_cast<location_inventory *>( this );
+    return inv->inv.visit_items_inline( func );
+}
+
+/** @relates visitable */
+template <>
+template <typename F>
+VisitResponse visitable<Character>::visit_items_inline( F &func )
+{
+    auto ch = static_cast<Character *>( this );
+
+    if( !ch->primary_weapon().is_null() &&
+        visit_node( func, &ch->primary_weapon() ) == VisitResponse::ABORT ) {
+        return VisitResponse::ABORT;
+    }
+
+    for( auto &e : ch->worn ) {
+        if( visit_node( func, e ) == VisitResponse::ABORT ) {
+            return VisitResponse::ABORT;
+        }
+    }
+
+    return ch->inv.visit_items_inline( func );
+}
+
+/** @relates visitable */
+template <>
+template <typename F>
+VisitResponse visitable<map_cursor>::visit_items_inline( F &func )
+{
+    auto cur = static_cast<map_cursor *>( this );
+    map &here = get_map();
+    // skip inaccessible items
+    if( here.has_flag( "SEALED", *cur ) && !here.has_flag( "LIQUIDCONT", *cur ) ) {
+        return VisitResponse::NEXT;
+    }
+
+    for( item *&e : here.i_at( *cur ) ) {
+        if( visit_node( func, e ) == VisitResponse::ABORT ) {
+            return VisitResponse::ABORT;
+        }
+    }
+    return VisitResponse::NEXT;
+}
+
+/** @relates visitable */
+template <>
+template <typename F>
+VisitResponse visitable<map_selector>::visit_items_inline( F &func )
+{
+    for( auto &cursor : static_cast<map_selector &>( *this ) ) {
+        if( cursor.visit_items_inline( func ) == VisitResponse::ABORT ) {
+            return VisitResponse::ABORT;
+        }
+    }
+    return VisitResponse::NEXT;
+}
+
+/** @relates visitable */
+template <>
+template <typename F>
+VisitResponse visitable<vehicle_cursor>::visit_items_inline( F &func )
+{
+    auto self = static_cast<vehicle_cursor *>( this );
+
+    int idx = self->veh.part_with_feature( self->part, "CARGO", true );
+    if( idx >= 0 ) {
+        for( auto *&e : self->veh.get_items( idx ) ) {
+            if( visit_node( func, e ) == VisitResponse::ABORT ) {
+                return VisitResponse::ABORT;
+            }
+        }
+    }
+    return VisitResponse::NEXT;
+}
+
+/** @relates visitable */
+template <>
+template <typename F>
+VisitResponse visitable<vehicle_selector>::visit_items_inline( F &func )
+{
+    for( auto &cursor : static_cast<vehicle_selector &>( *this ) ) {
+        if( cursor.visit_items_inline( func ) == VisitResponse::ABORT ) {
+            return VisitResponse::ABORT;
+        }
+    }
+    return VisitResponse::NEXT;
+}
+
+/** @relates visitable */
+template <>
+template <typename F>
+VisitResponse visitable<monster>::visit_items_inline( F &func )
+{
+    monster *mon = static_cast<monster *>( this );
+
+    for( item * const &it : mon->get_items() ) {
+        if( visit_node( func, it ) == VisitResponse::ABORT ) {
+            return VisitResponse::ABORT;
+        }
+    }
+
+    if( mon->get_storage_item() &&
+        visit_node( func, mon->get_storage_item() ) == VisitResponse::ABORT ) {
+        return VisitResponse::ABORT;
+    }
+    if( mon->get_armor_item() &&
+        visit_node( func, mon->get_armor_item() ) == VisitResponse::ABORT ) {
+        return VisitResponse::ABORT;
+    }
+    if( mon->get_tack_item() &&
+        visit_node( func, mon->get_tack_item() ) == VisitResponse::ABORT ) {
+        return VisitResponse::ABORT;
+    }
+    if( mon->get_tied_item() &&
+        visit_node( func, mon->get_tied_item() ) == VisitResponse::ABORT ) {
+        return VisitResponse::ABORT;
+    }
+
+    return VisitResponse::NEXT;
+}
+
+/**
+ * Read only visit for the queries below, the visitor takes the node or the node and its parent.
+ * Unlike visit_items, the visitor is inlined instead of being called through std::function.
+ */
+template <typename T, typename F>
+static VisitResponse visit_inline( const visitable<T> &self, F &&func )
+{
+    auto adapter = [&func]( item * node, item * parent ) {
+        if constexpr( std::is_invocable_v<F &, item *, item *> ) {
+            return func( node, parent );
+        } else {
+            return func( node );
+        }
+    };
+    return const_cast<visitable<T> &>( self ).visit_items_inline( adapter );
+}
+
+/** @relates visitable */
+template <typename T>
+VisitResponse visitable<T>::visit_items( const std::function<VisitResponse( item *, item * )> &func )
+{
+    return visit_items_inline( func );
+}
+
 /** @relates visitable */
 template <typename T>
 item *visitable<T>::find_parent( const item &it )
 {
     item *res = nullptr;
-    if( visit_items( [&]( item * node, item * parent ) {
+    if( visit_inline( *this, [&]( item * node, item * parent ) {
     if( node == &it ) {
             res = parent;
             return VisitResponse::ABORT;
@@ -98,7 +318,7 @@ std::vector<const item *> visitable<T>::parents( const item &it ) const
 template <typename T>
 bool visitable<T>::has_item( const item &it ) const
 {
-    return visit_items( [&it]( const item * node ) {
+    return visit_inline( *this, [&it]( const item * node ) {
         return node == &it ? VisitResponse::ABORT : VisitResponse::NEXT;
     } ) == VisitResponse::ABORT;
 }
@@ -107,7 +327,7 @@ bool visitable<T>::has_item( const item &it ) const
 template <typename T>
 bool visitable<T>::has_item_with( const std::function<bool( const item & )> &filter ) const
 {
-    return visit_items( [&filter]( const item * node ) {
+    return visit_inline( *this, [&filter]( const item * node ) {
         return filter( *node ) ? VisitResponse::ABORT : VisitResponse::NEXT;
     } ) == VisitResponse::ABORT;
 }
@@ -116,7 +336,7 @@ bool visitable<T>::has_item_with( const std::function<bool( const item & )> &fil
 template <typename T>
 bool visitable<T>::has_item_directly( const item &it ) const
 {
-    return visit_items( [&it]( const item * node ) {
+    return visit_inline( *this, [&it]( const item * node ) {
         return node == &it ? VisitResponse::ABORT : VisitResponse::SKIP;
     } ) == VisitResponse::ABORT;
 }
@@ -125,7 +345,7 @@ bool visitable<T>::has_item_directly( const item &it ) const
 template <typename T>
 bool visitable<T>::has_item_with_directly( const std::function<bool( const item & )> &filter ) const
 {
-    return visit_items( [&filter]( const item * node ) {
+    return visit_inline( *this, [&filter]( const item * node ) {
         return filter( *node ) ? VisitResponse::ABORT : VisitResponse::SKIP;
     } ) == VisitResponse::ABORT;
 }
@@ -152,7 +372,7 @@ static int has_quality_internal( const T &self, const quality_id &qual, int leve
 {
     int qty = 0;
 
-    self.visit_items( [&qual, level, &limit, &qty]( const item * e ) {
+    visit_inline( self, [&qual, level, &limit, &qty]( const item * e ) {
         if( e->get_quality( qual ) >= level ) {
             qty = sum_no_wrap( qty, e->count() );
             if( qty >= limit ) {
@@ -280,7 +500,7 @@ template <typename T>
 static int max_quality_internal( const T &self, const quality_id &qual )
 {
     int res = INT_MIN;
-    self.visit_items( [&res, &qual]( const item * e ) {
+    visit_inline( self, [&res, &qual]( const item * e ) {
         res = std::max( res, e->get_quality( qual ) );
         return VisitResponse::NEXT;
     } );
@@ -361,7 +581,7 @@ std::vector<item *> visitable<T>::items_with( const std::function<bool( const it
 const
 {
     std::vector<item *> res;
-    visit_items( [&res, &filter]( const item * node, const item * ) {
+    visit_inline( *this, [&res, &filter]( const item * node, const item * ) {
         if( filter( *node ) ) {
             res.push_back( const_cast<item *>( node ) );
         }
@@ -376,8 +596,7 @@ VisitResponse
 visitable<T>::visit_items( const std::function<VisitResponse( const item *,
                            const item * )> &func ) const
 {
-    return const_cast<visitable<T> *>( this )->visit_items(
-               static_cast<const std::function<VisitResponse( item *, item * )>&>( func ) );
+    return visit_inline( *this, func );
 }
 
 /** @relates visitable */
@@ -385,18 +604,14 @@ template <typename T>
 VisitResponse visitable<T>::visit_items( const std::function<VisitResponse( const item * )> &func )
 const
 {
-    return visit_items( [&func]( const item * it, const item * ) {
-        return func( it );
-    } );
+    return visit_inline( *this, func );
 }
 
 /** @relates visitable */
 template <typename T>
 VisitResponse visitable<T>::visit_items( const std::function<VisitResponse( item * )> &func )
 {
-    return visit_items( [&func]( item * it, item * ) {
-        return func( it );
-    } );
+    return visit_inline( *this, func );
 }
 
 
@@ -425,199 +640,6 @@ static VisitResponse visit_internal( std::function < VisitResponse( detached_ptr
     return last == VisitResponse::ABORT ? VisitResponse::ABORT : VisitResponse::NEXT;
 }
 
-// Specialize visitable<T>::visit_items() for each class that will implement the visitable interface
-
-static VisitResponse visit_internal( const std::function<VisitResponse( item *, item * )> &func,
-                                     item *node, item *parent = nullptr )
-{
-    switch( func( node, parent ) ) {
-        case VisitResponse::ABORT:
-            return VisitResponse::ABORT;
-
-        case VisitResponse::NEXT:
-            if( node->is_gun() || node->is_magazine() ) {
-                // Content of guns and magazines are accessible only via their specific accessors
-                return VisitResponse::NEXT;
-            }
-
-            if( node->contents.visit_contents( func, node ) == VisitResponse::ABORT ) {
-                return VisitResponse::ABORT;
-            }
-        /* intentional fallthrough */
-
-        case VisitResponse::SKIP:
-            return VisitResponse::NEXT;
-    }
-
-    /* never reached but suppresses GCC warning */
-    return VisitResponse::ABORT;
-}
-
-VisitResponse item_contents::visit_contents( const std::function<VisitResponse( item *, item * )>
-        &func, item *parent )
-{
-    for( item *&e : items ) {
-        switch( visit_internal( func, e, parent ) ) {
-            case VisitResponse::ABORT:
-                return VisitResponse::ABORT;
-            default:
-                break;
-        }
-    }
-    return VisitResponse::NEXT;
-}
-
-/** @relates visitable */
-template <>
-VisitResponse visitable<item>::visit_items(
-    const std::function<VisitResponse( item *, item * )> &func )
-{
-    auto it = static_cast<item *>( this );
-    return visit_internal( func, it );
-}
-
-/** @relates visitable */
-template <>
-VisitResponse visitable<inventory>::visit_items(
-    const std::function<VisitResponse( item *, item * )> &func )
-{
-    auto inv = static_cast<const inventory *>( this );
-    for( auto &stack : inv->items ) {
-        for( auto &it : stack ) {
-            if( visit_internal( func, it ) == VisitResponse::ABORT ) {
-                return VisitResponse::ABORT;
-            }
-        }
-    }
-    return VisitResponse::NEXT;
-}
-
-template <>
-VisitResponse visitable<location_inventory>::visit_items(
-    const std::function<VisitResponse( item *, item * )> &func )
-{
-    auto inv = static_cast<location_inventory *>( this );
-    return inv->inv.visit_items( func );
-}
-
-/** @relates visitable */
-template <>
-VisitResponse visitable<Character>::visit_items(
-    const std::function<VisitResponse( item *, item * )> &func )
-{
-    auto ch = static_cast<Character *>( this );
-
-    if( !ch->primary_weapon().is_null() &&
-        visit_internal( func, &ch->primary_weapon() ) == VisitResponse::ABORT ) {
-        return VisitResponse::ABORT;
-    }
-
-    for( auto &e : ch->worn ) {
-        if( visit_internal( func, e ) == VisitResponse::ABORT ) {
-            return VisitResponse::ABORT;
-        }
-    }
-
-    return ch->inv.visit_items( func );
-}
-
-/** @relates visitable */
-template <>
-VisitResponse visitable<map_cursor>::visit_items(
-    const std::function<VisitResponse( item *, item * )> &func )
-{
-    auto cur = static_cast<map_cursor *>( this );
-    map &here = get_map();
-    // skip inaccessible items
-    if( here.has_flag( "SEALED", *cur ) && !here.has_flag( "LIQUIDCONT", *cur ) ) {
-        return VisitResponse::NEXT;
-    }
-
-    for( item *&e : here.i_at( *cur ) ) {
-        if( visit_internal( func, e ) == VisitResponse::ABORT ) {
-            return VisitResponse::ABORT;
-        }
-    }
-    return VisitResponse::NEXT;
-}
-
-/** @relates visitable */
-template <>
-VisitResponse visitable<map_selector>::visit_items(
-    const std::function<VisitResponse( item *, item * )> &func )
-{
-    for( auto &cursor : static_cast<map_selector &>( *this ) ) {
-        if( cursor.visit_items( func ) == VisitResponse::ABORT ) {
-            return VisitResponse::ABORT;
-        }
-    }
-    return VisitResponse::NEXT;
-}
-
-/** @relates visitable */
-template <>
-VisitResponse visitable<vehicle_cursor>::visit_items(
-    const std::function<VisitResponse( item *, item * )> &func )
-{
-    auto self = static_cast<vehicle_cursor *>( this );
-
-    int idx = self->veh.part_with_feature( self->part, "CARGO", true );
-    if( idx >= 0 ) {
-        for( auto *&e : self->veh.get_items( idx ) ) {
-            if( visit_internal( func, e ) == VisitResponse::ABORT ) {
-                return VisitResponse::ABORT;
-            }
-        }
-    }
-    return VisitResponse::NEXT;
-}
-
-/** @relates visitable */
-template <>
-VisitResponse visitable<vehicle_selector>::visit_items(
-    const std::function<VisitResponse( item *, item * )> &func )
-{
-    for( auto &cursor : static_cast<vehicle_selector &>( *this ) ) {
-        if( cursor.visit_items( func ) == VisitResponse::ABORT ) {
-            return VisitResponse::ABORT;
-        }
-    }
-    return VisitResponse::NEXT;
-}
-
-/** @relates visitable */
-template <>
-VisitResponse visitable<monster>::visit_items(
-    const std::function<VisitResponse( item *, item * )> &func )
-{
-    monster *mon = static_cast<monster *>( this );
-
-    for( item * const &it : mon->get_items() ) {
-        if( visit_internal( func, it ) == VisitResponse::ABORT ) {
-            return VisitResponse::ABORT;
-        }
-    }
-
-    if( mon->get_storage_item() &&
-        visit_internal( func, mon->get_storage_item() ) == VisitResponse::ABORT ) {
-        return VisitResponse::ABORT;
-    }
-    if( mon->get_armor_item() &&
-        visit_internal( func, mon->get_armor_item() ) == VisitResponse::ABORT ) {
-        return VisitResponse::ABORT;
-    }
-    if( mon->get_tack_item() &&
-        visit_internal( func, mon->get_tack_item() ) == VisitResponse::ABORT ) {
-        return VisitResponse::ABORT;
-    }
-    if( mon->get_tied_item() &&
-        visit_internal( func, mon->get_tied_item() ) == VisitResponse::ABORT ) {
-        return VisitResponse::ABORT;
-    }
-
-    return VisitResponse::NEXT;
-}
-
 // Specialize visitable<T>::remove_items_with() for each class that will implement the visitable interface
 
 /** @relates visitable */
@@ -958,7 +980,7 @@ static int charges_of_internal( const T &self, const M &main, const itype_id &id
     int qty = 0;
 
     bool found_tool_with_UPS = false;
-    self.visit_items( [&]( const item * e ) {
+    visit_inline( self, [&]( const item * e ) {
         if( filter( *e ) ) {
             if( e->is_tool() ) {
                 if( e->typeId() == id ) {
@@ -1105,7 +1127,7 @@ static int amount_of_internal( const T &self, const itype_id &id, bool pseudo, i
                                const std::function<bool( const item & )> &filter )
 {
     int qty = 0;
-    self.visit_items( [&qty, &id, &pseudo, &limit, &filter]( const item * e ) {
+    visit_inline( self, [&qty, &id, &pseudo, &limit, &filter]( const item * e ) {
         if( ( id.str() == "any" || e->typeId() == id ) && filter( *e ) && ( pseudo ||
                 !e->has_flag( STATIC( flag_id( "PSEUDO" ) ) ) ) ) {
             qty = sum_no_wrap( qty, 1 );
@@ -1183,7 +1205,7 @@ int visitable<Character>::amount_of( const itype_id &what, bool pseudo, int limi
 
     if( what == itype_apparatus && pseudo ) {
         int qty = 0;
-        visit_items( [&qty, &limit, &filter]( const item * e ) {
+        visit_inline( *this, [&qty, &limit, &filter]( const item * e ) {
             if( e->get_quality( quality_id( "SMOKE_PIPE" ) ) >= 1 && filter( *e ) ) {
                 qty = sum_no_wrap( qty, 1 );
             }
@@ -45,6 +45,15 @@ class visitable
         VisitResponse visit_items( const std::function<VisitResponse( item * )> &func );
         VisitResponse visit_items( const std::function<VisitResponse( const item * )> &func ) const;
 
+        /**
+         * Same traversal as visit_items, but with the visitor as a template parameter so that
+         * calls to it can be inlined.  Only defined in visitable.cpp, where the queries below
+         * are built on it.
+         * @param func visitor taking the node and its parent
+         */
+        template <typename F>
+        VisitResponse visit_items_inline( F &func );
+
         /**
          * Determine the immediate parent container (if any) for an item.
          * @param it item to search for which must be contained (at any depth) by this object
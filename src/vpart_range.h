@@ -2,12 +2,14 @@
 #ifndef CATA_SRC_VPART_RANGE_H
 #define CATA_SRC_VPART_RANGE_H
 
+#include <algorithm>
 #include <cassert>
 #include <functional>
 #include <cstddef>
 #include <iterator>
 #include <optional>
 #include <utility>
+#include <vector>
 
 #include "vpart_position.h"
 #include "vehicle.h"
@@ -32,9 +34,10 @@ class vehicle_part_iterator
             return range_.get();
         }
         void skip_to_next_valid( size_t i ) {
+            i = range().next_candidate( i );
             while( i < range().part_count() &&
                    !range().matches( i ) ) {
-                ++i;
+                i = range().next_candidate( i + 1 );
             }
             if( i < range().part_count() ) {
                 vp_.emplace( range().vehicle(), i );
@@ -139,6 +142,11 @@ class generic_vehicle_part_range
         ::vehicle &vehicle() const {
             return vehicle_.get();
         }
+
+        /** First part at or after @p part that may match, ranges with an index skip the rest. */
+        size_t next_candidate( size_t part ) const {
+            return part;
+        }
 };
 
 /** A range that contains all parts of the vehicle. */
@@ -160,13 +168,30 @@ class vehicle_part_with_feature_range : public
     private:
         feature_type feature_;
         part_status_flag required_;
+        // Parts with the feature from vehicle::refresh, only parts after the indexed ones
+        // are checked one by one.
+        const std::vector<int> *candidates_ = nullptr;
+        size_t indexed_ = 0;
+
+        void find_candidates();
 
     public:
         vehicle_part_with_feature_range( ::vehicle &v, feature_type f, part_status_flag r ) :
             generic_vehicle_part_range<vehicle_part_with_feature_range<feature_type>>( v ),
-                    feature_( std::move( f ) ), required_( r ) { }
+                    feature_( std::move( f ) ), required_( r ) {
+            find_candidates();
+        }
 
         bool matches( size_t part ) const;
+
+        size_t next_candidate( size_t part ) const {
+            if( candidates_ == nullptr || part >= indexed_ ) {
+                return part;
+            }
+            const auto next = std::lower_bound( candidates_->begin(), candidates_->end(),
+                                                static_cast<int>( part ) );
+            return next == candidates_->end() ? indexed_ : static_cast<size_t>( *next );
+        }
 };
 
 #endif // CATA_SRC_VPART_RANGE_H
@@ -148,13 +148,24 @@ inline void proc_weather_sum( const weather_type_id wtype, weather_sum &data,
 const weather_type_id &current_weather( const tripoint &location, const time_point &t )
 {
     const weather_manager &weather = get_weather();
-    const auto wgen = weather.get_cur_weather_gen();
+    const weather_generator &wgen = weather.get_cur_weather_gen();
     if( weather.weather_override ) {
         return weather.weather_override;
     }
     return wgen.get_weather_conditions( location, t, g->get_seed() );
 }
 
+// Coarser steps for the far past, the sum doesn't need to be exact there
+static time_duration sum_tick_size( const time_duration &remaining )
+{
+    if( remaining < 10_turns ) {
+        return 1_turns;
+    } else if( remaining > 7_days ) {
+        return 1_hours;
+    }
+    return 1_minutes;
+}
+
 weather_sum sum_conditions( const time_point &start, const time_point &end,
                             const tripoint &location )
 {
@@ -162,14 +173,7 @@ weather_sum sum_conditions( const time_point &start, const time_point &end,
     weather_sum data;
 
     for( time_point t = start; t < end; t += tick_size ) {
-        const time_duration diff = end - t;
-        if( diff < 10_turns ) {
-            tick_size = 1_turns;
-        } else if( diff > 7_days ) {
-            tick_size = 1_hours;
-        } else {
-            tick_size = 1_minutes;
-        }
+        tick_size = sum_tick_size( end - t );
 
         weather_type_id wtype = current_weather( location, t );
         proc_weather_sum( wtype, data, t, tick_size );
@@ -183,6 +187,17 @@ weather_sum sum_conditions( const time_point &start, const time_point &end,
     return data;
 }
 
+float sum_sunlight( const time_point &start, const time_point &end, const tripoint &location )
+{
+    time_duration tick_size = 0_turns;
+    float sunlight = 0.0f;
+    for( time_point t = start; t < end; t += tick_size ) {
+        tick_size = sum_tick_size( end - t );
+        sunlight += incident_sunlight( current_weather( location, t ), t ) * to_turns<int>( tick_size );
+    }
+    return sunlight;
+}
+
 /**
  * Determine what a funnel has filled out of game, using funnelcontainer.bday as a starting point.
  */
@@ -1078,6 +1093,7 @@ void weather_manager::update_weather()
 
     sfx::do_ambient();
     temperature = w.temperature;
+    clear_temp_cache();
     lightning_active = false;
     // Check weather every few turns, instead of every turn.
     // TODO: predict when the weather changes and use that time.
@@ -1132,7 +1148,10 @@ auto weather_manager::get_temperature( const tripoint &location ) const -> units
                            location.z < 0 ? temperatures::annual_average : temperature );
 
     // Hack: adding temperatures between temperatures makes no sense
-    return units::from_celsius( std::round( units::fahrenheit_to_celsius( base_f + added_f ) ) );
+    const units::temperature result = units::from_celsius( std::round( units::fahrenheit_to_celsius(
+                                          base_f + added_f ) ) );
+    temperature_cache.emplace( location, result );
+    return result;
 }
 
 auto weather_manager::get_temperature( const tripoint_abs_omt &location ) const ->
@@ -1155,6 +1174,7 @@ auto weather_manager::get_water_temperature( const tripoint & ) const -> units::
 void weather_manager::clear_temp_cache()
 {
     temperature_cache.clear();
+    heat_radiation_cache.clear();
 }
 
 namespace weather
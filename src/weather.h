@@ -123,6 +123,8 @@ double get_local_windpower( double windpower, const oter_id &omter, const tripoi
 weather_sum sum_conditions( const time_point &start,
                             const time_point &end,
                             const tripoint &location );
+/** Just the @ref weather_sum::sunlight of @ref sum_conditions, skips wind and rain. */
+float sum_sunlight( const time_point &start, const time_point &end, const tripoint &location );
 
 /**
  * @param it The container item which is to be filled.
@@ -205,6 +207,14 @@ class weather_manager
 
         /** temperature cache, cleared every turn, sparse map of map tripoints to temperatures */
         mutable std::unordered_map< tripoint, units::temperature > temperature_cache;
+        struct heat_radiation {
+            int temp_mod = 0;
+            int best_fire = 0;
+            // Seen from the avatar's eyes, which see around corners differently
+            bool avatar_there = false;
+        };
+        /** Results of @ref get_heat_radiation, cleared together with temperature_cache */
+        mutable std::unordered_map<tripoint, heat_radiation> heat_radiation_cache;
         // Returns outdoor or indoor temperature of given location (in local coords).
         auto get_temperature( const tripoint &location ) const -> units::temperature;
         // Returns outdoor or indoor temperature of given location
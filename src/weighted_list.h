@@ -5,6 +5,7 @@
 #include "json.h"
 #include "rng.h"
 
+#include <algorithm>
 #include <climits>
 #include <cstdlib>
 #include <functional>
@@ -42,6 +43,7 @@ template <typename W, typename T> struct weighted_list {
             if( weight >= 0 ) {
                 objects.emplace_back( obj, weight );
                 total_weight += weight;
+                cumulative_weights.push_back( total_weight );
                 invalidate_precalc();
                 return &( objects[objects.size() - 1].obj );
             }
@@ -63,6 +65,7 @@ template <typename W, typename T> struct weighted_list {
                     if( itr.obj == obj ) {
                         total_weight += ( weight - itr.weight );
                         itr.weight = weight;
+                        rebuild_cumulative_weights();
                         return &( itr.obj );
                     }
                 }
@@ -133,6 +136,7 @@ template <typename W, typename T> struct weighted_list {
         void clear() {
             total_weight = 0;
             objects.clear();
+            cumulative_weights.clear();
             invalidate_precalc();
         }
 
@@ -172,7 +176,9 @@ template <typename W, typename T> struct weighted_list {
             typename std::vector<weighted_object<W, T> >::iterator first,
             typename std::vector<weighted_object<W, T> >::iterator last ) {
             invalidate_precalc();
-            return objects.erase( first, last );
+            auto result = objects.erase( first, last );
+            rebuild_cumulative_weights();
+            return result;
         }
         size_t size() const noexcept {
             return objects.size();
@@ -202,6 +208,28 @@ template <typename W, typename T> struct weighted_list {
     protected:
         W total_weight;
         std::vector<weighted_object<W, T> > objects;
+        /** Sum of the weights up to and including each object, for binary search in pick_ent. */
+        std::vector<W> cumulative_weights;
+
+        void rebuild_cumulative_weights() {
+            cumulative_weights.clear();
+            W sum = 0;
+            for( const weighted_object<W, T> &o : objects ) {
+                sum += o.weight;
+                cumulative_weights.push_back( sum );
+            }
+        }
+
+        /**
+         * Index of the first object whose cumulative weight reaches picked, which is what
+         * walking the list and summing the weights would find.
+         */
+        size_t find_cumulative( const W &picked ) const {
+            const auto it = std::lower_bound( cumulative_weights.begin(), cumulative_weights.end(),
+                                              picked );
+            // Rounding in floating point sums could make picked exceed the last entry
+            return std::min<size_t>( it - cumulative_weights.begin(), objects.size() - 1 );
+        }
 
         virtual size_t pick_ent( unsigned int ) const = 0;
         virtual void invalidate_precalc() {}
@@ -232,14 +260,8 @@ template <typename T> struct weighted_int_list : public weighted_list<int, T> {
                 // if the precalc_array is populated, use it for O(1) lookup
                 i = precalc_array[picked - 1];
             } else {
-                // otherwise do O(N) search through items
-                int accumulated_weight = 0;
-                for( i = 0; i < this->objects.size(); i++ ) {
-                    accumulated_weight += this->objects[i].weight;
-                    if( accumulated_weight >= picked ) {
-                        break;
-                    }
-                }
+                // otherwise do O(log N) search through the running sums
+                i = this->find_cumulative( picked );
             }
             return i;
         }
@@ -253,21 +275,11 @@ template <typename T> struct weighted_int_list : public weighted_list<int, T> {
 
 template <typename T> struct weighted_float_list : public weighted_list<double, T> {
 
-        // TODO: precalc using alias method
-
     protected:
 
         size_t pick_ent( unsigned int randi ) const override {
             const double picked = static_cast<double>( randi ) / UINT_MAX * this->total_weight;
-            double accumulated_weight = 0;
-            size_t i;
-            for( i = 0; i < this->objects.size(); i++ ) {
-                accumulated_weight += this->objects[i].weight;
-                if( accumulated_weight >= picked ) {
-                    break;
-                }
-            }
-            return i;
+            return this->find_cumulative( picked );
         }
 
 };
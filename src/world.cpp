@@ -2,10 +2,22 @@
 
 #include <sstream>
 #include <cstring>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <utility>
 #include <sqlite3.h>
 #include <zlib.h>
 
+#if defined(_WIN32) && !defined(_MSC_VER)
+#   include "mingw.thread.h"
+#endif
+
 #include "game.h"
 #include "avatar.h"
 #include "debug.h"
@@ -14,13 +26,65 @@
 #include "output.h"
 #include "worldfactory.h"
 #include "mod_manager.h"
+#include "options.h"
 #include "path_info.h"
 #include "compress.h"
+#include "string_utils.h"
 
 #define dbg(x) DebugLogFL((x),DC::Main)
-static sqlite3 *open_db( const std::string &path )
+/**
+ * An open world database.  Prepared statements are kept for the lifetime of the connection,
+ * so reading or writing a file doesn't compile its query again.
+ * Statements are guarded by a mutex, since asynchronous saves write from another thread.
+ */
+class world_db
+{
+    public:
+        explicit world_db( const std::string &path );
+        world_db( const world_db & ) = delete;
+        world_db &operator=( const world_db & ) = delete;
+        ~world_db();
+
+        void exec( const char *sql );
+        bool file_exist( const std::string &path );
+        /** Returns false if the database didn't take the data. */
+        bool write( const std::string &path, const std::string &data );
+        /** Same, but compresses what @p writer outputs while it is being written. */
+        bool write( const std::string &path, file_write_fn writer );
+        /** Returns false if there is no such file, throws if that's an error. */
+        bool read( const std::string &path, std::string &data, bool optional );
+        /** Codec for blobs written from now on.  Blobs already stored keep theirs. */
+        void set_codec( compression_codec c ) {
+            codec = c;
+        }
+
+    private:
+        sqlite3_stmt *prepare( sqlite3_stmt *&stmt, const char *sql );
+        bool write_blob( const std::string &path, compression_codec blob_codec,
+                         const std::vector<std::byte> &compressedData );
+
+        sqlite3 *db = nullptr;
+        std::mutex mutex;
+        sqlite3_stmt *exist_stmt = nullptr;
+        sqlite3_stmt *write_stmt = nullptr;
+        sqlite3_stmt *read_stmt = nullptr;
+        std::atomic<compression_codec> codec{ compression_codec::zlib };
+};
+
+namespace
+{
+// Makes a cached statement reusable when leaving the scope, whatever happened to it
+struct statement_reset {
+    sqlite3_stmt *stmt;
+    ~statement_reset() {
+        sqlite3_reset( stmt );
+        sqlite3_clear_bindings( stmt );
+    }
+};
+} // namespace
+
+world_db::world_db( const std::string &path )
 {
-    sqlite3 *db = nullptr;
     int ret;
 
     ret = sqlite3_initialize();
@@ -29,9 +93,12 @@ static sqlite3 *open_db( const std::string &path )
         throw std::runtime_error( "Failed to initialize sqlite3" );
     }
 
-    ret = sqlite3_open_v2( path.c_str(), &db, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, NULL );
+    // Asynchronous saves write from a background thread while the game keeps reading
+    ret = sqlite3_open_v2( path.c_str(), &db,
+                           SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_FULLMUTEX, NULL );
     if( ret != SQLITE_OK ) {
         dbg( DL::Error ) << "Failed to open db" << path << " (Error " << ret << ")";
+        sqlite3_close( db );
         throw std::runtime_error( "Failed to open db" );
     }
 
@@ -48,10 +115,40 @@ static sqlite3 *open_db( const std::string &path )
     ret = sqlite3_exec( db, sql, NULL, NULL, &sqlErrMsg );
     if( ret != SQLITE_OK ) {
         dbg( DL::Error ) << "Failed to init db" << path << " (" << sqlErrMsg << ")";
+        sqlite3_free( sqlErrMsg );
+        sqlite3_close( db );
         throw std::runtime_error( "Failed to open db" );
     }
 
-    return db;
+    // With a write-ahead log, a save transaction syncs once at commit instead of
+    // rewriting the pages it touched through a rollback journal.  If the file system
+    // doesn't support it, sqlite keeps the old mode, which works just as well.
+    sqlite3_exec( db, "PRAGMA journal_mode=WAL", NULL, NULL, NULL );
+    sqlite3_exec( db, "PRAGMA synchronous=NORMAL", NULL, NULL, NULL );
+}
+
+world_db::~world_db()
+{
+    for( sqlite3_stmt *stmt : { exist_stmt, write_stmt, read_stmt } ) {
+        sqlite3_finalize( stmt );
+    }
+    sqlite3_close( db );
+}
+
+sqlite3_stmt *world_db::prepare( sqlite3_stmt *&stmt, const char *sql )
+{
+    if( stmt == nullptr && sqlite3_prepare_v2( db, sql, -1, &stmt, nullptr ) != SQLITE_OK ) {
+        dbg( DL::Error ) << "Failed to prepare statement: " << sqlite3_errmsg( db ) << '\n';
+        sqlite3_finalize( stmt );
+        stmt = nullptr;
+        throw std::runtime_error( "DB query failed" );
+    }
+    return stmt;
+}
+
+void world_db::exec( const char *sql )
+{
+    sqlite3_exec( db, sql, NULL, NULL, NULL );
 }
 
 save_t::save_t( const std::string &name ): name( name ) {}
@@ -217,8 +314,7 @@ bool WORLDINFO::save( const bool is_conversion ) const
     // choice of world save format.
     if( world_save_format == save_format::V2_COMPRESSED_SQLITE3 &&
         !file_exist( folder_path() + "/map.sqlite3" ) ) {
-        sqlite3 *db = open_db( folder_path() + "/map.sqlite3" );
-        sqlite3_close( db );
+        world_db db( folder_path() + "/map.sqlite3" );
     }
     return true;
 }
@@ -266,141 +362,359 @@ void load_external_option( const JsonObject &jo )
     }
 }
 
-static bool file_exist_in_db( sqlite3 *db, const std::string &path )
+bool world_db::file_exist( const std::string &path )
 {
-    int fileCount = 0;
-    const char *sql = "SELECT count() FROM files WHERE path = :path";
-    sqlite3_stmt *stmt = nullptr;
-
-    if( sqlite3_prepare_v2( db, sql, -1, &stmt, nullptr ) != SQLITE_OK ) {
-        dbg( DL::Error ) << "Failed to prepare statement: " << sqlite3_errmsg( db ) << '\n';
-        throw std::runtime_error( "DB query failed" );
-    }
+    std::lock_guard<std::mutex> lock( mutex );
+    sqlite3_stmt *stmt = prepare( exist_stmt, "SELECT count() FROM files WHERE path = :path" );
+    statement_reset reset{ stmt };
 
     if( sqlite3_bind_text( stmt, sqlite3_bind_parameter_index( stmt, ":path" ), path.c_str(), -1,
                            SQLITE_TRANSIENT ) != SQLITE_OK ) {
         dbg( DL::Error ) << "Failed to bind parameter: " << sqlite3_errmsg( db ) << '\n';
-        sqlite3_finalize( stmt );
         throw std::runtime_error( "DB query failed" );
     }
 
-    if( sqlite3_step( stmt ) == SQLITE_ROW ) {
-        // Retrieve the count result
-        fileCount = sqlite3_column_int( stmt, 0 );
-    } else {
+    if( sqlite3_step( stmt ) != SQLITE_ROW ) {
         dbg( DL::Error ) << "Failed to execute query: " << sqlite3_errmsg( db ) << '\n';
-        sqlite3_finalize( stmt );
         throw std::runtime_error( "DB query failed" );
     }
-
-    sqlite3_finalize( stmt );
-
-    return fileCount > 0;
+    // Retrieve the count result
+    return sqlite3_column_int( stmt, 0 ) > 0;
 }
 
-static void write_to_db( sqlite3 *db, const std::string &path, file_write_fn writer )
+bool world_db::write( const std::string &path, const std::string &data )
 {
-    std::ostringstream oss;
-    writer( oss );
-    auto data = oss.str();
+    const compression_codec blob_codec = codec;
+    std::vector<std::byte> compressedData;
+    compress_blob( blob_codec, data, compressedData );
+    return write_blob( path, blob_codec, compressedData );
+}
 
+bool world_db::write( const std::string &path, file_write_fn writer )
+{
+    const compression_codec blob_codec = codec;
     std::vector<std::byte> compressedData;
-    zlib_compress( data, compressedData );
+    compress_streambuf buf( blob_codec, compressedData );
+    std::ostream stream( &buf );
+    writer( stream );
+    buf.finish();
+    return write_blob( path, blob_codec, compressedData );
+}
 
+bool world_db::write_blob( const std::string &path, compression_codec blob_codec,
+                           const std::vector<std::byte> &compressedData )
+{
     size_t basePos = path.find_last_of( "/\\" );
     auto parent = ( basePos == std::string::npos ) ? "" : path.substr( 0, basePos );
 
     auto sql = R"sql(
         INSERT INTO files(path, parent, data, compression)
-        VALUES (:path, :parent, :data, 'zlib')
+        VALUES (:path, :parent, :data, :compression)
         ON CONFLICT(path) DO UPDATE
             SET data = excluded.data,
                 parent = excluded.parent,
                 compression = excluded.compression;
     )sql";
 
-    sqlite3_stmt *stmt = nullptr;
-
-    if( sqlite3_prepare_v2( db, sql, -1, &stmt, nullptr ) != SQLITE_OK ) {
-        dbg( DL::Error ) << "Failed to prepare statement: " << sqlite3_errmsg( db ) << '\n';
-        throw std::runtime_error( "DB query failed" );
-    }
+    std::lock_guard<std::mutex> lock( mutex );
+    sqlite3_stmt *stmt = prepare( write_stmt, sql );
+    statement_reset reset{ stmt };
 
     if( sqlite3_bind_text( stmt, sqlite3_bind_parameter_index( stmt, ":path" ), path.c_str(), -1,
                            SQLITE_TRANSIENT ) != SQLITE_OK ||
         sqlite3_bind_text( stmt, sqlite3_bind_parameter_index( stmt, ":parent" ), parent.c_str(), -1,
                            SQLITE_TRANSIENT ) != SQLITE_OK ||
+        // The blob outlives the statement's use of it, so sqlite doesn't need its own copy
         sqlite3_bind_blob( stmt, sqlite3_bind_parameter_index( stmt, ":data" ), compressedData.data(),
-                           compressedData.size(), SQLITE_TRANSIENT ) != SQLITE_OK ) {
+                           compressedData.size(), SQLITE_STATIC ) != SQLITE_OK ||
+        sqlite3_bind_text( stmt, sqlite3_bind_parameter_index( stmt, ":compression" ),
+                           compression_codec_name( blob_codec ), -1, SQLITE_STATIC ) != SQLITE_OK ) {
         dbg( DL::Error ) << "Failed to bind parameters: " << sqlite3_errmsg( db ) << '\n';
-        sqlite3_finalize( stmt );
         throw std::runtime_error( "DB query failed" );
     }
 
     if( sqlite3_step( stmt ) != SQLITE_DONE ) {
         dbg( DL::Error ) << "Failed to execute query: " << sqlite3_errmsg( db ) << '\n';
+        return false;
     }
-    sqlite3_finalize( stmt );
+    return true;
 }
 
-static bool read_from_db( sqlite3 *db, const std::string &path, file_read_fn reader,
-                          bool optional )
+bool world_db::read( const std::string &path, std::string &data, bool optional )
 {
-    const char *sql = "SELECT data, compression FROM files WHERE path = :path LIMIT 1";
-
-    sqlite3_stmt *stmt = nullptr;
-
-    if( sqlite3_prepare_v2( db, sql, -1, &stmt, nullptr ) != SQLITE_OK ) {
-        dbg( DL::Error ) << "Failed to prepare statement: " << sqlite3_errmsg( db ) << '\n';
-        throw std::runtime_error( "DB query failed" );
-    }
+    std::vector<std::byte> blob;
+    std::string compression;
+    {
+        std::lock_guard<std::mutex> lock( mutex );
+        sqlite3_stmt *stmt = prepare( read_stmt,
+                                      "SELECT data, compression FROM files WHERE path = :path LIMIT 1" );
+        statement_reset reset{ stmt };
+
+        if( sqlite3_bind_text( stmt, sqlite3_bind_parameter_index( stmt, ":path" ), path.c_str(), -1,
+                               SQLITE_TRANSIENT ) != SQLITE_OK ) {
+            dbg( DL::Error ) << "Failed to bind parameter: " << sqlite3_errmsg( db ) << '\n';
+            throw std::runtime_error( "DB query failed" );
+        }
 
-    if( sqlite3_bind_text( stmt, sqlite3_bind_parameter_index( stmt, ":path" ), path.c_str(), -1,
-                           SQLITE_TRANSIENT ) != SQLITE_OK ) {
-        dbg( DL::Error ) << "Failed to bind parameter: " << sqlite3_errmsg( db ) << '\n';
-        sqlite3_finalize( stmt );
-        throw std::runtime_error( "DB query failed" );
-    }
+        if( sqlite3_step( stmt ) != SQLITE_ROW ) {
+            if( !optional ) {
+                dbg( DL::Error ) << "Failed to execute query: " << sqlite3_errmsg( db ) << '\n';
+                throw std::runtime_error( "DB query failed" );
+            }
+            return false;
+        }
 
-    if( sqlite3_step( stmt ) == SQLITE_ROW ) {
-        // Retrieve the count result
         const void *blobData = sqlite3_column_blob( stmt, 0 );
         int blobSize = sqlite3_column_bytes( stmt, 0 );
         auto compression_raw = sqlite3_column_text( stmt, 1 );
-        std::string compression = compression_raw ? reinterpret_cast<const char *>( compression_raw ) : "";
+        compression = compression_raw ? reinterpret_cast<const char *>( compression_raw ) : "";
 
         if( blobData == nullptr ) {
             return false; // Return an empty string if there's no data
         }
+        // Copied, so other threads can use the database while this one decompresses
+        const std::byte *bytes = static_cast<const std::byte *>( blobData );
+        blob.assign( bytes, bytes + blobSize );
+    }
 
-        std::string dataString;
-        if( compression.empty() ) {
-            dataString = std::string( static_cast<const char *>( blobData ), blobSize );
-        } else if( compression == "zlib" ) {
-            zlib_decompress( blobData, blobSize, dataString );
-        } else {
-            throw std::runtime_error( "Unknown compression format: " + compression );
+    const std::optional<compression_codec> blob_codec = compression_codec_from_name( compression );
+    if( !blob_codec ) {
+        throw std::runtime_error( "Unknown compression format: " + compression );
+    }
+    decompress_blob( *blob_codec, blob.data(), static_cast<int>( blob.size() ), data );
+    return true;
+}
+
+/**
+ * Background thread writing the database blobs of asynchronous saves, in the order
+ * they were queued.
+ */
+struct async_db_writer {
+    struct job {
+        world_db *db = nullptr;
+        std::string path;
+        // Null for statements without data (transaction control)
+        std::shared_ptr<const std::string> data;
+        const char *statement = nullptr;
+    };
+
+    std::mutex mutex;
+    std::condition_variable job_queued;
+    std::condition_variable queue_empty;
+    std::deque<job> jobs;
+    bool busy = false;
+    bool stopping = false;
+    // Latest data queued for a path, until it is written
+    std::map<std::pair<world_db *, std::string>, std::shared_ptr<const std::string>> pending;
+    // Files that could not be written, until the main thread tells the player
+    std::vector<std::string> failures;
+    // Last, so everything above is initialized before it starts
+    std::thread thread;
+
+    async_db_writer() : thread( &async_db_writer::run, this ) {}
+
+    ~async_db_writer() {
+        {
+            std::lock_guard<std::mutex> lock( mutex );
+            stopping = true;
         }
+        job_queued.notify_all();
+        // Queued jobs are still written before the thread exits
+        thread.join();
+    }
 
-        std::istringstream stream( dataString );
-        reader( stream );
-        sqlite3_finalize( stmt );
-    } else {
-        auto err = sqlite3_errmsg( db );
-        sqlite3_finalize( stmt );
+    void queue( job &&j ) {
+        {
+            std::lock_guard<std::mutex> lock( mutex );
+            if( j.data ) {
+                pending[ { j.db, j.path } ] = j.data;
+            }
+            jobs.push_back( std::move( j ) );
+        }
+        job_queued.notify_one();
+    }
 
-        if( !optional ) {
-            dbg( DL::Error ) << "Failed to execute query: " << err << '\n';
-            throw std::runtime_error( "DB query failed" );
+    std::shared_ptr<const std::string> find_pending( world_db *db, const std::string &path ) {
+        std::lock_guard<std::mutex> lock( mutex );
+        const auto iter = pending.find( { db, path } );
+        return iter == pending.end() ? nullptr : iter->second;
+    }
+
+    void wait_idle() {
+        std::unique_lock<std::mutex> lock( mutex );
+        queue_empty.wait( lock, [this] {
+            return jobs.empty() && !busy;
+        } );
+    }
+
+    std::vector<std::string> take_failures() {
+        std::lock_guard<std::mutex> lock( mutex );
+        return std::exchange( failures, {} );
+    }
+
+    void run() {
+        std::unique_lock<std::mutex> lock( mutex );
+        while( true ) {
+            job_queued.wait( lock, [this] {
+                return stopping || !jobs.empty();
+            } );
+            if( jobs.empty() ) {
+                return;
+            }
+            job j = std::move( jobs.front() );
+            jobs.pop_front();
+            busy = true;
+            lock.unlock();
+
+            std::string failure;
+            try {
+                if( j.data && !j.db->write( j.path, *j.data ) ) {
+                    failure = j.path;
+                } else if( !j.data ) {
+                    j.db->exec( j.statement );
+                }
+            } catch( const std::exception &err ) {
+                dbg( DL::Error ) << "Failed to write " << j.path << " in the background: " << err.what();
+                failure = j.path + ": " + err.what();
+            }
+
+            lock.lock();
+            busy = false;
+            if( !failure.empty() ) {
+                failures.push_back( std::move( failure ) );
+            }
+            if( j.data ) {
+                const auto iter = pending.find( { j.db, j.path } );
+                if( iter != pending.end() && iter->second == j.data ) {
+                    pending.erase( iter );
+                }
+            }
+            if( jobs.empty() ) {
+                queue_empty.notify_all();
+            }
         }
-        return false;
     }
+};
 
+/**
+ * Background thread reading and decompressing map quads ahead of the main thread while it
+ * parses the ones before them.
+ */
+struct map_prefetcher {
+    world_db *db;
+    std::vector<std::string> paths;
+
+    std::mutex mutex;
+    std::condition_variable quad_read;
+    // Paths the thread hasn't got to yet
+    std::set<std::string> waiting;
+    std::map<std::string, std::string> ready;
+    bool stopping = false;
+    // Last, so everything above is initialized before it starts
+    std::thread thread;
+
+    map_prefetcher( world_db *db, std::vector<std::string> &&quad_paths )
+        : db( db )
+        , paths( std::move( quad_paths ) )
+        , waiting( paths.begin(), paths.end() )
+        , thread( &map_prefetcher::run, this ) {}
+
+    ~map_prefetcher() {
+        {
+            std::lock_guard<std::mutex> lock( mutex );
+            stopping = true;
+            waiting.clear();
+        }
+        quad_read.notify_all();
+        thread.join();
+    }
+
+    /** Moves the data of @p path into @p data, false if the caller has to read it itself. */
+    bool take( const std::string &path, std::string &data ) {
+        std::unique_lock<std::mutex> lock( mutex );
+        quad_read.wait( lock, [&] {
+            return waiting.count( path ) == 0;
+        } );
+        const auto iter = ready.find( path );
+        if( iter == ready.end() ) {
+            return false;
+        }
+        data = std::move( iter->second );
+        ready.erase( iter );
+        return true;
+    }
+
+    /** Forgets @p path, its data is about to be overwritten. */
+    void drop( const std::string &path ) {
+        std::string unused;
+        take( path, unused );
+    }
+
+    void run() {
+        for( const std::string &path : paths ) {
+            std::string data;
+            bool found = false;
+            try {
+                found = db->read( path, data, true );
+            } catch( const std::exception & ) {
+                // The main thread reads it again and reports the error
+            }
+            {
+                std::lock_guard<std::mutex> lock( mutex );
+                if( stopping ) {
+                    return;
+                }
+                waiting.erase( path );
+                if( found ) {
+                    ready.emplace( path, std::move( data ) );
+                }
+            }
+            quad_read.notify_all();
+        }
+    }
+};
+
+void world::write_to_db( world_db *db, const std::string &path, file_write_fn writer ) const
+{
+    if( save_tx_async ) {
+        // Kept uncompressed, reads of files that are still queued are served from it
+        std::ostringstream oss;
+        writer( oss );
+        async_writer->queue( { db, path, std::make_shared<const std::string>( std::move( oss ).str() ),
+                               nullptr } );
+        return;
+    }
+    if( async_writer ) {
+        // Don't let older queued data overwrite this
+        async_writer->wait_idle();
+    }
+    if( prefetcher && prefetcher->db == db ) {
+        prefetcher->drop( path );
+    }
+    db->write( path, writer );
+}
+
+bool world::read_from_db( world_db *db, const std::string &path, file_read_fn reader,
+                          bool optional ) const
+{
+    std::string data;
+    const std::shared_ptr<const std::string> pending = async_writer ?
+            async_writer->find_pending( db, path ) : nullptr;
+    if( pending ) {
+        data = *pending;
+    } else if( prefetcher && prefetcher->db == db && prefetcher->take( path, data ) ) {
+        // Read and decompressed in the background already
+    } else if( !db->read( path, data, optional ) ) {
+        return false;
+    }
+    // Outside of the database lock, the reader may want to read more files
+    std::istringstream stream( data );
+    reader( stream );
     return true;
 }
 
-static bool read_from_db_json( sqlite3 *db, const std::string &path, file_read_json_fn reader,
-                               bool optional )
+bool world::read_from_db_json( world_db *db, const std::string &path, file_read_json_fn reader,
+                               bool optional ) const
 {
     return read_from_db( db, path, [&]( std::istream & fin ) {
         JsonIn jsin( fin, path );
@@ -408,6 +722,22 @@ static bool read_from_db_json( sqlite3 *db, const std::string &path, file_read_j
     }, optional );
 }
 
+bool world::file_exist_in_db( world_db *db, const std::string &path ) const
+{
+    return ( async_writer && async_writer->find_pending( db, path ) ) || db->file_exist( path );
+}
+
+void world::begin_save_tx( world_db *db ) const
+{
+    db->set_codec( get_option<std::string>( "SAVE_COMPRESSION" ) == "none" ?
+                   compression_codec::none : compression_codec::zlib );
+    if( save_tx_async ) {
+        async_writer->queue( { db, "", nullptr, "BEGIN TRANSACTION" } );
+    } else {
+        db->exec( "BEGIN TRANSACTION" );
+    }
+}
+
 world::world( WORLDINFO *info )
     : info( info )
     , save_tx_start_ts( 0 )
@@ -417,7 +747,7 @@ world::world( WORLDINFO *info )
     }
 
     if( info->world_save_format == save_format::V2_COMPRESSED_SQLITE3 ) {
-        map_db = open_db( info->folder_path() + "/map.sqlite3" );
+        map_db = std::make_unique<world_db>( info->folder_path() + "/map.sqlite3" );
     } else {
         if( !assure_dir_exist( "/maps" ) ) {
             dbg( DL::Error ) << "Unable to create or open world directory structure: " << info->folder_path();
@@ -427,34 +757,35 @@ world::world( WORLDINFO *info )
 
 world::~world()
 {
+    // Finish background reads and writes while the databases are still open
+    prefetcher.reset();
+    async_writer.reset();
+
     if( save_tx_start_ts != 0 ) {
         dbg( DL::Error ) << "Save transaction was not committed before world destruction";
     }
-
-    if( map_db ) {
-        sqlite3_close( map_db );
-    }
-
-    if( save_db ) {
-        sqlite3_close( save_db );
-    }
 }
 
-void world::start_save_tx()
+void world::start_save_tx( bool async )
 {
     if( save_tx_start_ts != 0 ) {
         throw std::runtime_error( "Attempted to start a save transaction while one was already in progress" );
     }
+    // Saves must not interleave
+    finish_async_writes();
     save_tx_start_ts = std::chrono::duration_cast< std::chrono::milliseconds >(
                            std::chrono::system_clock::now().time_since_epoch()
                        ).count();
 
-    if( map_db ) {
-        sqlite3_exec( map_db, "BEGIN TRANSACTION", NULL, NULL, NULL );
+    save_tx_async = async && map_db != nullptr;
+    if( save_tx_async && !async_writer ) {
+        async_writer = std::make_unique<async_db_writer>();
     }
 
-    if( save_db ) {
-        sqlite3_exec( save_db, "BEGIN TRANSACTION", NULL, NULL, NULL );
+    for( world_db *db : { map_db.get(), save_db.get() } ) {
+        if( db ) {
+            begin_save_tx( db );
+        }
     }
 }
 
@@ -464,13 +795,17 @@ int64_t world::commit_save_tx()
         throw std::runtime_error( "Attempted to commit a save transaction while none was in progress" );
     }
 
-    if( map_db ) {
-        sqlite3_exec( map_db, "COMMIT", NULL, NULL, NULL );
-    }
-
-    if( save_db ) {
-        sqlite3_exec( save_db, "COMMIT", NULL, NULL, NULL );
+    for( world_db *db : { map_db.get(), save_db.get() } ) {
+        if( !db ) {
+            continue;
+        }
+        if( save_tx_async ) {
+            async_writer->queue( { db, "", nullptr, "COMMIT" } );
+        } else {
+            db->exec( "COMMIT" );
+        }
     }
+    save_tx_async = false;
 
     int64_t now = std::chrono::duration_cast< std::chrono::milliseconds >(
                       std::chrono::system_clock::now().time_since_epoch()
@@ -480,6 +815,19 @@ int64_t world::commit_save_tx()
     return duration;
 }
 
+void world::finish_async_writes()
+{
+    if( !async_writer ) {
+        return;
+    }
+    async_writer->wait_idle();
+    const std::vector<std::string> failures = async_writer->take_failures();
+    if( !failures.empty() ) {
+        debugmsg( "Failed to save %d files of the game in the background, that save is "
+                  "incomplete:\n%s", static_cast<int>( failures.size() ), join( failures, "\n" ) );
+    }
+}
+
 /**
  * DOMAIN SPECIFIC: MAP
  */
@@ -502,7 +850,7 @@ bool world::read_map_quad( const tripoint &om_addr, file_read_json_fn reader ) c
 
     // V2 logic
     if( info->world_save_format == save_format::V2_COMPRESSED_SQLITE3 ) {
-        return read_from_db_json( map_db, quad_path, reader, true );
+        return read_from_db_json( map_db.get(), quad_path, reader, true );
     } else {
         if( !file_exist( quad_path ) ) {
             // Fix for old saves where the path was generated using std::stringstream, which
@@ -520,6 +868,42 @@ bool world::read_map_quad( const tripoint &om_addr, file_read_json_fn reader ) c
     }
 }
 
+void world::prefetch_map_quads( const std::vector<tripoint> &om_addrs )
+{
+    end_map_prefetch();
+    if( info->world_save_format != save_format::V2_COMPRESSED_SQLITE3 || om_addrs.empty() ) {
+        return;
+    }
+    // Queued data that is written while the thread reads would leave it with the old blobs
+    finish_async_writes();
+    std::vector<std::string> paths;
+    paths.reserve( om_addrs.size() );
+    for( const tripoint &om_addr : om_addrs ) {
+        paths.push_back( get_quad_dirname( om_addr ) + "/" + get_quad_filename( om_addr ) );
+    }
+    prefetcher = std::make_unique<map_prefetcher>( map_db.get(), std::move( paths ) );
+}
+
+void world::end_map_prefetch()
+{
+    prefetcher.reset();
+}
+
+void world::reopen_databases()
+{
+    if( save_tx_start_ts != 0 ) {
+        throw std::runtime_error( "Attempted to reopen the databases during a save transaction" );
+    }
+    prefetcher.reset();
+    async_writer.reset();
+    // The player database is opened again on first use
+    save_db.reset();
+    if( map_db ) {
+        map_db.reset();
+        map_db = std::make_unique<world_db>( info->folder_path() + "/map.sqlite3" );
+    }
+}
+
 bool world::write_map_quad( const tripoint &om_addr, file_write_fn writer ) const
 {
     const std::string dirname = get_quad_dirname( om_addr );
@@ -527,7 +911,7 @@ bool world::write_map_quad( const tripoint &om_addr, file_write_fn writer ) cons
 
     // V2 logic
     if( info->world_save_format == save_format::V2_COMPRESSED_SQLITE3 ) {
-        write_to_db( map_db, quad_path, writer );
+        write_to_db( map_db.get(), quad_path, writer );
         return true;
     } else {
         assure_dir_exist( dirname );
@@ -552,7 +936,7 @@ std::string world::overmap_player_filename( const point_abs_om &p ) const
 bool world::overmap_exists( const point_abs_om &p ) const
 {
     if( info->world_save_format == save_format::V2_COMPRESSED_SQLITE3 ) {
-        return file_exist_in_db( map_db, overmap_terrain_filename( p ) );
+        return file_exist_in_db( map_db.get(), overmap_terrain_filename( p ) );
     } else {
         return file_exist( overmap_terrain_filename( p ) );
     }
@@ -561,7 +945,7 @@ bool world::overmap_exists( const point_abs_om &p ) const
 bool world::read_overmap( const point_abs_om &p, file_read_fn reader ) const
 {
     if( info->world_save_format == save_format::V2_COMPRESSED_SQLITE3 ) {
-        return read_from_db( map_db, overmap_terrain_filename( p ), reader, true );
+        return read_from_db( map_db.get(), overmap_terrain_filename( p ), reader, true );
     } else {
         return read_from_file( overmap_terrain_filename( p ), reader, true );
     }
@@ -570,7 +954,7 @@ bool world::read_overmap( const point_abs_om &p, file_read_fn reader ) const
 bool world::read_overmap_player_visibility( const point_abs_om &p, file_read_fn reader )
 {
     if( info->world_save_format == save_format::V2_COMPRESSED_SQLITE3 ) {
-        sqlite3 *playerdb = get_player_db();
+        world_db *playerdb = get_player_db();
         return read_from_db( playerdb, overmap_player_filename( p ), reader, true );
     } else {
         return read_from_player_file( overmap_player_filename( p ), reader, true );
@@ -580,7 +964,7 @@ bool world::read_overmap_player_visibility( const point_abs_om &p, file_read_fn
 bool world::write_overmap( const point_abs_om &p, file_write_fn writer ) const
 {
     if( info->world_save_format == save_format::V2_COMPRESSED_SQLITE3 ) {
-        write_to_db( map_db, overmap_terrain_filename( p ), writer );
+        write_to_db( map_db.get(), overmap_terrain_filename( p ), writer );
         return true;
     } else {
         return write_to_file( overmap_terrain_filename( p ), writer );
@@ -590,7 +974,7 @@ bool world::write_overmap( const point_abs_om &p, file_write_fn writer ) const
 bool world::write_overmap_player_visibility( const point_abs_om &p, file_write_fn writer )
 {
     if( info->world_save_format == save_format::V2_COMPRESSED_SQLITE3 ) {
-        sqlite3 *playerdb = get_player_db();
+        world_db *playerdb = get_player_db();
         write_to_db( playerdb, overmap_player_filename( p ), writer );
         return true;
     } else {
@@ -609,7 +993,7 @@ static std::string get_mm_filename( const tripoint &p )
 bool world::read_player_mm_quad( const tripoint &p, file_read_json_fn reader )
 {
     if( info->world_save_format == save_format::V2_COMPRESSED_SQLITE3 ) {
-        sqlite3 *playerdb = get_player_db();
+        world_db *playerdb = get_player_db();
         return read_from_db_json( playerdb, get_mm_filename( p ), reader, true );
     } else {
         return read_from_player_file_json( ".mm1/" + get_mm_filename( p ), reader, true );
@@ -619,7 +1003,7 @@ bool world::read_player_mm_quad( const tripoint &p, file_read_json_fn reader )
 bool world::write_player_mm_quad( const tripoint &p, file_write_fn writer )
 {
     if( info->world_save_format == save_format::V2_COMPRESSED_SQLITE3 ) {
-        sqlite3 *playerdb = get_player_db();
+        world_db *playerdb = get_player_db();
         write_to_db( playerdb, get_mm_filename( p ), writer );
         return true;
     } else {
@@ -641,18 +1025,22 @@ std::string world::get_player_path() const
     return base64_encode( g->u.get_save_id() );
 }
 
-sqlite3 *world::get_player_db()
+world_db *world::get_player_db()
 {
     if( !save_db ) {
-        save_db = open_db( info->folder_path() + "/" + get_player_path() + ".sqlite3" );
+        save_db = std::make_unique<world_db>( info->folder_path() + "/" + get_player_path() + ".sqlite3" );
         last_save_id = g->u.get_save_id();
+        if( save_tx_start_ts != 0 ) {
+            // Opened in the middle of a save, its writes belong to the same transaction
+            begin_save_tx( save_db.get() );
+        }
     }
 
     if( last_save_id != g->u.get_save_id() ) {
         throw std::runtime_error( "Save ID changed without reloading the world object" );
     }
 
-    return save_db;
+    return save_db.get();
 }
 
 bool world::player_file_exist( const std::string &path )
@@ -729,10 +1117,10 @@ void world::convert_from_v1( const std::unique_ptr<WORLDINFO> &old_world )
     // The map database should already be loaded via the constructor.
     // The save database(s) will need to be created separately here.
     // Transactions are mostly being used for performance reasons rather than consistency.
-    sqlite3_exec( map_db, "BEGIN TRANSACTION", NULL, NULL, NULL );
+    map_db->exec( "BEGIN TRANSACTION" );
 
     // Keep track of the last used save DB
-    sqlite3 *last_save_db = nullptr;
+    std::unique_ptr<world_db> last_save_db;
     std::string last_save_id;
 
     // Begin copying files to the new world folder.
@@ -756,7 +1144,7 @@ void world::convert_from_v1( const std::unique_ptr<WORLDINFO> &old_world )
                     continue;
                 }
                 ::read_from_file( subpath, [&]( std::istream & fin ) {
-                    write_to_db( map_db, map_path, [&]( std::ostream & fout ) {
+                    write_to_db( map_db.get(), map_path, [&]( std::ostream & fout ) {
                         fout << fin.rdbuf();
                     } );
                 } );
@@ -767,7 +1155,7 @@ void world::convert_from_v1( const std::unique_ptr<WORLDINFO> &old_world )
         // Migrate o.* files into the map database
         if( part.starts_with( "o." ) ) {
             ::read_from_file( file_path, [&]( std::istream & fin ) {
-                write_to_db( map_db, part, [&]( std::ostream & fout ) {
+                write_to_db( map_db.get(), part, [&]( std::ostream & fout ) {
                     fout << fin.rdbuf();
                 } );
             } );
@@ -779,17 +1167,16 @@ void world::convert_from_v1( const std::unique_ptr<WORLDINFO> &old_world )
             auto save_id = part.substr( 0, part.find( '.' ) );
             if( save_id != last_save_id ) {
                 if( last_save_db ) {
-                    sqlite3_exec( last_save_db, "COMMIT", NULL, NULL, NULL );
-                    sqlite3_close( last_save_db );
+                    last_save_db->exec( "COMMIT" );
                 }
-                last_save_db = open_db( info->folder_path() + "/" + save_id + ".sqlite3" );
+                last_save_db = std::make_unique<world_db>( info->folder_path() + "/" + save_id + ".sqlite3" );
                 last_save_id = save_id;
-                sqlite3_exec( last_save_db, "BEGIN TRANSACTION", NULL, NULL, NULL );
+                last_save_db->exec( "BEGIN TRANSACTION" );
             }
 
             if( part.find( ".seen." ) != std::string::npos ) {
                 ::read_from_file( file_path, [&]( std::istream & fin ) {
-                    write_to_db( last_save_db, part.substr( save_id.size() ), [&]( std::ostream & fout ) {
+                    write_to_db( last_save_db.get(), part.substr( save_id.size() ), [&]( std::ostream & fout ) {
                         fout << fin.rdbuf();
                     } );
                 } );
@@ -803,7 +1190,7 @@ void world::convert_from_v1( const std::unique_ptr<WORLDINFO> &old_world )
                         continue;
                     }
                     ::read_from_file( subpath, [&]( std::istream & fin ) {
-                        write_to_db( last_save_db, map_path, [&]( std::ostream & fout ) {
+                        write_to_db( last_save_db.get(), map_path, [&]( std::ostream & fout ) {
                             fout << fin.rdbuf();
                         } );
                     } );
@@ -820,9 +1207,8 @@ void world::convert_from_v1( const std::unique_ptr<WORLDINFO> &old_world )
     }
 
     if( last_save_db ) {
-        sqlite3_exec( last_save_db, "COMMIT", NULL, NULL, NULL );
-        sqlite3_close( last_save_db );
+        last_save_db->exec( "COMMIT" );
     }
 
-    sqlite3_exec( map_db, "COMMIT", NULL, NULL, NULL );
+    map_db->exec( "COMMIT" );
 }
@@ -3,7 +3,10 @@
 #define CATA_SRC_WORLD_H
 
 #include <functional>
+#include <memory>
 #include <string>
+#include <vector>
+
 #include "json.h"
 #include "options.h"
 #include "type_id.h"
@@ -11,7 +14,9 @@
 #include "fstream_utils.h"
 
 class avatar;
-class sqlite3;
+class world_db;
+struct async_db_writer;
+struct map_prefetcher;
 
 class save_t
 {
@@ -103,9 +108,17 @@ class world
          * so we can print how long the save took.
          */
         /**@{*/
-        void start_save_tx();
+        /**
+         * When @param async is set, data written to the database during the save is only
+         * serialized on the calling thread; compressing and writing it happens in the
+         * background after @ref commit_save_tx returns.  Reads see the queued data,
+         * and the next save waits for the previous one to finish.
+         */
+        void start_save_tx( bool async = false );
         int64_t commit_save_tx();
         /**@}*/
+        /** Blocks until all data of asynchronous saves has been written. */
+        void finish_async_writes();
 
         /*
          * Targeted/domain-specific file operations. Different save formats may choose to
@@ -114,6 +127,20 @@ class world
          */
         bool read_map_quad( const tripoint &om_addr, file_read_json_fn reader ) const;
         bool write_map_quad( const tripoint &om_addr, file_write_fn writer ) const;
+        /**
+         * Starts reading and decompressing the map quads at @p om_addrs on a background
+         * thread, in that order, so @ref read_map_quad only has to parse them.  Does nothing
+         * for the loose file format, there is nothing to decompress.
+         */
+        void prefetch_map_quads( const std::vector<tripoint> &om_addrs );
+        /** Stops the background reads and drops quads that were read but never asked for. */
+        void end_map_prefetch();
+        /**
+         * Joins the background threads and opens new connections to the databases.
+         * Has to be called on both sides of a fork(): threads don't exist in the child and
+         * a sqlite connection must not be shared by two processes.
+         */
+        void reopen_databases();
 
         bool overmap_exists( const point_abs_om &p ) const;
         bool read_overmap( const point_abs_om &p, file_read_fn reader ) const;
@@ -175,11 +202,26 @@ class world
         std::string overmap_player_filename( const point_abs_om &p ) const;
         std::string get_player_path() const;
 
-        sqlite3 *map_db = nullptr;
+        std::unique_ptr<world_db> map_db;
 
-        sqlite3 *save_db = nullptr;
+        std::unique_ptr<world_db> save_db;
         std::string last_save_id = "";
-        sqlite3 *get_player_db();
+        world_db *get_player_db();
+
+        /** Database access that goes through the queue of an asynchronous save if needed. */
+        /**@{*/
+        void write_to_db( world_db *db, const std::string &path, file_write_fn writer ) const;
+        bool read_from_db( world_db *db, const std::string &path, file_read_fn reader,
+                           bool optional ) const;
+        bool read_from_db_json( world_db *db, const std::string &path, file_read_json_fn reader,
+                                bool optional ) const;
+        bool file_exist_in_db( world_db *db, const std::string &path ) const;
+        /**@}*/
+        void begin_save_tx( world_db *db ) const;
+        /** Set between start_save_tx and commit_save_tx of an asynchronous save. */
+        bool save_tx_async = false;
+        std::unique_ptr<async_db_writer> async_writer;
+        std::unique_ptr<map_prefetcher> prefetcher;
 };
 
 #endif // CATA_SRC_WORLD_H
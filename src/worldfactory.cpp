@@ -177,8 +177,15 @@ void worldfactory::init()
 
     // get the master files. These determine the validity of a world
     // worlds exist by having an option file
+    // Worlds are the save directory itself (legacy "save" world) and its direct subdirectories.
+    // Don't search deeper, that would walk every map file of every world.
+    std::vector<std::string> world_dirs = get_directories_with( qualifiers, PATH_INFO::savedir() );
+    for( const std::string &dir : get_subdirectories( PATH_INFO::savedir() ) ) {
+        const std::vector<std::string> found = get_directories_with( qualifiers, dir );
+        world_dirs.insert( world_dirs.end(), found.begin(), found.end() );
+    }
     // create worlds
-    for( const auto &world_dir : get_directories_with( qualifiers, PATH_INFO::savedir(), true ) ) {
+    for( const auto &world_dir : world_dirs ) {
         // get the save files
         auto world_sav_files = get_files_from_path( SAVE_EXTENSION, world_dir, false );
         // split the save file names between the directory and the extension
@@ -1,8 +1,11 @@
 #include "catch/catch.hpp"
 
+#include <map>
 #include <memory>
 #include <set>
+#include <vector>
 
+#include "active_item_cache.h"
 #include "calendar.h"
 #include "game.h"
 #include "game_constants.h"
@@ -50,3 +53,46 @@ TEST_CASE( "place_active_item_at_various_coordinates", "[item]" )
         }
     }
 }
+
+TEST_CASE( "active_item_cache_processes_each_item_once_per_period", "[item]" )
+{
+    active_item_cache cache;
+    item &active = *item::spawn_temporary( "firecracker_act", calendar::start_of_cataclysm,
+                                           item::default_charges_tag() );
+    std::vector<item *> food;
+    for( int i = 0; i < 3; i++ ) {
+        food.push_back( item::spawn_temporary( "apple" ) );
+    }
+    REQUIRE( active.processing_speed() == 1 );
+    const int period = food.front()->processing_speed();
+    REQUIRE( period > 1 );
+    cache.add( active );
+    for( item *it : food ) {
+        cache.add( *it );
+    }
+    // Adding twice doesn't add a second reference
+    cache.add( *food.front() );
+    CHECK( cache.get().size() == 4 );
+
+    std::map<item *, int> processed;
+    for( int turn = 0; turn < period; turn++ ) {
+        for( item *it : cache.get_for_processing() ) {
+            processed[it]++;
+        }
+    }
+    CHECK( processed[&active] == period );
+    for( item *it : food ) {
+        CHECK( processed[it] == 1 );
+    }
+
+    cache.remove( food.front() );
+    processed.clear();
+    for( int turn = 0; turn < period; turn++ ) {
+        for( item *it : cache.get_for_processing() ) {
+            processed[it]++;
+        }
+    }
+    CHECK( processed.count( food.front() ) == 0 );
+    CHECK( processed[food.back()] == 1 );
+    CHECK( cache.get().size() == 3 );
+}
@@ -0,0 +1,43 @@
+#include "catch/catch.hpp"
+
+#include <string>
+#include <vector>
+
+#include "auto_pickup.h"
+#include "string_utils.h"
+#include "type_id.h"
+
+TEST_CASE( "compiled_rules_match_like_wildcards", "[auto_pickup]" )
+{
+    const std::vector<std::string> patterns = {
+        "rag", "*", "**", "rag*", "*rag", "*ag*", "r*g", "R*a*G", "*mre*beef*", "a*b*c",
+        "plastic bottle", "p**le", "*e"
+    };
+    const std::vector<std::string> names = {
+        "rag", "RAG", "rags", "dirty rag", "rg", "plastic bottle", "mre - beef", "abc", "acb",
+        "a", "*", ""
+    };
+    for( const std::string &pattern : patterns ) {
+        const auto_pickup::compiled_rule compiled( auto_pickup::rule( pattern, true, false ) );
+        for( const std::string &name : names ) {
+            CAPTURE( pattern, name );
+            CHECK( compiled.matches( auto_pickup::compiled_rule::prepare_name( name ), {} ) ==
+                   wildcard_match( name, pattern ) );
+        }
+    }
+}
+
+TEST_CASE( "compiled_rules_match_materials", "[auto_pickup]" )
+{
+    const material_id cotton( "cotton" );
+    const material_id steel( "steel" );
+    const auto_pickup::compiled_rule any( auto_pickup::rule( "m:cotton", true, false ) );
+    const auto_pickup::compiled_rule all( auto_pickup::rule( "M:cotton", true, true ) );
+    const std::string name = auto_pickup::compiled_rule::prepare_name( "thing" );
+
+    CHECK( any.matches( name, { cotton, steel } ) );
+    CHECK_FALSE( all.matches( name, { cotton, steel } ) );
+    CHECK( all.matches( name, { cotton } ) );
+    CHECK( all.state == RULE_BLACKLISTED );
+    CHECK_FALSE( any.matches( name, {} ) );
+}
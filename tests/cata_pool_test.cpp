@@ -0,0 +1,69 @@
+#include "catch/catch.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "cata_pool.h"
+
+namespace
+{
+
+struct pooled_test_object {
+    std::uint64_t a;
+    std::uint32_t b;
+};
+
+using test_pool = cata_pool<sizeof( pooled_test_object ), alignof( pooled_test_object )>;
+
+} // namespace
+
+TEST_CASE( "cata_pool_reuses_freed_slots", "[cata_pool]" )
+{
+    void *first = test_pool::allocate();
+    test_pool::deallocate( first );
+    CHECK( test_pool::allocate() == first );
+    test_pool::deallocate( first );
+}
+
+TEST_CASE( "cata_pool_hands_out_distinct_slots", "[cata_pool]" )
+{
+    // More than one block, so a new block has to be added on the way
+    std::vector<void *> slots;
+    std::set<void *> unique;
+    for( size_t i = 0; i < 3 * test_pool::slots_per_block; i++ ) {
+        void *p = test_pool::allocate();
+        CHECK( reinterpret_cast<std::uintptr_t>( p ) % alignof( pooled_test_object ) == 0 );
+        slots.push_back( p );
+        unique.insert( p );
+    }
+    CHECK( unique.size() == slots.size() );
+    for( void *p : slots ) {
+        test_pool::deallocate( p );
+    }
+    // The most recently freed slot comes back first
+    void *again = test_pool::allocate();
+    CHECK( again == slots.back() );
+    test_pool::deallocate( again );
+}
+
+TEST_CASE( "cata_pool_allocator_backs_node_containers", "[cata_pool]" )
+{
+    using pooled_map = std::map<int, pooled_test_object, std::less<int>,
+          cata_pool_allocator<std::pair<const int, pooled_test_object>>>;
+    pooled_map values;
+    for( int i = 0; i < 1000; i++ ) {
+        values[i] = pooled_test_object{ static_cast<std::uint64_t>( i ), 0 };
+    }
+    values.erase( values.find( 500 ) );
+    CHECK( values.size() == 999 );
+    CHECK( values.count( 500 ) == 0 );
+    CHECK( values.at( 999 ).a == 999 );
+    // Copies allocate from the pool too and are independent of the original
+    pooled_map copy = values;
+    copy.clear();
+    CHECK( values.size() == 999 );
+}
@@ -52,6 +52,21 @@ TEST_CASE( "replace_all", "[utility]" )
     }
 }
 
+TEST_CASE( "lcmatch", "[utility]" )
+{
+    CHECK( lcmatch( "Plastic Bottle", "bottle" ) );
+    CHECK( lcmatch( "plastic bottle", "BOTTLE" ) );
+    CHECK( lcmatch( "bottle", "" ) );
+    CHECK( lcmatch( "", "" ) );
+    CHECK_FALSE( lcmatch( "", "a" ) );
+    CHECK_FALSE( lcmatch( "bott", "bottle" ) );
+
+    const lcmatcher match( "Bot" );
+    CHECK( match( "glass bottle" ) );
+    CHECK( match( "ROBOT" ) );
+    CHECK_FALSE( match( "b o t" ) );
+}
+
 TEST_CASE( "replace_first", "[utility]" )
 {
     static const std::vector<repl_test_data> data = {{
@@ -16,6 +16,8 @@ TEST_CASE( "utf8_width", "[catacharset][i18n]" )
     CHECK( utf8_width( "Hello, 世界!", false ) == 12 );
     CHECK( utf8_width( "<color_green>激活</color>", true ) == 4 );
     CHECK( utf8_width( "<color_green>激活</color>", false ) == 25 );
+    CHECK( utf8_width( "a<color_red>b</color>c<color_blue>ä</color>", true ) == 4 );
+    CHECK( utf8_width( "tab\there", false ) == utf8_width( "tabhere", false ) - 1 );
     CHECK( utf8_width( "à", false ) == 1 );
     CHECK( utf8_width( "y\u0300", false ) == 1 );
     CHECK( utf8_width( "à̸̠你⃫", false ) == 3 );
@@ -0,0 +1,48 @@
+#include "catch/catch.hpp"
+
+#include <vector>
+
+#include "cellular_automata.h"
+#include "point.h"
+#include "rng.h"
+
+// The straightforward version, with the same order of rolls
+static std::vector<std::vector<int>> reference_automaton( point size, int alive, int iterations,
+                                  int birth_limit, int stasis_limit )
+{
+    std::vector<std::vector<int>> current( size.x, std::vector<int>( size.y, 0 ) );
+    std::vector<std::vector<int>> next( size.x, std::vector<int>( size.y, 0 ) );
+    for( int i = 0; i < size.x; i++ ) {
+        for( int j = 0; j < size.y; j++ ) {
+            current[i][j] = x_in_y( alive, 100 );
+        }
+    }
+    for( int iteration = 0; iteration < iterations; iteration++ ) {
+        for( int i = 0; i < size.x; i++ ) {
+            for( int j = 0; j < size.y; j++ ) {
+                if( i == 0 || i == size.x - 1 || j == 0 || j == size.y - 1 ) {
+                    next[i][j] = 0;
+                    continue;
+                }
+                const int neighbors = CellularAutomata::neighbor_count( current, size, point( i, j ) );
+                next[i][j] = neighbors > ( current[i][j] == 0 ? birth_limit : stasis_limit );
+            }
+        }
+        std::swap( current, next );
+    }
+    return current;
+}
+
+TEST_CASE( "cellular_automaton_matches_reference", "[cellular_automata]" )
+{
+    const point size = GENERATE( point( 24, 24 ), point( 17, 40 ), point( 2, 5 ), point( 3, 3 ) );
+    const int iterations = GENERATE( 0, 1, 5 );
+    CAPTURE( size, iterations );
+
+    rng_set_engine_seed( 1234 );
+    const std::vector<std::vector<int>> expected = reference_automaton( size, 55, iterations, 4, 3 );
+    rng_set_engine_seed( 1234 );
+    const std::vector<std::vector<int>> actual = CellularAutomata::generate_cellular_automaton(
+                size, 55, iterations, 4, 3 );
+    CHECK( actual == expected );
+}
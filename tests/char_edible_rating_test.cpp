@@ -2,7 +2,7 @@
 
 #include <memory>
 #include <string>
-#include <vitamin.h>
+#include "vitamin.h"
 
 #include "avatar.h"
 #include "calendar.h"
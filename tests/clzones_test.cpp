@@ -0,0 +1,48 @@
+#include "catch/catch.hpp"
+
+#include <optional>
+#include <unordered_set>
+
+#include "clzones.h"
+#include "point.h"
+#include "type_id.h"
+
+static const zone_type_id zone_LOOT_FOOD( "LOOT_FOOD" );
+static const zone_type_id zone_LOOT_WOOD( "LOOT_WOOD" );
+
+TEST_CASE( "zone_range_queries", "[zone]" )
+{
+    zone_manager::reset_manager();
+    zone_manager &zmgr = zone_manager::get_manager();
+    const tripoint origin( 1000, 1000, 0 );
+    zmgr.add( "food", zone_LOOT_FOOD, your_fac, false, true,
+              origin + point( 5, 5 ), origin + point( 7, 6 ) );
+    // Overlaps the first one on two points
+    zmgr.add( "more food", zone_LOOT_FOOD, your_fac, false, true,
+              origin + point( 7, 6 ), origin + point( 8, 6 ) );
+    zmgr.add( "wood", zone_LOOT_WOOD, your_fac, false, false,
+              origin, origin + point( 2, 2 ) );
+
+    CHECK( zmgr.has( zone_LOOT_FOOD, origin + point( 8, 6 ) ) );
+    CHECK_FALSE( zmgr.has( zone_LOOT_FOOD, origin + point( 8, 5 ) ) );
+
+    CHECK( zmgr.has_near( zone_LOOT_FOOD, origin, 5 ) );
+    CHECK_FALSE( zmgr.has_near( zone_LOOT_FOOD, origin, 4 ) );
+    CHECK_FALSE( zmgr.has_near( zone_LOOT_FOOD, origin + tripoint_above, 10 ) );
+    // Disabled zones are not indexed
+    CHECK_FALSE( zmgr.has_near( zone_LOOT_WOOD, origin, 10 ) );
+
+    const std::unordered_set<tripoint> all = zmgr.get_near( zone_LOOT_FOOD, origin + point( 6, 6 ),
+            10 );
+    CHECK( all.size() == 7 );
+    const std::unordered_set<tripoint> part = zmgr.get_near( zone_LOOT_FOOD, origin + point( 9, 6 ),
+            1 );
+    CHECK( part == std::unordered_set<tripoint> { origin + point( 8, 6 ) } );
+
+    const std::optional<tripoint> nearest = zmgr.get_nearest( zone_LOOT_FOOD, origin + point( 10, 6 ),
+                                            3 );
+    CHECK( nearest == origin + point( 8, 6 ) );
+    CHECK_FALSE( zmgr.get_nearest( zone_LOOT_FOOD, origin + point( 10, 6 ), 1 ) );
+
+    zone_manager::reset_manager();
+}
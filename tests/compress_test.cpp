@@ -0,0 +1,57 @@
+#include "catch/catch.hpp"
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "compress.h"
+
+TEST_CASE( "compression_codecs_round_trip", "[compress]" )
+{
+    // Compresses far better than the initial 8x guess of the zlib decompressor
+    const std::string input = std::string( 100000, 'a' ) + "{\"terrain\":[\"t_grass\"]}";
+    for( compression_codec codec : { compression_codec::none, compression_codec::zlib } ) {
+        CAPTURE( compression_codec_name( codec ) );
+        CHECK( compression_codec_from_name( compression_codec_name( codec ) ) == codec );
+
+        std::vector<std::byte> compressed;
+        compress_blob( codec, input, compressed );
+        std::string output;
+        decompress_blob( codec, compressed.data(), compressed.size(), output );
+        CHECK( output == input );
+    }
+    CHECK( !compression_codec_from_name( "lzma" ) );
+}
+
+TEST_CASE( "zlib_decompress_rejects_truncated_blobs", "[compress]" )
+{
+    std::vector<std::byte> compressed;
+    zlib_compress( std::string( 1000, 'x' ), compressed );
+    compressed.resize( compressed.size() / 2 );
+    std::string output;
+    CHECK_THROWS( zlib_decompress( compressed.data(), compressed.size(), output ) );
+}
+
+TEST_CASE( "compress_streambuf_matches_blob_compression", "[compress]" )
+{
+    // Written in small pieces and spanning several chunks of the stream buffer
+    std::string input;
+    for( int i = 0; i < 20000; i++ ) {
+        input += "{\"id\":" + std::to_string( i ) + "}";
+    }
+    for( compression_codec codec : { compression_codec::none, compression_codec::zlib } ) {
+        CAPTURE( compression_codec_name( codec ) );
+        std::vector<std::byte> compressed;
+        compress_streambuf buf( codec, compressed );
+        std::ostream stream( &buf );
+        for( size_t i = 0; i < input.size(); i += 7 ) {
+            stream << input.substr( i, 7 );
+        }
+        buf.finish();
+        CHECK( stream.good() );
+
+        std::string output;
+        decompress_blob( codec, compressed.data(), compressed.size(), output );
+        CHECK( output == input );
+    }
+}
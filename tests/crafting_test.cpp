@@ -35,6 +35,7 @@
 #include "requirements.h"
 #include "state_helpers.h"
 #include "string_id.h"
+#include "string_utils.h"
 #include "type_id.h"
 #include "value_ptr.h"
 
@@ -128,6 +129,47 @@ TEST_CASE( "recipe_subset" )
     }
 }
 
+TEST_CASE( "recipe_subset_search_matches_substrings", "[recipes]" )
+{
+    clear_all_state();
+    recipe_subset subset;
+    for( const auto &e : recipe_dict ) {
+        if( !e.second.obsolete ) {
+            subset.include( &e.second );
+        }
+    }
+
+    for( const std::string query : {
+             "", "ru", "rum", "Wash", "ed ste", "nonexistent recipe"
+         } ) {
+        CAPTURE( query );
+        std::set<const recipe *> expected;
+        for( const recipe *r : subset ) {
+            if( lcmatch( r->result_name(), query ) ) {
+                expected.insert( r );
+            }
+        }
+        const std::vector<const recipe *> found = subset.search( query );
+        CHECK( std::set<const recipe *>( found.begin(), found.end() ) == expected );
+        CHECK( found.size() == expected.size() );
+    }
+
+    // Names starting with the query come first
+    const std::vector<const recipe *> found = subset.search( "rum" );
+    REQUIRE_FALSE( found.empty() );
+    bool seen_other = false;
+    for( const recipe *r : found ) {
+        const bool starts = to_lower_case( r->result_name() ).starts_with( "rum" );
+        CHECK_FALSE( ( starts && seen_other ) );
+        seen_other = seen_other || !starts;
+    }
+
+    const std::vector<const recipe *> with_molasses = subset.search( "molas",
+            recipe_subset::search_type::component );
+    CHECK( std::find( with_molasses.begin(), with_molasses.end(),
+                      &recipe_id( "brew_rum" ).obj() ) != with_molasses.end() );
+}
+
 TEST_CASE( "available_recipes", "[recipes]" )
 {
     clear_all_state();
@@ -606,6 +648,34 @@ TEST_CASE( "total crafting time with or without interruption", "[crafting][time]
     }
 }
 
+TEST_CASE( "crafting_inventory_follows_map_changes", "[crafting]" )
+{
+    clear_all_state();
+    avatar &u = get_avatar();
+    map &here = get_map();
+    const tripoint origin( 60, 60, 0 );
+    u.setpos( origin );
+    const itype_id rock( "rock" );
+    here.add_item( origin + point_east, item::spawn( rock ) );
+    REQUIRE( u.crafting_inventory().amount_of( rock ) == 1 );
+
+    // Each turn, nothing changed on the map
+    calendar::turn += 1_turns;
+    CHECK( u.crafting_inventory().amount_of( rock ) == 1 );
+
+    here.add_item( origin + point_west, item::spawn( rock ) );
+    calendar::turn += 1_turns;
+    CHECK( u.crafting_inventory().amount_of( rock ) == 2 );
+
+    here.i_clear( origin + point_east );
+    calendar::turn += 1_turns;
+    CHECK( u.crafting_inventory().amount_of( rock ) == 1 );
+
+    // Out of range after moving away
+    u.setpos( origin + point( PICKUP_RANGE + 3, 0 ) );
+    CHECK( u.crafting_inventory().amount_of( rock ) == 0 );
+}
+
 TEST_CASE( "debug hammerspace", "[crafting]" )
 {
     clear_all_state();
@@ -2,10 +2,14 @@
 
 #include <memory>
 
+#include "avatar.h"
+#include "calendar.h"
 #include "game.h"
+#include "map_iterator.h"
 #include "map.h"
 #include "map_helpers.h"
 #include "monster.h"
+#include "options_helpers.h"
 #include "point.h"
 #include "state_helpers.h"
 #include "type_id.h"
@@ -37,3 +41,50 @@ TEST_CASE( "creature_in_field", "[monster],[field]" )
         }
     }
 }
+
+TEST_CASE( "fields_far_from_the_player_catch_up_on_skipped_turns", "[field]" )
+{
+    clear_all_state();
+    map &here = get_map();
+    static const field_type_str_id fd_blood( "fd_blood" );
+    override_option lod_distance( "FIELD_LOD_DISTANCE", "4" );
+    override_option lod_interval( "FIELD_LOD_INTERVAL", "4" );
+    get_avatar().setpos( tripoint( 65, 65, 0 ) );
+    // Every submap counts as just loaded
+    calendar::turn += 1_days;
+    // The submap of the player and one at the edge of the bubble
+    const tripoint near( 66, 66, 0 );
+    const tripoint far( 2, 2, 0 );
+    here.add_field( near, fd_blood, 1, 0_turns );
+    here.add_field( far, fd_blood, 1, 0_turns );
+
+    for( int turn = 1; turn <= 9; turn++ ) {
+        calendar::turn += 1_turns;
+        here.process_fields();
+        CAPTURE( turn );
+        CHECK( here.get_field_age( near, fd_blood ) == time_duration::from_turns( turn ) );
+        // First processed when it's seen the first time, then every four turns
+        const int far_age = turn < 5 ? 1 : turn < 9 ? 5 : 9;
+        CHECK( here.get_field_age( far, fd_blood ) == time_duration::from_turns( far_age ) );
+    }
+}
+
+TEST_CASE( "process_fields_benchmark", "[.][field][benchmark]" )
+{
+    clear_all_state();
+    map &here = get_map();
+    const tripoint center( 60, 60, 0 );
+    static const field_type_str_id fd_smoke( "fd_smoke" );
+    static const field_type_str_id fd_fire( "fd_fire" );
+
+    BENCHMARK_ADVANCED( "smoke and fire" )( Catch::Benchmark::Chronometer meter ) {
+        // Fields spread and decay, so start every sample from the same state
+        clear_map();
+        for( const tripoint &p : here.points_in_radius( center, 10 ) ) {
+            here.add_field( p, ( p.x + p.y ) % 4 == 0 ? fd_fire : fd_smoke, 3 );
+        }
+        meter.measure( [&] {
+            here.process_fields();
+        } );
+    };
+}
@@ -0,0 +1,91 @@
+#include "catch/catch.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "creature_tracker.h"
+#include "memory_fast.h"
+#include "monster.h"
+#include "point.h"
+#include "type_id.h"
+
+static const mtype_id mon_zombie( "mon_zombie" );
+
+static bool contains( const std::vector<monster *> &found, const monster &critter )
+{
+    return std::find( found.begin(), found.end(), &critter ) != found.end();
+}
+
+TEST_CASE( "creature_tracker_range_queries", "[creature_tracker]" )
+{
+    Creature_tracker tracker;
+    const tripoint center( 60, 60, 0 );
+    shared_ptr_fast<monster> near = make_shared_fast<monster>( mon_zombie, center + point( 3, -2 ) );
+    shared_ptr_fast<monster> far = make_shared_fast<monster>( mon_zombie, center + point( 30, 0 ) );
+    shared_ptr_fast<monster> above = make_shared_fast<monster>( mon_zombie, center + tripoint_above );
+    REQUIRE( tracker.add( near ) );
+    REQUIRE( tracker.add( far ) );
+    REQUIRE( tracker.add( above ) );
+
+    std::vector<monster *> found = tracker.find_in_radius( center, 5 );
+    CHECK( found.size() == 2 );
+    CHECK( contains( found, *near ) );
+    CHECK( contains( found, *above ) );
+    CHECK( tracker.find_in_radius( center, 0 ).empty() );
+    CHECK( tracker.find_in_radius( center, 100 ).size() == 3 );
+
+    found = tracker.find_in_rectangle( center, center + tripoint( 40, 0, 0 ) );
+    CHECK( found.size() == 1 );
+    CHECK( contains( found, *far ) );
+
+    SECTION( "moving a monster moves it in the index" ) {
+        const tripoint dest = center + point( 40, 40 );
+        REQUIRE( tracker.update_pos( *near, dest ) );
+        near->spawn( dest );
+        CHECK_FALSE( contains( tracker.find_in_radius( center, 5 ), *near ) );
+        CHECK( contains( tracker.find_in_radius( dest, 1 ), *near ) );
+    }
+    SECTION( "swapped monsters are found at their new places" ) {
+        tracker.swap_positions( *near, *far );
+        CHECK( contains( tracker.find_in_radius( center, 5 ), *far ) );
+        CHECK_FALSE( contains( tracker.find_in_radius( center, 5 ), *near ) );
+    }
+    SECTION( "removed and dead monsters are not found" ) {
+        tracker.remove( *near );
+        above->set_hp( 0 );
+        CHECK( tracker.find_in_radius( center, 5 ).empty() );
+    }
+    SECTION( "rebuilding the cache keeps the index" ) {
+        tracker.rebuild_cache();
+        CHECK( tracker.find_in_radius( center, 5 ).size() == 2 );
+    }
+}
+
+TEST_CASE( "creature_tracker_removal_keeps_order", "[creature_tracker]" )
+{
+    Creature_tracker tracker;
+    std::vector<shared_ptr_fast<monster>> monsters;
+    for( int i = 0; i < 10; i++ ) {
+        monsters.push_back( make_shared_fast<monster>( mon_zombie, tripoint( 60 + i, 60, 0 ) ) );
+        REQUIRE( tracker.add( monsters.back() ) );
+    }
+
+    tracker.remove( *monsters[2] );
+    tracker.remove( *monsters[7] );
+    monsters[4]->set_hp( 0 );
+    CHECK( tracker.size() == 8 );
+    // Ids of the remaining monsters close the gaps
+    CHECK( tracker.temporary_id( *monsters[2] ) == -1 );
+    CHECK( tracker.temporary_id( *monsters[3] ) == 2 );
+    CHECK( tracker.from_temporary_id( 6 ) == monsters[8] );
+
+    tracker.remove_dead();
+    const std::vector<shared_ptr_fast<monster>> expected = {
+        monsters[0], monsters[1], monsters[3], monsters[5], monsters[6], monsters[8], monsters[9]
+    };
+    CHECK( tracker.get_monsters_list() == expected );
+    CHECK( tracker.size() == expected.size() );
+    CHECK( tracker.temporary_id( *monsters[9] ) == 6 );
+    CHECK( tracker.update_pos( *monsters[9], tripoint( 80, 80, 0 ) ) );
+}
@@ -7,6 +7,7 @@
 #include "cata_utility.h"
 #include "coordinate_conversions.h"
 #include "distribution_grid.h"
+#include "item.h"
 #include "map.h"
 #include "mapbuffer.h"
 #include "map_helpers.h"
@@ -22,8 +23,10 @@ static furn_str_id f_battery( "f_battery" );
 static furn_str_id f_cable_connector( "f_cable_connector" );
 static furn_str_id f_floor_lamp( "f_floor_lamp" );
 static furn_str_id f_floor_lamp_on( "f_floor_lamp_on" );
+static furn_str_id f_recharge_station( "f_recharge_station" );
 
 static itype_id itype_battery( "battery" );
+static itype_id itype_light_minus_battery_cell( "light_minus_battery_cell" );
 
 static inline void test_grid_veh( distribution_grid &grid, vehicle &veh, battery_tile &battery )
 {
@@ -187,6 +190,13 @@ struct grid_setup_watcher {
     tripoint_abs_ms watcher_pos;
 };
 
+struct grid_setup_charger {
+    distribution_grid &grid;
+    charger_tile &charger;
+    battery_tile &battery;
+    tripoint_abs_ms charger_pos;
+};
+
 template<typename T, typename S>
 static S set_up_grid_with_consumer( map &m, const furn_str_id &act_tile_id )
 {
@@ -373,6 +383,25 @@ TEST_CASE( "steady_consumer_in_bubble", "[grids]" )
     }
 }
 
+TEST_CASE( "grid_with_only_storage_is_not_updated", "[grids]" )
+{
+    clear_all_state();
+    calendar::turn = calendar::turn_zero;
+    put_player_underground();
+    map &m = get_map();
+
+    grid_setup setup = set_up_grid( m );
+    const tripoint_abs_ms battery_abs_pos( m.getabs( tripoint( 14, 10, 0 ) ) );
+    CHECK_FALSE( setup.grid.requires_updates() );
+
+    WHEN( "a consumer is added to the grid" ) {
+        m.furn_set( tripoint( 15, 10, 0 ), f_floor_lamp_on );
+        THEN( "the rebuilt grid is updated" ) {
+            CHECK( get_distribution_grid_tracker().grid_at( battery_abs_pos ).requires_updates() );
+        }
+    }
+}
+
 TEST_CASE( "charge_watcher_in_bubble", "[grids]" )
 {
     clear_all_state();
@@ -386,6 +415,28 @@ TEST_CASE( "charge_watcher_in_bubble", "[grids]" )
     }
 }
 
+TEST_CASE( "charger_catches_up_in_one_step", "[grids]" )
+{
+    clear_all_state();
+    calendar::turn = calendar::turn_zero;
+    put_player_underground();
+    map &m = get_map();
+
+    grid_setup_charger setup = set_up_grid_with_consumer<charger_tile, grid_setup_charger>
+                               ( m, f_recharge_station );
+    REQUIRE( setup.battery.mod_resource( setup.battery.max_stored ) == 0 );
+    detached_ptr<item> cell = item::spawn( itype_light_minus_battery_cell, calendar::turn );
+    cell->ammo_unset();
+    item &charging = *cell;
+    m.add_item( tripoint( 13, 10, 0 ), std::move( cell ) );
+    REQUIRE( charging.ammo_remaining() == 0 );
+
+    // A month at the charger's power would be far more than the cell holds
+    setup.grid.update( calendar::turn + 30_days );
+    CHECK( charging.ammo_remaining() == charging.ammo_capacity() );
+    CHECK( setup.grid.get_resource() == setup.battery.max_stored - charging.ammo_capacity() );
+}
+
 TEST_CASE( "grid_furn_transform_queue_in_bubble", "[grids]" )
 {
     clear_all_state();
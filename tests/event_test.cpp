@@ -58,3 +58,32 @@ TEST_CASE( "destroy_bus_before_subscriber", "[event]" )
                   character_id( 5 ), mtype_id( "zombie" ) ) );
     CHECK( sub.events.size() == 1 );
 }
+
+struct picky_subscriber : public test_subscriber {
+    bool wants( event_type type ) const override {
+        return type == event_type::game_start;
+    }
+};
+
+TEST_CASE( "bus_only_sends_wanted_events", "[event]" )
+{
+    event_bus bus;
+    test_subscriber all;
+    picky_subscriber picky;
+    bus.subscribe( &all );
+    bus.subscribe( &picky );
+
+    bus.send( cata::event::make<event_type::character_kills_monster>(
+                  character_id( 5 ), mtype_id( "zombie" ) ) );
+    CHECK( all.events.size() == 1 );
+    CHECK( picky.events.empty() );
+
+    bus.send<event_type::game_start>( character_id( 5 ) );
+    CHECK( all.events.size() == 2 );
+    REQUIRE( picky.events.size() == 1 );
+    CHECK( picky.events[0].type() == event_type::game_start );
+
+    bus.unsubscribe( &picky );
+    bus.send<event_type::game_start>( character_id( 5 ) );
+    CHECK( picky.events.size() == 1 );
+}
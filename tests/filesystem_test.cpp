@@ -141,6 +141,9 @@ static void filesystem_test_group( int serial, const std::string &s1, const std:
         std::sort( got.begin(), got.end(), comparator );
         CHECK( got == exp );
     }
+    // Only directories, and only the ones directly inside
+    CHECK( get_subdirectories( base ) == std::vector<std::string> { base + s1 } );
+    CHECK( get_subdirectories( dir1 ) == std::vector<std::string> { dir1 + s3 } );
 
     // Can't delete directory with files
     REQUIRE( !remove_directory( dir1 ) );
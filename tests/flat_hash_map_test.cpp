@@ -0,0 +1,37 @@
+#include "catch/catch.hpp"
+
+#include <string>
+
+#include "flat_hash_map.h"
+
+TEST_CASE( "flat_hash_map_insert_find_erase", "[flat_hash_map]" )
+{
+    flat_hash_map<int, std::string> map;
+    CHECK( map.find( 1 ) == nullptr );
+
+    for( int i = 0; i < 1000; ++i ) {
+        map[i * 7] = std::to_string( i );
+    }
+    CHECK( map.size() == 1000 );
+    for( int i = 0; i < 1000; ++i ) {
+        const std::string *value = map.find( i * 7 );
+        REQUIRE( value != nullptr );
+        CHECK( *value == std::to_string( i ) );
+        CHECK_FALSE( map.contains( i * 7 + 1 ) );
+    }
+
+    map[7] = "changed";
+    CHECK( map.size() == 1000 );
+    CHECK( *map.find( 7 ) == "changed" );
+
+    map.erase_if( []( int key, const std::string & ) {
+        return key % 2 == 0;
+    } );
+    CHECK( map.size() == 500 );
+    CHECK_FALSE( map.contains( 14 ) );
+    CHECK( map.contains( 21 ) );
+
+    map.clear();
+    CHECK( map.empty() );
+    CHECK( map.find( 21 ) == nullptr );
+}
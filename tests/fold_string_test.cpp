@@ -105,4 +105,13 @@ TEST_CASE( "fold-string" )
         };
         check_equal( folded.begin(), folded.end(), expected.begin(), expected.end() );
     }
+
+    SECTION( "Case 6 - folding the same text again" ) {
+        const std::string text = "Lorem ipsum dolor sit amet, consectetur adipiscing elit.";
+        const std::vector<std::string> first = foldstring( text, 17 );
+        CHECK( foldstring( text, 17 ) == first );
+        const std::vector<std::string> wide = foldstring( text, 30 );
+        CHECK( wide.size() < first.size() );
+        CHECK( foldstring( text, 17 ) == first );
+    }
 }
@@ -0,0 +1,100 @@
+#include "catch/catch.hpp"
+
+#include <numeric>
+#include <vector>
+
+#include "gas_diffusion.h"
+#include "point.h"
+
+static constexpr int layer_size = 12;
+
+static gas_diffusion::layer layer_with_cloud( std::uint16_t permeability )
+{
+    gas_diffusion::layer l( layer_size );
+    for( int y = 4; y < 8; y++ ) {
+        for( int x = 4; x < 8; x++ ) {
+            const int idx = x + y * layer_size;
+            l.intensity[idx] = 3;
+            l.age[idx] = 30;
+            l.permeability[idx] = permeability;
+        }
+    }
+    return l;
+}
+
+static int total( const std::vector<std::uint8_t> &intensities )
+{
+    return std::accumulate( intensities.begin(), intensities.end(), 0 );
+}
+
+TEST_CASE( "gas_diffusion_spreads_without_creating_gas", "[field][gas_diffusion]" )
+{
+    std::vector<gas_diffusion::layer> layers;
+    layers.push_back( layer_with_cloud( 0xff ) );
+    gas_diffusion::settings opts;
+    opts.percent_spread = 100;
+    opts.max_intensity = 3;
+    opts.seed = 42;
+
+    gas_diffusion::diffuse( layers, opts );
+    const gas_diffusion::layer &l = layers.front();
+    // Every tile of the cloud is full, only the border can give gas away
+    CHECK( total( l.next_intensity ) == total( l.intensity ) );
+    CHECK( l.next_intensity != l.intensity );
+    for( size_t i = 0; i < l.next_intensity.size(); i++ ) {
+        CHECK( l.next_intensity[i] <= 3 );
+        CHECK( l.next_age[i] >= 0 );
+    }
+}
+
+TEST_CASE( "gas_diffusion_is_deterministic", "[field][gas_diffusion]" )
+{
+    gas_diffusion::settings opts;
+    opts.percent_spread = 50;
+    opts.max_intensity = 3;
+    opts.seed = 7;
+
+    std::vector<gas_diffusion::layer> first;
+    first.push_back( layer_with_cloud( 0xff ) );
+    std::vector<gas_diffusion::layer> second = first;
+    gas_diffusion::diffuse( first, opts );
+    gas_diffusion::diffuse( second, opts );
+    CHECK( first.front().next_intensity == second.front().next_intensity );
+    CHECK( first.front().next_age == second.front().next_age );
+}
+
+TEST_CASE( "gas_diffusion_respects_obstacles", "[field][gas_diffusion]" )
+{
+    std::vector<gas_diffusion::layer> layers;
+    layers.push_back( layer_with_cloud( 0 ) );
+    gas_diffusion::settings opts;
+    opts.percent_spread = 100;
+    opts.max_intensity = 3;
+
+    gas_diffusion::diffuse( layers, opts );
+    CHECK( layers.front().next_intensity == layers.front().intensity );
+    CHECK( layers.front().next_age == layers.front().age );
+}
+
+TEST_CASE( "gas_diffusion_falls_to_lower_layer", "[field][gas_diffusion]" )
+{
+    std::vector<gas_diffusion::layer> layers;
+    layers.emplace_back( layer_size );
+    layers.push_back( layer_with_cloud( gas_diffusion::open_below ) );
+    gas_diffusion::settings opts;
+    opts.percent_spread = 100;
+    opts.max_intensity = 3;
+    opts.zlevels = true;
+
+    gas_diffusion::diffuse( layers, opts );
+    const int moved = total( layers[0].next_intensity );
+    CHECK( moved == 16 );
+    CHECK( total( layers[1].next_intensity ) + moved == total( layers[1].intensity ) );
+}
+
+TEST_CASE( "gas_diffusion_wind_blockers_face_the_wind", "[field][gas_diffusion]" )
+{
+    const std::array<point, 3> blockers = gas_diffusion::wind_blockers( 0 );
+    CHECK( blockers[0] == point_east );
+    CHECK( gas_diffusion::wind_blockers( 240 )[0] == point_south );
+}
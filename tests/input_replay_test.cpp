@@ -0,0 +1,29 @@
+#include "catch/catch.hpp"
+
+#include <string>
+
+#include "input.h"
+#include "input_replay.h"
+
+TEST_CASE( "input_replay_events_round_trip", "[input]" )
+{
+    input_event key( 'a', input_event_t::keyboard );
+    key.modifiers.push_back( 2 );
+    key.text = "a \"quoted\" é";
+    input_event click( MOUSE_BUTTON_LEFT, input_event_t::mouse );
+    click.mouse_pos = point( 12, -3 );
+    input_event timeout;
+    timeout.type = input_event_t::timeout;
+
+    for( const input_event &evt : {
+             key, click, timeout
+         } ) {
+        const std::string line = input_replay::serialize_event( evt );
+        CAPTURE( line );
+        CHECK( line.find( '\n' ) == std::string::npos );
+        const input_event back = input_replay::deserialize_event( line );
+        CHECK( back == evt );
+        CHECK( back.mouse_pos == evt.mouse_pos );
+        CHECK( back.text == evt.text );
+    }
+}
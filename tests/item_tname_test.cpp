@@ -308,3 +308,38 @@ TEST_CASE( "weapon fouling", "[item][tname][fouling][dirt]" )
         }
     }
 }
+
+TEST_CASE( "remembered names follow item changes", "[item][tname]" )
+{
+    clear_all_state();
+    item &rag = *item::spawn_temporary( "rag" );
+    REQUIRE( rag.tname() == "rag" );
+
+    rag.set_flag( flag_WET );
+    CHECK( rag.tname() == "rag (wet)" );
+    rag.unset_flag( flag_WET );
+    rag.set_flag( flag_FILTHY );
+    CHECK( rag.tname() == "rag (filthy)" );
+    CHECK( rag.tname( 2 ) == "rags (filthy)" );
+    rag.set_favorite( true );
+    CHECK( rag.tname() == "rag (filthy) *" );
+    CHECK( rag.tname( 1, false ) == "rag (filthy) *" );
+}
+
+TEST_CASE( "tname_benchmark", "[.][item][tname][benchmark]" )
+{
+    clear_all_state();
+    item &rag = *item::spawn_temporary( "rag" );
+    rag.set_flag( flag_WET );
+    item &bottle = *item::spawn_temporary( "bottle_plastic" );
+    detached_ptr<item> water = item::spawn( "water" );
+    water->charges = bottle.get_remaining_capacity_for_liquid( *water );
+    bottle.put_in( std::move( water ) );
+
+    BENCHMARK( "tname of a wet rag" ) {
+        return rag.tname();
+    };
+    BENCHMARK( "tname of a filled bottle" ) {
+        return bottle.tname();
+    };
+}
@@ -481,3 +481,42 @@ TEST_CASE( "serialize_optional", "[json]" )
         test_serialization( v, "[1,2,3]" );
     }
 }
+
+TEST_CASE( "jsonin_parse_benchmark", "[.][json][benchmark]" )
+{
+    // Roughly shaped like item definitions, about a megabyte in total
+    std::ostringstream os;
+    JsonOut jsout( os, true );
+    jsout.start_array();
+    for( int i = 0; i < 5000; ++i ) {
+        jsout.start_object();
+        jsout.member( "type", "GENERIC" );
+        jsout.member( "id", "test_item_" + std::to_string( i ) );
+        jsout.member( "name", "a test item with a \"long\" name" );
+        jsout.member( "description", std::string( 100, 'x' ) );
+        jsout.member( "weight", i * 10 );
+        jsout.member( "volume", 0.25 );
+        jsout.member( "flags", std::vector<std::string> { "FLAG_ONE", "FLAG_TWO", "FLAG_THREE" } );
+        jsout.end_object();
+    }
+    jsout.end_array();
+    const std::string text = os.str();
+
+    BENCHMARK( "skip_value" ) {
+        std::istringstream is( text );
+        JsonIn jsin( is );
+        jsin.skip_value();
+        return jsin.tell();
+    };
+    BENCHMARK( "read all members" ) {
+        std::istringstream is( text );
+        JsonIn jsin( is );
+        int total = 0;
+        for( JsonObject jo : jsin.get_array() ) {
+            total += jo.get_string( "id" ).size() + jo.get_string( "description" ).size();
+            total += jo.get_int( "weight" ) + jo.get_tags( "flags" ).size();
+            jo.allow_omitted_members();
+        }
+        return total;
+    };
+}
@@ -90,26 +90,75 @@ void clear_items( const int zlevel )
     }
 }
 
+// The map as the last clear_map() left it
+static std::vector<map::submap_stamp> cleared_map_stamps;
+
 void clear_overmap()
 {
+    // Freed submaps could be replaced by new ones at the same address
+    cleared_map_stamps.clear();
     MAPBUFFER.clear();
     overmap_buffer.clear();
 }
 
+// Calls @p func with the first tile of every submap on @p z that changed since the last clear_map()
+template<typename Func>
+static void for_each_changed_submap( const int z, Func func )
+{
+    map &here = get_map();
+    for( int smx = 0; smx < here.getmapsize(); ++smx ) {
+        for( int smy = 0; smy < here.getmapsize(); ++smy ) {
+            if( !here.submap_unchanged_since( cleared_map_stamps, { smx, smy, z } ) ) {
+                func( tripoint( smx * SEEX, smy * SEEY, z ) );
+            }
+        }
+    }
+}
+
 void clear_map()
 {
+    map &here = get_map();
     // Clearing all z-levels is rather slow, so just clear the ones I know the
     // tests use for now.
-    for( int z = -2; z <= 0; ++z ) {
-        clear_fields( z );
+    // Submaps nothing touched since the last call are still clear and get skipped.
+    for( int z = -2; z <= OVERMAP_HEIGHT; ++z ) {
+        const ter_id terrain = z == 0 ? t_grass : z < 0 ? t_rock : t_open_air;
+        for_each_changed_submap( z, [&]( const tripoint & corner ) {
+            for( const tripoint &p : here.points_in_rectangle( corner,
+                    corner + tripoint( SEEX - 1, SEEY - 1, 0 ) ) ) {
+                if( z <= 0 ) {
+                    std::vector<field_type_id> fields;
+                    for( auto &pr : here.field_at( p ) ) {
+                        fields.push_back( pr.second.get_field_type() );
+                    }
+                    for( field_type_id f : fields ) {
+                        here.remove_field( p, f );
+                    }
+                }
+                if( z >= -1 ) {
+                    here.set( p, terrain, f_null );
+                }
+            }
+        } );
     }
-    wipe_map_terrain();
+    clear_vehicles();
+    here.invalidate_map_cache( 0 );
+    here.build_map_cache( 0, true );
     clear_npcs();
     clear_creatures();
-    g->m.clear_traps();
+    here.clear_traps();
+    // Routes of earlier tests would be found valid again if the map ends up the same
+    here.clear_route_cache();
+    // Dead creatures may have left items behind, so check the submaps again
     for( int z = -2; z <= 0; ++z ) {
-        clear_items( z );
+        for_each_changed_submap( z, [&]( const tripoint & corner ) {
+            for( const tripoint &p : here.points_in_rectangle( corner,
+                    corner + tripoint( SEEX - 1, SEEY - 1, 0 ) ) ) {
+                here.i_clear( p );
+            }
+        } );
     }
+    cleared_map_stamps = here.stamp_submaps();
 }
 
 void put_player_underground()
@@ -68,6 +68,20 @@ TEST_CASE( "map_memory_overwrites", "[map_memory]" )
     CHECK( memory.get_symbol( p2 ) == 3 );
 }
 
+TEST_CASE( "map_memory_remembers_tiles", "[map_memory]" )
+{
+    map_memory memory;
+    memory.prepare_region( p1, p2 );
+    memory.memorize_tile( p1, "t_dirt", 1, 2 );
+    memory.memorize_tile( p2, "t_dirt", 1, 3 );
+    memory.memorize_tile( p2 + tripoint_east, "t_dirt", 1, 2 );
+    CHECK( memory.get_tile( p1 ) == memorized_terrain_tile{ "t_dirt", 1, 2 } );
+    CHECK( memory.get_tile( p2 ) == memorized_terrain_tile{ "t_dirt", 1, 3 } );
+    CHECK( &memory.get_tile( p1 ) == &memory.get_tile( p2 + tripoint_east ) );
+    memory.clear_memorized_tile( p1 );
+    CHECK( memory.get_tile( p1 ).tile.empty() );
+}
+
 TEST_CASE( "map_memory_forgets", "[map_memory]" )
 {
     map_memory memory;
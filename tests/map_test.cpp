@@ -1,5 +1,6 @@
 #include "catch/catch.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
@@ -9,8 +10,11 @@
 #include "game_constants.h"
 #include "map.h"
 #include "map_helpers.h"
+#include "map_iterator.h"
+#include "pathfinding.h"
 #include "point.h"
 #include "state_helpers.h"
+#include "submap.h"
 #include "type_id.h"
 
 TEST_CASE( "destroy_grabbed_furniture" )
@@ -144,3 +148,148 @@ TEST_CASE( "bash_through_roof_can_destroy_multiple_times" )
         }
     }
 }
+
+TEST_CASE( "find_clear_path_is_not_fooled_by_cached_visibility" )
+{
+    clear_all_state();
+    map &here = get_map();
+    const tripoint source( 60, 60, 0 );
+    const tripoint target( 65, 62, 0 );
+    // Blocks the default line, but not the one starting diagonally
+    const tripoint blocker( 61, 60, 0 );
+    here.ter_set( blocker, ter_id( "t_wall" ) );
+    here.build_map_cache( 0 );
+
+    REQUIRE_FALSE( here.sees( source, target, -1 ) );
+    const std::vector<tripoint> path = here.find_clear_path( source, target );
+    REQUIRE_FALSE( path.empty() );
+    CHECK( path.back() == target );
+    CHECK( std::find( path.begin(), path.end(), blocker ) == path.end() );
+}
+
+TEST_CASE( "submap_runs_cover_the_area_once", "[map]" )
+{
+    clear_all_state();
+    map &here = get_map();
+    // Crosses submap borders on both axes and is clipped at the map edge
+    const tripoint min( -3, 5, 0 );
+    const tripoint max( 2 * SEEX + 2, 2 * SEEY + 1, 0 );
+    std::vector<tripoint> seen;
+    here.for_each_submap_run( min, max, [&]( const submap_run & run ) {
+        CHECK( run.length > 0 );
+        CHECK( run.local.y + run.length <= SEEY );
+        for( int i = 0; i < run.length; i++ ) {
+            const tripoint p = run.start + point( 0, i );
+            CHECK( run.sm->get_ter( run.local + point( 0, i ) ) == here.ter( p ) );
+            seen.push_back( p );
+        }
+    } );
+    std::vector<tripoint> expected;
+    for( const tripoint &p : here.points_in_rectangle( tripoint( 0, 5, 0 ), max ) ) {
+        expected.push_back( p );
+    }
+    std::sort( seen.begin(), seen.end() );
+    std::sort( expected.begin(), expected.end() );
+    CHECK( seen == expected );
+}
+
+TEST_CASE( "clear_map_resets_changed_submaps", "[map]" )
+{
+    clear_all_state();
+    map &here = get_map();
+    const std::vector<map::submap_stamp> stamps = here.stamp_submaps();
+    const tripoint changed( 3, 4, 0 );
+    here.ter_set( changed, ter_id( "t_wall" ) );
+    CHECK_FALSE( here.submap_unchanged_since( stamps, tripoint_zero ) );
+    CHECK( here.submap_unchanged_since( stamps, tripoint( 2, 2, 0 ) ) );
+
+    clear_map();
+    CHECK( here.ter( changed ) == ter_id( "t_grass" ) );
+}
+
+TEST_CASE( "move_cost_follows_terrain_changes", "[map]" )
+{
+    clear_all_state();
+    map &here = get_map();
+    const tripoint wall( 60, 60, 0 );
+    const tripoint start( 58, 60, 0 );
+    const tripoint goal( 62, 60, 0 );
+    pathfinding_settings settings;
+    settings.max_dist = 10;
+    settings.max_length = 20;
+    here.ter_set( wall, ter_id( "t_wall" ) );
+    // Routing brings the pathfinding cache up to date, move costs come from it afterwards
+    here.route( start, goal, settings );
+    CHECK( here.move_cost( wall ) == 0 );
+    CHECK( here.move_cost( start ) == 2 );
+
+    here.ter_set( wall, ter_id( "t_floor" ) );
+    CHECK( here.move_cost( wall ) == 2 );
+    here.route( start, goal, settings );
+    CHECK( here.move_cost( wall ) == 2 );
+}
+
+TEST_CASE( "outside_cache_follows_roof_changes", "[map]" )
+{
+    clear_all_state();
+    map &here = get_map();
+    // Last tile of a submap, so the sheltered neighbours reach into the next one
+    const tripoint roof( 59, 60, 0 );
+    const tripoint sheltered( 60, 61, 0 );
+    here.build_outside_cache( 0 );
+    REQUIRE( here.is_outside( roof ) );
+    REQUIRE( here.is_outside( sheltered ) );
+
+    here.ter_set( roof, ter_id( "t_floor" ) );
+    here.build_outside_cache( 0 );
+    CHECK_FALSE( here.is_outside( roof ) );
+    CHECK_FALSE( here.is_outside( sheltered ) );
+    CHECK( here.is_outside( sheltered + tripoint_east ) );
+
+    here.ter_set( roof, ter_id( "t_grass" ) );
+    here.build_outside_cache( 0 );
+    CHECK( here.is_outside( roof ) );
+    CHECK( here.is_outside( sheltered ) );
+}
+
+TEST_CASE( "trap_locations_in_radius_finds_placed_traps", "[map]" )
+{
+    clear_all_state();
+    map &here = get_map();
+    // Next to a submap border, so the search area covers two of them
+    const tripoint trap_pos( 61, 65, 0 );
+    const tripoint center( 58, 65, 0 );
+    here.trap_set( trap_pos, trap_id( "tr_beartrap" ) );
+
+    CHECK( here.trap_locations_in_radius( center, 5 ) == std::vector<tripoint> { trap_pos } );
+    CHECK( here.trap_locations_in_radius( center, 2 ).empty() );
+
+    here.remove_trap( trap_pos );
+    CHECK( here.trap_locations_in_radius( center, 5 ).empty() );
+}
+
+TEST_CASE( "propagate_field_fills_the_center_first", "[map][field]" )
+{
+    clear_all_state();
+    map &here = get_map();
+    const field_type_id fd_smoke( "fd_smoke" );
+    const tripoint center( 60, 60, 0 );
+    const auto neighbor_intensity = [&]() {
+        int sum = 0;
+        for( const tripoint &p : here.points_in_radius( center, 1 ) ) {
+            if( p != center ) {
+                sum += here.get_field_intensity( p, fd_smoke );
+            }
+        }
+        return sum;
+    };
+
+    here.propagate_field( center, fd_smoke, 2, 3 );
+    CHECK( here.get_field_intensity( center, fd_smoke ) == 2 );
+    CHECK( neighbor_intensity() == 0 );
+
+    // One more fits on the center, the rest goes to the neighbors
+    here.propagate_field( center, fd_smoke, 4, 3 );
+    CHECK( here.get_field_intensity( center, fd_smoke ) == 3 );
+    CHECK( neighbor_intensity() == 3 );
+}
@@ -0,0 +1,38 @@
+#include "catch/catch.hpp"
+
+#include <memory>
+
+#include "coordinate_conversions.h"
+#include "mapbuffer.h"
+#include "point.h"
+#include "submap.h"
+
+TEST_CASE( "mapbuffer_stores_submaps_by_quad", "[mapbuffer]" )
+{
+    mapbuffer buffer;
+    // Negative coordinates must land in the same quad as their neighbours
+    const tripoint om_addr( -3, 5, 1 );
+    const tripoint origin = omt_to_sm_copy( om_addr );
+    const tripoint south_east = origin + point_south_east;
+
+    CHECK( mapbuffer::quad_index( origin ) == 0 );
+    CHECK( mapbuffer::quad_index( origin + point_south ) == 1 );
+    CHECK( mapbuffer::quad_index( origin + point_east ) == 2 );
+    CHECK( mapbuffer::quad_index( south_east ) == 3 );
+
+    std::unique_ptr<submap> sm = std::make_unique<submap>( sm_to_ms_copy( south_east ) );
+    submap *raw = sm.get();
+    REQUIRE( buffer.add_submap( south_east, sm ) );
+    CHECK( sm == nullptr );
+    CHECK( buffer.is_submap_loaded( south_east ) );
+    CHECK_FALSE( buffer.is_submap_loaded( origin ) );
+    CHECK( buffer.lookup_submap( south_east ) == raw );
+
+    std::unique_ptr<submap> again = std::make_unique<submap>( sm_to_ms_copy( south_east ) );
+    CHECK_FALSE( buffer.add_submap( south_east, again ) );
+    CHECK( again != nullptr );
+
+    const std::array<submap *, 4> quad = buffer.lookup_quad( om_addr );
+    CHECK( quad[0] == nullptr );
+    CHECK( quad[3] == raw );
+}
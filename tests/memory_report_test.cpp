@@ -0,0 +1,22 @@
+#include "catch/catch.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include "mapbuffer.h"
+#include "memory_report.h"
+#include "state_helpers.h"
+
+TEST_CASE( "memory_report_counts_buffered_submaps", "[memory_report]" )
+{
+    clear_all_state();
+    const std::vector<memory_report::entry> entries = memory_report::collect();
+    const auto submaps = std::find_if( entries.begin(), entries.end(),
+    []( const memory_report::entry & e ) {
+        return e.name == "submaps";
+    } );
+    REQUIRE( submaps != entries.end() );
+    CHECK( submaps->count == MAPBUFFER.num_submaps() );
+    CHECK( submaps->count > 0 );
+    CHECK( submaps->bytes >= submaps->count );
+}
@@ -11,6 +11,7 @@
 #include <utility>
 
 #include "avatar.h"
+#include "cata_utility.h"
 #include "game.h"
 #include "map.h"
 #include "map_helpers.h"
@@ -299,6 +300,7 @@ TEST_CASE( "write_slope_to_speed_map_trig", "[.]" )
     clear_all_state();
     put_player_underground();
     override_option opt( "CIRCLEDIST", "true" );
+    restore_on_out_of_scope<bool> restore_trigdist( trigdist );
     trigdist = true;
     test_moves_to_squares( "mon_zombie_dog", true );
     test_moves_to_squares( "mon_pig", true );
@@ -309,6 +311,7 @@ TEST_CASE( "write_slope_to_speed_map_square", "[.]" )
     clear_all_state();
     put_player_underground();
     override_option opt( "CIRCLEDIST", "false" );
+    restore_on_out_of_scope<bool> restore_trigdist( trigdist );
     trigdist = false;
     test_moves_to_squares( "mon_zombie_dog", true );
     test_moves_to_squares( "mon_pig", true );
@@ -321,6 +324,7 @@ TEST_CASE( "monster_speed_square", "[speed]" )
     clear_all_state();
     put_player_underground();
     override_option opt( "CIRCLEDIST", "false" );
+    restore_on_out_of_scope<bool> restore_trigdist( trigdist );
     trigdist = false;
     monster_check();
 }
@@ -331,6 +335,7 @@ TEST_CASE( "monster_speed_trig", "[speed][!mayfail]" )
     clear_all_state();
     put_player_underground();
     override_option opt( "CIRCLEDIST", "true" );
+    restore_on_out_of_scope<bool> restore_trigdist( trigdist );
     trigdist = true;
     monster_check();
 }
@@ -354,3 +359,33 @@ TEST_CASE( "monster_move_through_vehicle_holes" )
     CHECK( m2 == nullptr );
 
 }
+
+TEST_CASE( "idle_monsters_far_away_plan_less_often", "[monster][ai]" )
+{
+    clear_all_state();
+    override_option lod_distance( "MONSTER_AI_LOD_DISTANCE", "10" );
+    override_option lod_interval( "MONSTER_AI_LOD_INTERVAL", "4" );
+    const tripoint origin = get_avatar().pos();
+    monster &far = spawn_test_monster( "mon_zombie", origin + point( 30, 0 ) );
+    monster &near = spawn_test_monster( "mon_zombie", origin + point( 0, 5 ) );
+    // Keep it from noticing the player and getting a target
+    far.add_effect( efftype_id( "no_sight" ), 1_days );
+    far.set_moves( 100 );
+    near.set_moves( 100 );
+
+    g->monmove();
+    const time_point first_plan = calendar::turn;
+    CHECK( far.next_plan == first_plan + 4_turns );
+    CHECK( near.next_plan == calendar::before_time_starts );
+
+    calendar::turn += 1_turns;
+    far.set_moves( 100 );
+    g->monmove();
+    // It kept following its old plan
+    CHECK( far.next_plan == first_plan + 4_turns );
+
+    calendar::turn = first_plan + 4_turns;
+    far.set_moves( 100 );
+    g->monmove();
+    CHECK( far.next_plan == first_plan + 8_turns );
+}
@@ -101,3 +101,41 @@ TEST_CASE( "monsters_dont_see_through_vehicle_holes", "[vision]" )
     CHECK( !outside.sees( inside ) );
 
 }
+
+TEST_CASE( "shared field of view agrees with line of sight", "[vision]" )
+{
+    clear_all_state();
+    calendar::turn = midday;
+    map &here = get_map();
+    const tripoint target( 60, 60, 0 );
+    // A wall west of the target, running north to south
+    for( int y = 50; y <= 70; y++ ) {
+        here.ter_set( tripoint( 57, y, 0 ), t_wall );
+    }
+    here.invalidate_map_cache( 0 );
+    here.build_map_cache( 0 );
+
+    REQUIRE_FALSE( here.has_shared_fov( target ) );
+    here.share_fov( target );
+    REQUIRE( here.has_shared_fov( target ) );
+
+    for( int dy = -2; dy <= 2; dy++ ) {
+        // Open ground to the east
+        const tripoint east = target + point( 8, dy );
+        CHECK( here.sees_shared( east, target, 60 ) );
+        CHECK( here.sees( east, target, 60 ) );
+        // Behind the wall
+        const tripoint west = target + point( -8, dy );
+        CHECK_FALSE( here.sees_shared( west, target, 60 ) );
+        CHECK_FALSE( here.sees( west, target, 60 ) );
+    }
+    // The same field of view answers what the target itself sees
+    CHECK( here.sees_shared( target, target + point( 8, 0 ), 60 ) );
+    CHECK_FALSE( here.sees_shared( target, target + point( -8, 0 ), 60 ) );
+    // Range still applies
+    CHECK_FALSE( here.sees_shared( target + point( 8, 0 ), target, 5 ) );
+
+    // Rebuilding the map cache drops it
+    here.build_map_cache( 0 );
+    CHECK_FALSE( here.has_shared_fov( target ) );
+}
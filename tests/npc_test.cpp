@@ -508,3 +508,19 @@ TEST_CASE( "random npc spawn chance" )
     CHECK( npc_overmap::spawn_chance_in_hour( 4 * days_in_year, 1.0 ) == Approx( 0.25 / 24.0 ) );
     CHECK( npc_overmap::spawn_chance_in_hour( 8 * days_in_year, 1.0 ) == Approx( 0.125 / 24.0 ) );
 }
+
+TEST_CASE( "npc_item_searches_notice_new_items", "[npc]" )
+{
+    clear_all_state();
+    npc &guy = spawn_npc( get_player_character().pos().xy() + point( 5, 0 ), "test_talker" );
+    clear_character( guy );
+
+    CHECK_FALSE( guy.has_healing_options().bandage );
+    guy.i_add( item::spawn( itype_id( "bandages" ) ) );
+    CHECK( guy.has_healing_options().bandage );
+
+    item &mag = guy.i_add( item::spawn( itype_id( "glockmag" ) ) );
+    CHECK( guy.find_usable_ammo( mag ) == nullptr );
+    guy.i_add( item::spawn( itype_id( "9mm" ), calendar::turn, 10 ) );
+    CHECK( guy.find_usable_ammo( mag ) != nullptr );
+}
@@ -0,0 +1,25 @@
+#include "catch/catch.hpp"
+
+#include <string>
+
+#include "options.h"
+#include "options_helpers.h"
+
+TEST_CASE( "option_handle_follows_option_changes", "[options]" )
+{
+    const option_handle<bool> health_bar( "ITEM_HEALTH_BAR" );
+    const option_handle<std::string> units( "USE_CELSIUS" );
+    {
+        override_option on( "ITEM_HEALTH_BAR", "true" );
+        override_option kelvin( "USE_CELSIUS", "kelvin" );
+        CHECK( health_bar.get() );
+        CHECK( units.get() == "kelvin" );
+        {
+            override_option off( "ITEM_HEALTH_BAR", "false" );
+            CHECK_FALSE( health_bar.get() );
+        }
+        CHECK( health_bar.get() );
+    }
+    CHECK( health_bar.get() == get_option<bool>( "ITEM_HEALTH_BAR" ) );
+    CHECK( units.get() == get_option<std::string>( "USE_CELSIUS" ) );
+}
@@ -0,0 +1,97 @@
+#include "catch/catch.hpp"
+
+#include <vector>
+
+#include "line.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "pathfinding.h"
+#include "point.h"
+#include "state_helpers.h"
+#include "type_id.h"
+
+TEST_CASE( "shared_routes_match_astar_routes", "[pathfinding]" )
+{
+    clear_all_state();
+    map &here = get_map();
+    const tripoint goal( 60, 60, 0 );
+    // Wall in the way, so straight lines don't work
+    for( int y = 50; y <= 70; y++ ) {
+        here.ter_set( tripoint( 55, y, 0 ), ter_id( "t_wall" ) );
+    }
+    const pathfinding_settings settings( 0, 30, 120, 0, false, false, true, false, false );
+    const std::vector<tripoint> starts = {
+        { 50, 60, 0 }, { 50, 55, 0 }, { 52, 65, 0 }, { 48, 60, 0 }
+    };
+
+    for( const tripoint &start : starts ) {
+        CAPTURE( start );
+        const std::vector<tripoint> astar = here.route( start, goal, settings );
+        const std::vector<tripoint> shared = here.route_shared( start, goal, settings );
+        REQUIRE( !astar.empty() );
+        REQUIRE( !shared.empty() );
+        CHECK( shared.back() == goal );
+        tripoint prev = start;
+        for( const tripoint &p : shared ) {
+            CHECK( square_dist( prev, p ) == 1 );
+            CHECK( here.passable( p ) );
+            prev = p;
+        }
+    }
+
+    // Too far for the settings
+    CHECK( here.route_shared( tripoint( 20, 60, 0 ), goal, settings ).empty() );
+}
+
+TEST_CASE( "route_results_are_cached_until_pathfinding_cache_changes", "[pathfinding]" )
+{
+    clear_all_state();
+    map &here = get_map();
+    const tripoint start( 50, 60, 0 );
+    const tripoint goal( 60, 60, 0 );
+    for( int y = 50; y <= 70; y++ ) {
+        here.ter_set( tripoint( 55, y, 0 ), ter_id( "t_wall" ) );
+    }
+    const pathfinding_settings settings( 0, 30, 120, 0, false, false, true, false, false );
+
+    const route_cache_stats before = here.get_route_cache_stats();
+    const std::vector<tripoint> first = here.route( start, goal, settings );
+    const std::vector<tripoint> second = here.route( start, goal, settings );
+    CHECK( first == second );
+    CHECK( here.get_route_cache_stats().misses == before.misses + 1 );
+    CHECK( here.get_route_cache_stats().hits == before.hits + 1 );
+
+    // Opening the wall makes the old route stale
+    here.ter_set( tripoint( 55, 60, 0 ), ter_id( "t_floor" ) );
+    const std::vector<tripoint> third = here.route( start, goal, settings );
+    CHECK( here.get_route_cache_stats().invalidations == before.invalidations + 1 );
+    CHECK( third.size() < first.size() );
+}
+
+TEST_CASE( "route_benchmark", "[.][pathfinding][benchmark]" )
+{
+    clear_all_state();
+    map &here = get_map();
+    // Walls with gaps at alternating ends, so the search has to wind back and forth.
+    // route() only searches 16 tiles around the endpoints, the gaps have to be within that.
+    for( int x = 40; x <= 80; x += 4 ) {
+        const int gap_y = x % 8 == 0 ? 45 : 75;
+        for( int y = 30; y <= 90; y++ ) {
+            if( y != gap_y ) {
+                here.ter_set( tripoint( x, y, 0 ), ter_id( "t_wall" ) );
+            }
+        }
+    }
+    const pathfinding_settings settings( 0, 200, 5000, 0, false, false, true, false, false );
+    const tripoint start( 35, 60, 0 );
+    const tripoint goal( 85, 60, 0 );
+    REQUIRE( !here.route( start, goal, settings ).empty() );
+
+    BENCHMARK( "route after map change" ) {
+        here.set_pathfinding_cache_dirty( 0 );
+        return here.route( start, goal, settings ).size();
+    };
+    BENCHMARK( "repeated route" ) {
+        return here.route( start, goal, settings ).size();
+    };
+}
@@ -1,5 +1,6 @@
 #include "catch/catch.hpp"
 
+#include <cstdint>
 #include <functional>
 #include <optional>
 #include <vector>
@@ -78,3 +79,36 @@ TEST_CASE( "random_entry_preserves_constness" )
     i1 = 5678;
     CHECK( v1[0] == 5678 );
 }
+
+TEST_CASE( "rng_stream_is_reproducible", "[rng]" )
+{
+    rng_stream a( 1234, rng_domain::mapgen, 42 );
+    rng_stream b( 1234, rng_domain::mapgen, 42 );
+    rng_stream other_domain( 1234, rng_domain::weather, 42 );
+    rng_stream other_key( 1234, rng_domain::mapgen, 43 );
+    std::vector<std::uint64_t> first;
+    std::vector<std::uint64_t> second;
+    for( int i = 0; i < 16; i++ ) {
+        first.push_back( a() );
+        second.push_back( b() );
+    }
+    CHECK( first == second );
+    CHECK( other_domain() != first.front() );
+    CHECK( other_key() != first.front() );
+
+    // Forking does not advance the parent, and children only depend on their key
+    const rng_stream parent( 99 );
+    rng_stream child_1 = parent.fork( 1 );
+    rng_stream child_2 = parent.fork( 2 );
+    rng_stream child_1_again = parent.fork( 1 );
+    const std::uint64_t v = child_1();
+    CHECK( v == child_1_again() );
+    CHECK( v != child_2() );
+
+    for( int i = 0; i < 100; i++ ) {
+        const int r = rng( a, -3, 3 );
+        CHECK( r >= -3 );
+        CHECK( r <= 3 );
+    }
+    CHECK( one_in( a, 1 ) );
+}
@@ -204,3 +204,34 @@ TEST_CASE( "Items don't rot away on map load if in a freezer" )
     auto normal_stack_after = m.i_at( normal_pnt );
     REQUIRE( normal_stack_after.empty() );
 }
+
+TEST_CASE( "Rot caught up over days matches rot processed on the way" )
+{
+    weather_manager weather;
+    if( calendar::turn <= calendar::start_of_cataclysm ) {
+        calendar::turn = calendar::start_of_cataclysm + 1_minutes;
+    }
+    const tripoint pos( 10, 10, 0 );
+    const auto process = [&]( detached_ptr<item> &&it ) {
+        return item::process_rot( std::move( it ), false, pos, nullptr,
+                                  temperature_flag::TEMP_ROOT_CELLAR, weather );
+    };
+    detached_ptr<item> stepped = process( item::spawn( "apple" ) );
+    detached_ptr<item> caught_up = process( item::spawn( "apple" ) );
+    detached_ptr<item> second = process( item::spawn( "apple" ) );
+    REQUIRE( stepped->get_rot() == 0_turns );
+
+    for( int i = 0; i < 3 * 24 * 3; i++ ) {
+        calendar::turn += 20_minutes;
+        stepped = process( std::move( stepped ) );
+    }
+    // Both go through the same hours, the second one uses the remembered temperatures
+    caught_up = process( std::move( caught_up ) );
+    second = process( std::move( second ) );
+    REQUIRE( stepped );
+    REQUIRE( caught_up );
+    CHECK( caught_up->get_rot() > 0_turns );
+    CHECK( to_turns<int>( caught_up->get_rot() ) ==
+           Approx( to_turns<int>( stepped->get_rot() ) ).epsilon( 0.01 ) );
+    CHECK( second->get_rot() == caught_up->get_rot() );
+}
@@ -0,0 +1,44 @@
+#include "catch/catch.hpp"
+
+#include "cata_arena.h"
+#include "detached_ptr.h"
+#include "item.h"
+#include "safe_reference.h"
+#include "type_id.h"
+
+static const itype_id itype_rock( "rock" );
+
+TEST_CASE( "safe_reference_follows_object_lifetime", "[safe_reference]" )
+{
+    detached_ptr<item> owner = item::spawn( itype_rock );
+    item &obj = *owner;
+    safe_reference<item> first( obj );
+    const safe_reference<item> second( &obj );
+    CHECK( first == second );
+    CHECK( first == obj );
+    // Detached objects count as unloaded, so get() would refuse them
+    CHECK( first.get_const() == &obj );
+
+    owner = detached_ptr<item>();
+    CHECK( first.is_destroyed() );
+    CHECK( !second );
+    cata_arena<item>::cleanup();
+    CHECK( first.is_destroyed() );
+
+    // A new object, even if it reuses the memory, gets a record of its own
+    detached_ptr<item> other = item::spawn( itype_rock );
+    const safe_reference<item> third( *other );
+    CHECK( third.get_const() == &*other );
+    CHECK( third != first );
+    CHECK_FALSE( third.is_destroyed() );
+}
+
+TEST_CASE( "safe_reference_merge_moves_references", "[safe_reference]" )
+{
+    detached_ptr<item> primary = item::spawn( itype_rock );
+    detached_ptr<item> secondary = item::spawn( itype_rock );
+    const safe_reference<item> ref( *secondary );
+    safe_reference<item>::merge( &*primary, &*secondary );
+    CHECK( ref == *primary );
+    CHECK( safe_reference<item>( *primary ) == ref );
+}
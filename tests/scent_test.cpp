@@ -170,3 +170,42 @@ TEST_CASE( "scent_matches_old", "[.]" )
     }
 }
 
+TEST_CASE( "scent_spreads_evenly_on_open_ground", "[scent]" )
+{
+    clear_all_state();
+    const tripoint origin( 60, 60, 0 );
+    g->place_player( origin );
+    map &here = get_map();
+    g->scent.reset();
+    g->scent.set( origin, 1000, scenttype_id( "sc_human" ) );
+
+    g->scent.update( origin, here );
+    g->scent.update( origin, here );
+
+    const int here_scent = g->scent.get( origin );
+    CHECK( here_scent > 0 );
+    CHECK( here_scent < 1000 );
+    const int east = g->scent.get( origin + tripoint_east );
+    CHECK( east > 0 );
+    CHECK( g->scent.get( origin + tripoint_west ) == east );
+    CHECK( g->scent.get( origin + tripoint_north ) == east );
+    CHECK( g->scent.get( origin + tripoint_south ) == east );
+    const int diagonal = g->scent.get( origin + tripoint_north_east );
+    CHECK( g->scent.get( origin + tripoint_south_west ) == diagonal );
+    CHECK( g->scent.get( origin + point( 3, 0 ) ) == 0 );
+}
+
+TEST_CASE( "scent_update_benchmark", "[.][scent][benchmark]" )
+{
+    clear_all_state();
+    const tripoint origin( 60, 60, 0 );
+    g->place_player( origin );
+    map &here = get_map();
+    g->scent.reset();
+    g->scent.set( origin, 1000, scenttype_id( "sc_human" ) );
+
+    BENCHMARK( "scent_map::update" ) {
+        g->scent.update( origin, here );
+        return g->scent.get( origin );
+    };
+}
@@ -0,0 +1,26 @@
+#include "catch/catch.hpp"
+
+#include "map_helpers.h"
+#include "monster.h"
+#include "point.h"
+#include "sounds.h"
+#include "state_helpers.h"
+
+TEST_CASE( "only_monsters_in_range_hear_sounds", "[sounds][monster]" )
+{
+    clear_all_state();
+    // Sounds queued by earlier tests would be processed along with this one
+    sounds::reset_sounds();
+    const tripoint source( 60, 60, 0 );
+    monster &near = spawn_test_monster( "mon_zombie", source + point( 5, 0 ) );
+    monster &far = spawn_test_monster( "mon_zombie", source + point( 0, 50 ) );
+    near.wandf = 0;
+    far.wandf = 0;
+
+    sounds::sound( source, 20, sounds::sound_t::combat, "bang" );
+    sounds::process_sounds();
+
+    CHECK( near.wandf > 0 );
+    CHECK( near.wander_pos.z == source.z );
+    CHECK( far.wandf == 0 );
+}
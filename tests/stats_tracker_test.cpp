@@ -133,6 +133,31 @@ TEST_CASE( "stats_tracker_maximum_events", "[stats]" )
     CHECK( s.get_events( am ).maximum( "z" ) == 5 );
 }
 
+TEST_CASE( "event_multiset_summaries_match_counts", "[stats]" )
+{
+    const character_id u_id = g->u.getID();
+    event_multiset set( event_type::character_takes_damage );
+    set.add( cata::event::make<event_type::character_takes_damage>( u_id, 7 ) );
+    set.add( cata::event::make<event_type::character_takes_damage>( u_id, 7 ) );
+    set.add( cata::event::make<event_type::character_takes_damage>( u_id, 3 ) );
+    const cata::event::data_type any{};
+
+    CHECK( set.count() == 3 );
+    CHECK( set.count() == set.count( any ) );
+    CHECK( set.total( "damage" ) == 17 );
+    CHECK( set.total( "damage" ) == set.total( "damage", any ) );
+    CHECK( set.maximum( "damage" ) == 7 );
+    CHECK( set.minimum( "damage" ) == 0 );
+    CHECK( set.total( "no_such_field" ) == 0 );
+
+    event_multiset copy( event_type::character_takes_damage );
+    for( const event_multiset::counts_type::value_type &entry : set.counts() ) {
+        copy.add( entry );
+    }
+    CHECK( copy.count() == 3 );
+    CHECK( copy.total( "damage" ) == 17 );
+}
+
 TEST_CASE( "stats_tracker_with_event_statistics", "[stats]" )
 {
     stats_tracker s;
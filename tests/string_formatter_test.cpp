@@ -540,3 +540,18 @@ TEST_CASE( "string_formatter_errors" )
 
     CHECK_THROWS( test_for_error( "%d %d %d %d %d", 1, 2, 3, 4 ) );
 }
+
+TEST_CASE( "string_format_to_appends", "[string_formatter]" )
+{
+    std::string out = "abc ";
+    string_format_to( out, "%s %d %5.2f", "foo", 42, 1.5 );
+    CHECK( out == "abc foo 42  1.50" );
+    string_format_to( out, "|%-4s|%u", "x", 7u );
+    CHECK( out == "abc foo 42  1.50|x   |7" );
+
+    // The partial output of a broken format is replaced by the error
+    std::string broken = "abc ";
+    string_format_to( broken, "%d %d", 1 );
+    CHECK( broken.compare( 0, 4, "abc " ) == 0 );
+    CHECK( broken.find( "Requested argument" ) != std::string::npos );
+}
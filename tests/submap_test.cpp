@@ -1,8 +1,15 @@
 #include "catch/catch.hpp"
 
+#include <sstream>
+#include <string>
+#include <utility>
+
 #include "submap.h"
+#include "game.h"
+#include "json.h"
 #include "game_constants.h"
 #include "int_id.h"
+#include "item.h"
 #include "point.h"
 #include "type_id.h"
 
@@ -90,3 +97,126 @@ TEST_CASE( "submap rotation", "[submap]" )
         }
     }
 }
+
+TEST_CASE( "submap modification tracking", "[submap]" )
+{
+    submap sm( tripoint_zero );
+    CHECK( sm.is_modified_since_save() );
+
+    sm.mark_saved();
+    CHECK_FALSE( sm.is_modified_since_save() );
+    sm.get_ter( point_zero );
+    CHECK_FALSE( sm.is_modified_since_save() );
+
+    SECTION( "terrain change" ) {
+        sm.set_ter( point_zero, ter_id( 1 ) );
+        CHECK( sm.is_modified_since_save() );
+    }
+    SECTION( "mutable access to items" ) {
+        sm.get_items( point_zero );
+        CHECK( sm.is_modified_since_save() );
+    }
+    SECTION( "saving again" ) {
+        sm.set_radiation( point_zero, 10 );
+        sm.mark_saved();
+        CHECK_FALSE( sm.is_modified_since_save() );
+    }
+}
+
+TEST_CASE( "submap tile layers survive a save round trip", "[submap]" )
+{
+    submap sm( tripoint_zero );
+    for( int j = 0; j < SEEY; j++ ) {
+        for( int i = 0; i < SEEX; i++ ) {
+            sm.set_ter( point( i, j ), ter_id( 1 + ( i * j ) % 3 ) );
+        }
+    }
+    sm.set_furn( point( 3, 4 ), furn_id( 1 ) );
+    sm.set_trap( point( SEEX - 1, SEEY - 1 ), trap_id( 1 ) );
+
+    std::ostringstream os;
+    JsonOut jsout( os );
+    jsout.start_object();
+    sm.store( jsout );
+    jsout.end_object();
+
+    submap loaded( tripoint_zero );
+    std::istringstream is( os.str() );
+    JsonIn jsin( is );
+    jsin.start_object();
+    while( !jsin.end_object() ) {
+        const std::string name = jsin.get_member_name();
+        loaded.load( jsin, name, savegame_version, tripoint_zero );
+    }
+
+    for( int j = 0; j < SEEY; j++ ) {
+        for( int i = 0; i < SEEX; i++ ) {
+            const point p( i, j );
+            CAPTURE( p );
+            CHECK( loaded.get_ter( p ) == sm.get_ter( p ) );
+            CHECK( loaded.get_furn( p ) == sm.get_furn( p ) );
+            CHECK( loaded.get_trap( p ) == sm.get_trap( p ) );
+        }
+    }
+}
+
+TEST_CASE( "identical map items are saved once per run", "[submap][item]" )
+{
+    submap sm( tripoint_zero );
+    const point p( 2, 3 );
+    for( int i = 0; i < 50; i++ ) {
+        sm.get_items( p ).push_back( item::spawn( "rock" ) );
+    }
+    sm.get_items( p ).push_back( item::spawn( "rag" ) );
+    for( int i = 0; i < 3; i++ ) {
+        sm.get_items( p ).push_back( item::spawn( "rock" ) );
+    }
+
+    std::ostringstream os;
+    JsonOut jsout( os );
+    jsout.start_object();
+    sm.store( jsout );
+    jsout.end_object();
+
+    const std::string saved = os.str();
+    size_t rocks_written = 0;
+    for( size_t pos = saved.find( "\"rock\"" ); pos != std::string::npos;
+         pos = saved.find( "\"rock\"", pos + 1 ) ) {
+        rocks_written++;
+    }
+    CHECK( rocks_written == 2 );
+
+    submap loaded( tripoint_zero );
+    std::istringstream is( saved );
+    JsonIn jsin( is );
+    jsin.start_object();
+    while( !jsin.end_object() ) {
+        const std::string name = jsin.get_member_name();
+        loaded.load( jsin, name, savegame_version, tripoint_zero );
+    }
+
+    const location_vector<item> &items = std::as_const( loaded ).get_items( p );
+    REQUIRE( items.size() == 54 );
+    int index = 0;
+    for( const item *it : items ) {
+        CHECK( it->typeId() == itype_id( index == 50 ? "rag" : "rock" ) );
+        index++;
+    }
+}
+
+TEST_CASE( "submap field tile marks follow rotation", "[submap][field]" )
+{
+    submap sm( tripoint_zero );
+    const point p( 1, 2 );
+    CHECK_FALSE( sm.may_have_field( p ) );
+    sm.mark_field_tile( p );
+    REQUIRE( sm.may_have_field( p ) );
+
+    sm.rotate( 1 );
+    const point rotated = p.rotate( 1, { SEEX, SEEY } );
+    CHECK_FALSE( sm.may_have_field( p ) );
+    CHECK( sm.may_have_field( rotated ) );
+
+    sm.clear_field_tile( rotated );
+    CHECK_FALSE( sm.may_have_field( rotated ) );
+}
@@ -19,12 +19,14 @@
 #define CATCH_CONFIG_RUNNER
 #include <algorithm>
 #include <cassert>
+#include <cerrno>
 #include <chrono>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <ctime>
 #include <exception>
+#include <iostream>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -57,9 +59,18 @@
 #include "string_utils.h"
 #include "string_formatter.h"
 #include "type_id.h"
+#include "stall_watchdog.h"
+#include "thread_pool.h"
 #include "weather.h"
+#include "world.h"
 #include "worldfactory.h"
 
+#if !defined(_WIN32)
+#   include <fcntl.h>
+#   include <sys/wait.h>
+#   include <unistd.h>
+#endif
+
 using name_value_pair_t = std::pair<std::string, std::string>;
 using option_overrides_t = std::vector<name_value_pair_t>;
 
@@ -239,6 +250,154 @@ static std::string extract_user_dir( std::vector<const char *> &arg_vec )
     return option_user_dir;
 }
 
+#if !defined(_WIN32)
+// Test spec that matches exactly the test case called name
+static std::string exact_test_spec( const std::string &name )
+{
+    std::string ret = "\"";
+    for( const char c : name ) {
+        if( c == '\\' || c == '"' || c == ',' ) {
+            ret += '\\';
+        }
+        ret += c;
+    }
+    return ret + "\"";
+}
+
+// Copies the folder of the active world so a shard saves and loads its own files.
+// Returns the name of the copy, or an empty string when the folder could not be made.
+static std::string copy_world_for_shard( const WORLDINFO &info, int shard )
+{
+    const std::string name = string_format( "%s_shard_%d", info.world_name, shard );
+    const std::string from = info.folder_path() + "/";
+    const std::string to = PATH_INFO::savedir() + name + "/";
+    if( !remove_tree( to ) || !assure_dir_exist( to ) ) {
+        return std::string();
+    }
+    for( const std::string &file_path : get_files_from_path( "", from, true, true ) ) {
+        const std::string part = file_path.substr( from.size() );
+        const size_t last_separator = part.find_last_of( "/\\" );
+        if( last_separator != std::string::npos ) {
+            assure_dir_exist( to + part.substr( 0, last_separator ) );
+        }
+        copy_file( file_path, to + part );
+    }
+    return name;
+}
+
+// Runs the selected tests in num_shards processes forked from this one, so the game data
+// is only loaded once and every shard still gets its own copy of the global state and world.
+// Tests are dealt out round-robin, the output of every shard is printed when it is done.
+// Returns the sum of the exit codes of the shards.
+static int run_sharded( Catch::Session &session, int num_shards, const std::string &user_dir )
+{
+    Catch::Config &config = session.config();
+    const std::vector<Catch::TestCase> tests = Catch::filterTests(
+                Catch::getAllTestCasesSorted( config ), config.testSpec(), config );
+    num_shards = std::min( num_shards, static_cast<int>( tests.size() ) );
+    if( num_shards <= 1 ) {
+        return session.run();
+    }
+
+    // Threads don't exist in the children and sqlite connections must not be shared with them
+    const int num_workers = get_thread_pool().num_workers();
+    get_thread_pool().resize( 0 );
+    stall_watchdog::set_threshold( 0 );
+    world *active_world = g->get_active_world();
+    if( active_world != nullptr ) {
+        active_world->reopen_databases();
+    }
+    std::cout.flush();
+    std::cerr.flush();
+    fflush( nullptr );
+
+    std::vector<pid_t> children;
+    for( int shard = 0; shard < num_shards; shard++ ) {
+        const pid_t pid = fork();
+        if( pid < 0 ) {
+            cata_printf( "Failed to start shard %d: %s\n", shard, strerror( errno ) );
+            break;
+        }
+        if( pid > 0 ) {
+            children.push_back( pid );
+            continue;
+        }
+
+        // Debug messages go to the log of the shard too
+        const std::string log_path = string_format( "%sshard_%d.log", user_dir, shard );
+        const int log = open( log_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644 );
+        if( log >= 0 ) {
+            dup2( log, STDOUT_FILENO );
+            dup2( log, STDERR_FILENO );
+            close( log );
+        }
+        if( active_world != nullptr ) {
+            const std::string shard_world = copy_world_for_shard( *active_world->info, shard );
+            if( shard_world.empty() ) {
+                cata_printf( "Failed to copy the test world for shard %d\n", shard );
+                _exit( 1 );
+            }
+            active_world->info->world_name = shard_world;
+            active_world->reopen_databases();
+        }
+        get_thread_pool().resize( num_workers );
+
+        Catch::ConfigData data = session.configData();
+        data.testsOrTags.clear();
+        for( size_t i = shard; i < tests.size(); i += num_shards ) {
+            if( !data.testsOrTags.empty() ) {
+                data.testsOrTags.emplace_back( "," );
+            }
+            data.testsOrTags.push_back( exact_test_spec( tests[i].name ) );
+        }
+        if( !data.outputFilename.empty() ) {
+            data.outputFilename += string_format( ".shard_%d", shard );
+        }
+        session.useConfigData( data );
+        int result = session.run();
+        if( result == 0 && debug_has_error_been_observed() ) {
+            cata_printf( "\nTreating result as failure due to error logged during tests.\n" );
+            result = 1;
+        }
+        std::cout.flush();
+        std::cerr.flush();
+        fflush( nullptr );
+        // Skips the destructors of the global state, it belongs to the parent
+        _exit( result );
+    }
+
+    int failures = children.size() < static_cast<size_t>( num_shards ) ? 1 : 0;
+    for( size_t shard = 0; shard < children.size(); shard++ ) {
+        int status = 0;
+        while( waitpid( children[shard], &status, 0 ) < 0 && errno == EINTR ) {
+        }
+        const std::string log_path = string_format( "%sshard_%d.log", user_dir, shard );
+        cata_printf( "\n=== Shard %d of %d ===\n%s", static_cast<int>( shard ), num_shards,
+                     read_entire_file( log_path ) );
+        const bool passed = WIFEXITED( status ) && WEXITSTATUS( status ) == 0;
+        if( active_world != nullptr ) {
+            const std::string shard_world = string_format( "%s_shard_%d",
+                                            active_world->info->world_name, shard );
+            if( passed ) {
+                remove_tree( PATH_INFO::savedir() + shard_world );
+            } else {
+                cata_printf( "Test world \"%s\" of shard %d left for inspection.\n",
+                             shard_world, static_cast<int>( shard ) );
+            }
+        }
+        if( WIFEXITED( status ) ) {
+            failures += WEXITSTATUS( status );
+        } else {
+            cata_printf( "Shard %d was killed by signal %d\n", static_cast<int>( shard ),
+                         WIFSIGNALED( status ) ? WTERMSIG( status ) : 0 );
+            failures++;
+        }
+    }
+    get_thread_pool().resize( num_workers );
+    return std::min( failures, 255 );
+}
+#endif
+
 struct CataListener : Catch::TestEventListenerBase {
     using TestEventListenerBase::TestEventListenerBase;
 
@@ -284,6 +443,15 @@ int main( int argc, const char *argv[] )
 
     std::string user_dir = extract_user_dir( arg_vec );
 
+    const std::string shards_string = extract_argument( arg_vec, "--shards=" );
+    const int shards = shards_string.empty() ? 1 : std::atoi( shards_string.c_str() );
+#if defined(_WIN32)
+    if( shards > 1 ) {
+        printf( "--shards is not supported on Windows" );
+        return EXIT_FAILURE;
+    }
+#endif
+
     std::string error_fmt = extract_argument( arg_vec, "--error-format=" );
     if( error_fmt == "github-action" ) {
         error_log_format = error_log_format_t::github_action;
@@ -305,6 +473,8 @@ int main( int argc, const char *argv[] )
         cata_printf( "  -D, --drop-world             Don't save the world on test failure.\n" );
         cata_printf( "  --option_overrides=n:v[,…]   Name-value pairs of game options for tests.\n" );
         cata_printf( "                               (overrides config/options.json values)\n" );
+        cata_printf( "  --shards=<n>                 Run the tests in n processes forked after loading.\n" );
+        cata_printf( "                               Not available on Windows.\n" );
         cata_printf( "  --error-format=<value>       Format of error messages.  Possible values are:\n" );
         cata_printf( "                                   human-readable (default)\n" );
         cata_printf( "                                   github-action\n" );
@@ -346,7 +516,14 @@ int main( int argc, const char *argv[] )
     // Leading newline in case there were debug messages during
     // initialization.
     cata_printf( "\nStarting the actual test at %s", std::ctime( &start_time ) );
+#if !defined(_WIN32)
+    const Catch::ConfigData &catch_data = session.configData();
+    const bool listing = catch_data.listTests || catch_data.listTags || catch_data.listReporters ||
+                         catch_data.listTestNamesOnly;
+    result = shards > 1 && !listing ? run_sharded( session, shards, user_dir ) : session.run();
+#else
     result = session.run();
+#endif
     const auto end = std::chrono::system_clock::now();
     std::time_t end_time = std::chrono::system_clock::to_time_t( end );
 
@@ -0,0 +1,54 @@
+#include "catch/catch.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "thread_pool.h"
+
+TEST_CASE( "thread_pool_visits_every_index_once", "[thread_pool]" )
+{
+    const int num_workers = GENERATE( 0, 1, 3 );
+    CAPTURE( num_workers );
+    thread_pool pool( num_workers );
+    CHECK( pool.num_workers() == num_workers );
+
+    std::vector<std::atomic<int>> visits( 100 );
+    for( int batch = 0; batch < 5; ++batch ) {
+        pool.parallel_for( 0, 100, [&]( int i ) {
+            visits[i]++;
+        } );
+    }
+    for( const std::atomic<int> &v : visits ) {
+        CHECK( v == 5 );
+    }
+}
+
+TEST_CASE( "thread_pool_nested_batches_run_serially", "[thread_pool]" )
+{
+    thread_pool pool( 2 );
+    std::atomic<int> total{ 0 };
+    pool.parallel_for( 0, 4, [&]( int ) {
+        pool.parallel_for( 0, 4, [&]( int ) {
+            total++;
+        } );
+    } );
+    CHECK( total == 16 );
+}
+
+TEST_CASE( "thread_pool_rethrows_job_exceptions", "[thread_pool]" )
+{
+    thread_pool pool( 2 );
+    CHECK_THROWS_AS( pool.parallel_for( 0, 10, []( int i ) {
+        if( i == 7 ) {
+            throw std::runtime_error( "job failed" );
+        }
+    } ), std::runtime_error );
+
+    // The pool is still usable afterwards
+    std::atomic<int> total{ 0 };
+    pool.parallel_for( 0, 10, [&]( int ) {
+        total++;
+    } );
+    CHECK( total == 10 );
+}
@@ -100,6 +100,22 @@ TEST_CASE( "translations_add_context", "[translations][i18n]" )
     }
 }
 
+TEST_CASE( "translations_plural_forms_are_cached_separately", "[translations][i18n]" )
+{
+    const translation rock = translation::pl_translation( "rock", "rocks" );
+    const translation ctxt_rock = translation::pl_translation( "stone", "rock", "rocks" );
+    for( int i = 0; i < 2; i++ ) {
+        CHECK( rock.translated( 1 ) == "rock" );
+        CHECK( rock.translated( 2 ) == "rocks" );
+        CHECK( rock.translated( 5 ) == "rocks" );
+        CHECK( ctxt_rock.translated() == "rock" );
+        CHECK( ctxt_rock.translated( 3 ) == "rocks" );
+    }
+    invalidate_translations();
+    CHECK( rock.translated( 2 ) == "rocks" );
+    CHECK( rock.translated_eq( translation::to_translation( "rock" ) ) );
+}
+
 // assuming [en] language is used for this test
 // requires .mo file for "en" language
 TEST_CASE( "translations_macro_char_address_translated", "[.][translations][i18n]" )
@@ -0,0 +1,166 @@
+#include "catch/catch.hpp"
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "avatar.h"
+#include "calendar.h"
+#include "fstream_utils.h"
+#include "game.h"
+#include "json.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "map_iterator.h"
+#include "player_helpers.h"
+#include "point.h"
+#include "state_helpers.h"
+#include "turn_profiler.h"
+#include "type_id.h"
+#include "vehicle.h"
+
+// Reproducible turn time baselines for typical heavy scenes.  Hidden from normal runs,
+// start with `cata_test [turn_benchmark]`.  Results are written to turn_benchmark.json.
+
+namespace
+{
+
+struct bench_scenario {
+    std::string name;
+    std::function<void( const tripoint & )> setup;
+};
+
+constexpr int benchmark_turns = 100;
+
+// The simulation part of game::do_turn, without the player's input handling
+void simulate_turn()
+{
+    using turn_profiler::phase;
+    using turn_profiler::scoped_phase;
+    map &here = get_map();
+
+    calendar::turn += 1_turns;
+    get_avatar().moves = 0;
+    {
+        scoped_phase profile( phase::vehmove );
+        here.vehmove();
+    }
+    {
+        scoped_phase profile( phase::process_fields );
+        here.process_fields();
+    }
+    {
+        scoped_phase profile( phase::process_items );
+        here.process_items();
+    }
+    {
+        scoped_phase profile( phase::build_map_cache );
+        here.build_map_cache( g->get_levz(), true );
+    }
+    g->monmove();
+    turn_profiler::end_turn( to_turns<int>( calendar::turn - calendar::turn_zero ) );
+}
+
+void horde_siege( const tripoint &center )
+{
+    for( int i = 0; i < 100; ++i ) {
+        const point offset( -20 + i % 40, i < 50 ? -15 : 15 );
+        spawn_test_monster( "mon_zombie", center + offset );
+    }
+}
+
+void city_fire( const tripoint &center )
+{
+    map &here = get_map();
+    static const field_type_str_id fd_fire( "fd_fire" );
+    for( const tripoint &p : here.points_in_radius( center, 12 ) ) {
+        if( p != center && ( p.x + p.y ) % 3 == 0 ) {
+            here.add_field( p, fd_fire, 3 );
+        }
+    }
+}
+
+void vehicle_convoy( const tripoint &center )
+{
+    map &here = get_map();
+    for( int i = 0; i < 10; ++i ) {
+        const tripoint pos = center + point( -40, -30 + i * 6 );
+        vehicle *veh = here.add_vehicle( vproto_id( "car" ), pos, 0_degrees, 100, 0, false );
+        REQUIRE( veh != nullptr );
+        veh->tags.insert( "IN_CONTROL_OVERRIDE" );
+        veh->engine_on = true;
+        veh->cruise_on = true;
+        veh->cruise_velocity = 500;
+        veh->velocity = 500;
+    }
+}
+
+void npc_camp( const tripoint &center )
+{
+    for( int i = 0; i < 30; ++i ) {
+        const point offset( -10 + 2 * ( i % 10 ), 4 + 2 * ( i / 10 ) );
+        spawn_npc( center.xy() + offset, "test_talker" );
+    }
+}
+
+} // namespace
+
+TEST_CASE( "turn_benchmark", "[turn_benchmark][benchmark][.]" )
+{
+    const std::vector<bench_scenario> scenarios = {
+        { "horde_siege", horde_siege },
+        { "city_fire", city_fire },
+        { "vehicle_convoy", vehicle_convoy },
+        { "npc_camp", npc_camp },
+    };
+
+    cata_ofstream out;
+    out.open( "turn_benchmark.json" );
+    REQUIRE( out.is_open() );
+    JsonOut jsout( *out, true );
+    jsout.start_object();
+    jsout.member( "turns", benchmark_turns );
+    jsout.member( "scenarios" );
+    jsout.start_array();
+
+    for( const bench_scenario &sc : scenarios ) {
+        clear_all_state();
+        clear_map();
+        const tripoint center = get_avatar().pos();
+        sc.setup( center );
+
+        turn_profiler::set_enabled( true );
+        const auto start = std::chrono::steady_clock::now();
+        for( int turn = 0; turn < benchmark_turns; ++turn ) {
+            simulate_turn();
+        }
+        const std::chrono::duration<double, std::milli> elapsed =
+            std::chrono::steady_clock::now() - start;
+        int turns = 0;
+        const turn_profiler::turn_stats totals = turn_profiler::recent_totals( turns );
+        turn_profiler::set_enabled( false );
+        CHECK( turns == benchmark_turns );
+
+        jsout.start_object();
+        jsout.member( "name", sc.name );
+        jsout.member( "total_ms", elapsed.count() );
+        jsout.member( "phases" );
+        jsout.start_object();
+        for( size_t i = 0; i < turn_profiler::num_phases; ++i ) {
+            jsout.member( turn_profiler::phase_name( static_cast<turn_profiler::phase>( i ) ) );
+            jsout.start_object();
+            const std::chrono::duration<double, std::milli> ms = totals[i].time;
+            jsout.member( "ms", ms.count() );
+            jsout.member( "calls", totals[i].calls );
+            jsout.end_object();
+        }
+        jsout.end_object();
+        jsout.end_object();
+    }
+
+    jsout.end_array();
+    jsout.end_object();
+    clear_all_state();
+}
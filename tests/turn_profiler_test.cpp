@@ -0,0 +1,59 @@
+#include "catch/catch.hpp"
+
+#include "turn_profiler.h"
+
+TEST_CASE( "turn_profiler_aggregates_phases_per_turn", "[turn_profiler]" )
+{
+    using turn_profiler::phase;
+
+    turn_profiler::set_enabled( true );
+    for( int turn = 0; turn < turn_profiler::history_size + 10; ++turn ) {
+        for( int i = 0; i < 3; ++i ) {
+            turn_profiler::scoped_phase profile( phase::monmove );
+        }
+        {
+            turn_profiler::scoped_phase profile( phase::draw );
+            profile.stop();
+            // Stopping twice records nothing more
+            profile.stop();
+        }
+        turn_profiler::end_turn( turn );
+    }
+
+    int turns = 0;
+    turn_profiler::turn_stats totals = turn_profiler::recent_totals( turns );
+    CHECK( turns == turn_profiler::history_size );
+    CHECK( totals[static_cast<size_t>( phase::monmove )].calls == 3 * turns );
+    CHECK( totals[static_cast<size_t>( phase::draw )].calls == turns );
+    CHECK( totals[static_cast<size_t>( phase::vehmove )].calls == 0 );
+
+    turn_profiler::set_enabled( false );
+    {
+        turn_profiler::scoped_phase profile( phase::monmove );
+    }
+    turn_profiler::end_turn( 0 );
+    totals = turn_profiler::recent_totals( turns );
+    CHECK( turns == 0 );
+    CHECK( totals[static_cast<size_t>( phase::monmove )].calls == 0 );
+}
+
+TEST_CASE( "turn_profiler_tracks_innermost_phase", "[turn_profiler]" )
+{
+    using turn_profiler::phase;
+
+    // Tracked even when the profiler is off, the stall watchdog relies on it
+    turn_profiler::set_enabled( false );
+    CHECK( turn_profiler::current_phase() == phase::num_phases );
+    {
+        turn_profiler::scoped_phase outer( phase::monmove );
+        CHECK( turn_profiler::current_phase() == phase::monmove );
+        {
+            turn_profiler::scoped_phase inner( phase::monster_plan );
+            CHECK( turn_profiler::current_phase() == phase::monster_plan );
+        }
+        CHECK( turn_profiler::current_phase() == phase::monmove );
+        outer.stop();
+        CHECK( turn_profiler::current_phase() == phase::num_phases );
+    }
+    CHECK( turn_profiler::current_phase() == phase::num_phases );
+}
@@ -0,0 +1,12 @@
+#include "catch/catch.hpp"
+
+#include <chrono>
+
+#include "ui_manager.h"
+
+TEST_CASE( "present_if_due_coalesces_presents", "[ui_manager]" )
+{
+    CHECK( ui_manager::present_if_due( std::chrono::milliseconds( 0 ) ) );
+    CHECK_FALSE( ui_manager::present_if_due( std::chrono::hours( 1 ) ) );
+    CHECK( ui_manager::present_if_due( std::chrono::milliseconds( 0 ) ) );
+}
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <optional>
+#include <string>
 #include <vector>
 
 #include "avatar.h"
@@ -17,6 +18,7 @@
 #include "vehicle.h"
 #include "vehicle_part.h"
 #include "vpart_position.h"
+#include "vpart_range.h"
 #include "veh_type.h"
 
 TEST_CASE( "detaching_vehicle_unboards_passengers" )
@@ -201,3 +203,112 @@ TEST_CASE( "vehicle_rotation_reverse" )
         }
     }
 }
+
+static std::vector<int> part_indices( const vehicle_part_with_feature_range<std::string> &range )
+{
+    std::vector<int> found;
+    for( const vpart_reference &vp : range ) {
+        found.push_back( static_cast<int>( vp.part_index() ) );
+    }
+    return found;
+}
+
+TEST_CASE( "vehicle_feature_queries_follow_part_changes" )
+{
+    clear_all_state();
+    const tripoint vehicle_origin( 60, 60, 0 );
+    vehicle *veh_ptr = get_map().add_vehicle( vproto_id( "car" ), vehicle_origin, 0_degrees, 0, 0 );
+    REQUIRE( veh_ptr != nullptr );
+    vehicle &veh = *veh_ptr;
+
+    const auto brute_force = [&veh]( const std::string & flag ) {
+        std::vector<int> found;
+        for( int i = 0; i < veh.part_count(); i++ ) {
+            const vehicle_part &vp = veh.cpart( i );
+            if( !vp.removed && vp.info().has_flag( flag ) ) {
+                found.push_back( i );
+            }
+        }
+        return found;
+    };
+    for( const std::string flag : {
+             "CARGO", "SEAT", "ENGINE", "WHEEL", "NOT_A_FLAG"
+         } ) {
+        CAPTURE( flag );
+        CHECK( part_indices( veh.get_any_parts( flag ) ) == brute_force( flag ) );
+    }
+    const std::vector<int> cargo = part_indices( veh.get_any_parts( "CARGO" ) );
+    REQUIRE( !cargo.empty() );
+    size_t cargo_by_bitflag = 0;
+    for( const vpart_reference &vp : veh.get_any_parts( VPFLAG_CARGO ) ) {
+        CHECK( vp.info().has_flag( "CARGO" ) );
+        cargo_by_bitflag++;
+    }
+    CHECK( cargo_by_bitflag == cargo.size() );
+
+    SECTION( "parts installed while refresh is suspended are found" ) {
+        veh.suspend_refresh();
+        const int added = veh.install_part( point_zero, vpart_id( "trunk" ), true );
+        REQUIRE( added >= 0 );
+        CHECK( part_indices( veh.get_any_parts( "CARGO" ) ).back() == added );
+        veh.enable_refresh();
+        CHECK( part_indices( veh.get_any_parts( "CARGO" ) ) == brute_force( "CARGO" ) );
+    }
+    SECTION( "removed parts are not found" ) {
+        veh.remove_part( cargo.front() );
+        veh.part_removal_cleanup();
+        CHECK( part_indices( veh.get_any_parts( "CARGO" ) ) == brute_force( "CARGO" ) );
+        CHECK( part_indices( veh.get_any_parts( "CARGO" ) ).size() == cargo.size() - 1 );
+    }
+}
+
+TEST_CASE( "vehicle_center_of_mass_follows_rotation" )
+{
+    clear_all_state();
+    vehicle *veh_ptr = get_map().add_vehicle( vproto_id( "car" ), tripoint( 60, 60, 0 ), 0_degrees,
+                       0, 0 );
+    REQUIRE( veh_ptr != nullptr );
+    vehicle &veh = *veh_ptr;
+    // Placement may have used another pivot, start from the one used below
+    veh.precalc_mounts( 0, 0_degrees, veh.pivot_point() );
+    const point before = veh.rotated_center_of_mass();
+
+    veh.precalc_mounts( 0, 90_degrees, veh.pivot_point() );
+    const point turned = veh.rotated_center_of_mass();
+    // Recalculating from scratch gives the same point as the remembered one
+    veh.invalidate_mass();
+    CHECK( veh.rotated_center_of_mass() == turned );
+
+    veh.precalc_mounts( 0, 0_degrees, veh.pivot_point() );
+    CHECK( veh.rotated_center_of_mass() == before );
+}
+
+TEST_CASE( "parked_vehicles_hibernate_until_something_runs" )
+{
+    clear_all_state();
+    vehicle *veh_ptr = get_map().add_vehicle( vproto_id( "car" ), tripoint( 60, 60, 0 ), 0_degrees,
+                       0, 0 );
+    REQUIRE( veh_ptr != nullptr );
+    vehicle &veh = *veh_ptr;
+    veh.engine_on = false;
+    veh.velocity = 0;
+    for( const vpart_reference &vp : veh.get_all_parts() ) {
+        vp.part().enabled = false;
+    }
+    CHECK( veh.is_hibernating() );
+
+    SECTION( "running engine" ) {
+        veh.engine_on = true;
+        CHECK_FALSE( veh.is_hibernating() );
+    }
+    SECTION( "moving" ) {
+        veh.velocity = 100;
+        CHECK_FALSE( veh.is_hibernating() );
+    }
+    SECTION( "enabled power consumer" ) {
+        auto consumers = veh.get_avail_parts( VPFLAG_ENABLED_DRAINS_EPOWER );
+        REQUIRE( !empty( consumers ) );
+        consumers.begin()->part().enabled = true;
+        CHECK_FALSE( veh.is_hibernating() );
+    }
+}
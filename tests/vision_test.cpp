@@ -515,6 +515,52 @@ TEST_CASE( "vision_wall_can_be_lit_by_player", "[shadowcasting][vision]" )
     t.test_all();
 }
 
+TEST_CASE( "vision_lightmap_is_recast_when_its_inputs_change", "[shadowcasting][vision]" )
+{
+    clear_all_state();
+    set_time( midnight );
+    map &here = get_map();
+    Character &player_character = get_player_character();
+    const tripoint lamp( 60, 60, 0 );
+    const tripoint target = lamp + point( 3, 0 );
+    player_character.setpos( lamp + point( -40, 0 ) );
+
+    here.build_map_cache( lamp.z );
+    const float dark = here.ambient_light_at( target );
+    // Nothing changed, the last lightmap is kept
+    here.build_map_cache( lamp.z );
+    CHECK( here.ambient_light_at( target ) == Approx( dark ) );
+
+    here.ter_set( lamp, ter_id( "t_utility_light" ) );
+    here.build_map_cache( lamp.z );
+    const float lit = here.ambient_light_at( target );
+    CHECK( lit > dark );
+
+    // Changes the transparency cache, the light source list stays the same
+    for( int dy = -1; dy <= 1; dy++ ) {
+        here.ter_set( lamp + point( 1, dy ), ter_id( "t_brick_wall" ) );
+    }
+    here.build_map_cache( lamp.z );
+    CHECK( here.ambient_light_at( target ) < lit );
+
+    for( int dy = -1; dy <= 1; dy++ ) {
+        here.ter_set( lamp + point( 1, dy ), ter_id( "t_grass" ) );
+    }
+    here.ter_set( lamp, ter_id( "t_grass" ) );
+    here.build_map_cache( lamp.z );
+    CHECK( here.ambient_light_at( target ) == Approx( dark ) );
+
+    // The light moves with the character
+    player_character.worn.push_back( item::spawn( "wearable_light_on" ) );
+    player_character.setpos( target + point( 1, 0 ) );
+    here.build_map_cache( lamp.z );
+    const float carried = here.ambient_light_at( target );
+    CHECK( carried > dark );
+    player_character.setpos( lamp + point( -40, 0 ) );
+    here.build_map_cache( lamp.z );
+    CHECK( here.ambient_light_at( target ) < carried );
+}
+
 TEST_CASE( "vision_crouching_blocks_vision_but_not_light", "[shadowcasting][vision]" )
 {
     clear_all_state();
@@ -19,3 +19,20 @@ TEST_CASE( "visitable_summation" )
 
     CHECK( test_inv.charges_of( itype_id( "water" ), item::INFINITE_CHARGES ) > 1 );
 }
+
+TEST_CASE( "charges_of_benchmark", "[.][visitable][benchmark]" )
+{
+    inventory test_inv;
+    for( int i = 0; i < 50; ++i ) {
+        detached_ptr<item> bottle = item::spawn( "bottle_plastic", calendar::turn );
+        detached_ptr<item> water = item::spawn( "water", calendar::turn );
+        water->charges = bottle->get_remaining_capacity_for_liquid( *water );
+        bottle->put_in( std::move( water ) );
+        test_inv.add_item( *bottle );
+        test_inv.add_item( *item::spawn_temporary( "rag" ) );
+    }
+
+    BENCHMARK( "inventory::charges_of" ) {
+        return test_inv.charges_of( itype_id( "water" ) );
+    };
+}
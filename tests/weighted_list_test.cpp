@@ -0,0 +1,58 @@
+#include "catch/catch.hpp"
+
+#include <climits>
+#include <vector>
+
+#include "weighted_list.h"
+
+// What picking used to do: walk the list until the running sum reaches the picked weight
+static size_t reference_pick( const std::vector<int> &weights, unsigned int randi )
+{
+    int total = 0;
+    for( int w : weights ) {
+        total += w;
+    }
+    const int picked = randi % total + 1;
+    int accumulated = 0;
+    for( size_t i = 0; i < weights.size(); i++ ) {
+        accumulated += weights[i];
+        if( accumulated >= picked ) {
+            return i;
+        }
+    }
+    return weights.size();
+}
+
+TEST_CASE( "weighted_int_list_picks_like_a_linear_scan", "[weighted_list]" )
+{
+    const std::vector<int> weights = { 3, 0, 1, 5, 0, 2 };
+    weighted_int_list<int> list;
+    for( size_t i = 0; i < weights.size(); i++ ) {
+        list.add( static_cast<int>( i ), weights[i] );
+    }
+    for( unsigned int randi = 0; randi < 100; randi++ ) {
+        CAPTURE( randi );
+        CHECK( *list.pick( randi ) == static_cast<int>( reference_pick( weights, randi ) ) );
+    }
+
+    SECTION( "after replacing a weight" ) {
+        list.add_or_replace( 1, 4 );
+        std::vector<int> changed = weights;
+        changed[1] = 4;
+        for( unsigned int randi = 0; randi < 100; randi++ ) {
+            CAPTURE( randi );
+            CHECK( *list.pick( randi ) == static_cast<int>( reference_pick( changed, randi ) ) );
+        }
+    }
+}
+
+TEST_CASE( "weighted_float_list_never_picks_past_the_end", "[weighted_list]" )
+{
+    weighted_float_list<int> list;
+    list.add( 0, 0.1 );
+    list.add( 1, 0.2 );
+    list.add( 2, 0.0 );
+    CHECK( *list.pick( 0 ) == 0 );
+    CHECK( *list.pick( UINT_MAX ) == 1 );
+    CHECK( *list.pick( UINT_MAX / 2 ) == 1 );
+}